@@ -0,0 +1,183 @@
+// Benchmark the bit reversal & inverted byte pair helpers, per frame.
+// Copyright 2026 David Conran
+//
+// Compares the byteswap/SWAR based reverseBits(), reverseBitsInBytes(),
+// invertBytePairs() & checkInvertedBytePairs() against the bit/byte at a time
+// loops they replaced. (A copy of which is kept below, in the `legacy`
+// namespace.) Each is timed over a whole 152-bit (Mitsubishi Heavy 152) &
+// 424-bit (Hitachi 424) frame. i.e.
+//   reverse bytes: Reverse the bit order of every byte of the frame.
+//   reverse words: Reverse the frame as up to 64-bit integers.
+//   invert pairs:  Make every second byte the inverse of the one before it.
+//   check pairs:   Check every second byte is the inverse of the one before.
+// It fails if the old & new versions ever disagree.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./bitorder_bench --json > before.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRremoteESP8266.h"
+#include "IRutils.h"
+
+namespace legacy {
+uint64_t reverseBits(uint64_t input, uint16_t nbits) {
+  if (nbits <= 1) return input;  // Reversing <= 1 bits makes no change at all.
+  // Cap the nr. of bits to rotate to the max nr. of bits in the input.
+  nbits = std::min(nbits, static_cast<uint16_t>((sizeof(input) * 8)));
+  uint64_t output = 0;
+  for (uint16_t i = 0; i < nbits; i++) {
+    output <<= 1;
+    output |= (input & 1);
+    input >>= 1;
+  }
+  // Merge any remaining unreversed bits back to the top of the reversed bits.
+  return (input << nbits) | output;
+}
+
+uint8_t * reverseBitsInBytes(uint8_t * const ptr, const uint16_t length) {
+  for (uint16_t i = 0; i < length; i++) ptr[i] = reverseBits(ptr[i], 8);
+  return ptr;
+}
+
+uint8_t * invertBytePairs(uint8_t *ptr, const uint16_t length) {
+  for (uint16_t i = 1; i < length; i += 2) {
+    // Code done this way to avoid a compiler warning bug.
+    uint8_t inv = ~*(ptr + i - 1);
+    *(ptr + i) = inv;
+  }
+  return ptr;
+}
+
+bool checkInvertedBytePairs(const uint8_t * const ptr,
+                            const uint16_t length) {
+  for (uint16_t i = 1; i < length; i += 2) {
+    // Code done this way to avoid a compiler warning bug.
+    uint8_t inv = ~*(ptr + i - 1);
+    if (*(ptr + i) != inv) return false;
+  }
+  return true;
+}
+}  // namespace legacy
+
+// Reverse a frame as a series of (up to) 64-bit integers, & summarise the
+// results in `sum`, so they can be compared. An empty NAMESPACE is the current
+// (global) reverseBits().
+#define REVERSE_WORDS(NAMESPACE) do {\
+    sum = 0;\
+    for (uint16_t bit = 0; bit < nbits; bit += 64) {\
+      const uint16_t bits = std::min(nbits - bit, 64);\
+      uint64_t word = 0;\
+      memcpy(&word, frame + bit / 8, bits / 8);\
+      sum ^= NAMESPACE::reverseBits(word, bits) + bit;\
+    }\
+  } while (0)
+
+// The sizes of the frames to benchmark.
+const uint16_t kFrameBits[] = {kMitsubishiHeavy152Bits, kHitachiAc424Bits};
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint64_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// Run the old & new versions of one operation over a frame, & time each.
+// Returns false if they disagree.
+#define BENCH_OP(NAME, LEGACY, CURRENT) do {\
+    uint64_t sum;\
+    memcpy(frame, original, nbytes);\
+    LEGACY;\
+    const uint64_t legacy_sum = sum;\
+    uint8_t legacy_frame[kHitachiAc424StateLength];\
+    memcpy(legacy_frame, frame, nbytes);\
+    memcpy(frame, original, nbytes);\
+    CURRENT;\
+    if (sum != legacy_sum || memcmp(frame, legacy_frame, nbytes)) {\
+      std::cerr << NAME << " disagrees for " << nbits << " bits" << std::endl;\
+      return false;\
+    }\
+    std::chrono::steady_clock::time_point start =\
+        std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++) {\
+      LEGACY;\
+      sink += sum;\
+    }\
+    const double legacy_ns = nsSince(start) / iterations;\
+    start = std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++) {\
+      CURRENT;\
+      sink += sum;\
+    }\
+    const double new_ns = nsSince(start) / iterations;\
+    if (json)\
+      printf("%s\n  {\"operation\": \"%s\", \"bits\": %u, "\
+             "\"legacy_ns\": %.1f, \"new_ns\": %.1f}", first ? "" : ",",\
+             NAME, nbits, legacy_ns, new_ns);\
+    else\
+      printf("%-14s %6u %10.1f %10.1f\n", NAME, nbits, legacy_ns, new_ns);\
+    first = false;\
+  } while (0)
+
+bool benchmark(const uint32_t iterations, const bool json) {
+  bool first = true;
+  uint8_t original[kHitachiAc424StateLength];
+  uint8_t frame[kHitachiAc424StateLength];
+  srand(42);
+  for (uint16_t i = 0; i < sizeof(original); i++) original[i] = rand();
+  if (json)
+    printf("{\"iterations\": %u, \"operations\": [", iterations);
+  else
+    printf("Iterations: %u (ns per frame)\n%-14s %6s %10s %10s\n", iterations,
+           "Operation", "Bits", "Legacy", "New");
+  for (uint8_t f = 0; f < sizeof(kFrameBits) / sizeof(kFrameBits[0]); f++) {
+    const uint16_t nbits = kFrameBits[f];
+    const uint16_t nbytes = nbits / 8;
+    BENCH_OP("reverse bytes",
+             sum = legacy::reverseBitsInBytes(frame, nbytes)[nbytes - 1],
+             sum = irutils::reverseBitsInBytes(frame, nbytes)[nbytes - 1]);
+    BENCH_OP("reverse words", REVERSE_WORDS(legacy), REVERSE_WORDS());
+    BENCH_OP("invert pairs",
+             sum = legacy::invertBytePairs(frame, nbytes)[nbytes - 1],
+             sum = irutils::invertBytePairs(frame, nbytes)[nbytes - 1]);
+    // A frame that passes the check, so every pair needs to be checked.
+    legacy::invertBytePairs(original, nbytes);
+    BENCH_OP("check pairs",
+             sum = legacy::checkInvertedBytePairs(frame, nbytes),
+             sum = irutils::checkInvertedBytePairs(frame, nbytes));
+  }
+  if (json) printf("\n]}\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+  return benchmark(iterations, json) ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+// Benchmark the checksum helpers the protocols use.
+// Copyright 2026 David Conran
+//
+// Compares the word at a time (SWAR) sumBytes(), xorBytes(), sumNibbles(),
+// sumLowNibbles(), sumHighNibbles() & countBits() against the byte/bit at a
+// time loops they replaced. (A copy of which is kept below, in the `legacy`
+// namespace.) Each is run over messages the size of common A/C states, at
+// every alignment. It fails if they ever disagree.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./checksum_bench --json > before.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRremoteESP8266.h"
+#include "IRutils.h"
+
+namespace legacy {
+uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
+                 const uint8_t init = 0) {
+  uint8_t checksum = init;
+  const uint8_t *ptr;
+  for (ptr = start; ptr - start < length; ptr++) checksum += *ptr;
+  return checksum;
+}
+
+uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
+                 const uint8_t init = 0) {
+  uint8_t checksum = init;
+  const uint8_t *ptr;
+  for (ptr = start; ptr - start < length; ptr++) checksum ^= *ptr;
+  return checksum;
+}
+
+uint16_t countBits(const uint8_t * const start, const uint16_t length,
+                   const bool ones = true, const uint16_t init = 0) {
+  uint16_t count = init;
+  for (uint16_t offset = 0; offset < length; offset++)
+    for (uint8_t currentbyte = *(start + offset);
+         currentbyte;
+         currentbyte >>= 1)
+      if (currentbyte & 1) count++;
+  if (ones || length == 0)
+    return count;
+  else
+    return (length * 8) - count;
+}
+
+uint8_t sumNibbles(const uint8_t * const start, const uint16_t length,
+                   const uint8_t init = 0) {
+  uint8_t sum = init;
+  const uint8_t *ptr;
+  for (ptr = start; ptr - start < length; ptr++)
+    sum += (*ptr >> 4) + (*ptr & 0xF);
+  return sum;
+}
+
+uint8_t sumLowNibbles(const uint8_t * const start, const uint16_t length,
+                      const uint8_t init = 0) {
+  uint8_t sum = init;
+  for (uint16_t i = 0; i < length; i++) sum += start[i] & 0xF;
+  return sum;
+}
+
+uint8_t sumHighNibbles(const uint8_t * const start, const uint16_t length,
+                       const uint8_t init = 0) {
+  uint8_t sum = init;
+  for (uint16_t i = 0; i < length; i++) sum += start[i] >> 4;
+  return sum;
+}
+}  // namespace legacy
+
+using irutils::sumHighNibbles;
+using irutils::sumLowNibbles;
+using irutils::sumNibbles;
+
+// Typical message sizes. i.e. Toshiba, York, Daikin2, Daikin216,
+// Daikin, Hitachi & Hitachi424 sized A/C states.
+const uint16_t kLengths[] = {kToshibaACStateLength, kYorkStateLength,
+                             kDaikin2StateLength, kDaikin216StateLength,
+                             kDaikinStateLength, kHitachiAcStateLength,
+                             kHitachiAc424StateLength};
+
+// Data to checksum. Enough for the largest length at any alignment.
+uint8_t data[64];
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// Run both implementations of one checksum over a length of data, at every
+// alignment, & time each. Returns false if they ever disagree.
+#define BENCH_CHECKSUM(NAME, CALL) do {\
+    for (uint8_t align = 0; align < 8; align++) {\
+      const uint8_t *ptr = data + align;\
+      if (legacy::CALL != CALL) {\
+        std::cerr << NAME << " disagrees for " << length << " bytes at +"\
+                  << (uint16_t)align << std::endl;\
+        return false;\
+      }\
+    }\
+    std::chrono::steady_clock::time_point start =\
+        std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++) {\
+      const uint8_t *ptr = data + (n & 7);\
+      sink += legacy::CALL;\
+    }\
+    const double legacy_ns = nsSince(start) / iterations;\
+    start = std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++) {\
+      const uint8_t *ptr = data + (n & 7);\
+      sink += CALL;\
+    }\
+    const double word_ns = nsSince(start) / iterations;\
+    if (json)\
+      printf("%s\n  {\"checksum\": \"%s\", \"length\": %u, "\
+             "\"legacy_ns\": %.1f, \"word_ns\": %.1f}", first ? "" : ",",\
+             NAME, length, legacy_ns, word_ns);\
+    else\
+      printf("%-16s %6u %10.1f %10.1f\n", NAME, length, legacy_ns, word_ns);\
+    first = false;\
+  } while (0)
+
+bool benchmark(const uint32_t iterations, const bool json) {
+  bool first = true;
+  if (json)
+    printf("{\"iterations\": %u, \"checksums\": [", iterations);
+  else
+    printf("Iterations: %u (ns per call)\n%-16s %6s %10s %10s\n", iterations,
+           "Checksum", "Length", "Legacy", "Word");
+  for (uint8_t i = 0; i < sizeof(kLengths) / sizeof(kLengths[0]); i++) {
+    const uint16_t length = kLengths[i];
+    BENCH_CHECKSUM("sumBytes", sumBytes(ptr, length));
+    BENCH_CHECKSUM("xorBytes", xorBytes(ptr, length));
+    BENCH_CHECKSUM("countBits", countBits(ptr, length));
+    BENCH_CHECKSUM("sumNibbles", sumNibbles(ptr, length));
+    BENCH_CHECKSUM("sumLowNibbles", sumLowNibbles(ptr, length));
+    BENCH_CHECKSUM("sumHighNibbles", sumHighNibbles(ptr, length));
+  }
+  if (json) printf("\n]}\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+  srand(42);
+  for (uint8_t i = 0; i < sizeof(data); i++) data[i] = rand();
+  return benchmark(iterations, json) ? 0 : 1;
+}
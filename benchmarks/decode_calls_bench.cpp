@@ -0,0 +1,195 @@
+// Copyright 2026 David Conran
+// Benchmark how many decoders IRrecv::decode() calls per capture.
+//
+// For every protocol we can send, it sends a message with IRsendTest, then
+// decodes it twice. Once like the original chain of decoders did, i.e. trying
+// every decoder in table order until one succeeds, & once with the header mark
+// buckets & the other screens that decode() normally uses. For each, it
+// reports the nr. of decoders called, the nr. of decoder table entries looked
+// at, & the time per decode() in nano-Seconds.
+// Messages that don't decode as the protocol sent (e.g. ones with a bad
+// checksum) are still measured, as decode() has to get through them too.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./decode_calls_bench --json > after.json
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// How one way of decoding a capture did.
+typedef struct {
+  uint16_t calls;      // Nr. of decoders called.
+  uint16_t looked_at;  // Nr. of decoder table entries looked at.
+  double decode_ns;    // Time per decode().
+} decode_cost_t;
+
+// The results for one protocol.
+typedef struct {
+  decode_type_t type;   // The protocol that was sent.
+  uint16_t nbits;       // The size of the message sent.
+  bool decoded;         // Was it decoded as the protocol that was sent?
+  decode_cost_t chain;  // Trying every decoder in turn.
+  decode_cost_t screened;  // With the header buckets & screens.
+} bench_result_t;
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// Send an arbitrary, but varied, message for a protocol.
+// Returns the nr. of bits sent, or 0 if we can't send it.
+uint16_t sendSample(IRsendTest *irsend, const decode_type_t type) {
+  const uint16_t nbits = IRsend::defaultBits(type);
+  if (!nbits) return 0;
+  irsend->reset();
+  if (hasACState(type)) {
+    uint8_t state[kStateSizeMax];
+    for (uint16_t i = 0; i < kStateSizeMax; i++) state[i] = 0xA5 ^ (i * 0x1D);
+    if (!irsend->send(type, state, nbits / 8)) return 0;
+  } else {
+    uint64_t value = 0xA5A5A5A5A5A5A5A5ULL;
+    if (nbits < 64) value &= (1ULL << nbits) - 1;
+    if (!irsend->send(type, value, nbits)) return 0;
+  }
+  return nbits;
+}
+
+// Measure decoding a capture, with or without the screening.
+decode_cost_t measure(IRrecv *irrecv, const std::vector<uint16_t> &capture,
+                      const bool screen, const uint32_t iterations,
+                      decode_results *results) {
+  decode_cost_t cost;
+  std::vector<uint16_t> rawbuf(capture);
+  irrecv->_screenDecoders = screen;
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++) {
+    results->rawbuf = rawbuf.data();
+    results->rawlen = rawbuf.size();
+    results->overflow = false;
+    sink += irrecv->decode(results);
+  }
+  cost.decode_ns = nsSince(start) / iterations;
+  cost.calls = irrecv->_decodeAttempts;
+  cost.looked_at = irrecv->_decodeCandidates;
+  return cost;
+}
+
+// Benchmark a single protocol. Returns false if it can't be sent.
+bool benchmark(const decode_type_t type, const uint32_t iterations,
+               bench_result_t *result) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  result->type = type;
+  result->nbits = sendSample(&irsend, type);
+  if (!result->nbits) return false;
+  irsend.makeDecodeResult();
+  const std::vector<uint16_t> capture(
+      irsend.capture.rawbuf, irsend.capture.rawbuf + irsend.capture.rawlen);
+  decode_results results;
+  result->chain = measure(&irrecv, capture, false, iterations, &results);
+  result->screened = measure(&irrecv, capture, true, iterations, &results);
+  result->decoded = results.decode_type == type;
+  return true;
+}
+
+void printText(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("Iterations per protocol: %u\n", iterations);
+  printf("(Chain = every decoder in turn. Screened = header buckets etc.)\n");
+  printf("%-26s %5s %3s %11s %11s %11s %11s %11s\n", "Protocol", "Bits",
+         "OK", "Chain calls", "Scr. looked", "Scr. calls", "Chain ns",
+         "Scr. ns");
+  uint32_t chain_calls = 0;
+  uint32_t looked_at = 0;
+  uint32_t calls = 0;
+  double chain_ns = 0;
+  double screened_ns = 0;
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%-26s %5u %3s %11u %11u %11u %11.1f %11.1f\n",
+           typeToString(r.type).c_str(), r.nbits, r.decoded ? "Y" : "N",
+           r.chain.calls, r.screened.looked_at, r.screened.calls,
+           r.chain.decode_ns, r.screened.decode_ns);
+    chain_calls += r.chain.calls;
+    looked_at += r.screened.looked_at;
+    calls += r.screened.calls;
+    chain_ns += r.chain.decode_ns;
+    screened_ns += r.screened.decode_ns;
+  }
+  printf("%-26s %5s %3s %11u %11u %11u %11.1f %11.1f\n", "(Total)", "", "",
+         chain_calls, looked_at, calls, chain_ns, screened_ns);
+  if (results.size())
+    printf("Mean decoder calls per capture: %.1f chained, %.1f screened.\n",
+           static_cast<double>(chain_calls) / results.size(),
+           static_cast<double>(calls) / results.size());
+}
+
+void printJson(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("{\"iterations\": %u, \"decoders\": %u, \"protocols\": [",
+         iterations, IRrecv::_nrDecoders);
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%s\n  {\"protocol\": \"%s\", \"type\": %d, \"bits\": %u, "
+           "\"decoded\": %s, \"chain_calls\": %u, \"chain_ns\": %.1f, "
+           "\"screened_looked_at\": %u, \"screened_calls\": %u, "
+           "\"screened_ns\": %.1f}",
+           i ? "," : "", typeToString(r.type).c_str(), r.type, r.nbits,
+           r.decoded ? "true" : "false", r.chain.calls, r.chain.decode_ns,
+           r.screened.looked_at, r.screened.calls, r.screened.decode_ns);
+  }
+  printf("\n]}\n");
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  std::vector<bench_result_t> results;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    bench_result_t result;
+    if (benchmark((decode_type_t)i, iterations, &result))
+      results.push_back(result);
+  }
+  if (json)
+    printJson(results, iterations);
+  else
+    printText(results, iterations);
+  return 0;
+}
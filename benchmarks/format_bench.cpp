@@ -0,0 +1,210 @@
+// Benchmark the cost of describing an A/C message as text.
+// Copyright 2026 David Conran
+//
+// For every A/C protocol that IRac supports, it makes a valid message with
+// IRac, decodes it, then times IRAcUtils::resultAcToString() writing to:
+//   - a String. (The original API. A heap allocation or more per call.)
+//   - a caller provided, fixed size, buffer via an IRtextWriter.
+//   - a stream (FILE*) via an IRtextWriter.
+// Along with the nano-Seconds per call, it counts the heap allocations made
+// per call, by counting calls to the global `operator new`.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./format_bench --json > before.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <new>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// Nr. of heap allocations made via `operator new` so far.
+static uint64_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  void *ptr = malloc(size ? size : 1);
+  if (ptr == NULL) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+
+// The results for one way of formatting.
+typedef struct {
+  double ns;      // Time per call.
+  double allocs;  // Heap allocations per call.
+} cost_t;
+
+// The results for one protocol.
+typedef struct {
+  decode_type_t type;  // The protocol that was described.
+  uint16_t length;     // The length of the description.
+  cost_t string;       // Costs when writing to a String.
+  cost_t buffer;       // Costs when writing to a fixed buffer.
+  cost_t stream;       // Costs when writing to a stream.
+} bench_result_t;
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// Make a valid A/C message for a protocol with IRac, & decode it.
+// Returns false if we can't.
+bool makeSample(const decode_type_t type, IRsendTest *irsend) {
+  IRrecv irrecv(kGpioUnused);
+  IRac ac(kGpioUnused);
+  stdAc::state_t state = ac.getState();
+  state.protocol = type;
+  state.power = true;
+  state.mode = stdAc::opmode_t::kCool;
+  state.degrees = 24;
+  state.fanspeed = stdAc::fanspeed_t::kHigh;
+  IRpulseBuffer pulses(RAW_BUF);
+  IRsend::renderAllTo(&pulses);
+  const bool sent = ac.sendAc(state, NULL);
+  IRsend::renderAllTo(NULL);
+  irsend->reset();
+  if (!sent || !irsend->play(&pulses)) return false;
+  irsend->makeDecodeResult();
+  return irrecv.decode(&irsend->capture) &&
+      irsend->capture.decode_type == type;
+}
+
+// Benchmark a single protocol. Returns false if it has no description.
+bool benchmark(const decode_type_t type, const uint32_t iterations,
+               FILE *stream, bench_result_t *result) {
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  if (!makeSample(type, &irsend)) return false;
+  const decode_results *results = &irsend.capture;
+  result->type = type;
+  result->length = IRAcUtils::resultAcToString(results).length();
+  if (!result->length) return false;
+
+  uint64_t before = allocations;
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++)
+    sink += IRAcUtils::resultAcToString(results).length();
+  result->string.ns = nsSince(start) / iterations;
+  result->string.allocs = (double)(allocations - before) / iterations;
+
+  char buffer[512];
+  before = allocations;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++) {
+    IRtextWriter out(buffer, sizeof(buffer));
+    IRAcUtils::resultAcToString(&out, results);
+    sink += out.getLength();
+  }
+  result->buffer.ns = nsSince(start) / iterations;
+  result->buffer.allocs = (double)(allocations - before) / iterations;
+
+  before = allocations;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++) {
+    IRtextWriter out(stream);
+    IRAcUtils::resultAcToString(&out, results);
+    sink += out.getLength();
+  }
+  result->stream.ns = nsSince(start) / iterations;
+  result->stream.allocs = (double)(allocations - before) / iterations;
+  return true;
+}
+
+void printText(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("Iterations per protocol: %u\n", iterations);
+  printf("%-26s %4s %10s %7s %10s %7s %10s %7s\n", "Protocol", "Len",
+         "String ns", "allocs", "Buffer ns", "allocs", "Stream ns", "allocs");
+  bench_result_t total;
+  memset(&total, 0, sizeof(total));
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%-26s %4u %10.1f %7.2f %10.1f %7.2f %10.1f %7.2f\n",
+           typeToString(r.type).c_str(), r.length, r.string.ns,
+           r.string.allocs, r.buffer.ns, r.buffer.allocs, r.stream.ns,
+           r.stream.allocs);
+    total.string.ns += r.string.ns;
+    total.string.allocs += r.string.allocs;
+    total.buffer.ns += r.buffer.ns;
+    total.buffer.allocs += r.buffer.allocs;
+    total.stream.ns += r.stream.ns;
+    total.stream.allocs += r.stream.allocs;
+  }
+  printf("%-26s %4s %10.1f %7.2f %10.1f %7.2f %10.1f %7.2f\n", "(Total)", "",
+         total.string.ns, total.string.allocs, total.buffer.ns,
+         total.buffer.allocs, total.stream.ns, total.stream.allocs);
+}
+
+void printJson(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("{\"iterations\": %u, \"protocols\": [", iterations);
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%s\n  {\"protocol\": \"%s\", \"type\": %d, \"length\": %u, "
+           "\"string_ns\": %.1f, \"string_allocs\": %.2f, "
+           "\"buffer_ns\": %.1f, \"buffer_allocs\": %.2f, "
+           "\"stream_ns\": %.1f, \"stream_allocs\": %.2f}",
+           i ? "," : "", typeToString(r.type).c_str(), r.type, r.length,
+           r.string.ns, r.string.allocs, r.buffer.ns, r.buffer.allocs,
+           r.stream.ns, r.stream.allocs);
+  }
+  printf("\n]}\n");
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  FILE *stream = fopen("/dev/null", "w");
+  if (stream == NULL) {
+    std::cerr << "Can't open /dev/null" << std::endl;
+    return 1;
+  }
+  std::vector<bench_result_t> results;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    if (!IRac::isProtocolSupported((decode_type_t)i)) continue;
+    bench_result_t result;
+    if (benchmark((decode_type_t)i, iterations, stream, &result))
+      results.push_back(result);
+  }
+  fclose(stream);
+  if (json)
+    printJson(results, iterations);
+  else
+    printText(results, iterations);
+  return 0;
+}
@@ -0,0 +1,428 @@
+// Benchmark the IRac::strTo*() keyword parsers.
+// Copyright 2026 David Conran
+//
+// Compares the hash table based IRac::strToOpmode(), strToFanspeed(),
+// strToSwingV(), strToSwingH(), strToModel(), strToCommandType() &
+// strToBool() against the chains of string comparisons they replaced.
+// (A copy of which is kept below, in the `legacy` namespace.)
+// Every keyword, in each category, plus some non-keywords, is parsed by both.
+// It fails if they ever disagree.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./keyword_bench --json > before.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include <vector>
+#include "IRac.h"
+#include "IRtext.h"
+#include "IRutils.h"
+
+#define STRCASECMP(LHS, RHS) strcasecmp(LHS, RHS)
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// The if/else chains that IRac::strTo*() used to be.
+namespace legacy {
+stdAc::ac_command_t strToCommandType(const char *str,
+                                     const stdAc::ac_command_t def) {
+  if (!STRCASECMP(str, kControlCommandStr))
+    return stdAc::ac_command_t::kControlCommand;
+  else if (!STRCASECMP(str, kIFeelReportStr) ||
+           !STRCASECMP(str, kIFeelStr))
+    return stdAc::ac_command_t::kSensorTempReport;
+  else if (!STRCASECMP(str, kSetTimerCommandStr) ||
+           !STRCASECMP(str, kTimerStr))
+    return stdAc::ac_command_t::kTimerCommand;
+  else if (!STRCASECMP(str, kConfigCommandStr))
+    return stdAc::ac_command_t::kConfigCommand;
+  else
+    return def;
+}
+
+stdAc::opmode_t strToOpmode(const char *str,
+                            const stdAc::opmode_t def) {
+  if (!STRCASECMP(str, kAutoStr) ||
+      !STRCASECMP(str, kAutomaticStr))
+    return stdAc::opmode_t::kAuto;
+  else if (!STRCASECMP(str, kOffStr) ||
+           !STRCASECMP(str, kStopStr))
+    return stdAc::opmode_t::kOff;
+  else if (!STRCASECMP(str, kCoolStr) ||
+           !STRCASECMP(str, kCoolingStr))
+    return stdAc::opmode_t::kCool;
+  else if (!STRCASECMP(str, kHeatStr) ||
+           !STRCASECMP(str, kHeatingStr))
+    return stdAc::opmode_t::kHeat;
+  else if (!STRCASECMP(str, kDryStr) ||
+           !STRCASECMP(str, kDryingStr) ||
+           !STRCASECMP(str, kDehumidifyStr))
+    return stdAc::opmode_t::kDry;
+  else if (!STRCASECMP(str, kFanStr) ||
+           !STRCASECMP(str, kFanOnlyStr) ||
+           !STRCASECMP(str, kFan_OnlyStr) ||
+           !STRCASECMP(str, kFanOnlyWithSpaceStr) ||
+           !STRCASECMP(str, kFanOnlyNoSpaceStr))
+    return stdAc::opmode_t::kFan;
+  else
+    return def;
+}
+
+stdAc::fanspeed_t strToFanspeed(const char *str,
+                                const stdAc::fanspeed_t def) {
+  if (!STRCASECMP(str, kAutoStr) ||
+      !STRCASECMP(str, kAutomaticStr))
+    return stdAc::fanspeed_t::kAuto;
+  else if (!STRCASECMP(str, kMinStr) ||
+           !STRCASECMP(str, kMinimumStr) ||
+           !STRCASECMP(str, kLowestStr))
+    return stdAc::fanspeed_t::kMin;
+  else if (!STRCASECMP(str, kLowStr) ||
+           !STRCASECMP(str, kLoStr))
+    return stdAc::fanspeed_t::kLow;
+  else if (!STRCASECMP(str, kMedStr) ||
+           !STRCASECMP(str, kMediumStr) ||
+           !STRCASECMP(str, kMidStr))
+    return stdAc::fanspeed_t::kMedium;
+  else if (!STRCASECMP(str, kHighStr) ||
+           !STRCASECMP(str, kHiStr))
+    return stdAc::fanspeed_t::kHigh;
+  else if (!STRCASECMP(str, kMaxStr) ||
+           !STRCASECMP(str, kMaximumStr) ||
+           !STRCASECMP(str, kHighestStr))
+    return stdAc::fanspeed_t::kMax;
+  else if (!STRCASECMP(str, kMedHighStr))
+    return stdAc::fanspeed_t::kMediumHigh;
+  else
+    return def;
+}
+
+stdAc::swingv_t strToSwingV(const char *str,
+                            const stdAc::swingv_t def) {
+  if (!STRCASECMP(str, kAutoStr) ||
+      !STRCASECMP(str, kAutomaticStr) ||
+      !STRCASECMP(str, kOnStr) ||
+      !STRCASECMP(str, kSwingStr))
+    return stdAc::swingv_t::kAuto;
+  else if (!STRCASECMP(str, kOffStr) ||
+           !STRCASECMP(str, kStopStr))
+    return stdAc::swingv_t::kOff;
+  else if (!STRCASECMP(str, kMinStr) ||
+           !STRCASECMP(str, kMinimumStr) ||
+           !STRCASECMP(str, kLowestStr) ||
+           !STRCASECMP(str, kBottomStr) ||
+           !STRCASECMP(str, kDownStr))
+    return stdAc::swingv_t::kLowest;
+  else if (!STRCASECMP(str, kLowStr))
+    return stdAc::swingv_t::kLow;
+  else if (!STRCASECMP(str, kMidStr) ||
+           !STRCASECMP(str, kMiddleStr) ||
+           !STRCASECMP(str, kMedStr) ||
+           !STRCASECMP(str, kMediumStr) ||
+           !STRCASECMP(str, kCentreStr))
+    return stdAc::swingv_t::kMiddle;
+  else if (!STRCASECMP(str, kUpperMiddleStr))
+    return stdAc::swingv_t::kUpperMiddle;
+  else if (!STRCASECMP(str, kHighStr) ||
+           !STRCASECMP(str, kHiStr))
+    return stdAc::swingv_t::kHigh;
+  else if (!STRCASECMP(str, kHighestStr) ||
+           !STRCASECMP(str, kMaxStr) ||
+           !STRCASECMP(str, kMaximumStr) ||
+           !STRCASECMP(str, kTopStr) ||
+           !STRCASECMP(str, kUpStr))
+    return stdAc::swingv_t::kHighest;
+  else
+    return def;
+}
+
+stdAc::swingh_t strToSwingH(const char *str,
+                            const stdAc::swingh_t def) {
+  if (!STRCASECMP(str, kAutoStr) ||
+      !STRCASECMP(str, kAutomaticStr) ||
+      !STRCASECMP(str, kOnStr) || !STRCASECMP(str, kSwingStr))
+    return stdAc::swingh_t::kAuto;
+  else if (!STRCASECMP(str, kOffStr) ||
+           !STRCASECMP(str, kStopStr))
+    return stdAc::swingh_t::kOff;
+  else if (!STRCASECMP(str, kLeftMaxNoSpaceStr) ||              // "LeftMax"
+           !STRCASECMP(str, kLeftMaxStr) ||                     // "Left Max"
+           !STRCASECMP(str, kMaxLeftNoSpaceStr) ||              // "MaxLeft"
+           !STRCASECMP(str, kMaxLeftStr))                       // "Max Left"
+    return stdAc::swingh_t::kLeftMax;
+  else if (!STRCASECMP(str, kLeftStr))
+    return stdAc::swingh_t::kLeft;
+  else if (!STRCASECMP(str, kMidStr) ||
+           !STRCASECMP(str, kMiddleStr) ||
+           !STRCASECMP(str, kMedStr) ||
+           !STRCASECMP(str, kMediumStr) ||
+           !STRCASECMP(str, kCentreStr))
+    return stdAc::swingh_t::kMiddle;
+  else if (!STRCASECMP(str, kRightStr))
+    return stdAc::swingh_t::kRight;
+  else if (!STRCASECMP(str, kRightMaxNoSpaceStr) ||              // "RightMax"
+           !STRCASECMP(str, kRightMaxStr) ||                     // "Right Max"
+           !STRCASECMP(str, kMaxRightNoSpaceStr) ||              // "MaxRight"
+           !STRCASECMP(str, kMaxRightStr))                       // "Max Right"
+    return stdAc::swingh_t::kRightMax;
+  else if (!STRCASECMP(str, kWideStr))
+    return stdAc::swingh_t::kWide;
+  else
+    return def;
+}
+
+int16_t strToModel(const char *str, const int16_t def) {
+  // Gree
+  if (!STRCASECMP(str, kYaw1fStr)) {
+    return gree_ac_remote_model_t::YAW1F;
+  } else if (!STRCASECMP(str, kYbofbStr)) {
+    return gree_ac_remote_model_t::YBOFB;
+  } else if (!STRCASECMP(str, kYx1fsfStr)) {
+    return gree_ac_remote_model_t::YX1FSF;
+  // Haier models
+  } else if (!STRCASECMP(str, kV9014557AStr)) {
+    return haier_ac176_remote_model_t::V9014557_A;
+  } else if (!STRCASECMP(str, kV9014557BStr)) {
+    return haier_ac176_remote_model_t::V9014557_B;
+  // HitachiAc1 models
+  } else if (!STRCASECMP(str, kRlt0541htaaStr)) {
+    return hitachi_ac1_remote_model_t::R_LT0541_HTA_A;
+  } else if (!STRCASECMP(str, kRlt0541htabStr)) {
+    return hitachi_ac1_remote_model_t::R_LT0541_HTA_B;
+  // Fujitsu A/C models
+  } else if (!STRCASECMP(str, kArrah2eStr)) {
+    return fujitsu_ac_remote_model_t::ARRAH2E;
+  } else if (!STRCASECMP(str, kArdb1Str)) {
+    return fujitsu_ac_remote_model_t::ARDB1;
+  } else if (!STRCASECMP(str, kArreb1eStr)) {
+    return fujitsu_ac_remote_model_t::ARREB1E;
+  } else if (!STRCASECMP(str, kArjw2Str)) {
+    return fujitsu_ac_remote_model_t::ARJW2;
+  } else if (!STRCASECMP(str, kArry4Str)) {
+    return fujitsu_ac_remote_model_t::ARRY4;
+  } else if (!STRCASECMP(str, kArrew4eStr)) {
+    return fujitsu_ac_remote_model_t::ARREW4E;
+  // LG A/C models
+  } else if (!STRCASECMP(str, kGe6711ar2853mStr)) {
+    return lg_ac_remote_model_t::GE6711AR2853M;
+  } else if (!STRCASECMP(str, kAkb75215403Str)) {
+    return lg_ac_remote_model_t::AKB75215403;
+  } else if (!STRCASECMP(str, kAkb74955603Str)) {
+    return lg_ac_remote_model_t::AKB74955603;
+  } else if (!STRCASECMP(str, kAkb73757604Str)) {
+    return lg_ac_remote_model_t::AKB73757604;
+  } else if (!STRCASECMP(str, kLg6711a20083vStr)) {
+    return lg_ac_remote_model_t::LG6711A20083V;
+  // Panasonic A/C families
+  } else if (!STRCASECMP(str, kLkeStr) ||
+             !STRCASECMP(str, kPanasonicLkeStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicLke;
+  } else if (!STRCASECMP(str, kNkeStr) ||
+             !STRCASECMP(str, kPanasonicNkeStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicNke;
+  } else if (!STRCASECMP(str, kDkeStr) ||
+             !STRCASECMP(str, kPanasonicDkeStr) ||
+             !STRCASECMP(str, kPkrStr) ||
+             !STRCASECMP(str, kPanasonicPkrStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicDke;
+  } else if (!STRCASECMP(str, kJkeStr) ||
+             !STRCASECMP(str, kPanasonicJkeStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicJke;
+  } else if (!STRCASECMP(str, kCkpStr) ||
+             !STRCASECMP(str, kPanasonicCkpStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicCkp;
+  } else if (!STRCASECMP(str, kRkrStr) ||
+             !STRCASECMP(str, kPanasonicRkrStr)) {
+    return panasonic_ac_remote_model_t::kPanasonicRkr;
+  // Sharp A/C Models
+  } else if (!STRCASECMP(str, kA907Str)) {
+    return sharp_ac_remote_model_t::A907;
+  } else if (!STRCASECMP(str, kA705Str)) {
+    return sharp_ac_remote_model_t::A705;
+  } else if (!STRCASECMP(str, kA903Str)) {
+    return sharp_ac_remote_model_t::A903;
+  // TCL A/C Models
+  } else if (!STRCASECMP(str, kTac09chsdStr)) {
+    return tcl_ac_remote_model_t::TAC09CHSD;
+  } else if (!STRCASECMP(str, kGz055be1Str)) {
+    return tcl_ac_remote_model_t::GZ055BE1;
+  // Voltas A/C models
+  } else if (!STRCASECMP(str, k122lzfStr)) {
+    return voltas_ac_remote_model_t::kVoltas122LZF;
+  // Whirlpool A/C models
+  } else if (!STRCASECMP(str, kDg11j13aStr) ||
+             !STRCASECMP(str, kDg11j104Str)) {
+    return whirlpool_ac_remote_model_t::DG11J13A;
+  } else if (!STRCASECMP(str, kDg11j191Str)) {
+    return whirlpool_ac_remote_model_t::DG11J191;
+  // Argo A/C models
+  } else if (!STRCASECMP(str, kArgoWrem2Str)) {
+    return argo_ac_remote_model_t::SAC_WREM2;
+  } else if (!STRCASECMP(str, kArgoWrem3Str)) {
+    return argo_ac_remote_model_t::SAC_WREM3;
+  } else {
+    int16_t number = atoi(str);
+    if (number > 0)
+      return number;
+    else
+      return def;
+  }
+}
+
+bool strToBool(const char *str, const bool def) {
+  if (!STRCASECMP(str, kOnStr) ||
+      !STRCASECMP(str, k1Str) ||
+      !STRCASECMP(str, kYesStr) ||
+      !STRCASECMP(str, kTrueStr))
+    return true;
+  else if (!STRCASECMP(str, kOffStr) ||
+           !STRCASECMP(str, k0Str) ||
+           !STRCASECMP(str, kNoStr) ||
+           !STRCASECMP(str, kFalseStr))
+    return false;
+  else
+    return def;
+}
+}  // namespace legacy
+
+// Every keyword the parsers accept, in some category.
+const char * const kKeywords[] = {
+    kControlCommandStr, kIFeelReportStr, kIFeelStr, kSetTimerCommandStr,
+    kTimerStr, kConfigCommandStr, kAutoStr, kAutomaticStr,
+    kOffStr, kStopStr, kCoolStr, kCoolingStr,
+    kHeatStr, kHeatingStr, kDryStr, kDryingStr,
+    kDehumidifyStr, kFanStr, kFanOnlyStr, kFan_OnlyStr,
+    kFanOnlyWithSpaceStr, kFanOnlyNoSpaceStr, kMinStr, kMinimumStr,
+    kLowestStr, kLowStr, kLoStr, kMedStr,
+    kMediumStr, kMidStr, kHighStr, kHiStr,
+    kMaxStr, kMaximumStr, kHighestStr, kMedHighStr,
+    kOnStr, kSwingStr, kBottomStr, kDownStr,
+    kMiddleStr, kCentreStr, kUpperMiddleStr, kTopStr,
+    kUpStr, kLeftMaxNoSpaceStr, kLeftMaxStr, kMaxLeftNoSpaceStr,
+    kMaxLeftStr, kLeftStr, kRightStr, kRightMaxNoSpaceStr,
+    kRightMaxStr, kMaxRightNoSpaceStr, kMaxRightStr, kWideStr,
+    kYaw1fStr, kYbofbStr, kYx1fsfStr, kV9014557AStr,
+    kV9014557BStr, kRlt0541htaaStr, kRlt0541htabStr, kArrah2eStr,
+    kArdb1Str, kArreb1eStr, kArjw2Str, kArry4Str,
+    kArrew4eStr, kGe6711ar2853mStr, kAkb75215403Str, kAkb74955603Str,
+    kAkb73757604Str, kLg6711a20083vStr, kLkeStr, kPanasonicLkeStr,
+    kNkeStr, kPanasonicNkeStr, kDkeStr, kPanasonicDkeStr,
+    kPkrStr, kPanasonicPkrStr, kJkeStr, kPanasonicJkeStr,
+    kCkpStr, kPanasonicCkpStr, kRkrStr, kPanasonicRkrStr,
+    kA907Str, kA705Str, kA903Str, kTac09chsdStr,
+    kGz055be1Str, k122lzfStr, kDg11j13aStr, kDg11j104Str,
+    kDg11j191Str, kArgoWrem2Str, kArgoWrem3Str, k1Str,
+    kYesStr, kTrueStr, k0Str, kNoStr,
+    kFalseStr,
+};
+
+// Things that aren't keywords in any category.
+const char * const kNonKeywords[] = {
+    "", "foobar", "fan only please", "42", "Auto ", "Lowe", "Hig",
+    "PANASONIC", "DG11J1", "0",
+};
+
+// Parse every input with both implementations of one parser, & time each.
+// Returns false if they ever disagree.
+#define BENCH_PARSER(NAME, CALL) do {\
+    for (uint16_t i = 0; i < inputs.size(); i++) {\
+      const char *str = inputs[i].c_str();\
+      if (legacy::CALL != IRac::CALL) {\
+        std::cerr << NAME << " disagrees on \"" << str << '"' << std::endl;\
+        return false;\
+      }\
+    }\
+    std::chrono::steady_clock::time_point start =\
+        std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++)\
+      for (uint16_t i = 0; i < inputs.size(); i++) {\
+        const char *str = inputs[i].c_str();\
+        sink += static_cast<uint32_t>(legacy::CALL);\
+      }\
+    const double legacy_ns = nsSince(start) / (iterations * inputs.size());\
+    start = std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++)\
+      for (uint16_t i = 0; i < inputs.size(); i++) {\
+        const char *str = inputs[i].c_str();\
+        sink += static_cast<uint32_t>(IRac::CALL);\
+      }\
+    const double table_ns = nsSince(start) / (iterations * inputs.size());\
+    if (json)\
+      printf("%s\n  {\"parser\": \"%s\", \"legacy_ns\": %.1f, "\
+             "\"table_ns\": %.1f}", first ? "" : ",", NAME, legacy_ns,\
+             table_ns);\
+    else\
+      printf("%-18s %10.1f %10.1f\n", NAME, legacy_ns, table_ns);\
+    first = false;\
+  } while (0)
+
+bool benchmark(const uint32_t iterations, const bool json) {
+  std::vector<std::string> inputs;
+  for (uint16_t i = 0; i < sizeof(kKeywords) / sizeof(kKeywords[0]); i++) {
+    std::string keyword = kKeywords[i];
+    inputs.push_back(keyword);
+    // Also in lower case, as people & home automation systems often use it.
+    for (uint16_t c = 0; c < keyword.length(); c++)
+      keyword[c] = tolower(keyword[c]);
+    inputs.push_back(keyword);
+  }
+  for (uint16_t i = 0; i < sizeof(kNonKeywords) / sizeof(kNonKeywords[0]);
+       i++)
+    inputs.push_back(kNonKeywords[i]);
+
+  bool first = true;
+  if (json)
+    printf("{\"iterations\": %u, \"inputs\": %u, \"parsers\": [",
+           iterations, (uint32_t)inputs.size());
+  else
+    printf("Iterations: %u, Inputs: %u (ns per call)\n%-18s %10s %10s\n",
+           iterations, (uint32_t)inputs.size(), "Parser", "Legacy",
+           "Table");
+  BENCH_PARSER("strToCommandType",
+               strToCommandType(str, stdAc::ac_command_t::kControlCommand));
+  BENCH_PARSER("strToOpmode", strToOpmode(str, stdAc::opmode_t::kAuto));
+  BENCH_PARSER("strToFanspeed", strToFanspeed(str, stdAc::fanspeed_t::kAuto));
+  BENCH_PARSER("strToSwingV", strToSwingV(str, stdAc::swingv_t::kOff));
+  BENCH_PARSER("strToSwingH", strToSwingH(str, stdAc::swingh_t::kOff));
+  BENCH_PARSER("strToModel", strToModel(str, -1));
+  BENCH_PARSER("strToBool", strToBool(str, false));
+  if (json) printf("\n]}\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+  return benchmark(iterations, json) ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+// Benchmark learning & looking up codes from remotes with unknown protocols.
+// Copyright 2026 David Conran
+//
+// Learns a corpus of 2048 captured codes (every command of 4 NEC & 4 Samsung
+// remotes, as those are codes that differ by very little) into an
+// IRlearnedCodes store. It then replays each code with random timing errors of
+// up to +/-`jitter`% per mark/space, like a real receiver gives, & looks it up
+// via:
+//   - decodeHash(): The exact hash the library reports for UNKNOWN messages,
+//     as a map from the hash of each learned code to its id.
+//   - IRlearnedCodes::lookup(): The nearest code, via the index.
+//   - A linear scan for the nearest code, comparing it to every learned code.
+// For each, it reports how many lookups found the right code (match), the
+// wrong code (false), or nothing (miss), & the nano-Seconds per lookup. For
+// the index, it also reports the average nr. of codes compared per lookup.
+// The index may miss codes the linear scan finds, but it fails if the index
+// ever finds a code the linear scan says is too far away.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./learn_bench --json > before.json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <map>
+#include <vector>
+#include "IRlearn.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// Nr. of remotes of each protocol, & of commands per remote.
+const uint8_t kRemotes = 4;
+const uint16_t kCommands = 256;
+const uint16_t kCorpusSize = 2 * kRemotes * kCommands;
+
+// The timing errors, in +/- percent, to replay the corpus with.
+const uint8_t kJitters[] = {0, 5, 10, 15, 20, 25};
+
+// A captured code.
+typedef struct {
+  std::vector<uint16_t> rawbuf;  // The capture's raw durations.
+  decode_results results;       // The capture, pointing at `rawbuf`.
+} capture_t;
+
+// How well one way of looking codes up did.
+typedef struct {
+  uint32_t match;  // Found the right code.
+  uint32_t wrong;  // Found the wrong code.
+  uint32_t miss;   // Found nothing.
+  double ns;       // Time per lookup.
+} outcome_t;
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// Copy what was sent into a capture.
+void capture(IRsendTest *irsend, capture_t *code) {
+  irsend->makeDecodeResult();
+  code->results = irsend->capture;
+  code->rawbuf.assign(irsend->rawbuf, irsend->rawbuf + code->results.rawlen);
+  code->results.rawbuf = code->rawbuf.data();
+}
+
+// Make the corpus of codes.
+void makeCorpus(std::vector<capture_t> *corpus) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  corpus->resize(kCorpusSize);
+  uint16_t n = 0;
+  for (uint8_t remote = 0; remote < kRemotes; remote++)
+    for (uint16_t command = 0; command < kCommands; command++) {
+      irsend.reset();
+      irsend.sendNEC(irsend.encodeNEC(remote, command));
+      capture(&irsend, &(*corpus)[n++]);
+      irsend.reset();
+      irsend.sendSAMSUNG(irsend.encodeSAMSUNG(remote + 7, command));
+      capture(&irsend, &(*corpus)[n++]);
+    }
+}
+
+// Change each duration of a capture by a random amount, up to `percent`%.
+void jitter(const capture_t &code, const uint8_t percent, capture_t *replay) {
+  *replay = code;
+  replay->results.rawbuf = replay->rawbuf.data();
+  for (uint16_t i = 1; i < replay->results.rawlen; i++) {
+    const int32_t change = rand() % (2 * percent + 1) - percent;
+    replay->rawbuf[i] = replay->rawbuf[i] * (100 + change) / 100;
+  }
+}
+
+// Pack the symbols of a capture, like IRlearnedCodes does.
+std::vector<uint8_t> pack(const decode_results &results) {
+  const uint16_t length = IRlearnedCodes::symbolCount(&results);
+  std::vector<uint8_t> symbols((length + 3) / 4, 0);
+  for (uint16_t i = 0; i < length; i++)
+    symbols[i / 4] |= IRlearnedCodes::symbol(results.rawbuf[i + 1],
+                                             results.rawbuf[i + 3])
+        << ((i % 4) * 2);
+  return symbols;
+}
+
+// Find the nearest code by comparing a capture to every code.
+bool linearLookup(const std::vector<std::vector<uint8_t> > &learned,
+                  const decode_results &results, uint32_t *id,
+                  uint16_t *distance) {
+  const std::vector<uint8_t> symbols = pack(results);
+  const uint16_t length = IRlearnedCodes::symbolCount(&results);
+  uint32_t best_distance = kLearnDefaultMaxDistance + 1;
+  for (uint32_t i = 0; i < learned.size() && best_distance; i++) {
+    if (learned[i].size() != symbols.size()) continue;
+    const uint16_t d = IRlearnedCodes::distance(symbols.data(),
+                                                learned[i].data(), length,
+                                                best_distance);
+    if (d < best_distance) {
+      best_distance = d;
+      *id = i;
+    }
+  }
+  *distance = best_distance;
+  return best_distance <= kLearnDefaultMaxDistance;
+}
+
+// Count the outcome of a lookup.
+void score(outcome_t *outcome, const bool found, const uint32_t id,
+           const uint32_t expected) {
+  if (!found)
+    outcome->miss++;
+  else if (id == expected)
+    outcome->match++;
+  else
+    outcome->wrong++;
+}
+
+// Time one way of looking up every replay, `iterations` times.
+#define TIME_LOOKUPS(OUTCOME, LOOKUP) do {\
+    std::chrono::steady_clock::time_point start =\
+        std::chrono::steady_clock::now();\
+    for (uint32_t n = 0; n < iterations; n++)\
+      for (uint16_t i = 0; i < kCorpusSize; i++) {\
+        uint32_t id = 0;\
+        uint16_t distance = 0;\
+        sink += LOOKUP + id + distance;\
+      }\
+    OUTCOME.ns = nsSince(start) / iterations / kCorpusSize;\
+  } while (0)
+
+bool benchmark(const uint32_t iterations, const bool json) {
+  std::vector<capture_t> corpus;
+  makeCorpus(&corpus);
+  IRrecv irrecv(0);
+  IRlearnedCodes codes(kCorpusSize, kCorpusSize * 20);
+  std::map<uint32_t, uint32_t> hashes;
+  std::vector<std::vector<uint8_t> > learned;
+  for (uint16_t i = 0; i < kCorpusSize; i++) {
+    if (!codes.learn(&corpus[i].results, i)) {
+      std::cerr << "Failed to learn code " << i << std::endl;
+      return false;
+    }
+    decode_results results = corpus[i].results;
+    irrecv.decodeHash(&results);
+    hashes.insert(std::make_pair(results.value, i));  // Keeps the 1st.
+    learned.push_back(pack(corpus[i].results));
+  }
+  if (json)
+    printf("{\"codes\": %u, \"unique_hashes\": %u, \"iterations\": %u, "
+           "\"jitters\": [", kCorpusSize, (uint32_t)hashes.size(),
+           iterations);
+  else
+    printf("Codes: %u (%u unique hashes), Iterations: %u (ns per lookup)\n"
+           "%6s | %-27s | %-35s | %-27s\n"
+           "%6s | %5s %5s %5s %9s | %5s %5s %5s %9s %7s | %5s %5s %5s %9s\n",
+           kCorpusSize, (uint32_t)hashes.size(), iterations, "", "decodeHash",
+           "Index", "Linear", "Jitter", "Match", "False", "Miss", "ns",
+           "Match", "False", "Miss", "ns", "Compared", "Match", "False",
+           "Miss", "ns");
+  srand(42);
+  for (uint8_t j = 0; j < sizeof(kJitters); j++) {
+    std::vector<capture_t> replays(kCorpusSize);
+    for (uint16_t i = 0; i < kCorpusSize; i++)
+      jitter(corpus[i], kJitters[j], &replays[i]);
+    outcome_t hash, index, linear;
+    memset(&hash, 0, sizeof(hash));
+    memset(&index, 0, sizeof(index));
+    memset(&linear, 0, sizeof(linear));
+    uint32_t compared = 0;
+    for (uint16_t i = 0; i < kCorpusSize; i++) {
+      decode_results results = replays[i].results;
+      irrecv.decodeHash(&results);
+      std::map<uint32_t, uint32_t>::const_iterator it =
+          hashes.find(results.value);
+      score(&hash, it != hashes.end(), it == hashes.end() ? 0 : it->second, i);
+      uint32_t id = 0;
+      uint16_t distance = 0;
+      const bool indexed = codes.lookup(&replays[i].results, &id, &distance);
+      compared += codes.candidates();
+      score(&index, indexed, id, i);
+      uint16_t linear_distance = 0;
+      const bool found = linearLookup(learned, replays[i].results, &id,
+                                      &linear_distance);
+      score(&linear, found, id, i);
+      if (indexed && (!found || distance < linear_distance)) {
+        std::cerr << "Index & linear scan disagree for code " << i << " at "
+                  << (uint16_t)kJitters[j] << "% jitter" << std::endl;
+        return false;
+      }
+    }
+    TIME_LOOKUPS(hash, (irrecv.decodeHash(&replays[i].results),
+                        hashes.count(replays[i].results.value)));
+    TIME_LOOKUPS(index, codes.lookup(&replays[i].results, &id, &distance));
+    TIME_LOOKUPS(linear, linearLookup(learned, replays[i].results, &id,
+                                      &distance));
+    const double avg_compared = (double)compared / kCorpusSize;
+    if (json)
+      printf("%s\n  {\"jitter\": %u, "
+             "\"hash_match\": %u, \"hash_false\": %u, \"hash_miss\": %u, "
+             "\"hash_ns\": %.1f, "
+             "\"index_match\": %u, \"index_false\": %u, \"index_miss\": %u, "
+             "\"index_ns\": %.1f, \"index_compared\": %.2f, "
+             "\"linear_match\": %u, \"linear_false\": %u, "
+             "\"linear_miss\": %u, \"linear_ns\": %.1f}", j ? "," : "",
+             kJitters[j], hash.match, hash.wrong, hash.miss, hash.ns,
+             index.match, index.wrong, index.miss, index.ns, avg_compared,
+             linear.match, linear.wrong, linear.miss, linear.ns);
+    else
+      printf("%5u%% | %5u %5u %5u %9.1f | %5u %5u %5u %9.1f %7.2f | "
+             "%5u %5u %5u %9.1f\n", kJitters[j], hash.match, hash.wrong,
+             hash.miss, hash.ns, index.match, index.wrong, index.miss,
+             index.ns, avg_compared, linear.match, linear.wrong, linear.miss,
+             linear.ns);
+  }
+  if (json) printf("\n]}\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 10;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+  return benchmark(iterations, json) ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+// Benchmark the send -> decode -> describe round trip for every protocol.
+// Copyright 2026 David Conran
+//
+// For every protocol we can send, it sends a representative message with
+// IRsendTest, decodes it with IRrecv::decode(), then turns the result into
+// text with resultToHumanReadableBasic() & IRAcUtils::resultAcToString().
+// Each step is timed separately & reported in nano-Seconds per operation,
+// along with where the protocol's decoder sits in decode()'s chain of
+// decoders. (The later it is, the more decoders get tried before it.)
+// The send time is just the send() call. Clearing IRsendTest's output between
+// sends isn't timed, as that costs far more than most sends do.
+//
+// Use `--json` to get output that is easy to compare between commits. e.g.
+//   ./roundtrip_bench --json > before.json
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// The results for one protocol.
+typedef struct {
+  decode_type_t type;   // The protocol that was sent.
+  uint16_t nbits;       // The size of the message sent.
+  int32_t chain;        // Index in decode()'s chain of decoders. -1 if none.
+  bool decoded;         // Was it decoded as the protocol that was sent?
+  double send_ns;       // Time per send(). Excludes IRsendTest::reset().
+  double decode_ns;     // Time per decode().
+  double basic_ns;      // Time per resultToHumanReadableBasic().
+  double ac_ns;         // Time per IRAcUtils::resultAcToString().
+} bench_result_t;
+
+// Stop the compiler from optimising away work whose result we don't use.
+volatile uint32_t sink;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--json] [--iterations <nr>]"
+            << std::endl;
+}
+
+// Nano-Seconds elapsed since `start`.
+double nsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+// A message to send for a protocol.
+typedef struct {
+  uint16_t nbits;                // The size of the message.
+  uint64_t value;                // The message, if it isn't an A/C state.
+  uint8_t state[kStateSizeMax];  // The message, if it is an A/C state.
+} sample_t;
+
+// Known good values for protocols whose messages have a checksum or a
+// structure that an arbitrary pattern of bits won't satisfy.
+// Mostly taken from the unit tests.
+const struct {
+  decode_type_t type;
+  uint64_t value;
+} kKnownValues[] = {
+  {NEC, 0x807F40BF},
+  {SAMSUNG, 0xE0E09966},
+  {SHARP, 0x452A},  // i.e. encodeSharp(0x11, 0x52)
+  {SHERWOOD, 0xC1A28877},
+  {SANYO_LC7461, 0x1D8113F00FF},
+  {RC5X, 0x1881},  // i.e. encodeRC5X(0x02, 0x41, true)
+  {MAGIQUEST, 0x123456789ABC},
+  {PIONEER, 0x659A857AF50A3DC2},
+  {LG2, 0x880094D},
+  {LEGOPF, 0x330F},
+  {SONY_38K, 0x240C},
+  {EPSON, 0xC1AA09F6},
+  {DOSHISHA, 0x800B3048D0},
+  {ZEPEAL, 0x6C81},
+  {METZ, 0x5CA95},
+  {MILESTAG2, 0x379},
+  {XMP, 0x170F443E1C002100},
+  {ARRIS, 0x1080695D},
+  {TOTO, 0x0D0D00},
+};
+
+// Send a sample message for a protocol. Returns false if we can't.
+// Call irsend->reset() first, as it adds to what was sent before.
+bool sendSample(IRsendTest *irsend, const decode_type_t type,
+                const sample_t &sample) {
+  if (hasACState(type))
+    return irsend->send(type, sample.state, sample.nbits / 8);
+  return irsend->send(type, sample.value, sample.nbits);
+}
+
+// Does the message irsend sent decode as the protocol we sent? If so, keep it.
+bool keepIfDecoded(IRsendTest *irsend, IRrecv *irrecv,
+                   const decode_type_t type, sample_t *sample) {
+  irsend->makeDecodeResult();
+  if (!irrecv->decode(&irsend->capture) || irsend->capture.decode_type != type)
+    return false;
+  sample->nbits = irsend->capture.bits;
+  sample->value = irsend->capture.value;
+  if (hasACState(type))
+    memcpy(sample->state, irsend->capture.state, sample->nbits / 8);
+  return true;
+}
+
+// Find a representative message for a protocol. Preferably one that decodes
+// as the protocol sent. e.g. With a valid checksum etc.
+// Returns false if we can't send the protocol at all.
+bool findSample(const decode_type_t type, sample_t *sample) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  // A/C messages that IRac can make should be valid, so try those first.
+  if (IRac::isProtocolSupported(type)) {
+    IRac ac(kGpioUnused);
+    stdAc::state_t state = ac.getState();
+    state.protocol = type;
+    state.power = true;
+    state.mode = stdAc::opmode_t::kCool;
+    state.degrees = 24;
+    IRpulseBuffer pulses(RAW_BUF);
+    IRsend::renderAllTo(&pulses);
+    const bool sent = ac.sendAc(state, NULL);
+    IRsend::renderAllTo(NULL);
+    irsend.reset();
+    if (sent && irsend.play(&pulses) &&
+        keepIfDecoded(&irsend, &irrecv, type, sample))
+      return true;
+  }
+  // Otherwise, an arbitrary, but varied, pattern of bits.
+  sample->nbits = IRsend::defaultBits(type);
+  if (!sample->nbits) return false;  // Not something we can send.
+  sample->value = 0xA5A5A5A5A5A5A5A5ULL;
+  if (sample->nbits < 64) sample->value &= (1ULL << sample->nbits) - 1;
+  for (uint16_t i = 0; i < kStateSizeMax; i++)
+    sample->state[i] = 0xA5 ^ (i * 0x1D);
+  for (uint16_t i = 0; i < sizeof(kKnownValues) / sizeof(kKnownValues[0]);
+       i++)
+    if (kKnownValues[i].type == type) sample->value = kKnownValues[i].value;
+  irsend.reset();
+  if (!sendSample(&irsend, type, *sample)) return false;
+  keepIfDecoded(&irsend, &irrecv, type, sample);
+  return true;
+}
+
+// Where the first decoder for a protocol is in decode()'s chain.
+int32_t chainPosition(const decode_type_t type) {
+  for (uint16_t i = 0; i < IRrecv::_nrDecoders; i++)
+    if (IRrecv::_decoders[i].type == type) return i;
+  return -1;
+}
+
+// Benchmark a single protocol. Returns false if it can't be sent.
+bool benchmark(const decode_type_t type, const uint32_t iterations,
+               bench_result_t *result) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  sample_t sample;
+  if (!findSample(type, &sample)) return false;
+  result->type = type;
+  result->nbits = sample.nbits;
+  result->chain = chainPosition(type);
+
+  // Only time the sends. The reset()s clear two 10000 entry arrays each.
+  std::chrono::steady_clock::time_point start;
+  double send_ns = 0;
+  for (uint32_t n = 0; n < iterations; n++) {
+    irsend.reset();
+    start = std::chrono::steady_clock::now();
+    sendSample(&irsend, type, sample);
+    send_ns += nsSince(start);
+  }
+  result->send_ns = send_ns / iterations;
+
+  irsend.makeDecodeResult();
+  const std::vector<uint16_t> capture(
+      irsend.capture.rawbuf, irsend.capture.rawbuf + irsend.capture.rawlen);
+  std::vector<uint16_t> rawbuf(capture);
+  decode_results results;
+  results.rawbuf = rawbuf.data();
+  results.rawlen = rawbuf.size();
+  results.overflow = false;
+  result->decoded = irrecv.decode(&results) && results.decode_type == type;
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++) {
+    results.rawbuf = rawbuf.data();
+    results.rawlen = rawbuf.size();
+    results.overflow = false;
+    sink += irrecv.decode(&results);
+  }
+  result->decode_ns = nsSince(start) / iterations;
+
+  // Describe the last decode. Whatever it was.
+  start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++)
+    sink += resultToHumanReadableBasic(&results).length();
+  result->basic_ns = nsSince(start) / iterations;
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++)
+    sink += IRAcUtils::resultAcToString(&results).length();
+  result->ac_ns = nsSince(start) / iterations;
+  return true;
+}
+
+void printText(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("Iterations per protocol: %u\n", iterations);
+  printf("(Send ns is just the send() call, not IRsendTest::reset().)\n");
+  printf("%-26s %5s %5s %3s %10s %10s %10s %10s\n", "Protocol", "Bits",
+         "Chain", "OK", "Send ns", "Decode ns", "Basic ns", "AcStr ns");
+  bench_result_t total = {UNKNOWN, 0, 0, true, 0, 0, 0, 0};
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%-26s %5u %5d %3s %10.1f %10.1f %10.1f %10.1f\n",
+           typeToString(r.type).c_str(), r.nbits, r.chain,
+           r.decoded ? "Y" : "N", r.send_ns, r.decode_ns, r.basic_ns, r.ac_ns);
+    total.send_ns += r.send_ns;
+    total.decode_ns += r.decode_ns;
+    total.basic_ns += r.basic_ns;
+    total.ac_ns += r.ac_ns;
+  }
+  printf("%-26s %5s %5s %3s %10.1f %10.1f %10.1f %10.1f\n", "(Total)", "", "",
+         "", total.send_ns, total.decode_ns, total.basic_ns, total.ac_ns);
+}
+
+void printJson(const std::vector<bench_result_t> &results,
+               const uint32_t iterations) {
+  printf("{\"iterations\": %u, "
+         "\"send_ns_covers\": \"send() only, excludes IRsendTest::reset()\", "
+         "\"protocols\": [", iterations);
+  for (uint16_t i = 0; i < results.size(); i++) {
+    const bench_result_t &r = results[i];
+    printf("%s\n  {\"protocol\": \"%s\", \"type\": %d, \"bits\": %u, "
+           "\"chain\": %d, \"decoded\": %s, \"send_ns\": %.1f, "
+           "\"decode_ns\": %.1f, \"basic_ns\": %.1f, \"ac_ns\": %.1f}",
+           i ? "," : "", typeToString(r.type).c_str(), r.type, r.nbits,
+           r.chain, r.decoded ? "true" : "false", r.send_ns, r.decode_ns,
+           r.basic_ns, r.ac_ns);
+  }
+  printf("\n]}\n");
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 1000;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--iterations", argv[i], 13) == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  std::vector<bench_result_t> results;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    bench_result_t result;
+    if (benchmark((decode_type_t)i, iterations, &result))
+      results.push_back(result);
+  }
+  if (json)
+    printJson(results, iterations);
+  else
+    printText(results, iterations);
+  return 0;
+}
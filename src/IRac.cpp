@@ -8,10 +8,12 @@
 #ifndef UNIT_TEST
 #include <Arduino.h>
 #endif
+#include <stddef.h>
 #include <string.h>
 #ifndef ARDUINO
 #include <string>
 #endif
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #if __cplusplus >= 201103L && defined(_GLIBCXX_USE_C99_MATH_TR1)
@@ -23,6 +25,7 @@
 #include <vector>
 extern std::vector<int> timingList;
 #endif  // SWIGLIB
+#include "IRmacros.h"
 #include "IRsend.h"
 #include "IRremoteESP8266.h"
 #include "IRtext.h"
@@ -75,6 +78,18 @@ extern std::vector<int> timingList;
 #define STRCASECMP(LHS, RHS) strcasecmp(LHS, RHS)
 #endif  // ESP8266
 #endif  // STRCASECMP
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
+#endif  // PROGMEM
+#ifndef pgm_read_byte
+#define pgm_read_byte(ADDR) (*(ADDR))
+#endif  // pgm_read_byte
+#ifndef pgm_read_word
+#define pgm_read_word(ADDR) (*(ADDR))
+#endif  // pgm_read_word
+#ifndef pgm_read_dword
+#define pgm_read_dword(ADDR) (*(ADDR))
+#endif  // pgm_read_dword
 
 #ifndef UNIT_TEST
 #define OUTPUT_DECODE_RESULTS_FOR_UT(ac)
@@ -118,9 +133,28 @@ IRac::IRac(const uint16_t pin, const bool inverted, const bool use_modulation) {
   _pin = pin;
   _inverted = inverted;
   _modulation = use_modulation;
+  _queue = NULL;
+  _queue_callback = NULL;
+  _cache = NULL;
+  _persistent = false;
+#if SEND_DAIKIN
+  _daikin = NULL;
+#endif  // SEND_DAIKIN
+#if SEND_GREE
+  _gree = NULL;
+#endif  // SEND_GREE
+#if SEND_MITSUBISHI_AC
+  _mitsubishi = NULL;
+#endif  // SEND_MITSUBISHI_AC
+#if SEND_PANASONIC_AC
+  _panasonic = NULL;
+#endif  // SEND_PANASONIC_AC
   this->markAsSent();
 }
 
+/// Class destructor.
+IRac::~IRac(void) { _freeEncoders(); }
+
 /// Initialise the given state with the supplied settings.
 /// @param[out] state A Ptr to where the settings will be stored.
 /// @param[in] vendor The vendor/protocol type.
@@ -860,25 +894,30 @@ void IRac::corona(IRCoronaAc *ac,
 /// @param[in] turbo Run the device in turbo/powerful mode.
 /// @param[in] econo Run the device in economical mode.
 /// @param[in] clean Turn on the self-cleaning mode. e.g. Mould, dry filters etc
+/// @param[in] changed Flags for the settings that have changed. Only they are
+///   set. e.g. `kAcFieldDegrees`. Default is all of them.
 void IRac::daikin(IRDaikinESP *ac,
                   const bool on, const stdAc::opmode_t mode,
                   const float degrees, const stdAc::fanspeed_t fan,
                   const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
                   const bool quiet, const bool turbo, const bool econo,
-                  const bool clean) {
-  ac->begin();
-  ac->setPower(on);
-  ac->setMode(ac->convertMode(mode));
-  ac->setTemp(degrees);
-  ac->setFan(ac->convertFan(fan));
-  ac->setSwingVertical((int8_t)swingv >= 0);
-  ac->setSwingHorizontal((int8_t)swingh >= 0);
-  ac->setQuiet(quiet);
-  // No Light setting available.
-  // No Filter setting available.
-  ac->setPowerful(turbo);
-  ac->setEcono(econo);
-  ac->setMold(clean);
+                  const bool clean, const uint32_t changed) {
+  if (changed == kAcFieldsAll) ac->begin();
+  if (changed & kAcFieldPower) ac->setPower(on);
+  if (changed & kAcFieldMode) ac->setMode(ac->convertMode(mode));
+  if (changed & kAcFieldDegrees) ac->setTemp(degrees);
+  if (changed & kAcFieldFanspeed) ac->setFan(ac->convertFan(fan));
+  if (changed & kAcFieldSwingv) ac->setSwingVertical((int8_t)swingv >= 0);
+  if (changed & kAcFieldSwingh) ac->setSwingHorizontal((int8_t)swingh >= 0);
+  // Quiet, Powerful, & Econo turn each other off, so set them together.
+  if (changed & (kAcFieldQuiet | kAcFieldTurbo | kAcFieldEcono)) {
+    ac->setQuiet(quiet);
+    // No Light setting available.
+    // No Filter setting available.
+    ac->setPowerful(turbo);
+    ac->setEcono(econo);
+  }
+  if (changed & kAcFieldClean) ac->setMold(clean);
   // No Beep setting available.
   // No Sleep setting available.
   // No Clock setting available.
@@ -1432,27 +1471,36 @@ void IRac::goodweather(IRGoodweatherAc *ac,
 /// @param[in] light Turn on the LED/Display mode.
 /// @param[in] clean Turn on the self-cleaning mode. e.g. Mould, dry filters etc
 /// @param[in] sleep Nr. of minutes for sleep mode. -1 is Off, >= 0 is on.
+/// @param[in] changed Flags for the settings that have changed. Only they are
+///   set. e.g. `kAcFieldDegrees`. Default is all of them.
 void IRac::gree(IRGreeAC *ac, const gree_ac_remote_model_t model,
                 const bool on, const stdAc::opmode_t mode, const bool celsius,
                 const float degrees, const stdAc::fanspeed_t fan,
                 const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
                 const bool iFeel, const bool turbo, const bool econo,
-                const bool light, const bool clean, const int16_t sleep) {
-  ac->begin();
-  ac->setModel(model);
-  ac->setPower(on);
-  ac->setMode(ac->convertMode(mode));
-  ac->setTemp(degrees, !celsius);
-  ac->setFan(ac->convertFan(fan));
-  ac->setSwingVertical(swingv == stdAc::swingv_t::kAuto,  // Set auto flag.
-                       ac->convertSwingV(swingv));
-  ac->setSwingHorizontal(ac->convertSwingH(swingh));
-  ac->setIFeel(iFeel);
-  ac->setLight(light);
-  ac->setTurbo(turbo);
-  ac->setEcono(econo);
-  ac->setXFan(clean);
-  ac->setSleep(sleep >= 0);  // Sleep on this A/C is either on or off.
+                const bool light, const bool clean, const int16_t sleep,
+                const uint32_t changed) {
+  if (changed == kAcFieldsAll) ac->begin();
+  if (changed & kAcFieldModel) ac->setModel(model);
+  if (changed & kAcFieldPower) ac->setPower(on);
+  if (changed & kAcFieldMode) ac->setMode(ac->convertMode(mode));
+  if (changed & (kAcFieldDegrees | kAcFieldCelsius))
+    ac->setTemp(degrees, !celsius);
+  if (changed & kAcFieldFanspeed) ac->setFan(ac->convertFan(fan));
+  if (changed & kAcFieldSwingv)
+    ac->setSwingVertical(swingv == stdAc::swingv_t::kAuto,  // Set auto flag.
+                         ac->convertSwingV(swingv));
+  if (changed & kAcFieldSwingh)
+    ac->setSwingHorizontal(ac->convertSwingH(swingh));
+  if (changed & kAcFieldIFeel) ac->setIFeel(iFeel);
+  if (changed & kAcFieldLight) ac->setLight(light);
+  if (changed & (kAcFieldTurbo | kAcFieldEcono)) {
+    ac->setTurbo(turbo);
+    ac->setEcono(econo);
+  }
+  if (changed & kAcFieldClean) ac->setXFan(clean);
+  // Sleep on this A/C is either on or off.
+  if (changed & kAcFieldSleep) ac->setSleep(sleep >= 0);
   // No Econo setting available.
   // No Filter setting available.
   // No Beep setting available.
@@ -2025,24 +2073,31 @@ void IRac::mirage(IRMirageAc *ac, const stdAc::state_t state) {
 /// @param[in] quiet Run the device in quiet/silent mode.
 /// @param[in] clock The time in Nr. of mins since midnight. < 0 is ignore.
 /// @note Clock can only be set in 10 minute increments. i.e. % 10.
+/// @param[in] changed Flags for the settings that have changed. Only they are
+///   set. e.g. `kAcFieldDegrees`. Default is all of them.
 void IRac::mitsubishi(IRMitsubishiAC *ac,
                       const bool on, const stdAc::opmode_t mode,
                       const float degrees,
                       const stdAc::fanspeed_t fan, const stdAc::swingv_t swingv,
                       const stdAc::swingh_t swingh,
-                      const bool quiet, const int16_t clock) {
-  ac->begin();
+                      const bool quiet, const int16_t clock,
+                      const uint32_t changed) {
+  if (changed == kAcFieldsAll) ac->begin();
   // Uncomment next line if you *really* need the weekly timer enabled via IRac.
   // ac->setWeeklyTimerEnabled(true);  // Weekly Timer is disabled by default.
-  ac->setPower(on);
-  ac->setMode(ac->convertMode(mode));
-  ac->setTemp(degrees);
-  ac->setFan(ac->convertFan(fan));
-  ac->setVane(ac->convertSwingV(swingv));
-  ac->setVaneLeft(ac->convertSwingV(swingv));
-  ac->setWideVane(ac->convertSwingH(swingh));
-  if (quiet) ac->setFan(kMitsubishiAcFanSilent);
-  ac->setISave10C(false);
+  if (changed & kAcFieldPower) ac->setPower(on);
+  if (changed & kAcFieldMode) ac->setMode(ac->convertMode(mode));
+  if (changed & kAcFieldDegrees) ac->setTemp(degrees);
+  if (changed & (kAcFieldFanspeed | kAcFieldQuiet)) {
+    ac->setFan(ac->convertFan(fan));
+    if (quiet) ac->setFan(kMitsubishiAcFanSilent);
+  }
+  if (changed & kAcFieldSwingv) {
+    ac->setVane(ac->convertSwingV(swingv));
+    ac->setVaneLeft(ac->convertSwingV(swingv));
+  }
+  if (changed & kAcFieldSwingh) ac->setWideVane(ac->convertSwingH(swingh));
+  if (changed == kAcFieldsAll) ac->setISave10C(false);
   // No Turbo setting available.
   // No Light setting available.
   // No Filter setting available.
@@ -2261,23 +2316,30 @@ void IRac::neoclima(IRNeoclimaAc *ac,
 /// @param[in] turbo Run the device in turbo/powerful mode.
 /// @param[in] filter Turn on the (ion/pollen/etc) filter mode.
 /// @param[in] clock The time in Nr. of mins since midnight. < 0 is ignore.
+/// @param[in] changed Flags for the settings that have changed. Only they are
+///   set. e.g. `kAcFieldDegrees`. Default is all of them.
 void IRac::panasonic(IRPanasonicAc *ac, const panasonic_ac_remote_model_t model,
                      const bool on, const stdAc::opmode_t mode,
                      const float degrees, const stdAc::fanspeed_t fan,
                      const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
                      const bool quiet, const bool turbo, const bool filter,
-                     const int16_t clock) {
-  ac->begin();
-  ac->setModel(model);
-  ac->setPower(on);
-  ac->setMode(ac->convertMode(mode));
-  ac->setTemp(degrees);
-  ac->setFan(ac->convertFan(fan));
-  ac->setSwingVertical(ac->convertSwingV(swingv));
-  ac->setSwingHorizontal(ac->convertSwingH(swingh));
-  ac->setQuiet(quiet);
-  ac->setPowerful(turbo);
-  ac->setIon(filter);
+                     const int16_t clock, const uint32_t changed) {
+  if (changed == kAcFieldsAll) ac->begin();
+  if (changed & kAcFieldModel) ac->setModel(model);
+  if (changed & kAcFieldPower) ac->setPower(on);
+  if (changed & kAcFieldMode) ac->setMode(ac->convertMode(mode));
+  if (changed & kAcFieldDegrees) ac->setTemp(degrees);
+  if (changed & kAcFieldFanspeed) ac->setFan(ac->convertFan(fan));
+  if (changed & kAcFieldSwingv)
+    ac->setSwingVertical(ac->convertSwingV(swingv));
+  if (changed & kAcFieldSwingh)
+    ac->setSwingHorizontal(ac->convertSwingH(swingh));
+  // Quiet & Powerful turn each other off, so set them together.
+  if (changed & (kAcFieldQuiet | kAcFieldTurbo)) {
+    ac->setQuiet(quiet);
+    ac->setPowerful(turbo);
+  }
+  if (changed & kAcFieldFilter) ac->setIon(filter);
   // No Light setting available.
   // No Econo setting available.
   // No Clean setting available.
@@ -3107,6 +3169,8 @@ bool IRac::sendAc(const decode_type_t vendor, const int16_t model,
 /// You need to use `power` for that.
 /// @return True, if accepted/converted/attempted etc. False, if unsupported.
 bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
+  if (_queue != NULL || _cache != NULL)
+    return this->_sendRendered(desired, prev);
   // Convert the temp from Fahrenheit to Celsius if we are not in Celsius mode.
   float degC __attribute__((unused)) =
       desired.celsius ? desired.degrees : fahrenheitToCelsius(desired.degrees);
@@ -3237,6 +3301,19 @@ bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
 #if SEND_DAIKIN
     case DAIKIN:
     {
+      if (_persistent) {
+        if (_daikin == NULL) {
+          _daikin = new IRDaikinESP(_pin, _inverted, _modulation);
+          _daikinLast = stdAc::state_t();  // i.e. Nothing encoded yet.
+        }
+        const uint32_t changed = _encoderChanges(&_daikinLast, send,
+                                                 kAcFieldsNeedReset);
+        if (changed == kAcFieldsAll) _daikin->stateReset();
+        daikin(_daikin, send.power, send.mode, degC, send.fanspeed,
+               send.swingv, send.swingh, send.quiet, send.turbo, send.econo,
+               send.clean, changed);
+        break;
+      }
       IRDaikinESP ac(_pin, _inverted, _modulation);
       daikin(&ac, send.power, send.mode, degC, send.fanspeed, send.swingv,
              send.swingh, send.quiet, send.turbo, send.econo, send.clean);
@@ -3377,6 +3454,21 @@ bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
 #if SEND_GREE
     case GREE:
     {
+      if (_persistent) {
+        if (_gree == NULL) {
+          _gree = new IRGreeAC(_pin, (gree_ac_remote_model_t)send.model,
+                               _inverted, _modulation);
+          _greeLast = stdAc::state_t();  // i.e. Nothing encoded yet.
+        }
+        const uint32_t changed = _encoderChanges(&_greeLast, send,
+                                                 kAcFieldsNeedReset);
+        if (changed == kAcFieldsAll) _gree->stateReset();
+        gree(_gree, (gree_ac_remote_model_t)send.model, send.power,
+             send.mode, send.celsius, send.degrees, send.fanspeed,
+             send.swingv, send.swingh, send.iFeel, send.turbo, send.econo,
+             send.light, send.clean, send.sleep, changed);
+        break;
+      }
       IRGreeAC ac(_pin, (gree_ac_remote_model_t)send.model, _inverted,
                   _modulation);
       gree(&ac, (gree_ac_remote_model_t)send.model, send.power, send.mode,
@@ -3536,6 +3628,18 @@ bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
 #if SEND_MITSUBISHI_AC
     case MITSUBISHI_AC:
     {
+      if (_persistent) {
+        if (_mitsubishi == NULL) {
+          _mitsubishi = new IRMitsubishiAC(_pin, _inverted, _modulation);
+          _mitsubishiLast = stdAc::state_t();  // i.e. Nothing encoded yet.
+        }
+        const uint32_t changed = _encoderChanges(&_mitsubishiLast, send,
+                                                 kAcFieldsNeedReset);
+        if (changed == kAcFieldsAll) _mitsubishi->stateReset();
+        mitsubishi(_mitsubishi, send.power, send.mode, degC, send.fanspeed,
+                   send.swingv, send.swingh, send.quiet, send.clock, changed);
+        break;
+      }
       IRMitsubishiAC ac(_pin, _inverted, _modulation);
       mitsubishi(&ac, send.power, send.mode, degC, send.fanspeed, send.swingv,
                  send.swingh, send.quiet, send.clock);
@@ -3591,10 +3695,24 @@ bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
 #if SEND_PANASONIC_AC
     case PANASONIC_AC:
     {
+      if (_persistent) {
+        if (_panasonic == NULL) {
+          _panasonic = new IRPanasonicAc(_pin, _inverted, _modulation);
+          _panasonicLast = stdAc::state_t();  // i.e. Nothing encoded yet.
+        }
+        const uint32_t changed = _encoderChanges(&_panasonicLast, send,
+                                                 kAcFieldsNeedReset);
+        if (changed == kAcFieldsAll) _panasonic->stateReset();
+        panasonic(_panasonic, (panasonic_ac_remote_model_t)send.model,
+                  send.power, send.mode, degC, send.fanspeed, send.swingv,
+                  send.swingh, send.quiet, send.turbo, send.filter,
+                  send.clock, changed);
+        break;
+      }
       IRPanasonicAc ac(_pin, _inverted, _modulation);
       panasonic(&ac, (panasonic_ac_remote_model_t)send.model, send.power,
                 send.mode, degC, send.fanspeed, send.swingv, send.swingh,
-                send.quiet, send.turbo, send.clock);
+                send.quiet, send.turbo, send.filter, send.clock);
       break;
     }
 #endif  // SEND_PANASONIC_AC
@@ -3769,6 +3887,129 @@ void IRac::markAsSent(void) {
   _prev = next;
 }
 
+/// Queue the messages `sendAc()` would send, rather than sending them, so it
+/// returns without waiting for them to be sent.
+/// @param[in] queue A Ptr to the queue to add them to. It should send via the
+///   same GPIO as this object. NULL means go back to sending them directly.
+/// @param[in] callback A function to call when each set of messages has been
+///   sent, or NULL.
+/// @note `sendAc()` returns false if the queue is full.
+void IRac::setSendQueue(IRsendQueue *queue, const send_callback_t callback) {
+  _queue = queue;
+  _queue_callback = callback;
+}
+
+/// Keep the messages `sendAc()` renders, & reuse them when the same state is
+/// sent again, rather than encoding it all over again.
+/// @param[in] cache A Ptr to the cache to use. NULL means don't cache them.
+void IRac::setFrameCache(IRacFrameCache *cache) { _cache = cache; }
+
+/// Keep the A/C objects `sendAc()` uses to encode messages, rather than make
+/// new ones each time. When the same protocol is sent again, only the settings
+/// that changed since it was last used are set. This saves time & stack space
+/// when sending often, or for many A/Cs.
+/// @param[in] enable Keep them or not. Off by default. Turning it off frees
+///   any kept objects.
+/// @note Only some protocols (Daikin, Gree, Mitsubishi A/C & Panasonic A/C)
+///   have persistent objects. Others work as before.
+void IRac::setPersistentEncoders(const bool enable) {
+  _persistent = enable;
+  if (!enable) _freeEncoders();
+}
+
+/// Are the A/C objects that encode messages being kept & reused?
+/// @return true if they are, false if not.
+bool IRac::getPersistentEncoders(void) const { return _persistent; }
+
+/// Work out which settings of a persistent encoder object need to be set to
+/// get to the desired state.
+/// @param[in,out] last The state the object last encoded. Updated to `desired`.
+/// @param[in] desired The state we want it to encode.
+/// @param[in] need_reset Flags for the fields which, if changed, mean the
+///   object needs to be reset & every field set again.
+/// @return Flags for the fields that need to be set. `kAcFieldsAll` means the
+///   object needs to be reset first.
+uint32_t IRac::_encoderChanges(stdAc::state_t *last,
+                               const stdAc::state_t desired,
+                               const uint32_t need_reset) {
+  uint32_t changed = diffStates(*last, desired);
+  // A setting that's turned off can't be un-set, only reset. e.g. The clock.
+  if (changed & need_reset || (changed & kAcFieldClock && desired.clock < 0))
+    changed = kAcFieldsAll;
+  *last = desired;
+  return changed;
+}
+
+/// Free all the persistent encoder objects.
+void IRac::_freeEncoders(void) {
+#if SEND_DAIKIN
+  delete _daikin;
+  _daikin = NULL;
+#endif  // SEND_DAIKIN
+#if SEND_GREE
+  delete _gree;
+  _gree = NULL;
+#endif  // SEND_GREE
+#if SEND_MITSUBISHI_AC
+  delete _mitsubishi;
+  _mitsubishi = NULL;
+#endif  // SEND_MITSUBISHI_AC
+#if SEND_PANASONIC_AC
+  delete _panasonic;
+  _panasonic = NULL;
+#endif  // SEND_PANASONIC_AC
+}
+
+/// Render the message(s) for an A/C state, or find them in the cache, then
+/// send them or queue them.
+/// @param[in] desired The state_t structure describing the desired new ac state
+/// @param[in] prev A Ptr to the state_t structure containing the previous state
+/// @return True, if accepted/converted/attempted etc. False, if unsupported.
+bool IRac::_sendRendered(const stdAc::state_t desired,
+                         const stdAc::state_t *prev) {
+  // Don't evict a cached message for something we can't render anyway.
+  if (!isProtocolSupported(desired.protocol)) return false;
+  const stdAc::state_t send = this->handleToggles(this->cleanState(desired),
+                                                  prev);
+  const IRpulseBuffer *pulses = NULL;
+  IRpulseBuffer *target = NULL;
+  IRpulseBuffer *temp = NULL;
+  if (_cache != NULL) {
+    pulses = _cache->lookup(send, prev);
+    if (pulses == NULL) target = _cache->reserve(send, prev);
+  }
+  if (pulses == NULL) {  // Render it.
+    if (target == NULL)  // Not cacheable, so use a temporary buffer.
+      target = temp = new IRpulseBuffer((_queue != NULL) ?
+          _queue->getBufferSize() : _cache->getBufferSize());
+    IRsendQueue *queue = _queue;
+    IRacFrameCache *cache = _cache;
+    _queue = NULL;
+    _cache = NULL;
+    IRsend::renderAllTo(target);
+    const bool success = this->sendAc(desired, prev);
+    IRsend::renderAllTo(NULL);
+    _queue = queue;
+    _cache = cache;
+    if (!success || target->hasOverflowed()) {
+      if (_cache != NULL) _cache->discard(target);
+      delete temp;
+      return false;
+    }
+    pulses = target;
+  }
+  bool success;
+  if (_queue != NULL) {
+    success = _queue->enqueue(pulses, _queue_callback);
+  } else {
+    IRsend irsend(_pin, _inverted, _modulation);
+    irsend.begin();
+    success = irsend.play(pulses);
+  }
+  delete temp;
+  return success;
+}
+
 /// Send an A/C message based soley on our internal state.
 /// @return True, if accepted/converted/attempted. False, if unsupported.
 bool IRac::sendAc(void) {
@@ -3793,65 +4034,488 @@ bool IRac::cmpStates(const stdAc::state_t a, const stdAc::state_t b) {
       a.iFeel != b.iFeel;
 }
 
+/// Which fields of two AirCon states differ.
+/// @note Unlike `cmpStates()`, the clock is included.
+/// @param a A state_t to be compared.
+/// @param b A state_t to be compared.
+/// @return The flags (e.g. `kAcFieldDegrees`) of the fields that differ.
+uint32_t IRac::diffStates(const stdAc::state_t a, const stdAc::state_t b) {
+  uint32_t changed = 0;
+  if (a.protocol != b.protocol) changed |= kAcFieldProtocol;
+  if (a.model != b.model) changed |= kAcFieldModel;
+  if (a.power != b.power) changed |= kAcFieldPower;
+  if (a.mode != b.mode) changed |= kAcFieldMode;
+  if (a.degrees != b.degrees) changed |= kAcFieldDegrees;
+  if (a.celsius != b.celsius) changed |= kAcFieldCelsius;
+  if (a.fanspeed != b.fanspeed) changed |= kAcFieldFanspeed;
+  if (a.swingv != b.swingv) changed |= kAcFieldSwingv;
+  if (a.swingh != b.swingh) changed |= kAcFieldSwingh;
+  if (a.quiet != b.quiet) changed |= kAcFieldQuiet;
+  if (a.turbo != b.turbo) changed |= kAcFieldTurbo;
+  if (a.econo != b.econo) changed |= kAcFieldEcono;
+  if (a.light != b.light) changed |= kAcFieldLight;
+  if (a.filter != b.filter) changed |= kAcFieldFilter;
+  if (a.clean != b.clean) changed |= kAcFieldClean;
+  if (a.beep != b.beep) changed |= kAcFieldBeep;
+  if (a.sleep != b.sleep) changed |= kAcFieldSleep;
+  if (a.clock != b.clock) changed |= kAcFieldClock;
+  if (a.command != b.command) changed |= kAcFieldCommand;
+  if (a.iFeel != b.iFeel) changed |= kAcFieldIFeel;
+  if (a.sensorTemperature != b.sensorTemperature)
+    changed |= kAcFieldSensorTemperature;
+  return changed;
+}
+
+/// The nr. of bits each field of a packed state_t uses, from bit 0 up.
+/// i.e. protocol, model, mode, fanspeed, swingv, swingh, command, power,
+/// celsius, quiet, turbo, econo, light, filter, clean, beep, iFeel, degrees,
+/// sensorTemperature, & sleep.
+static const uint8_t kPackedStateBits[kPackedStateFields] = {
+    8, 4, 3, 3, 3, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 7, 14};
+
+/// Pack an AirCon state into a single 64 bit word.
+/// Two states pack to the same word if & only if `cmpStates()` says they are
+/// the same, so it can be used to compare, hash, or store states cheaply.
+/// @note The clock isn't included, same as `cmpStates()`.
+/// @note Temperatures are stored in 0.5 degree steps for Celsius, & whole
+///   degrees for Fahrenheit. `sleep` must be less than 16383 minutes.
+/// @param[in] state The state to pack.
+/// @param[out] packed Where to store the packed state.
+/// @return true if it could be packed exactly, false if it couldn't.
+///   e.g. A value is out of range.
+bool IRac::packState(const stdAc::state_t state, uint64_t *packed) {
+  const float scale = state.celsius ? 2 : 1;
+  const float degrees = state.degrees * scale;
+  const float sensor = (state.sensorTemperature == kNoTempValue) ? -1
+      : state.sensorTemperature * scale;
+  if (degrees != static_cast<int32_t>(degrees) ||
+      sensor != static_cast<int32_t>(sensor)) return false;
+  const int32_t values[kPackedStateFields] = {
+      state.protocol + 1, state.model + 1,
+      static_cast<int32_t>(state.mode) + 1,
+      static_cast<int32_t>(state.fanspeed),
+      static_cast<int32_t>(state.swingv) + 1,
+      static_cast<int32_t>(state.swingh) + 1,
+      static_cast<int32_t>(state.command),
+      state.power, state.celsius, state.quiet, state.turbo, state.econo,
+      state.light, state.filter, state.clean, state.beep, state.iFeel,
+      static_cast<int32_t>(degrees), static_cast<int32_t>(sensor) + 1,
+      state.sleep + 1};
+  uint64_t result = 0;
+  uint8_t offset = 0;
+  for (uint8_t i = 0; i < kPackedStateFields; i++) {
+    if (values[i] < 0 || values[i] >> kPackedStateBits[i]) return false;
+    result |= static_cast<uint64_t>(values[i]) << offset;
+    offset += kPackedStateBits[i];
+  }
+  *packed = result;
+  return true;
+}
+
+/// Unpack an AirCon state packed by `packState()`.
+/// @param[in] packed The packed state.
+/// @return The state. The clock is always -1 (not set).
+stdAc::state_t IRac::unpackState(const uint64_t packed) {
+  int32_t values[kPackedStateFields];
+  uint8_t offset = 0;
+  for (uint8_t i = 0; i < kPackedStateFields; i++) {
+    values[i] = GETBITS64(packed, offset, kPackedStateBits[i]);
+    offset += kPackedStateBits[i];
+  }
+  stdAc::state_t state;
+  state.protocol = (decode_type_t)(values[0] - 1);
+  state.model = values[1] - 1;
+  state.mode = (stdAc::opmode_t)(values[2] - 1);
+  state.fanspeed = (stdAc::fanspeed_t)values[3];
+  state.swingv = (stdAc::swingv_t)(values[4] - 1);
+  state.swingh = (stdAc::swingh_t)(values[5] - 1);
+  state.command = (stdAc::ac_command_t)values[6];
+  state.power = values[7];
+  state.celsius = values[8];
+  state.quiet = values[9];
+  state.turbo = values[10];
+  state.econo = values[11];
+  state.light = values[12];
+  state.filter = values[13];
+  state.clean = values[14];
+  state.beep = values[15];
+  state.iFeel = values[16];
+  const float scale = state.celsius ? 2 : 1;
+  state.degrees = values[17] / scale;
+  state.sensorTemperature = values[18] ? (values[18] - 1) / scale
+                                       : kNoTempValue;
+  state.sleep = values[19] - 1;
+  state.clock = -1;
+  return state;
+}
+
+/// Calculate a hash of a packed AirCon state. e.g. For a hash table.
+/// @param[in] packed The packed state. See `packState()`.
+/// @return A well mixed 32 bit hash of it.
+uint32_t IRac::hashState(const uint64_t packed) {
+  return (packed * 0x9E3779B97F4A7C15ULL) >> 32;  // Fibonacci hashing.
+}
+
 /// Check if the internal state has changed from what was previously sent.
 /// @note The comparison excludes the clock.
 /// @return True if it has changed, False if not.
 bool IRac::hasStateChanged(void) { return cmpStates(next, _prev); }
 
+/// The categories of keywords that the `IRac::strTo*()` functions accept.
+enum irac_keyword_t {
+  kCommandKeyword = 0,
+  kOpmodeKeyword,
+  kFanspeedKeyword,
+  kSwingVKeyword,
+  kSwingHKeyword,
+  kModelKeyword,
+  kBoolKeyword,
+};
+
+// Every keyword that the `IRac::strTo*()` functions accept.
+// i.e. X(<category>, <value>, <IRtext name>, <text>)
+// If a text is in the same category more than once, the earliest entry wins.
+#define IRAC_KEYWORDS(X) \
+    X(kCommandKeyword, stdAc::ac_command_t::kControlCommand, \
+      kControlCommandStr, D_STR_CONTROL) \
+    X(kCommandKeyword, stdAc::ac_command_t::kSensorTempReport, \
+      kIFeelReportStr, D_STR_IFEELREPORT) \
+    X(kCommandKeyword, stdAc::ac_command_t::kSensorTempReport, \
+      kIFeelStr, D_STR_IFEEL) \
+    X(kCommandKeyword, stdAc::ac_command_t::kTimerCommand, \
+      kSetTimerCommandStr, D_STR_SET_TIMER) \
+    X(kCommandKeyword, stdAc::ac_command_t::kTimerCommand, \
+      kTimerStr, D_STR_TIMER) \
+    X(kCommandKeyword, stdAc::ac_command_t::kConfigCommand, \
+      kConfigCommandStr, D_STR_CONFIG) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kAuto, kAutoStr, D_STR_AUTO) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kAuto, kAutomaticStr, D_STR_AUTOMATIC) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kOff, kOffStr, D_STR_OFF) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kOff, kStopStr, D_STR_STOP) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kCool, kCoolStr, D_STR_COOL) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kCool, kCoolingStr, D_STR_COOLING) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kHeat, kHeatStr, D_STR_HEAT) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kHeat, kHeatingStr, D_STR_HEATING) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kDry, kDryStr, D_STR_DRY) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kDry, kDryingStr, D_STR_DRYING) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kDry, kDehumidifyStr, D_STR_DEHUMIDIFY) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kFan, kFanStr, D_STR_FAN) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kFan, kFanOnlyStr, D_STR_FANONLY) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kFan, kFan_OnlyStr, D_STR_FAN_ONLY) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kFan, \
+      kFanOnlyWithSpaceStr, D_STR_FANSPACEONLY) \
+    X(kOpmodeKeyword, stdAc::opmode_t::kFan, \
+      kFanOnlyNoSpaceStr, D_STR_FANONLYNOSPACE) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kAuto, kAutoStr, D_STR_AUTO) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kAuto, \
+      kAutomaticStr, D_STR_AUTOMATIC) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMin, kMinStr, D_STR_MIN) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMin, kMinimumStr, D_STR_MINIMUM) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMin, kLowestStr, D_STR_LOWEST) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kLow, kLowStr, D_STR_LOW) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kLow, kLoStr, D_STR_LO) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMedium, kMedStr, D_STR_MED) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMedium, kMediumStr, D_STR_MEDIUM) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMedium, kMidStr, D_STR_MID) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kHigh, kHighStr, D_STR_HIGH) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kHigh, kHiStr, D_STR_HI) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMax, kMaxStr, D_STR_MAX) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMax, kMaximumStr, D_STR_MAXIMUM) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMax, kHighestStr, D_STR_HIGHEST) \
+    X(kFanspeedKeyword, stdAc::fanspeed_t::kMediumHigh, \
+      kMedHighStr, D_STR_MED_HIGH) \
+    X(kSwingVKeyword, stdAc::swingv_t::kAuto, kAutoStr, D_STR_AUTO) \
+    X(kSwingVKeyword, stdAc::swingv_t::kAuto, kAutomaticStr, D_STR_AUTOMATIC) \
+    X(kSwingVKeyword, stdAc::swingv_t::kAuto, kOnStr, D_STR_ON) \
+    X(kSwingVKeyword, stdAc::swingv_t::kAuto, kSwingStr, D_STR_SWING) \
+    X(kSwingVKeyword, stdAc::swingv_t::kOff, kOffStr, D_STR_OFF) \
+    X(kSwingVKeyword, stdAc::swingv_t::kOff, kStopStr, D_STR_STOP) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLowest, kMinStr, D_STR_MIN) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLowest, kMinimumStr, D_STR_MINIMUM) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLowest, kLowestStr, D_STR_LOWEST) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLowest, kBottomStr, D_STR_BOTTOM) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLowest, kDownStr, D_STR_DOWN) \
+    X(kSwingVKeyword, stdAc::swingv_t::kLow, kLowStr, D_STR_LOW) \
+    X(kSwingVKeyword, stdAc::swingv_t::kMiddle, kMidStr, D_STR_MID) \
+    X(kSwingVKeyword, stdAc::swingv_t::kMiddle, kMiddleStr, D_STR_MIDDLE) \
+    X(kSwingVKeyword, stdAc::swingv_t::kMiddle, kMedStr, D_STR_MED) \
+    X(kSwingVKeyword, stdAc::swingv_t::kMiddle, kMediumStr, D_STR_MEDIUM) \
+    X(kSwingVKeyword, stdAc::swingv_t::kMiddle, kCentreStr, D_STR_CENTRE) \
+    X(kSwingVKeyword, stdAc::swingv_t::kUpperMiddle, \
+      kUpperMiddleStr, D_STR_UPPER_MIDDLE) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHigh, kHighStr, D_STR_HIGH) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHigh, kHiStr, D_STR_HI) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHighest, kHighestStr, D_STR_HIGHEST) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHighest, kMaxStr, D_STR_MAX) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHighest, kMaximumStr, D_STR_MAXIMUM) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHighest, kTopStr, D_STR_TOP) \
+    X(kSwingVKeyword, stdAc::swingv_t::kHighest, kUpStr, D_STR_UP) \
+    X(kSwingHKeyword, stdAc::swingh_t::kAuto, kAutoStr, D_STR_AUTO) \
+    X(kSwingHKeyword, stdAc::swingh_t::kAuto, kAutomaticStr, D_STR_AUTOMATIC) \
+    X(kSwingHKeyword, stdAc::swingh_t::kAuto, kOnStr, D_STR_ON) \
+    X(kSwingHKeyword, stdAc::swingh_t::kAuto, kSwingStr, D_STR_SWING) \
+    X(kSwingHKeyword, stdAc::swingh_t::kOff, kOffStr, D_STR_OFF) \
+    X(kSwingHKeyword, stdAc::swingh_t::kOff, kStopStr, D_STR_STOP) \
+    X(kSwingHKeyword, stdAc::swingh_t::kLeftMax, \
+      kLeftMaxNoSpaceStr, D_STR_LEFTMAX_NOSPACE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kLeftMax, kLeftMaxStr, D_STR_LEFTMAX) \
+    X(kSwingHKeyword, stdAc::swingh_t::kLeftMax, \
+      kMaxLeftNoSpaceStr, D_STR_MAXLEFT_NOSPACE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kLeftMax, kMaxLeftStr, D_STR_MAXLEFT) \
+    X(kSwingHKeyword, stdAc::swingh_t::kLeft, kLeftStr, D_STR_LEFT) \
+    X(kSwingHKeyword, stdAc::swingh_t::kMiddle, kMidStr, D_STR_MID) \
+    X(kSwingHKeyword, stdAc::swingh_t::kMiddle, kMiddleStr, D_STR_MIDDLE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kMiddle, kMedStr, D_STR_MED) \
+    X(kSwingHKeyword, stdAc::swingh_t::kMiddle, kMediumStr, D_STR_MEDIUM) \
+    X(kSwingHKeyword, stdAc::swingh_t::kMiddle, kCentreStr, D_STR_CENTRE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kRight, kRightStr, D_STR_RIGHT) \
+    X(kSwingHKeyword, stdAc::swingh_t::kRightMax, \
+      kRightMaxNoSpaceStr, D_STR_RIGHTMAX_NOSPACE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kRightMax, \
+      kRightMaxStr, D_STR_RIGHTMAX) \
+    X(kSwingHKeyword, stdAc::swingh_t::kRightMax, \
+      kMaxRightNoSpaceStr, D_STR_MAXRIGHT_NOSPACE) \
+    X(kSwingHKeyword, stdAc::swingh_t::kRightMax, \
+      kMaxRightStr, D_STR_MAXRIGHT) \
+    X(kSwingHKeyword, stdAc::swingh_t::kWide, kWideStr, D_STR_WIDE) \
+    X(kModelKeyword, gree_ac_remote_model_t::YAW1F, kYaw1fStr, D_STR_YAW1F) \
+    X(kModelKeyword, gree_ac_remote_model_t::YBOFB, kYbofbStr, D_STR_YBOFB) \
+    X(kModelKeyword, gree_ac_remote_model_t::YX1FSF, kYx1fsfStr, D_STR_YX1FSF) \
+    X(kModelKeyword, haier_ac176_remote_model_t::V9014557_A, \
+      kV9014557AStr, D_STR_V9014557_A) \
+    X(kModelKeyword, haier_ac176_remote_model_t::V9014557_B, \
+      kV9014557BStr, D_STR_V9014557_B) \
+    X(kModelKeyword, hitachi_ac1_remote_model_t::R_LT0541_HTA_A, \
+      kRlt0541htaaStr, D_STR_RLT0541HTA_A) \
+    X(kModelKeyword, hitachi_ac1_remote_model_t::R_LT0541_HTA_B, \
+      kRlt0541htabStr, D_STR_RLT0541HTA_B) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARRAH2E, \
+      kArrah2eStr, D_STR_ARRAH2E) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARDB1, kArdb1Str, D_STR_ARDB1) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARREB1E, \
+      kArreb1eStr, D_STR_ARREB1E) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARJW2, kArjw2Str, D_STR_ARJW2) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARRY4, kArry4Str, D_STR_ARRY4) \
+    X(kModelKeyword, fujitsu_ac_remote_model_t::ARREW4E, \
+      kArrew4eStr, D_STR_ARREW4E) \
+    X(kModelKeyword, lg_ac_remote_model_t::GE6711AR2853M, \
+      kGe6711ar2853mStr, D_STR_GE6711AR2853M) \
+    X(kModelKeyword, lg_ac_remote_model_t::AKB75215403, \
+      kAkb75215403Str, D_STR_AKB75215403) \
+    X(kModelKeyword, lg_ac_remote_model_t::AKB74955603, \
+      kAkb74955603Str, D_STR_AKB74955603) \
+    X(kModelKeyword, lg_ac_remote_model_t::AKB73757604, \
+      kAkb73757604Str, D_STR_AKB73757604) \
+    X(kModelKeyword, lg_ac_remote_model_t::LG6711A20083V, \
+      kLg6711a20083vStr, D_STR_LG6711A20083V) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicLke, \
+      kLkeStr, D_STR_LKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicLke, \
+      kPanasonicLkeStr, D_STR_PANASONICLKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicNke, \
+      kNkeStr, D_STR_NKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicNke, \
+      kPanasonicNkeStr, D_STR_PANASONICNKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicDke, \
+      kDkeStr, D_STR_DKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicDke, \
+      kPanasonicDkeStr, D_STR_PANASONICDKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicDke, \
+      kPkrStr, D_STR_PKR) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicDke, \
+      kPanasonicPkrStr, D_STR_PANASONICPKR) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicJke, \
+      kJkeStr, D_STR_JKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicJke, \
+      kPanasonicJkeStr, D_STR_PANASONICJKE) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicCkp, \
+      kCkpStr, D_STR_CKP) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicCkp, \
+      kPanasonicCkpStr, D_STR_PANASONICCKP) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicRkr, \
+      kRkrStr, D_STR_RKR) \
+    X(kModelKeyword, panasonic_ac_remote_model_t::kPanasonicRkr, \
+      kPanasonicRkrStr, D_STR_PANASONICRKR) \
+    X(kModelKeyword, sharp_ac_remote_model_t::A907, kA907Str, D_STR_A907) \
+    X(kModelKeyword, sharp_ac_remote_model_t::A705, kA705Str, D_STR_A705) \
+    X(kModelKeyword, sharp_ac_remote_model_t::A903, kA903Str, D_STR_A903) \
+    X(kModelKeyword, tcl_ac_remote_model_t::TAC09CHSD, \
+      kTac09chsdStr, D_STR_TAC09CHSD) \
+    X(kModelKeyword, tcl_ac_remote_model_t::GZ055BE1, \
+      kGz055be1Str, D_STR_GZ055BE1) \
+    X(kModelKeyword, voltas_ac_remote_model_t::kVoltas122LZF, \
+      k122lzfStr, D_STR_122LZF) \
+    X(kModelKeyword, whirlpool_ac_remote_model_t::DG11J13A, \
+      kDg11j13aStr, D_STR_DG11J13A) \
+    X(kModelKeyword, whirlpool_ac_remote_model_t::DG11J13A, \
+      kDg11j104Str, D_STR_DG11J104) \
+    X(kModelKeyword, whirlpool_ac_remote_model_t::DG11J191, \
+      kDg11j191Str, D_STR_DG11J191) \
+    X(kModelKeyword, argo_ac_remote_model_t::SAC_WREM2, \
+      kArgoWrem2Str, D_STR_ARGO_WREM2) \
+    X(kModelKeyword, argo_ac_remote_model_t::SAC_WREM3, \
+      kArgoWrem3Str, D_STR_ARGO_WREM3) \
+    X(kBoolKeyword, true, kOnStr, D_STR_ON) \
+    X(kBoolKeyword, true, k1Str, D_STR_1) \
+    X(kBoolKeyword, true, kYesStr, D_STR_YES) \
+    X(kBoolKeyword, true, kTrueStr, D_STR_TRUE) \
+    X(kBoolKeyword, false, kOffStr, D_STR_OFF) \
+    X(kBoolKeyword, false, k0Str, D_STR_0) \
+    X(kBoolKeyword, false, kNoStr, D_STR_NO) \
+    X(kBoolKeyword, false, kFalseStr, D_STR_FALSE)
+
+/// @cond IGNORE
+#define IRAC_KEYWORD_STR(CAT, VALUE, NAME, TEXT) TEXT "\x0"
+#define IRAC_KEYWORD_MEMBER(CAT, VALUE, NAME, TEXT)\
+    char CAT ## _ ## NAME[sizeof(TEXT)];
+#define IRAC_KEYWORD_OFFSET(CAT, VALUE, NAME, TEXT)\
+    offsetof(irac_keyword_texts_t, CAT ## _ ## NAME),
+#define IRAC_KEYWORD_CATEGORY(CAT, VALUE, NAME, TEXT) CAT,
+#define IRAC_KEYWORD_VALUE(CAT, VALUE, NAME, TEXT) static_cast<int16_t>(VALUE),
+#define IRAC_KEYWORD_HASH(CAT, VALUE, NAME, TEXT)\
+    irutils::caseInsensitiveHash(TEXT),
+#define IRAC_KEYWORD_NEXT(CAT, VALUE, NAME, TEXT)\
+    keywordChain(keywordBucket(irutils::caseInsensitiveHash(TEXT), CAT),\
+                 keywordIndex(offsetof(irac_keyword_texts_t, CAT ## _ ## NAME))\
+                 + 1),
+#define IRAC_KEYWORD_HEAD(B) keywordChain(B, 0),
+/// @endcond
+
+/// Nr. of buckets in the keyword hash table.
+const uint16_t kKeywordHashSize = 256;
+/// Marks the end of a chain of keywords in the keyword hash table.
+const uint8_t kNoKeyword = 0xFF;
+
+/// The texts of all the keywords, one after the other.
+static const char kKeywordTexts[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_STR)
+};
+
+/// The layout of `kKeywordTexts`. It is never instantiated. It lets the
+/// compiler work out where each keyword's text starts.
+struct irac_keyword_texts_t {
+  IRAC_KEYWORDS(IRAC_KEYWORD_MEMBER)
+};
+
+/// Where each keyword's text starts in `kKeywordTexts`.
+static constexpr uint16_t kKeywordOffset[] = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_OFFSET)
+};
+/// The category of each keyword.
+static constexpr uint8_t kKeywordCategory[] = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_CATEGORY)
+};
+/// The case insensitive hash of each keyword's text.
+static constexpr uint32_t kKeywordHash[] = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_HASH)
+};
+/// Nr. of keywords.
+static constexpr uint16_t kNrKeywords =
+    sizeof(kKeywordCategory) / sizeof(kKeywordCategory[0]);
+static_assert(kNrKeywords < kNoKeyword, "Too many keywords for a uint8_t.");
+static_assert(kKeywordHashSize == 256,
+              "kKeywordHeads is built with REPEAT256().");
+
+/// Which keyword starts at a given offset in `kKeywordTexts`.
+/// @param[in] offset The offset of the keyword's text.
+/// @param[in] index The keyword to start looking from.
+/// @return The index of the keyword.
+static constexpr uint16_t keywordIndex(const uint16_t offset,
+                                       const uint16_t index = 0) {
+  return (index >= kNrKeywords || kKeywordOffset[index] == offset) ? index :
+      keywordIndex(offset, index + 1);
+}
+
+/// Which hash table bucket a keyword is in.
+/// @param[in] hash The case insensitive hash of the keyword's text.
+/// @param[in] category The category of the keyword.
+/// @return The bucket.
+static constexpr uint16_t keywordBucket(const uint32_t hash,
+                                        const uint8_t category) {
+  return (hash ^ category) % kKeywordHashSize;
+}
+
+/// Find the first keyword, from `index` onwards, in a hash table bucket.
+/// @param[in] bucket The bucket.
+/// @param[in] index The keyword to start looking from.
+/// @return The index of the keyword, or `kNoKeyword` if there isn't one.
+static constexpr uint8_t keywordChain(const uint16_t bucket,
+                                      const uint16_t index) {
+  return (index >= kNrKeywords) ? kNoKeyword :
+      (keywordBucket(kKeywordHash[index], kKeywordCategory[index]) == bucket) ?
+      index : keywordChain(bucket, index + 1);
+}
+
+// Lookup tables, built at compile time, for the keywords. See `findKeyword()`
+/// Where each keyword's text starts in `kKeywordTexts`.
+static const uint16_t kKeywordOffsets[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_OFFSET)
+};
+/// The category of each keyword.
+static const uint8_t kKeywordCategories[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_CATEGORY)
+};
+/// The value each keyword converts to.
+static const int16_t kKeywordValues[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_VALUE)
+};
+/// The case insensitive hash of each keyword's text.
+static const uint32_t kKeywordHashes[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_HASH)
+};
+/// The first keyword in each bucket of the keyword hash table.
+static const uint8_t kKeywordHeads[] PROGMEM = {
+    REPEAT256(IRAC_KEYWORD_HEAD, 0)
+};
+/// The next keyword in the same bucket of the keyword hash table.
+static const uint8_t kKeywordNext[] PROGMEM = {
+    IRAC_KEYWORDS(IRAC_KEYWORD_NEXT)
+};
+
+/// Find the value of a keyword, via a hash table built at compile time.
+/// @param[in] str A Ptr to a C-style string to be converted.
+/// @param[in] category The category of keyword to look for.
+/// @param[out] value Where to store the value of the keyword, if found.
+/// @return true, if the keyword was found. Otherwise, false.
+static bool findKeyword(const char *str, const irac_keyword_t category,
+                        int16_t *value) {
+  const uint32_t hash = irutils::caseInsensitiveHash(str);
+  for (uint8_t i = pgm_read_byte(kKeywordHeads +
+                                 keywordBucket(hash, category));
+       i != kNoKeyword; i = pgm_read_byte(kKeywordNext + i)) {
+    if (pgm_read_dword(kKeywordHashes + i) == hash &&
+        pgm_read_byte(kKeywordCategories + i) == category &&
+        !STRCASECMP(str, kKeywordTexts + pgm_read_word(kKeywordOffsets + i))) {
+      *value = pgm_read_word(kKeywordValues + i);
+      return true;
+    }
+  }
+  return false;
+}
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::ac_command_t IRac::strToCommandType(const char *str,
                                            const stdAc::ac_command_t def) {
-  if (!STRCASECMP(str, kControlCommandStr))
-    return stdAc::ac_command_t::kControlCommand;
-  else if (!STRCASECMP(str, kIFeelReportStr) ||
-           !STRCASECMP(str, kIFeelStr))
-    return stdAc::ac_command_t::kSensorTempReport;
-  else if (!STRCASECMP(str, kSetTimerCommandStr) ||
-           !STRCASECMP(str, kTimerStr))
-    return stdAc::ac_command_t::kTimerCommand;
-  else if (!STRCASECMP(str, kConfigCommandStr))
-    return stdAc::ac_command_t::kConfigCommand;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kCommandKeyword, &value) ?
+      static_cast<stdAc::ac_command_t>(value) : def;
 }
 
 /// Convert the supplied str into the appropriate enum.
+/// @note The Fan strings with "only" are accepted to help with HomeAssistant
+///   & Google Home Climate integration.
+/// @see https://www.home-assistant.io/integrations/google_assistant/#climate-operation-modes
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::opmode_t IRac::strToOpmode(const char *str,
                                   const stdAc::opmode_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::opmode_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::opmode_t::kOff;
-  else if (!STRCASECMP(str, kCoolStr) ||
-           !STRCASECMP(str, kCoolingStr))
-    return stdAc::opmode_t::kCool;
-  else if (!STRCASECMP(str, kHeatStr) ||
-           !STRCASECMP(str, kHeatingStr))
-    return stdAc::opmode_t::kHeat;
-  else if (!STRCASECMP(str, kDryStr) ||
-           !STRCASECMP(str, kDryingStr) ||
-           !STRCASECMP(str, kDehumidifyStr))
-    return stdAc::opmode_t::kDry;
-  else if (!STRCASECMP(str, kFanStr) ||
-          // The following Fans strings with "only" are required to help with
-          // HomeAssistant & Google Home Climate integration.
-          // For compatibility only.
-          // Ref: https://www.home-assistant.io/integrations/google_assistant/#climate-operation-modes
-           !STRCASECMP(str, kFanOnlyStr) ||
-           !STRCASECMP(str, kFan_OnlyStr) ||
-           !STRCASECMP(str, kFanOnlyWithSpaceStr) ||
-           !STRCASECMP(str, kFanOnlyNoSpaceStr))
-    return stdAc::opmode_t::kFan;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kOpmodeKeyword, &value) ?
+      static_cast<stdAc::opmode_t>(value) : def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3860,31 +4524,9 @@ stdAc::opmode_t IRac::strToOpmode(const char *str,
 /// @return The equivalent enum.
 stdAc::fanspeed_t IRac::strToFanspeed(const char *str,
                                       const stdAc::fanspeed_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::fanspeed_t::kAuto;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr))
-    return stdAc::fanspeed_t::kMin;
-  else if (!STRCASECMP(str, kLowStr) ||
-           !STRCASECMP(str, kLoStr))
-    return stdAc::fanspeed_t::kLow;
-  else if (!STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kMidStr))
-    return stdAc::fanspeed_t::kMedium;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::fanspeed_t::kHigh;
-  else if (!STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kHighestStr))
-    return stdAc::fanspeed_t::kMax;
-  else if (!STRCASECMP(str, kMedHighStr))
-    return stdAc::fanspeed_t::kMediumHigh;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kFanspeedKeyword, &value) ?
+      static_cast<stdAc::fanspeed_t>(value) : def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3893,41 +4535,9 @@ stdAc::fanspeed_t IRac::strToFanspeed(const char *str,
 /// @return The equivalent enum.
 stdAc::swingv_t IRac::strToSwingV(const char *str,
                                   const stdAc::swingv_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, kSwingStr))
-    return stdAc::swingv_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingv_t::kOff;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr) ||
-           !STRCASECMP(str, kBottomStr) ||
-           !STRCASECMP(str, kDownStr))
-    return stdAc::swingv_t::kLowest;
-  else if (!STRCASECMP(str, kLowStr))
-    return stdAc::swingv_t::kLow;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingv_t::kMiddle;
-  else if (!STRCASECMP(str, kUpperMiddleStr))
-    return stdAc::swingv_t::kUpperMiddle;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::swingv_t::kHigh;
-  else if (!STRCASECMP(str, kHighestStr) ||
-           !STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kTopStr) ||
-           !STRCASECMP(str, kUpStr))
-    return stdAc::swingv_t::kHighest;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kSwingVKeyword, &value) ?
+      static_cast<stdAc::swingv_t>(value) : def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3936,37 +4546,9 @@ stdAc::swingv_t IRac::strToSwingV(const char *str,
 /// @return The equivalent enum.
 stdAc::swingh_t IRac::strToSwingH(const char *str,
                                   const stdAc::swingh_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) || !STRCASECMP(str, kSwingStr))
-    return stdAc::swingh_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingh_t::kOff;
-  else if (!STRCASECMP(str, kLeftMaxNoSpaceStr) ||              // "LeftMax"
-           !STRCASECMP(str, kLeftMaxStr) ||                     // "Left Max"
-           !STRCASECMP(str, kMaxLeftNoSpaceStr) ||              // "MaxLeft"
-           !STRCASECMP(str, kMaxLeftStr))                       // "Max Left"
-    return stdAc::swingh_t::kLeftMax;
-  else if (!STRCASECMP(str, kLeftStr))
-    return stdAc::swingh_t::kLeft;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingh_t::kMiddle;
-  else if (!STRCASECMP(str, kRightStr))
-    return stdAc::swingh_t::kRight;
-  else if (!STRCASECMP(str, kRightMaxNoSpaceStr) ||              // "RightMax"
-           !STRCASECMP(str, kRightMaxStr) ||                     // "Right Max"
-           !STRCASECMP(str, kMaxRightNoSpaceStr) ||              // "MaxRight"
-           !STRCASECMP(str, kMaxRightStr))                       // "Max Right"
-    return stdAc::swingh_t::kRightMax;
-  else if (!STRCASECMP(str, kWideStr))
-    return stdAc::swingh_t::kWide;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kSwingHKeyword, &value) ?
+      static_cast<stdAc::swingh_t>(value) : def;
 }
 
 /// Convert the supplied str into the appropriate enum.
@@ -3974,103 +4556,16 @@ stdAc::swingh_t IRac::strToSwingH(const char *str,
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
-/// @note After adding a new model you should update modelToStr() too.
+/// @note After adding a new model you should update modelToStr() and
+///   `IRAC_KEYWORDS` too.
 int16_t IRac::strToModel(const char *str, const int16_t def) {
-  // Gree
-  if (!STRCASECMP(str, kYaw1fStr)) {
-    return gree_ac_remote_model_t::YAW1F;
-  } else if (!STRCASECMP(str, kYbofbStr)) {
-    return gree_ac_remote_model_t::YBOFB;
-  } else if (!STRCASECMP(str, kYx1fsfStr)) {
-    return gree_ac_remote_model_t::YX1FSF;
-  // Haier models
-  } else if (!STRCASECMP(str, kV9014557AStr)) {
-    return haier_ac176_remote_model_t::V9014557_A;
-  } else if (!STRCASECMP(str, kV9014557BStr)) {
-    return haier_ac176_remote_model_t::V9014557_B;
-  // HitachiAc1 models
-  } else if (!STRCASECMP(str, kRlt0541htaaStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_A;
-  } else if (!STRCASECMP(str, kRlt0541htabStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_B;
-  // Fujitsu A/C models
-  } else if (!STRCASECMP(str, kArrah2eStr)) {
-    return fujitsu_ac_remote_model_t::ARRAH2E;
-  } else if (!STRCASECMP(str, kArdb1Str)) {
-    return fujitsu_ac_remote_model_t::ARDB1;
-  } else if (!STRCASECMP(str, kArreb1eStr)) {
-    return fujitsu_ac_remote_model_t::ARREB1E;
-  } else if (!STRCASECMP(str, kArjw2Str)) {
-    return fujitsu_ac_remote_model_t::ARJW2;
-  } else if (!STRCASECMP(str, kArry4Str)) {
-    return fujitsu_ac_remote_model_t::ARRY4;
-  } else if (!STRCASECMP(str, kArrew4eStr)) {
-    return fujitsu_ac_remote_model_t::ARREW4E;
-  // LG A/C models
-  } else if (!STRCASECMP(str, kGe6711ar2853mStr)) {
-    return lg_ac_remote_model_t::GE6711AR2853M;
-  } else if (!STRCASECMP(str, kAkb75215403Str)) {
-    return lg_ac_remote_model_t::AKB75215403;
-  } else if (!STRCASECMP(str, kAkb74955603Str)) {
-    return lg_ac_remote_model_t::AKB74955603;
-  } else if (!STRCASECMP(str, kAkb73757604Str)) {
-    return lg_ac_remote_model_t::AKB73757604;
-  } else if (!STRCASECMP(str, kLg6711a20083vStr)) {
-    return lg_ac_remote_model_t::LG6711A20083V;
-  // Panasonic A/C families
-  } else if (!STRCASECMP(str, kLkeStr) ||
-             !STRCASECMP(str, kPanasonicLkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicLke;
-  } else if (!STRCASECMP(str, kNkeStr) ||
-             !STRCASECMP(str, kPanasonicNkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicNke;
-  } else if (!STRCASECMP(str, kDkeStr) ||
-             !STRCASECMP(str, kPanasonicDkeStr) ||
-             !STRCASECMP(str, kPkrStr) ||
-             !STRCASECMP(str, kPanasonicPkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicDke;
-  } else if (!STRCASECMP(str, kJkeStr) ||
-             !STRCASECMP(str, kPanasonicJkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicJke;
-  } else if (!STRCASECMP(str, kCkpStr) ||
-             !STRCASECMP(str, kPanasonicCkpStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicCkp;
-  } else if (!STRCASECMP(str, kRkrStr) ||
-             !STRCASECMP(str, kPanasonicRkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicRkr;
-  // Sharp A/C Models
-  } else if (!STRCASECMP(str, kA907Str)) {
-    return sharp_ac_remote_model_t::A907;
-  } else if (!STRCASECMP(str, kA705Str)) {
-    return sharp_ac_remote_model_t::A705;
-  } else if (!STRCASECMP(str, kA903Str)) {
-    return sharp_ac_remote_model_t::A903;
-  // TCL A/C Models
-  } else if (!STRCASECMP(str, kTac09chsdStr)) {
-    return tcl_ac_remote_model_t::TAC09CHSD;
-  } else if (!STRCASECMP(str, kGz055be1Str)) {
-    return tcl_ac_remote_model_t::GZ055BE1;
-  // Voltas A/C models
-  } else if (!STRCASECMP(str, k122lzfStr)) {
-    return voltas_ac_remote_model_t::kVoltas122LZF;
-  // Whirlpool A/C models
-  } else if (!STRCASECMP(str, kDg11j13aStr) ||
-             !STRCASECMP(str, kDg11j104Str)) {
-    return whirlpool_ac_remote_model_t::DG11J13A;
-  } else if (!STRCASECMP(str, kDg11j191Str)) {
-    return whirlpool_ac_remote_model_t::DG11J191;
-  // Argo A/C models
-  } else if (!STRCASECMP(str, kArgoWrem2Str)) {
-    return argo_ac_remote_model_t::SAC_WREM2;
-  } else if (!STRCASECMP(str, kArgoWrem3Str)) {
-    return argo_ac_remote_model_t::SAC_WREM3;
-  } else {
-    int16_t number = atoi(str);
-    if (number > 0)
-      return number;
-    else
-      return def;
-  }
+  int16_t value;
+  if (findKeyword(str, kModelKeyword, &value)) return value;
+  const int16_t number = atoi(str);
+  if (number > 0)
+    return number;
+  else
+    return def;
 }
 
 /// Convert the supplied str into the appropriate boolean value.
@@ -4078,18 +4573,8 @@ int16_t IRac::strToModel(const char *str, const int16_t def) {
 /// @param[in] def The boolean value to return if no conversion was possible.
 /// @return The equivalent boolean value.
 bool IRac::strToBool(const char *str, const bool def) {
-  if (!STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, k1Str) ||
-      !STRCASECMP(str, kYesStr) ||
-      !STRCASECMP(str, kTrueStr))
-    return true;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, k0Str) ||
-           !STRCASECMP(str, kNoStr) ||
-           !STRCASECMP(str, kFalseStr))
-    return false;
-  else
-    return def;
+  int16_t value;
+  return findKeyword(str, kBoolKeyword, &value) ? value : def;
 }
 
 /// Convert the supplied boolean into the appropriate String.
@@ -4178,6 +4663,207 @@ String IRac::swinghToString(const stdAc::swingh_t swingh) {
   }
 }
 
+/// Class constructor.
+/// @param[in] entries The max. nr. of messages to keep.
+/// @param[in] size The max. nr. of pulses each message can have.
+///   See IRpulseBuffer.
+IRacFrameCache::IRacFrameCache(const uint8_t entries, const uint16_t size) {
+  _nentries = std::max(entries, (uint8_t)1);
+  _size = size;
+  _keys = new key_t[_nentries];
+  _entries = new IRpulseBuffer*[_nentries];
+  for (uint8_t i = 0; i < _nentries; i++)
+    _entries[i] = new IRpulseBuffer(size);
+  clear();
+  resetStats();
+}
+
+/// Class destructor.
+IRacFrameCache::~IRacFrameCache(void) {
+  for (uint8_t i = 0; i < _nentries; i++) delete _entries[i];
+  delete[] _entries;
+  delete[] _keys;
+}
+
+/// Can the messages for a state be cached?
+/// @param[in] state The (cleaned) state to check.
+/// @return true if they can, false if they can't. e.g. The clock is set, or
+///   it can't be packed. See `IRac::packState()`.
+bool IRacFrameCache::isCacheable(const stdAc::state_t state) {
+  uint64_t packed;
+  return state.clock < 0 && IRac::packState(state, &packed);
+}
+
+/// Make the key for the messages for a state.
+/// @param[in] state The (cleaned) state.
+/// @param[in] prev A Ptr to the previous state. Can be NULL.
+/// @param[out] key Where to store the key.
+/// @return true if it could be made, false if the state can't be cached.
+bool IRacFrameCache::_makeKey(const stdAc::state_t state,
+                              const stdAc::state_t *prev, key_t *key) {
+  if (state.clock >= 0 || !IRac::packState(state, &key->state)) return false;
+  // Only the parts of the previous state that `IRac::sendAc()` uses.
+  stdAc::state_t reduced;
+  key->has_prev = (prev != NULL);
+  if (key->has_prev) {
+    reduced.power = prev->power;
+    reduced.swingv = prev->swingv;
+    reduced.swingh = prev->swingh;
+    reduced.quiet = prev->quiet;
+    reduced.light = prev->light;
+    reduced.sleep = prev->sleep;
+  }
+  return IRac::packState(reduced, &key->prev);
+}
+
+/// Find the entry holding the messages for a key.
+/// @param[in] key The key to look for.
+/// @return The index of the entry, or -1 if there isn't one.
+int16_t IRacFrameCache::_find(const key_t *key) const {
+  for (uint8_t i = 0; i < _nentries; i++)
+    if (_keys[i].valid && _keys[i].state == key->state &&
+        _keys[i].prev == key->prev && _keys[i].has_prev == key->has_prev)
+      return i;
+  return -1;
+}
+
+/// Find the cached messages for a state.
+/// @param[in] state The (cleaned) state to look for.
+/// @param[in] prev A Ptr to the previous state. Can be NULL.
+/// @return A Ptr to the rendered messages, or NULL if they aren't cached.
+const IRpulseBuffer *IRacFrameCache::lookup(const stdAc::state_t state,
+                                            const stdAc::state_t *prev) {
+  key_t key;
+  if (!_makeKey(state, prev, &key)) return NULL;
+  const int16_t i = _find(&key);
+  if (i < 0) return NULL;
+  _stats.hits++;
+  _keys[i].used = ++_clock;
+  return _entries[i];
+}
+
+/// Make room in the cache for the messages for a state.
+/// The least recently used entry is dropped if there isn't a free one.
+/// @param[in] state The (cleaned) state they are for.
+/// @param[in] prev A Ptr to the previous state. Can be NULL.
+/// @return A Ptr to an empty buffer to render the messages into, or NULL if
+///   the state can't be cached.
+IRpulseBuffer *IRacFrameCache::reserve(const stdAc::state_t state,
+                                       const stdAc::state_t *prev) {
+  key_t key;
+  if (!_makeKey(state, prev, &key)) {
+    _stats.bypassed++;
+    return NULL;
+  }
+  _stats.misses++;
+  int16_t i = _find(&key);
+  if (i < 0) {  // Pick a free entry, or the least recently used one.
+    i = 0;
+    for (uint8_t j = 0; j < _nentries; j++) {
+      if (!_keys[j].valid) {
+        i = j;
+        break;
+      }
+      if (_keys[j].used < _keys[i].used) i = j;
+    }
+    if (_keys[i].valid) _stats.evictions++;
+  }
+  _keys[i] = key;
+  _keys[i].used = ++_clock;
+  _keys[i].valid = true;
+  _entries[i]->clear();
+  return _entries[i];
+}
+
+/// Drop a cached message. e.g. It couldn't be rendered.
+/// @param[in] pulses A Ptr to the buffer `reserve()` returned.
+void IRacFrameCache::discard(const IRpulseBuffer *pulses) {
+  for (uint8_t i = 0; i < _nentries; i++)
+    if (_entries[i] == pulses) _keys[i].valid = false;
+}
+
+/// Drop all the cached messages.
+void IRacFrameCache::clear(void) {
+  for (uint8_t i = 0; i < _nentries; i++) _keys[i].valid = false;
+  _clock = 0;
+}
+
+/// Get the nr. of messages in the cache.
+/// @return The nr. of entries in use.
+uint8_t IRacFrameCache::getCount(void) const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < _nentries; i++) count += _keys[i].valid;
+  return count;
+}
+
+/// Get the max. nr. of pulses each cached message can have.
+/// @return The nr. of pulses. See IRpulseBuffer.
+uint16_t IRacFrameCache::getBufferSize(void) const { return _size; }
+
+/// Get the statistics about the cache since `resetStats()`.
+/// @return The statistics.
+ac_cache_stats_t IRacFrameCache::getStats(void) const { return _stats; }
+
+/// Reset the statistics about the cache.
+void IRacFrameCache::resetStats(void) {
+  _stats.hits = 0;
+  _stats.misses = 0;
+  _stats.evictions = 0;
+  _stats.bypassed = 0;
+}
+
+/// Class constructor.
+/// @param[in] sender A Ptr to the IRmultiSend object to send the messages with.
+/// @param[in] size The max. nr. of entries in each message. See IRpulseBuffer.
+///   Each `sendAc()` renders into a single buffer this big, & keeps each
+///   message in a buffer only as big as it needs. So it costs 4 bytes of heap
+///   per entry once, not per A/C.
+IRacMulti::IRacMulti(IRmultiSend *sender, const uint16_t size)
+    : _sender(sender), _size(size), _passes(0) {}
+
+/// Send each A/C the message to put it in the state we want, all at once.
+/// @param[in] targets The A/Cs to send to, & what to send them.
+/// @param[in] count The nr. of A/Cs in `targets`. If there are more than
+///   kMultiSendMax, they are sent in batches of that many.
+/// @return The nr. of A/Cs that were sent a message. Those that weren't have
+///   an unsupported protocol, or a message too big for the buffers.
+uint8_t IRacMulti::sendAc(const ac_target_t targets[], const uint8_t count) {
+  IRpulseBuffer rendered(_size);  // Big enough for any of the messages.
+  IRpulseBuffer *buffers[kMultiSendMax] = {NULL};  // Just big enough for each.
+  uint8_t sent = 0;
+  _passes = 0;
+  for (uint16_t first = 0; first < count; first += kMultiSendMax) {
+    const uint8_t batch = std::min(count - first, (int)kMultiSendMax);
+    _sender->clear();
+    for (uint8_t i = 0; i < batch; i++) {
+      const ac_target_t *target = &targets[first + i];
+      rendered.clear();
+      IRac ac(target->pin);
+      IRsend::renderAllTo(&rendered);
+      const bool success = ac.sendAc(target->state, target->prev);
+      IRsend::renderAllTo(NULL);
+      if (!success || rendered.hasOverflowed()) continue;
+      const uint16_t length = rendered.getLength();
+      if (buffers[i] == NULL || buffers[i]->getSize() < length) {
+        delete buffers[i];
+        buffers[i] = new IRpulseBuffer(length);
+      }
+      if (buffers[i] != NULL && buffers[i]->copyFrom(&rendered))
+        _sender->add(target->pin, buffers[i]);
+    }
+    sent += _sender->getCount();
+    _passes += _sender->send();
+  }
+  _sender->clear();
+  for (uint8_t i = 0; i < kMultiSendMax; i++) delete buffers[i];
+  return sent;
+}
+
+/// Get the nr. of passes the last `sendAc()` took. i.e. Nr. of times messages
+/// had to be sent one after the other, rather than simultaneously.
+/// @return The nr. of passes.
+uint8_t IRacMulti::getPasses(void) const { return _passes; }
+
 namespace IRAcUtils {
 /// Display the human readable state of an A/C message if we can.
 /// @param[in] result A Ptr to the captured `decode_results` that contains an
@@ -4185,26 +4871,43 @@ namespace IRAcUtils {
 /// @return A string with the human description of the A/C message.
 ///   An empty string if we can't.
 String resultAcToString(const decode_results * const result) {
+  String text = "";
+  IRtextWriter out(&text);
+  resultAcToString(&out, result);
+  return text;
+}
+
+/// Write the human readable state of an A/C message if we can.
+/// @param[out] out Where to write the text.
+/// @param[in] result A Ptr to the captured `decode_results` that contains an
+///   A/C mesg.
+/// @return true, if we wrote a human description of the A/C message.
+///   false, and nothing is written, if we can't.
+bool resultAcToString(IRtextWriter *out,
+                      const decode_results * const result) {
   switch (result->decode_type) {
 #if DECODE_AIRTON
     case decode_type_t::AIRTON: {
       IRAirtonAc ac(kGpioUnused);
       ac.setRaw(result->value);  // AIRTON uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_AIRTON
 #if DECODE_AIRWELL
     case decode_type_t::AIRWELL: {
       IRAirwellAc ac(kGpioUnused);
       ac.setRaw(result->value);  // AIRWELL uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_AIRWELL
 #if DECODE_AMCOR
     case decode_type_t::AMCOR: {
       IRAmcorAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_AMCOR
 #if DECODE_ARGO
@@ -4213,25 +4916,29 @@ String resultAcToString(const decode_results * const result) {
                                               true)) {
         IRArgoAC_WREM3 ac(kGpioUnused);
         ac.setRaw(result->state, result->bits / 8);
-        return ac.toString();
+        ac.toString(out);
+        return true;
       }
       IRArgoAC ac(kGpioUnused);
       ac.setRaw(result->state, result->bits / 8);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_ARGO
 #if DECODE_BOSCH144
     case decode_type_t::BOSCH144: {
       IRBosch144AC ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_BOSCH144
 #if DECODE_CARRIER_AC64
     case decode_type_t::CARRIER_AC64: {
       IRCarrierAc64 ac(kGpioUnused);
       ac.setRaw(result->value);  // CARRIER_AC64 uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_CARRIER_AC64
 #if DECODE_COOLIX
@@ -4239,7 +4946,8 @@ String resultAcToString(const decode_results * const result) {
       IRCoolixAC ac(kGpioUnused);
       ac.on();
       ac.setRaw(result->value);  // Coolix uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_COOLIX
 #if DECODE_COOLIX48
@@ -4248,84 +4956,96 @@ String resultAcToString(const decode_results * const result) {
       ac.on();
       // Coolix uses value instead of state.
       ac.setRawFromCoolix48(result->value);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_COOLIX
 #if DECODE_CORONA_AC
     case decode_type_t::CORONA_AC: {
       IRCoronaAc ac(kGpioUnused);
       ac.setRaw(result->state, result->bits / 8);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_CORONA_AC
 #if DECODE_DAIKIN
     case decode_type_t::DAIKIN: {
       IRDaikinESP ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN
 #if DECODE_DAIKIN128
     case decode_type_t::DAIKIN128: {
       IRDaikin128 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN128
 #if DECODE_DAIKIN152
     case decode_type_t::DAIKIN152: {
       IRDaikin152 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN152
 #if DECODE_DAIKIN160
     case decode_type_t::DAIKIN160: {
       IRDaikin160 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN160
 #if DECODE_DAIKIN176
     case decode_type_t::DAIKIN176: {
       IRDaikin176 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN160
 #if DECODE_DAIKIN2
     case decode_type_t::DAIKIN2: {
       IRDaikin2 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN2
 #if DECODE_DAIKIN216
     case decode_type_t::DAIKIN216: {
       IRDaikin216 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN216
 #if DECODE_DAIKIN312
     case decode_type_t::DAIKIN312: {
       IRDaikin312 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN312
 #if DECODE_DAIKIN64
     case decode_type_t::DAIKIN64: {
       IRDaikin64 ac(kGpioUnused);
       ac.setRaw(result->value);  // Daikin64 uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DAIKIN64
 #if DECODE_DELONGHI_AC
     case decode_type_t::DELONGHI_AC: {
       IRDelonghiAc ac(kGpioUnused);
       ac.setRaw(result->value);  // DelonghiAc uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_DELONGHI_AC
 #if DECODE_ECOCLIM
@@ -4333,128 +5053,146 @@ String resultAcToString(const decode_results * const result) {
       if (result->bits == kEcoclimBits) {
         IREcoclimAc ac(kGpioUnused);
         ac.setRaw(result->value);  // EcoClim uses value instead of state.
-        return ac.toString();
+        ac.toString(out);
+        return true;
       }
-      return "";
+      return false;
     }
 #endif  // DECODE_ECOCLIM
 #if DECODE_ELECTRA_AC
     case decode_type_t::ELECTRA_AC: {
       IRElectraAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_ELECTRA_AC
 #if DECODE_EUROM
     case decode_type_t::EUROM: {
       IREuromAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_EUROM
 #if DECODE_FUJITSU_AC
     case decode_type_t::FUJITSU_AC: {
       IRFujitsuAC ac(kGpioUnused);
       ac.setRaw(result->state, result->bits / 8);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_FUJITSU_AC
 #if DECODE_GOODWEATHER
     case decode_type_t::GOODWEATHER: {
       IRGoodweatherAc ac(kGpioUnused);
       ac.setRaw(result->value);  // Goodweather uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_GOODWEATHER
 #if DECODE_GREE
     case decode_type_t::GREE: {
       IRGreeAC ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_GREE
 #if DECODE_HAIER_AC
     case decode_type_t::HAIER_AC: {
       IRHaierAC ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HAIER_AC
 #if DECODE_HAIER_AC160
     case decode_type_t::HAIER_AC160: {
       IRHaierAC160 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HAIER_AC160
 #if DECODE_HAIER_AC176
     case decode_type_t::HAIER_AC176: {
       IRHaierAC176 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HAIER_AC176
 #if DECODE_HAIER_AC_YRW02
     case decode_type_t::HAIER_AC_YRW02: {
       IRHaierACYRW02 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HAIER_AC_YRW02
 #if DECODE_HITACHI_AC
     case decode_type_t::HITACHI_AC: {
       IRHitachiAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC
 #if DECODE_HITACHI_AC1
     case decode_type_t::HITACHI_AC1: {
       IRHitachiAc1 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC1
 #if DECODE_HITACHI_AC264
     case decode_type_t::HITACHI_AC264: {
       IRHitachiAc264 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC264
 #if DECODE_HITACHI_AC296
     case decode_type_t::HITACHI_AC296: {
       IRHitachiAc296 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC296
 #if DECODE_HITACHI_AC344
     case decode_type_t::HITACHI_AC344: {
       IRHitachiAc344 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC344
 #if DECODE_HITACHI_AC424
     case decode_type_t::HITACHI_AC424: {
       IRHitachiAc424 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_HITACHI_AC424
 #if DECODE_KELON
     case decode_type_t::KELON: {
       IRKelonAc ac(kGpioUnused);
       ac.setRaw(result->value);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_KELON
 #if DECODE_KELVINATOR
     case decode_type_t::KELVINATOR: {
       IRKelvinatorAC ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_KELVINATOR
 #if DECODE_LG
@@ -4462,61 +5200,71 @@ String resultAcToString(const decode_results * const result) {
     case decode_type_t::LG2: {
       IRLgAc ac(kGpioUnused);
       ac.setRaw(result->value, result->decode_type);  // Use value, not state.
-      return ac.isValidLgAc() ? ac.toString() : "";
+      if (!ac.isValidLgAc()) return false;
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_LG
 #if DECODE_MIDEA
     case decode_type_t::MIDEA: {
       IRMideaAC ac(kGpioUnused);
       ac.setRaw(result->value);  // Midea uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MIDEA
 #if DECODE_MIRAGE
     case decode_type_t::MIRAGE: {
       IRMirageAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MIRAGE
 #if DECODE_MITSUBISHI_AC
     case decode_type_t::MITSUBISHI_AC: {
       IRMitsubishiAC ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MITSUBISHI_AC
 #if DECODE_MITSUBISHI112
     case decode_type_t::MITSUBISHI112: {
       IRMitsubishi112 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MITSUBISHI112
 #if DECODE_MITSUBISHI136
     case decode_type_t::MITSUBISHI136: {
       IRMitsubishi136 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MITSUBISHI136
 #if DECODE_MITSUBISHIHEAVY
     case decode_type_t::MITSUBISHI_HEAVY_88: {
       IRMitsubishiHeavy88Ac ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
     case decode_type_t::MITSUBISHI_HEAVY_152: {
       IRMitsubishiHeavy152Ac ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_MITSUBISHIHEAVY
 #if DECODE_NEOCLIMA
     case decode_type_t::NEOCLIMA: {
       IRNeoclimaAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_NEOCLIMA
 #if DECODE_PANASONIC_AC
@@ -4524,9 +5272,10 @@ String resultAcToString(const decode_results * const result) {
       if (result->bits > kPanasonicAcShortBits) {
         IRPanasonicAc ac(kGpioUnused);
         ac.setRaw(result->state);
-        return ac.toString();
+        ac.toString(out);
+        return true;
       }
-      return "";
+      return false;
     }
 #endif  // DECODE_PANASONIC_AC
 #if DECODE_PANASONIC_AC32
@@ -4534,44 +5283,50 @@ String resultAcToString(const decode_results * const result) {
       if (result->bits >= kPanasonicAc32Bits) {
         IRPanasonicAc32 ac(kGpioUnused);
         ac.setRaw(result->value);  // Uses value instead of state.
-        return ac.toString();
+        ac.toString(out);
+        return true;
       }
-      return "";
+      return false;
     }
 #endif  // DECODE_PANASONIC_AC
 #if DECODE_RHOSS
   case decode_type_t::RHOSS: {
     IRRhossAc ac(kGpioUnused);
     ac.setRaw(result->state);
-    return ac.toString();
+    ac.toString(out);
+    return true;
   }
 #endif  // DECODE_RHOSS
 #if DECODE_SAMSUNG_AC
     case decode_type_t::SAMSUNG_AC: {
       IRSamsungAc ac(kGpioUnused);
       ac.setRaw(result->state, result->bits / 8);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_SAMSUNG_AC
 #if DECODE_SANYO_AC
     case decode_type_t::SANYO_AC: {
       IRSanyoAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_SANYO_AC
 #if DECODE_SANYO_AC88
     case decode_type_t::SANYO_AC88: {
       IRSanyoAc88 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_SANYO_AC88
 #if DECODE_SHARP_AC
     case decode_type_t::SHARP_AC: {
       IRSharpAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_SHARP_AC
 #if (DECODE_TCL112AC || DECODE_TEKNOPOINT)
@@ -4579,28 +5334,32 @@ String resultAcToString(const decode_results * const result) {
     case decode_type_t::TEKNOPOINT: {
       IRTcl112Ac ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // (DECODE_TCL112AC || DECODE_TEKNOPOINT)
 #if DECODE_TECHNIBEL_AC
     case decode_type_t::TECHNIBEL_AC: {
       IRTechnibelAc ac(kGpioUnused);
       ac.setRaw(result->value);  // TechnibelAc uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TECHNIBEL_AC
 #if DECODE_TECO
     case decode_type_t::TECO: {
       IRTecoAc ac(kGpioUnused);
       ac.setRaw(result->value);  // Like Coolix, use value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TECO
 #if DECODE_TOSHIBA_AC
     case decode_type_t::TOSHIBA_AC: {
       IRToshibaAC ac(kGpioUnused);
       ac.setRaw(result->state, result->bits / 8);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TOSHIBA_AC
 #if DECODE_TRANSCOLD
@@ -4608,60 +5367,68 @@ String resultAcToString(const decode_results * const result) {
       IRTranscoldAc ac(kGpioUnused);
       ac.on();
       ac.setRaw(result->value);  // TRANSCOLD uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TRANSCOLD
 #if DECODE_TROTEC
     case decode_type_t::TROTEC: {
       IRTrotecESP ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TROTEC
 #if DECODE_TROTEC_3550
     case decode_type_t::TROTEC_3550: {
       IRTrotec3550 ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TROTEC_3550
 #if DECODE_TRUMA
     case decode_type_t::TRUMA: {
       IRTrumaAc ac(kGpioUnused);
       ac.setRaw(result->value);  // Truma uses value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_TRUMA
 #if DECODE_VESTEL_AC
     case decode_type_t::VESTEL_AC: {
       IRVestelAc ac(kGpioUnused);
       ac.setRaw(result->value);  // Like Coolix, use value instead of state.
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_VESTEL_AC
 #if DECODE_VOLTAS
     case decode_type_t::VOLTAS: {
       IRVoltas ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_VOLTAS
 #if DECODE_WHIRLPOOL_AC
     case decode_type_t::WHIRLPOOL_AC: {
       IRWhirlpoolAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_WHIRLPOOL_AC
 #if DECODE_YORK
     case decode_type_t::YORK: {
       IRYorkAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_YORK
     default:
-      return "";
+      return false;
   }
 }
 
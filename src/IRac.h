@@ -57,6 +57,88 @@
 
 // Constants
 const int8_t kGpioUnused = -1;  ///< A placeholder for not using an actual GPIO.
+const uint8_t kAcFrameCacheEntries = 4;  ///< Default nr. of cached messages.
+const uint8_t kPackedStateFields = 20;  ///< Nr. of fields in a packed state_t.
+
+// Flags for each field of a stdAc::state_t. See `IRac::diffStates()`.
+const uint32_t kAcFieldProtocol =          1UL << 0;   ///< `protocol`
+const uint32_t kAcFieldModel =             1UL << 1;   ///< `model`
+const uint32_t kAcFieldPower =             1UL << 2;   ///< `power`
+const uint32_t kAcFieldMode =              1UL << 3;   ///< `mode`
+const uint32_t kAcFieldDegrees =           1UL << 4;   ///< `degrees`
+const uint32_t kAcFieldCelsius =           1UL << 5;   ///< `celsius`
+const uint32_t kAcFieldFanspeed =          1UL << 6;   ///< `fanspeed`
+const uint32_t kAcFieldSwingv =            1UL << 7;   ///< `swingv`
+const uint32_t kAcFieldSwingh =            1UL << 8;   ///< `swingh`
+const uint32_t kAcFieldQuiet =             1UL << 9;   ///< `quiet`
+const uint32_t kAcFieldTurbo =             1UL << 10;  ///< `turbo`
+const uint32_t kAcFieldEcono =             1UL << 11;  ///< `econo`
+const uint32_t kAcFieldLight =             1UL << 12;  ///< `light`
+const uint32_t kAcFieldFilter =            1UL << 13;  ///< `filter`
+const uint32_t kAcFieldClean =             1UL << 14;  ///< `clean`
+const uint32_t kAcFieldBeep =              1UL << 15;  ///< `beep`
+const uint32_t kAcFieldSleep =             1UL << 16;  ///< `sleep`
+const uint32_t kAcFieldClock =             1UL << 17;  ///< `clock`
+const uint32_t kAcFieldCommand =           1UL << 18;  ///< `command`
+const uint32_t kAcFieldIFeel =             1UL << 19;  ///< `iFeel`
+const uint32_t kAcFieldSensorTemperature = 1UL << 20;  ///< `sensorTemperature`
+const uint32_t kAcFieldsAll = (1UL << 21) - 1;  ///< Every field.
+/// The fields that, if changed, mean a persistent encoder object is reset &
+/// every setting is applied again. i.e. Ones whose setters have side effects.
+const uint32_t kAcFieldsNeedReset = kAcFieldProtocol | kAcFieldModel |
+    kAcFieldPower | kAcFieldMode | kAcFieldCelsius;
+
+/// Statistics about how well an IRacFrameCache has been working.
+typedef struct {
+  uint32_t hits;       // Nr. of times a message was found in the cache.
+  uint32_t misses;     // Nr. of times it had to be rendered.
+  uint32_t evictions;  // Nr. of messages dropped to make room for another.
+  uint32_t bypassed;   // Nr. of messages that can't be cached. e.g. Clock set.
+} ac_cache_stats_t;
+
+/// A small Least Recently Used cache of the messages `IRac::sendAc()` has
+/// rendered, keyed by the (cleaned) state they were rendered for.
+/// A hit skips all of the protocol class's logic & encoding.
+/// @note States with the clock set (i.e. `clock >= 0`) aren't cached, as the
+///   time they send changes from minute to minute.
+class IRacFrameCache {
+ public:
+  explicit IRacFrameCache(const uint8_t entries = kAcFrameCacheEntries,
+                          const uint16_t size = kPulseBufferSize);
+  ~IRacFrameCache(void);
+  static bool isCacheable(const stdAc::state_t state);
+  const IRpulseBuffer *lookup(const stdAc::state_t state,
+                              const stdAc::state_t *prev);
+  IRpulseBuffer *reserve(const stdAc::state_t state,
+                         const stdAc::state_t *prev);
+  void discard(const IRpulseBuffer *pulses);
+  void clear(void);
+  uint8_t getCount(void) const;
+  uint16_t getBufferSize(void) const;
+  ac_cache_stats_t getStats(void) const;
+  void resetStats(void);
+#ifndef UNIT_TEST
+
+ private:
+#endif  // UNIT_TEST
+  /// What a cached message was rendered for.
+  typedef struct {
+    uint64_t state;  // The packed state, after handling any toggles.
+    uint64_t prev;   // The parts of the previous state that matter, packed.
+    bool has_prev;   // Was there a previous state?
+    uint32_t used;   // When it was last used. Larger is more recent.
+    bool valid;      // Does this entry hold a message?
+  } key_t;
+  key_t *_keys;  ///< What each entry holds.
+  IRpulseBuffer **_entries;  ///< The rendered messages.
+  uint8_t _nentries;  ///< Nr. of entries.
+  uint16_t _size;  ///< Nr. of pulses each entry can hold.
+  uint32_t _clock;  ///< A counter used to order the entries by use.
+  ac_cache_stats_t _stats;
+  static bool _makeKey(const stdAc::state_t state,
+                       const stdAc::state_t *prev, key_t *key);
+  int16_t _find(const key_t *key) const;
+};
 
 // Class
 /// A universal/common/generic interface for controling supported A/Cs.
@@ -64,6 +146,10 @@ class IRac {
  public:
   explicit IRac(const uint16_t pin, const bool inverted = false,
                 const bool use_modulation = true);
+  ~IRac(void);
+  // It owns the persistent encoders, so copies would delete them twice.
+  IRac(const IRac &) = delete;
+  IRac &operator=(const IRac &) = delete;
   static bool isProtocolSupported(const decode_type_t protocol);
   static void initState(stdAc::state_t *state,
                         const decode_type_t vendor, const int16_t model,
@@ -78,6 +164,10 @@ class IRac {
                         const int16_t clock);
   static void initState(stdAc::state_t *state);
   void markAsSent(void);
+  void setSendQueue(IRsendQueue *queue, const send_callback_t callback = NULL);
+  void setFrameCache(IRacFrameCache *cache);
+  void setPersistentEncoders(const bool enable);
+  bool getPersistentEncoders(void) const;
   bool sendAc(void);
   bool sendAc(const stdAc::state_t desired, const stdAc::state_t *prev = NULL);
   bool sendAc(const decode_type_t vendor, const int16_t model,
@@ -89,6 +179,10 @@ class IRac {
               const bool beep, const int16_t sleep = -1,
               const int16_t clock = -1);
   static bool cmpStates(const stdAc::state_t a, const stdAc::state_t b);
+  static uint32_t diffStates(const stdAc::state_t a, const stdAc::state_t b);
+  static bool packState(const stdAc::state_t state, uint64_t *packed);
+  static stdAc::state_t unpackState(const uint64_t packed);
+  static uint32_t hashState(const uint64_t packed);
   static bool strToBool(const char *str, const bool def = false);
   static int16_t strToModel(const char *str, const int16_t def = -1);
   static stdAc::ac_command_t strToCommandType(const char *str,
@@ -133,6 +227,31 @@ class IRac {
   uint16_t _pin;  ///< The GPIO to use to transmit messages from.
   bool _inverted;  ///< IR LED is lit when GPIO is LOW (true) or HIGH (false)?
   bool _modulation;  ///< Is frequency modulation to be used?
+  IRsendQueue *_queue;  ///< Where to queue messages. NULL means send them.
+  send_callback_t _queue_callback;  ///< Called when a queued message is sent.
+  IRacFrameCache *_cache;  ///< Where rendered messages are kept for reuse.
+  bool _sendRendered(const stdAc::state_t desired, const stdAc::state_t *prev);
+  bool _persistent;  ///< Keep & reuse the A/C objects that encode messages?
+  static uint32_t _encoderChanges(stdAc::state_t *last,
+                                  const stdAc::state_t desired,
+                                  const uint32_t need_reset);
+  void _freeEncoders(void);
+#if SEND_DAIKIN
+  IRDaikinESP *_daikin;  ///< Persistent encoder. NULL if not created yet.
+  stdAc::state_t _daikinLast;  ///< What `_daikin` last encoded.
+#endif  // SEND_DAIKIN
+#if SEND_GREE
+  IRGreeAC *_gree;  ///< Persistent encoder. NULL if not created yet.
+  stdAc::state_t _greeLast;  ///< What `_gree` last encoded.
+#endif  // SEND_GREE
+#if SEND_MITSUBISHI_AC
+  IRMitsubishiAC *_mitsubishi;  ///< Persistent encoder. NULL if not made yet.
+  stdAc::state_t _mitsubishiLast;  ///< What `_mitsubishi` last encoded.
+#endif  // SEND_MITSUBISHI_AC
+#if SEND_PANASONIC_AC
+  IRPanasonicAc *_panasonic;  ///< Persistent encoder. NULL if not created yet.
+  stdAc::state_t _panasonicLast;  ///< What `_panasonic` last encoded.
+#endif  // SEND_PANASONIC_AC
   stdAc::state_t _prev;  ///< The state we expect the device to currently be in.
 #if SEND_AIRTON
   void airton(IRAirtonAc *ac,
@@ -201,7 +320,7 @@ void carrier64(IRCarrierAc64 *ac,
               const stdAc::fanspeed_t fan,
               const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
               const bool quiet, const bool turbo, const bool econo,
-              const bool clean);
+              const bool clean, const uint32_t changed = kAcFieldsAll);
 #endif  // SEND_DAIKIN
 #if SEND_DAIKIN128
   void daikin128(IRDaikin128 *ac,
@@ -317,7 +436,8 @@ void electra(IRElectraAc *ac,
             const float degrees, const stdAc::fanspeed_t fan,
             const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
             const bool iFeel, const bool turbo, const bool econo,
-            const bool light, const bool clean, const int16_t sleep = -1);
+            const bool light, const bool clean, const int16_t sleep = -1,
+            const uint32_t changed = kAcFieldsAll);
 #endif  // SEND_GREE
 #if SEND_HAIER_AC
   void haier(IRHaierAC *ac,
@@ -429,7 +549,8 @@ void electra(IRElectraAc *ac,
                   const float degrees,
                   const stdAc::fanspeed_t fan, const stdAc::swingv_t swingv,
                   const stdAc::swingh_t swingh,
-                  const bool quiet, const int16_t clock = -1);
+                  const bool quiet, const int16_t clock = -1,
+                  const uint32_t changed = kAcFieldsAll);
 #endif  // SEND_MITSUBISHI_AC
 #if SEND_MITSUBISHI112
   void mitsubishi112(IRMitsubishi112 *ac,
@@ -475,7 +596,8 @@ void electra(IRElectraAc *ac,
                  const stdAc::fanspeed_t fan,
                  const stdAc::swingv_t swingv, const stdAc::swingh_t swingh,
                  const bool quiet, const bool turbo, const bool filter,
-                 const int16_t clock = -1);
+                 const int16_t clock = -1,
+                 const uint32_t changed = kAcFieldsAll);
 #endif  // SEND_PANASONIC_AC
 #if SEND_PANASONIC_AC32
   void panasonic32(IRPanasonicAc32 *ac,
@@ -598,9 +720,37 @@ static stdAc::state_t handleToggles(const stdAc::state_t desired,
                                     const stdAc::state_t *prev = NULL);
 };  // IRac class
 
+/// A device for IRacMulti to control. i.e. Which GPIO its IR LED is on, & the
+/// state we want it to be in.
+typedef struct {
+  uint16_t pin;  // The GPIO its IR LED is on.
+  stdAc::state_t state;  // The state we want it to be in.
+  const stdAc::state_t *prev;  // The state it was in, or NULL if unknown.
+} ac_target_t;
+
+/// Controls several A/Cs at once, each via an IR LED on its own GPIO.
+/// All of their messages are rendered first, then sent by an IRmultiSend.
+/// Ones that share a carrier are sent simultaneously, so it takes about as long
+/// as the longest message, rather than all of them one after the other.
+class IRacMulti {
+ public:
+  // The default fits the longest A/C message. i.e. HITACHI_AC424 needs 855.
+  explicit IRacMulti(IRmultiSend *sender,
+                     const uint16_t size = kSendQueueBufferSize);
+  uint8_t sendAc(const ac_target_t targets[], const uint8_t count);
+  uint8_t getPasses(void) const;
+
+ private:
+  IRmultiSend *_sender;  ///< What the messages are sent with.
+  uint16_t _size;  ///< Nr. of entries in each rendered message's buffer.
+  uint8_t _passes;  ///< Nr. of passes the last `sendAc()` took.
+};
+
 /// Common functions for use with all A/Cs supported by the IRac class.
 namespace IRAcUtils {
 String resultAcToString(const decode_results * const results);
+bool resultAcToString(IRtextWriter *out,
+                      const decode_results * const results);
 bool decodeToState(const decode_results *decode, stdAc::state_t *result,
                    const stdAc::state_t *prev = NULL);
 }  // namespace IRAcUtils
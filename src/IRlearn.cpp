@@ -0,0 +1,271 @@
+// Copyright 2026 David Conran
+
+/// @file IRlearn.cpp
+/// @brief A store of learned IR codes, for remotes with an unknown protocol.
+
+#include "IRlearn.h"
+#include <string.h>
+#include <algorithm>
+#include "IRutils.h"
+
+// Ratio (in tenths) of a duration to the previous one, under which it is
+// shorter. `decodeHash()` uses 8.
+const uint8_t kLearnRatio = 7;
+
+/// Nr. of bytes needed to store a nr. of symbols. (2 bits per symbol)
+/// @param[in] length Nr. of symbols.
+/// @return Nr. of bytes.
+static inline uint32_t _symbolBytes(const uint16_t length) {
+  return (length + 3) / 4;
+}
+
+/// Class constructor.
+/// @param[in] capacity The maximum nr. of codes that can be learned.
+/// @param[in] poolsize The nr. of bytes to store the codes in. Each code needs
+///   a byte per 4 entries in its raw capture buffer.
+/// @param[in] maxsymbols The most symbols a capture can have. i.e. The size of
+///   the raw capture buffer, less 3. Longer captures are ignored.
+/// @note If it can't allocate the memory it needs, its capacity is 0.
+IRlearnedCodes::IRlearnedCodes(const uint16_t capacity,
+                               const uint32_t poolsize,
+                               const uint16_t maxsymbols) {
+  _capacity = std::min(capacity, static_cast<uint16_t>(kLearnNone - 1));
+  _poolsize = poolsize;
+  _maxsymbols = maxsymbols;
+  // Roughly a bucket per code, per band.
+  for (_nbuckets = 16; _nbuckets < _capacity && _nbuckets < 0x8000; )
+    _nbuckets <<= 1;
+  _codes = new learned_code_t[_capacity];
+  _heads = new uint16_t[kLearnBands * _nbuckets];
+  _counts = new uint16_t[kLearnBands * _nbuckets];
+  _stamps = new uint16_t[_capacity];
+  _pool = new uint8_t[_poolsize];
+  _scratch = new uint8_t[_symbolBytes(_maxsymbols)];
+  // Check we allocated the memory successfully.
+  if (_codes == NULL || _heads == NULL || _counts == NULL || _stamps == NULL ||
+      _pool == NULL || _scratch == NULL) {
+    DPRINTLN(
+        "Could not allocate memory for the learned IR codes.\n"
+        "Try a smaller capacity or poolsize.");
+    delete[] _codes;
+    delete[] _heads;
+    delete[] _counts;
+    delete[] _stamps;
+    delete[] _pool;
+    delete[] _scratch;
+    _codes = NULL;
+    _heads = NULL;
+    _counts = NULL;
+    _stamps = NULL;
+    _pool = NULL;
+    _scratch = NULL;
+    _capacity = 0;
+    _poolsize = 0;
+    _maxsymbols = 0;
+    _nbuckets = 0;
+  }
+  clear();
+}
+
+/// Class destructor.
+IRlearnedCodes::~IRlearnedCodes(void) {
+  delete[] _codes;
+  delete[] _heads;
+  delete[] _counts;
+  delete[] _stamps;
+  delete[] _pool;
+  delete[] _scratch;
+}
+
+/// Forget all the learned codes.
+void IRlearnedCodes::clear(void) {
+  _size = 0;
+  _used = 0;
+  _stamp = 0;
+  _candidates = 0;
+  if (!_capacity) return;  // Nothing was allocated.
+  for (uint32_t i = 0; i < kLearnBands * _nbuckets; i++) _heads[i] = kLearnNone;
+  memset(_counts, 0, kLearnBands * _nbuckets * sizeof(_counts[0]));
+  memset(_stamps, 0, _capacity * sizeof(_stamps[0]));
+}
+
+/// Get the nr. of learned codes.
+/// @return The nr. of codes.
+uint16_t IRlearnedCodes::size(void) const { return _size; }
+
+/// Get the maximum nr. of codes that can be learned.
+/// @return The nr. of codes.
+uint16_t IRlearnedCodes::capacity(void) const { return _capacity; }
+
+/// Get how many learned codes the last lookup compared the capture to.
+/// i.e. How well the index narrowed down the search.
+/// @return The nr. of codes compared.
+uint16_t IRlearnedCodes::candidates(void) const { return _candidates; }
+
+/// Nr. of symbols a capture has.
+/// The same comparisons as `IRrecv::decodeHash()`, including the trailing
+/// space, for the same reason.
+/// @param[in] results A ptr to the capture.
+/// @return The nr. of symbols.
+uint16_t IRlearnedCodes::symbolCount(const decode_results * const results) {
+  return (results->rawlen > 3) ? results->rawlen - 3 : 0;
+}
+
+/// Compare a duration to the previous one of the same type, with integers.
+/// @param[in] oldval Nr. of ticks in the previous duration.
+/// @param[in] newval Nr. of ticks in this duration.
+/// @return How it compares.
+learn_symbol_t IRlearnedCodes::symbol(const uint16_t oldval,
+                                      const uint16_t newval) {
+  if (newval * 10UL < oldval * (uint32_t)kLearnRatio) return kLearnShorter;
+  if (oldval * 10UL < newval * (uint32_t)kLearnRatio) return kLearnLonger;
+  return kLearnSame;
+}
+
+/// Count the nr. of symbols that differ between two codes.
+/// @param[in] a A ptr to the packed symbols of a code.
+/// @param[in] b A ptr to the packed symbols of the other code.
+/// @param[in] length The nr. of symbols in both codes.
+/// @param[in] limit Stop counting once it reaches this many.
+/// @return The nr. of differences found. (Up to about `limit`)
+uint16_t IRlearnedCodes::distance(const uint8_t * const a,
+                                  const uint8_t * const b,
+                                  const uint16_t length,
+                                  const uint16_t limit) {
+  const uint64_t lowbits = 0x5555555555555555ULL;  // The low bit of each.
+  const uint32_t nbytes = _symbolBytes(length);
+  uint16_t count = 0;
+  // 32 symbols at a time. The unused symbols at the end are 0 in both.
+  for (uint32_t i = 0; i < nbytes && count < limit; i += sizeof(uint64_t)) {
+    uint64_t x = 0;
+    uint64_t y = 0;
+    const uint32_t n = std::min(nbytes - i, (uint32_t)sizeof(uint64_t));
+    memcpy(&x, a + i, n);
+    memcpy(&y, b + i, n);
+    const uint64_t diff = x ^ y;
+    count += countBits((diff | (diff >> 1)) & lowbits, 64);
+  }
+  return count;
+}
+
+/// The bucket a band's key is in.
+/// @param[in] band The band of symbols the key is for.
+/// @param[in] key The hash key of the band.
+/// @return The index of the bucket in `_heads` & `_counts`.
+uint32_t IRlearnedCodes::_bucket(const uint8_t band, const uint32_t key) const {
+  return band * _nbuckets + (key & (_nbuckets - 1));
+}
+
+/// Calculate the packed symbols, & the index keys, of a capture.
+/// @param[in] results A ptr to the capture.
+/// @param[out] symbols Where to store the packed symbols.
+/// @param[out] keys Where to store the hash key of each band of symbols.
+void IRlearnedCodes::_fingerprint(const decode_results * const results,
+                                  uint8_t * const symbols,
+                                  uint32_t * const keys) const {
+  const uint16_t length = symbolCount(results);
+  for (uint8_t band = 0; band < kLearnBands; band++)
+    keys[band] = (kFnvBasis32 ^ length) * kFnvPrime32;
+  memset(symbols, 0, _symbolBytes(length));
+  for (uint16_t i = 0; i < length; i++) {
+    const learn_symbol_t sym = symbol(results->rawbuf[i + 1],
+                                      results->rawbuf[i + 3]);
+    symbols[i / 4] |= sym << ((i % 4) * 2);
+    uint32_t *key = &keys[i % kLearnBands];
+    *key = (*key ^ sym) * kFnvPrime32;
+  }
+}
+
+/// Learn a capture as a code.
+/// @param[in] results A ptr to the capture to learn.
+/// @param[in] id The id to return when a capture matches this code.
+/// @return true, if it was learned. false, if it was empty, too long, or there
+///   is no room.
+bool IRlearnedCodes::learn(const decode_results * const results,
+                           const uint32_t id) {
+  const uint16_t length = symbolCount(results);
+  const uint32_t nbytes = _symbolBytes(length);
+  if (!length || length > _maxsymbols || _size >= _capacity ||
+      _used + nbytes > _poolsize)
+    return false;
+  uint32_t keys[kLearnBands];
+  _fingerprint(results, _pool + _used, keys);
+  learned_code_t *code = &_codes[_size];
+  code->offset = _used;
+  code->id = id;
+  code->length = length;
+  for (uint8_t band = 0; band < kLearnBands; band++) {
+    const uint32_t bucket = _bucket(band, keys[band]);
+    code->next[band] = _heads[bucket];
+    _heads[bucket] = _size;
+    _counts[bucket]++;
+  }
+  _used += nbytes;
+  _size++;
+  return true;
+}
+
+/// Find the learned code nearest to a capture.
+/// @param[in] results A ptr to the capture to look up.
+/// @param[out] id Where to store the id of the nearest code.
+/// @param[out] distance Where to store the distance to it, if not NULL.
+///   i.e. How many of the symbols differed.
+/// @param[in] maxdistance The furthest a code can be & still match.
+/// @return true, if a code matched. Otherwise false. e.g. It was too long.
+/// @note Each symbol that differs changes the key of only one band. So a code
+///   `n` symbols away from the capture is in the same bucket as it in at least
+///   `kLearnBands - n` of the bands. Once we have searched more bands than the
+///   distance of the best code so far, no nearer code can be left. Thus it
+///   finds the nearest code, if it is less than `kLearnBands` away.
+///   If codes are equally near, the most recently learned one is found.
+bool IRlearnedCodes::lookup(const decode_results * const results,
+                            uint32_t *id, uint16_t *distance,
+                            const uint16_t maxdistance) {
+  _candidates = 0;
+  const uint16_t length = symbolCount(results);
+  // No learned code is longer than `_maxsymbols`, so neither can a match be.
+  if (!length || length > _maxsymbols || !_size) return false;
+  uint32_t keys[kLearnBands];
+  _fingerprint(results, _scratch, keys);
+  // Mark each code we compare with a nr. unique to this lookup, so codes that
+  // share more than one band with the capture are only compared once.
+  if (++_stamp == 0) {  // Wrapped around, so the old marks are ambiguous.
+    memset(_stamps, 0, _capacity * sizeof(_stamps[0]));
+    _stamp = 1;
+  }
+  // Search the smallest buckets first. Bands that are the same for lots of
+  // codes (e.g. all the marks of a protocol) are then often never needed.
+  uint32_t buckets[kLearnBands];
+  uint8_t order[kLearnBands];
+  for (uint8_t band = 0; band < kLearnBands; band++) {
+    buckets[band] = _bucket(band, keys[band]);
+    uint8_t pos = band;
+    for (; pos && _counts[buckets[order[pos - 1]]] > _counts[buckets[band]];
+         pos--)
+      order[pos] = order[pos - 1];
+    order[pos] = band;
+  }
+  uint16_t best = kLearnNone;
+  uint32_t best_distance = maxdistance + 1UL;
+  for (uint8_t n = 0; n < kLearnBands && n < best_distance; n++) {
+    const uint8_t band = order[n];
+    for (uint16_t i = _heads[buckets[band]];
+         i != kLearnNone && best_distance; i = _codes[i].next[band]) {
+      if (_stamps[i] == _stamp) continue;  // Already compared.
+      _stamps[i] = _stamp;
+      if (_codes[i].length != length) continue;
+      _candidates++;
+      const uint16_t d = IRlearnedCodes::distance(
+          _scratch, _pool + _codes[i].offset, length,
+          std::min(best_distance, (uint32_t)UINT16_MAX));
+      if (d < best_distance) {
+        best = i;
+        best_distance = d;
+      }
+    }
+  }
+  if (best == kLearnNone) return false;
+  *id = _codes[best].id;
+  if (distance != NULL) *distance = best_distance;
+  return true;
+}
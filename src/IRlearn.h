@@ -0,0 +1,99 @@
+// Copyright 2026 David Conran
+
+/// @file IRlearn.h
+/// @brief A store of learned IR codes, for remotes with an unknown protocol.
+/// It finds the stored code nearest to a new capture, even when some of the
+/// pulses in the capture are a little too short or too long.
+
+#ifndef IRLEARN_H_
+#define IRLEARN_H_
+
+#define __STDC_LIMIT_MACROS
+#include <stdint.h>
+#include "IRrecv.h"
+
+// Constants
+const uint8_t kLearnBands = 8;  ///< Nr. of hash tables each code is in.
+const uint16_t kLearnDefaultCapacity = 64;  ///< Default max nr. of codes.
+const uint32_t kLearnDefaultPoolSize = 4096;  ///< Default bytes of symbols.
+const uint16_t kLearnDefaultMaxDistance = 2;  ///< Default max mismatches.
+/// Default max nr. of symbols in a capture. i.e. A full default sized IRrecv
+/// capture buffer.
+const uint16_t kLearnDefaultMaxSymbols = kRawBuf - 3;
+const uint16_t kLearnNone = UINT16_MAX;  ///< Not the index of a learned code.
+
+/// The result of comparing a duration to the same type of duration after it.
+/// Like `IRrecv::decodeHash()`, but with thresholds half way (in ratio terms)
+/// between the same (1:1) & double (1:2) durations most protocols use. i.e.
+/// +/-15% of error in both durations can't change the result.
+enum learn_symbol_t {
+  kLearnShorter = 0,  ///< Under 70% of the previous one.
+  kLearnSame = 1,     ///< Between 70% & ~143% (i.e. 1 / 70%) of it.
+  kLearnLonger = 2,   ///< Over ~143% of the previous one.
+};
+
+/// A store of learned IR codes, which finds the nearest learned code to a
+/// capture.
+/// Each capture is fingerprinted like `IRrecv::decodeHash()` does, as the
+/// sequence of how each mark/space compares to the next mark/space, but with
+/// thresholds that timing errors rarely cross. The distance between two codes
+/// is the nr. of those symbols that differ. i.e. The Hamming distance.
+/// To avoid comparing a capture to every learned code, each code is indexed by
+/// the hashes of `kLearnBands` interleaved bands of its symbols. Only codes
+/// that share a band hash with the capture are compared. i.e. Locality
+/// Sensitive Hashing. A few flipped pulses only change some of the bands, &
+/// the bands with the fewest codes in their bucket are searched first.
+/// @note Captures must have the same nr. of pulses to match.
+class IRlearnedCodes {
+ public:
+  explicit IRlearnedCodes(const uint16_t capacity = kLearnDefaultCapacity,
+                          const uint32_t poolsize = kLearnDefaultPoolSize,
+                          const uint16_t maxsymbols = kLearnDefaultMaxSymbols);
+  ~IRlearnedCodes(void);
+  // It owns its tables, so copies would delete them twice.
+  IRlearnedCodes(const IRlearnedCodes &) = delete;
+  IRlearnedCodes &operator=(const IRlearnedCodes &) = delete;
+  bool learn(const decode_results * const results, const uint32_t id);
+  bool lookup(const decode_results * const results, uint32_t *id,
+              uint16_t *distance = NULL,
+              const uint16_t maxdistance = kLearnDefaultMaxDistance);
+  void clear(void);
+  uint16_t size(void) const;
+  uint16_t capacity(void) const;
+  uint16_t candidates(void) const;
+  static uint16_t symbolCount(const decode_results * const results);
+  static learn_symbol_t symbol(const uint16_t oldval, const uint16_t newval);
+  static uint16_t distance(const uint8_t * const a, const uint8_t * const b,
+                           const uint16_t length,
+                           const uint16_t limit = UINT16_MAX);
+#ifndef UNIT_TEST
+
+ private:
+#endif  // UNIT_TEST
+  /// A learned code.
+  typedef struct {
+    uint32_t offset;  ///< Where its symbols start in the pool.
+    uint32_t id;      ///< The id it was learned as.
+    uint16_t length;  ///< Nr. of symbols.
+    uint16_t next[kLearnBands];  ///< The next code in each band's bucket.
+  } learned_code_t;
+  learned_code_t *_codes;  ///< The learned codes.
+  uint16_t *_heads;   ///< The first code in each bucket, of each band.
+  uint16_t *_counts;  ///< The nr. of codes in each bucket, of each band.
+  uint16_t *_stamps;  ///< The lookup that last compared each code.
+  uint8_t *_pool;     ///< The packed symbols of all the learned codes.
+  uint8_t *_scratch;  ///< The packed symbols of the capture being looked up.
+  uint32_t _poolsize;     ///< Size of `_pool` in bytes.
+  uint32_t _used;         ///< Nr. of bytes of `_pool` in use.
+  uint16_t _maxsymbols;   ///< Max nr. of symbols in a capture.
+  uint16_t _capacity;     ///< Max nr. of codes.
+  uint16_t _size;         ///< Nr. of learned codes.
+  uint16_t _nbuckets;     ///< Nr. of buckets per band. A power of 2.
+  uint16_t _stamp;        ///< Nr. of the current lookup.
+  uint16_t _candidates;   ///< Nr. of codes compared by the last lookup.
+  uint32_t _bucket(const uint8_t band, const uint32_t key) const;
+  void _fingerprint(const decode_results * const results,
+                    uint8_t * const symbols, uint32_t * const keys) const;
+};
+
+#endif  // IRLEARN_H_
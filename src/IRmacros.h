@@ -50,4 +50,27 @@
  * end of COND() set of macros
  */
 
+/**
+ * REPEAT256() Expand a macro for each of 256 consecutive values.
+ * e.g. To fill a 256 entry lookup table at compile time.
+ *
+ * Usage:
+ * REPEAT256(<macro>, <first_value>)
+ * i.e. <macro>(<first_value>) <macro>(<first_value> + 1) ...
+ *      <macro>(<first_value> + 255)
+ */
+/// @cond TEST
+#define REPEAT4(M, B) M(B) M(B + 1) M(B + 2) M(B + 3)
+#define REPEAT16(M, B) \
+    REPEAT4(M, B) REPEAT4(M, B + 4) REPEAT4(M, B + 8) REPEAT4(M, B + 12)
+#define REPEAT64(M, B) \
+    REPEAT16(M, B) REPEAT16(M, B + 16) REPEAT16(M, B + 32) REPEAT16(M, B + 48)
+#define REPEAT256(M, B) \
+    REPEAT64(M, B) REPEAT64(M, B + 64) REPEAT64(M, B + 128) \
+    REPEAT64(M, B + 192)
+/// @endcond
+/**
+ * end of REPEAT256() set of macros
+ */
+
 #endif  // IRMACROS_H_
@@ -5,6 +5,7 @@
 
 #include "IRrecv.h"
 #include <stddef.h>
+#include <string.h>
 #ifndef UNIT_TEST
 #if defined(ESP8266)
 extern "C" {
@@ -17,9 +18,80 @@ extern "C" {
 #include <algorithm>
 #ifdef UNIT_TEST
 #include <cassert>
+#if ENABLE_DECODE_PROFILING
+#include <chrono>  // NOLINT(build/c++11)
+#endif  // ENABLE_DECODE_PROFILING
 #endif  // UNIT_TEST
 #include "IRremoteESP8266.h"
+#include "IRtimer.h"
 #include "IRutils.h"
+// For the timings the decoders are screened with.
+#include "ir_Airton.h"
+#include "ir_Amcor.h"
+#include "ir_Argo.h"
+#include "ir_Arris.h"
+#include "ir_BluestarHeavy.h"
+#include "ir_Bosch.h"
+#include "ir_Bose.h"
+#include "ir_Carrier.h"
+#include "ir_ClimaButler.h"
+#include "ir_Coolix.h"
+#include "ir_Corona.h"
+#include "ir_Daikin.h"
+#include "ir_Delonghi.h"
+#include "ir_Dish.h"
+#include "ir_Doshisha.h"
+#include "ir_Ecoclim.h"
+#include "ir_Electra.h"
+#include "ir_Eurom.h"
+#include "ir_Fujitsu.h"
+#include "ir_GICable.h"
+#include "ir_Goodweather.h"
+#include "ir_Gorenje.h"
+#include "ir_Gree.h"
+#include "ir_Haier.h"
+#include "ir_Hitachi.h"
+#include "ir_Inax.h"
+#include "ir_JVC.h"
+#include "ir_Kelon.h"
+#include "ir_Kelvinator.h"
+#include "ir_Lego.h"
+#include "ir_LG.h"
+#include "ir_Metz.h"
+#include "ir_Midea.h"
+#include "ir_MilesTag2.h"
+#include "ir_Mirage.h"
+#include "ir_Mitsubishi.h"
+#include "ir_MitsubishiHeavy.h"
+#include "ir_NEC.h"
+#include "ir_Neoclima.h"
+#include "ir_Nikai.h"
+#include "ir_Panasonic.h"
+#include "ir_Pioneer.h"
+#include "ir_RC5_RC6.h"
+#include "ir_RCMM.h"
+#include "ir_Rhoss.h"
+#include "ir_Samsung.h"
+#include "ir_Sanyo.h"
+#include "ir_Sharp.h"
+#include "ir_Sony.h"
+#include "ir_Tcl.h"
+#include "ir_Technibel.h"
+#include "ir_Teco.h"
+#include "ir_Teknopoint.h"
+#include "ir_Toshiba.h"
+#include "ir_Toto.h"
+#include "ir_Transcold.h"
+#include "ir_Trotec.h"
+#include "ir_Truma.h"
+#include "ir_Vestel.h"
+#include "ir_Voltas.h"
+#include "ir_Whirlpool.h"
+#include "ir_Whynter.h"
+#include "ir_Wowwee.h"
+#include "ir_Xmp.h"
+#include "ir_York.h"
+#include "ir_Zepeal.h"
 
 #if defined(ESP32)
 #if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) )
@@ -30,6 +102,11 @@ extern "C" {
 #ifdef UNIT_TEST
 #undef ICACHE_RAM_ATTR
 #define ICACHE_RAM_ATTR
+#define USE_IRAM_ATTR
+#define memcpy_P memcpy  // Host builds have no separate program memory.
+#endif
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
 #endif
 
 #ifndef USE_IRAM_ATTR
@@ -154,15 +231,105 @@ namespace _IRrecv {  // Namespace extension
 #if defined(ESP32)
 portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
 #endif  // ESP32
-atomic_irparams_t params;
-irparams_t *params_save;  // A copy of the interrupt state while decoding.
+// The interrupt state of the IRrecv instance that has the hardware.
+// i.e. The last one `enableIRIn()` was called on. Each instance has its own
+// state, but there is only one set of interrupts to feed them from.
+atomic_irparams_t *isr_params = NULL;
 }  // namespace _IRrecv
 
 #if defined(ESP32)
 using _IRrecv::mux;
 #endif  // ESP32
-using _IRrecv::params;
-using _IRrecv::params_save;
+using _IRrecv::isr_params;
+
+#if ENABLE_DECODE_PROFILING
+/// A stopwatch for profiling the decoders, in nano-Seconds.
+/// @note IRtimer is simulated when UNIT_TEST is defined (i.e. Unit tests &
+///   the host tools), so the host's real clock is used instead there.
+class DecodeTimer {
+ public:
+  DecodeTimer(void) {
+#ifdef UNIT_TEST
+    start = std::chrono::steady_clock::now();
+#endif  // UNIT_TEST
+  }
+  /// Calculate how many nano-Seconds have elapsed since the timer was created.
+  /// @return Nr. of nano-Seconds.
+  uint32_t elapsed(void) {
+#ifdef UNIT_TEST
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+#else  // UNIT_TEST
+    return timer.elapsed() * 1000;
+#endif  // UNIT_TEST
+  }
+
+ private:
+#ifdef UNIT_TEST
+  std::chrono::steady_clock::time_point start;
+#else  // UNIT_TEST
+  IRtimer timer;
+#endif  // UNIT_TEST
+};
+#endif  // ENABLE_DECODE_PROFILING
+
+/// Finish capturing the current message. i.e. The timeout has occurred.
+/// Without capture slots, capturing stops until `resume()` is called.
+/// With them, the message is left in its slot for `decode()`, and capturing
+/// carries on in the next free slot. If there isn't a free one, the message is
+/// dropped, & its slot is reused.
+/// @param[in,out] params A PTR to the interrupt state to finish capturing in.
+static void USE_IRAM_ATTR endCapture(atomic_irparams_t *params) {
+  if (!params->rawlen) return;  // Nothing has been captured yet.
+  if (!params->nslots) {
+    params->rcvstate = kStopState;
+    return;
+  }
+  if (params->overflow) params->overflows++;
+  uint8_t next = params->head + 1;
+  if (next >= params->nslots) next = 0;
+  if (next == params->tail) {  // Every other slot is waiting to be decoded.
+    params->drops++;
+  } else {
+    params->slots[params->head].rawlen = params->rawlen;
+    params->slots[params->head].overflow = params->overflow;
+    params->rawbuf = params->slots[next].rawbuf;
+    // The slot's entries & details aren't volatile, so make sure they are all
+    // written before decode() can see the new head. i.e. A release barrier.
+    __sync_synchronize();
+    params->head = next;  // Only now can decode() see the finished slot.
+  }
+  params->rawlen = 0;
+  params->overflow = false;
+  params->rcvstate = kIdleState;
+}
+
+/// Stop the interrupt handlers from changing the capture state, so the main
+/// loop can change it safely while they are armed.
+/// @note Keep it short, & always follow it with `unlockCapture()`.
+static inline void lockCapture(void) {
+#ifndef UNIT_TEST
+#if defined(ESP8266)
+  os_intr_lock();
+#endif  // ESP8266
+#if defined(ESP32)
+  portENTER_CRITICAL(&mux);
+#endif  // ESP32
+#endif  // UNIT_TEST
+}
+
+/// Let the interrupt handlers change the capture state again.
+/// @see lockCapture()
+static inline void unlockCapture(void) {
+#ifndef UNIT_TEST
+#if defined(ESP8266)
+  os_intr_unlock();
+#endif  // ESP8266
+#if defined(ESP32)
+  portEXIT_CRITICAL(&mux);
+#endif  // ESP32
+#endif  // UNIT_TEST
+}
 
 #ifndef UNIT_TEST
 #if defined(ESP8266)
@@ -181,7 +348,7 @@ static void USE_IRAM_ATTR read_timeout(void) {
 /// @endcond
   portENTER_CRITICAL(&mux);
 #endif  // ESP32
-  if (params.rawlen) params.rcvstate = kStopState;
+  if (isr_params != NULL) endCapture(isr_params);
 #if defined(ESP8266)
   os_intr_unlock();
 #endif  // ESP8266
@@ -201,36 +368,43 @@ static void USE_IRAM_ATTR gpio_intr() {
   GPIO_REG_WRITE(GPIO_STATUS_W1TC_ADDRESS, gpio_status);
 #endif  // ESP8266
 
+  // The state of the IRrecv we are capturing for. Only look it up once.
+  atomic_irparams_t *params = isr_params;
+  if (params == NULL) return;  // Nothing to capture into.
+
   // Grab a local copy of rawlen to reduce instructions used in IRAM.
   // This is an ugly premature optimisation code-wise, but we do everything we
   // can to save IRAM.
   // It seems referencing the value via the structure uses more instructions.
   // Less instructions means faster and less IRAM used.
   // N.B. It saves about 13 bytes of IRAM.
-  uint16_t rawlen = params.rawlen;
+  uint16_t rawlen = params->rawlen;
 
-  if (rawlen >= params.bufsize) {
-    params.overflow = true;
-    params.rcvstate = kStopState;
+  if (rawlen >= params->bufsize) {
+    params->overflow = true;
+    // With capture slots, let the timeout end the capture. Otherwise stop now.
+    if (!params->nslots) params->rcvstate = kStopState;
   }
 
-  if (params.rcvstate == kStopState) return;
+  if (params->rcvstate == kStopState) return;
 
-  if (params.rcvstate == kIdleState) {
-    params.rcvstate = kMarkState;
-    params.rawbuf[rawlen] = 1;
-  } else {
-    if (now < start)
-      params.rawbuf[rawlen] = (UINT32_MAX - start + now) / kRawTick;
-    else
-      params.rawbuf[rawlen] = (now - start) / kRawTick;
+  if (!params->overflow) {
+    if (params->rcvstate == kIdleState) {
+      params->rcvstate = kMarkState;
+      params->rawbuf[rawlen] = 1;
+    } else {
+      if (now < start)
+        params->rawbuf[rawlen] = (UINT32_MAX - start + now) / kRawTick;
+      else
+        params->rawbuf[rawlen] = (now - start) / kRawTick;
+    }
+    params->rawlen = params->rawlen + 1;  // C++20 fix
   }
-  params.rawlen = params.rawlen + 1;  // C++20 fix
 
   start = now;
 
 #if defined(ESP8266)
-  os_timer_arm(&timer, params.timeout, ONCE);
+  os_timer_arm(&timer, params->timeout, ONCE);
 #endif  // ESP8266
 #if defined(ESP32)
   // Reset the timeout.
@@ -312,6 +486,20 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
   // capture buffer.
   params.timeout = std::min(timeout, (uint8_t)kMaxTimeoutMs);
   params.rawbuf = new uint16_t[bufsize];
+  params.slots = NULL;
+  params.nslots = 0;
+  params.head = 0;
+  params.tail = 0;
+  params.drops = 0;
+  params.overflows = 0;
+  _slot_in_use = false;
+#if ENABLE_DECODE_PROFILING
+  resetDecodeProfile();
+#endif  // ENABLE_DECODE_PROFILING
+#if ENABLE_MATCH_TRACE
+  _trace_hook = NULL;
+  clearMatchTrace();
+#endif  // ENABLE_MATCH_TRACE
   if (params.rawbuf == NULL) {
     DPRINTLN(
         "Could not allocate memory for the primary IR buffer.\n"
@@ -322,10 +510,10 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
   }
   // If we have been asked to use a save buffer (for decoding), then create one.
   if (save_buffer) {
-    params_save = new irparams_t;
-    params_save->rawbuf = new uint16_t[bufsize];
+    irparams_save = new irparams_t;
+    irparams_save->rawbuf = new uint16_t[bufsize];
     // Check we allocated the memory successfully.
-    if (params_save->rawbuf == NULL) {
+    if (irparams_save->rawbuf == NULL) {
       DPRINTLN(
           "Could not allocate memory for the second IR buffer.\n"
           "Try a smaller size for CAPTURE_BUFFER_SIZE.\nRebooting!");
@@ -334,12 +522,21 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
 #endif
     }
   } else {
-    params_save = NULL;
+    irparams_save = NULL;
   }
 #if DECODE_HASH
   _unknown_threshold = kUnknownThreshold;
 #endif  // DECODE_HASH
   _tolerance = kTolerance;
+  _early_decode = false;
+  _early_rawlen = 0;
+  _pulses.valid = false;
+#ifdef UNIT_TEST
+  _decodeAttempts = 0;
+  _decodeCandidates = 0;
+  _screenDecoders = true;
+#endif  // UNIT_TEST
+  _indexDecoders();
 }
 
 /// Class destructor
@@ -348,16 +545,19 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
 /// timers or interrupts used.
 IRrecv::~IRrecv(void) {
   disableIRIn();
+  _freeSlots();
   delete[] params.rawbuf;
-  if (params_save != NULL) {
-    delete[] params_save->rawbuf;
-    delete params_save;
+  if (irparams_save != NULL) {
+    delete[] irparams_save->rawbuf;
+    delete irparams_save;
   }
 }
 
 /// Set up and (re)start the IR capture mechanism.
 /// @param[in] pullup A flag indicating should the GPIO use the internal pullup
 /// resistor. (Default: `false`. i.e. No.)
+/// @note Only one IRrecv instance can capture at a time, as there is only one
+///   set of timer & GPIO interrupts. It is the last one this was called on.
 void IRrecv::enableIRIn(const bool pullup) {
   // ESP32's seem to require explicitly setting the GPIO to INPUT etc.
   // This wasn't required on the ESP8266s, but it shouldn't hurt to make sure.
@@ -401,6 +601,7 @@ void IRrecv::enableIRIn(const bool pullup) {
 
   // Initialise state machine variables
   resume();
+  isr_params = &params;  // The interrupts now capture for us.
 
 #ifndef UNIT_TEST
 #if defined(ESP8266)
@@ -432,14 +633,17 @@ void IRrecv::disableIRIn(void) {
 #endif  // ESP32
   detachInterrupt(params.recvpin);
 #endif  // UNIT_TEST
+  if (isr_params == &params) isr_params = NULL;
 }
 
 /// Pause collection of received IR data.
 /// @see IRrecv class constructor
 void IRrecv::pause(void) {
+  lockCapture();
   params.rcvstate = kStopState;
   params.rawlen = 0;
   params.overflow = false;
+  unlockCapture();
 #if defined(ESP32)
   gpio_intr_disable((gpio_num_t)params.recvpin);
 #endif  // ESP32
@@ -450,9 +654,22 @@ void IRrecv::pause(void) {
 ///   not set when the class was instanciated.
 /// @see IRrecv class constructor
 void IRrecv::resume(void) {
+  // We are finished with the slot we were decoding.
+  if (params.nslots) _releaseSlot();
+  // The ISRs may still be armed. e.g. After an early decode. So don't let
+  // them see the new state until all of it is in place.
+  lockCapture();
+  // With capture slots, leave the ISR alone unless it has been stopped.
+  // e.g. By `pause()`.
+  if (params.nslots && params.rcvstate != kStopState) {
+    unlockCapture();
+    return;
+  }
   params.rcvstate = kIdleState;
   params.rawlen = 0;
   params.overflow = false;
+  unlockCapture();
+  _early_rawlen = 0;
 #if defined(ESP32)
   // Check for ESP32 core version and handle timer functions differently
 #if defined(_ESP32_ARDUINO_CORE_V3PLUS)
@@ -497,6 +714,268 @@ void IRrecv::copyIrParams(atomic_irparams_t *src, irparams_t *dst) {
 /// @return The size of the buffer that is in use by the object.
 uint16_t IRrecv::getBufSize(void) { return params.bufsize; }
 
+/// Set the nr. of capture slots to use.
+/// Normally there is only one capture buffer, and any messages that arrive
+/// while it is waiting to be decoded are lost. With capture slots, the
+/// interrupt handler moves on to the next free slot when a message is
+/// complete, and `decode()` decodes the captured slots, oldest first, in place.
+/// i.e. Up to `nr - 1` messages can be waiting to be decoded.
+/// e.g. A/C remotes that send several messages in quick succession.
+/// @param[in] nr The nr. of capture slots. Each one uses a capture buffer of
+///   `getBufSize()` entries. Less than 2 means only use the one buffer.
+/// @note Call this before `enableIRIn()`.
+/// @note With capture slots, there is no need for a save buffer (`save_buffer`)
+///   and early decoding (`setEarlyDecode()`) isn't performed.
+void IRrecv::setCaptureSlots(const uint8_t nr) {
+  _freeSlots();
+  if (nr < 2) return;
+  params.slots = new capture_slot_t[nr];
+  if (params.slots == NULL) {
+    DPRINTLN("Could not allocate memory for the IR capture slots.");
+    return;
+  }
+  // The first slot uses the capture buffer we already have.
+  params.slots[0].rawbuf = params.rawbuf;
+  for (uint8_t i = 1; i < nr; i++) {
+    params.slots[i].rawbuf = new uint16_t[params.bufsize];
+    if (params.slots[i].rawbuf == NULL) {
+      DPRINTLN(
+          "Could not allocate memory for an IR capture slot.\n"
+          "Try a smaller size for CAPTURE_BUFFER_SIZE.\nRebooting!");
+#ifndef UNIT_TEST
+      ESP.restart();  // Mem alloc failure. Reboot.
+#endif
+    }
+  }
+  for (uint8_t i = 0; i < nr; i++) {
+    params.slots[i].rawlen = 0;
+    params.slots[i].overflow = false;
+  }
+  params.head = 0;
+  params.tail = 0;
+  params.rawlen = 0;
+  params.overflow = false;
+  params.nslots = nr;
+}
+
+/// Get the nr. of capture slots in use.
+/// @return The nr. of capture slots. 0 if there is only a single buffer.
+uint8_t IRrecv::getCaptureSlots(void) { return params.nslots; }
+
+/// Get the nr. of messages that were lost because all the capture slots were
+/// waiting to be decoded.
+/// @return The nr. of dropped messages. (Only counted with capture slots.)
+uint16_t IRrecv::getDropCount(void) { return params.drops; }
+
+/// Get the nr. of messages that were too big for their capture slot.
+/// @return The nr. of overflowed messages. (Only counted with capture slots.)
+uint16_t IRrecv::getOverflowCount(void) { return params.overflows; }
+
+#if ENABLE_DECODE_PROFILING
+/// Get the decoding statistics collected for a protocol.
+/// @param[in] protocol The protocol to get the statistics of.
+/// @return The statistics since the last `resetDecodeProfile()`.
+decode_profile_t IRrecv::getDecodeProfile(const decode_type_t protocol) {
+  if (protocol > UNUSED && protocol <= kLastDecodeType)
+    return _profile[protocol];
+  decode_profile_t none = {0, 0, 0, 0, 0};
+  return none;
+}
+
+/// Clear all of the decoding statistics collected so far.
+void IRrecv::resetDecodeProfile(void) {
+  for (uint16_t i = 0; i <= kLastDecodeType; i++) {
+    _profile[i].attempts = 0;
+    _profile[i].successes = 0;
+    _profile[i].nsecs = 0;
+    _profile[i].rejects = 0;
+    _profile[i].reject_offsets = 0;
+  }
+  _profile_reject = NULL;
+}
+
+/// Describe the decoding statistics collected so far as a table.
+/// Only the protocols whose decoders have been tried are listed.
+/// @return A multi-line String containing the table.
+/// @note The "Reject at" column is the average capture offset at which the
+///   failed attempts gave up, where it is known.
+String IRrecv::decodeProfileToString(void) {
+  String output = "";
+  String value = "";
+  // Columns: 20 chars for the protocol name, then 10 chars per number.
+  output += F("Protocol              Attempts Successes     uSecs Reject at\n");
+  for (uint16_t i = 1; i <= kLastDecodeType; i++) {
+    const decode_profile_t *profile = &_profile[i];
+    if (!profile->attempts) continue;
+    value = typeToString((decode_type_t)i);
+    while (value.length() < 20) value += ' ';
+    output += value;
+    const uint64_t columns[3] = {profile->attempts, profile->successes,
+                                 profile->nsecs / 1000};
+    for (uint8_t c = 0; c < 3; c++) {
+      value = uint64ToString(columns[c]);
+      while (value.length() < 10) value = ' ' + value;
+      output += value;
+    }
+    if (profile->rejects)
+      value = uint64ToString(profile->reject_offsets / profile->rejects);
+    else
+      value = "-";  // Unknown.
+    while (value.length() < 10) value = ' ' + value;
+    output += value;
+    output += '\n';
+  }
+  return output;
+}
+
+/// Describe the decoding statistics collected so far as JSON.
+/// Only the protocols whose decoders have been tried are listed.
+/// @return A String containing a JSON array, with an object per protocol.
+String IRrecv::decodeProfileToJson(void) {
+  String output = "[";
+  for (uint16_t i = 1; i <= kLastDecodeType; i++) {
+    const decode_profile_t *profile = &_profile[i];
+    if (!profile->attempts) continue;
+    if (output.length() > 1) output += ',';
+    output += F("{\"protocol\":\"");
+    output += typeToString((decode_type_t)i);
+    output += F("\",\"attempts\":");
+    output += uint64ToString(profile->attempts);
+    output += F(",\"successes\":");
+    output += uint64ToString(profile->successes);
+    output += F(",\"usecs\":");
+    output += uint64ToString(profile->nsecs / 1000);
+    output += F(",\"rejects\":");
+    output += uint64ToString(profile->rejects);
+    output += F(",\"reject_offsets\":");
+    output += uint64ToString(profile->reject_offsets);
+    output += '}';
+  }
+  output += ']';
+  return output;
+}
+#endif  // ENABLE_DECODE_PROFILING
+
+#if ENABLE_MATCH_TRACE
+/// Get the number of matches currently held in the trace.
+/// @return The nr. of matches, up to `kMatchTraceLength`.
+uint16_t IRrecv::getMatchTraceCount(void) {
+  return std::min(_trace_count, (uint32_t)kMatchTraceLength);
+}
+
+/// Get one of the matches held in the trace.
+/// @param[in] index Which match. 0 is the oldest one held.
+/// @return The details of the match. An out of range index returns a
+///   non-matching entry for UNKNOWN with all the values zeroed.
+match_trace_t IRrecv::getMatchTrace(const uint16_t index) {
+  const uint16_t count = getMatchTraceCount();
+  if (index < count)
+    return _trace[(_trace_count - count + index) % kMatchTraceLength];
+  match_trace_t none = {UNKNOWN, 0, 0, 0, 0, 0, false};
+  return none;
+}
+
+/// Discard all of the matches traced so far.
+void IRrecv::clearMatchTrace(void) {
+  _trace_count = 0;
+  _traceDecoder(UNKNOWN, 0);
+}
+
+/// Set a function to be called with each match as it is traced.
+/// e.g. To log or count them somewhere other than the trace.
+/// @param[in] hook The function to call. NULL means don't call anything.
+/// @note It is called from within the decoders, so it should be quick.
+void IRrecv::setMatchTraceHook(const match_trace_hook_t hook) {
+  _trace_hook = hook;
+}
+
+/// Describe the matches held in the trace as a table, oldest first.
+/// @return A multi-line String containing the table.
+/// @note A "Max" of "-" means there was no upper limit. e.g. A gap.
+String IRrecv::matchTraceToString(void) {
+  String output = "";
+  String value = "";
+  // Columns: 20 chars for the protocol name, then 8 chars per number.
+  output += F("Protocol              Offset    Step   uSecs     Min     Max"
+              " Matched\n");
+  for (uint16_t i = 0; i < getMatchTraceCount(); i++) {
+    const match_trace_t trace = getMatchTrace(i);
+    value = typeToString(trace.protocol);
+    while (value.length() < 20) value += ' ';
+    output += value;
+    const uint32_t columns[5] = {trace.offset, trace.step, trace.measured,
+                                 trace.low, trace.high};
+    for (uint8_t c = 0; c < 5; c++) {
+      if (c == 4 && trace.high == UINT32_MAX)
+        value = "-";  // No limit.
+      else
+        value = uint64ToString(columns[c]);
+      while (value.length() < 8) value = ' ' + value;
+      output += value;
+    }
+    output += trace.matched ? F("     Yes\n") : F("      No\n");
+  }
+  return output;
+}
+#endif  // ENABLE_MATCH_TRACE
+
+/// Free the capture slots, and go back to using a single capture buffer.
+void IRrecv::_freeSlots(void) {
+  if (params.slots == NULL) return;
+  const uint8_t nslots = params.nslots;
+  params.nslots = 0;
+  // Keep the first slot's buffer, as that's the one we started with.
+  params.rawbuf = params.slots[0].rawbuf;
+  for (uint8_t i = 1; i < nslots; i++) delete[] params.slots[i].rawbuf;
+  delete[] params.slots;
+  params.slots = NULL;
+  params.rawlen = 0;
+  params.overflow = false;
+  _slot_in_use = false;
+}
+
+/// Get the oldest captured message from the capture slots for decoding.
+/// @param[out] results A PTR to where the captured message will be pointed at.
+/// @param[out] save A PTR to an irparams_t instance to copy the message to.
+///   NULL means decode it in place. i.e. Don't copy it.
+/// @return true if there is a message to decode, otherwise false.
+bool IRrecv::_readSlot(decode_results *results, irparams_t *save) {
+  _releaseSlot();  // We must be finished with the previous one by now.
+  if (params.tail == params.head) return false;  // Nothing captured yet.
+  // Don't read anything in the slot before we've seen the ISR's head move
+  // past it. i.e. An acquire barrier. Pairs with the one in `endCapture()`.
+  __sync_synchronize();
+  const capture_slot_t *slot = &params.slots[params.tail];
+  // Clear the entry after the capture. See `decode()` for why.
+  if (!slot->overflow && slot->rawlen < params.bufsize)
+    slot->rawbuf[slot->rawlen] = 0;
+  results->rawlen = slot->rawlen;
+  results->overflow = slot->overflow;
+  _slot_in_use = true;  // The slot is ours until `_releaseSlot()`.
+  if (save == NULL) {
+    results->rawbuf = slot->rawbuf;  // Decode it in place.
+  } else {
+    for (uint16_t i = 0; i < slot->rawlen; i++)
+      save->rawbuf[i] = slot->rawbuf[i];
+    save->rawlen = slot->rawlen;
+    save->overflow = slot->overflow;
+    results->rawbuf = save->rawbuf;
+    _releaseSlot();  // We have a copy, so the ISR can have it back.
+  }
+  return true;
+}
+
+/// Give the capture slot we are decoding back to the interrupt handler.
+void IRrecv::_releaseSlot(void) {
+  if (!_slot_in_use) return;
+  _slot_in_use = false;
+  uint8_t next = params.tail + 1;
+  if (next >= params.nslots) next = 0;
+  // Finish with the slot before the ISR can reuse it.
+  __sync_synchronize();
+  params.tail = next;
+}
+
 #if DECODE_HASH
 /// Set the minimum length we will consider for reporting UNKNOWN message types.
 /// @param[in] length Min nr. of mark/space pulses required to be considered.
@@ -516,6 +995,28 @@ void IRrecv::setTolerance(const uint8_t percent) {
 /// @return A integer percentage.
 uint8_t IRrecv::getTolerance(void) { return _tolerance; }
 
+/// Set if `decode()` should try to decode a message while it is still being
+/// captured. i.e. Before the timeout period after the message has passed.
+/// This removes the timeout from the delay between the end of a message and
+/// `decode()` reporting it. e.g. Button press to action latency for TV remotes.
+/// @param[in] enable true to decode early where possible, false to always wait
+///   for the timeout.
+/// @note Only protocols that have a fixed length & end with a mark can be
+///   decoded early. i.e. NEC & Samsung. All others are still decoded after the
+///   timeout as normal. e.g. Sony, RC5 & RC6 messages can't be, as we can't
+///   tell how many bits they have until the timeout occurs. (RC6 Mode 0's 20
+///   bits are also the start of a RC6-36 (MCE) message.)
+/// @warning A message that starts the same way as one of those protocols, but
+///   is longer, may be reported as the shorter protocol. e.g. Sanyo LC7461 and
+///   Aiwa RC T501 messages may be reported as NEC. The rest of the message is
+///   discarded.
+void IRrecv::setEarlyDecode(const bool enable) { _early_decode = enable; }
+
+/// Get if `decode()` will try to decode a message while it is still being
+/// captured.
+/// @return true if it will, false if it waits for the timeout.
+bool IRrecv::getEarlyDecode(void) { return _early_decode; }
+
 #if ENABLE_NOISE_FILTER_OPTION
 /// Remove or merge pulses in the capture buffer that are too short.
 /// @param[in,out] results Ptr to the decode_results we are going to filter.
@@ -547,298 +1048,193 @@ void IRrecv::crudeNoiseFilter(decode_results *results, const uint16_t floor) {
 }
 #endif  // ENABLE_NOISE_FILTER_OPTION
 
-/// Decodes the received IR message.
-/// If the interrupt state is saved, we will immediately resume waiting
-/// for the next IR message to avoid missing messages.
-/// @note There is a trade-off here. Saving the state means less time lost until
-/// we can receiving the next message vs. using more RAM. Choose appropriately.
-/// @param[out] results A PTR to where the decoded IR message will be stored.
-/// @param[out] save A PTR to an irparams_t instance in which to save
-///   the interrupt's memory/state. NULL means don't save it.
-/// @param[in] max_skip Maximum Nr. of pulses at the begining of a capture we
-///   can skip when attempting to find a protocol we can successfully decode.
-///   This parameter can dramatically improve detection of protocols
-///   when there is light IR interference just before an incoming IR
-///   message, however, it comes at a steep performace price.
-///   (Default is 0. No skipping.)
-/// @warning Increasing the `max_skip` value will dramatically (linearly)
-///   increase the cpu time & usage to decode protocols.
-///   e.g. 0 -> 1 will be a 2x increase in cpu usage/time.
-///        0 -> 2 will be a 3x increase etc.
-///   If you are going to do this, consider disabling protocol decoding for
-///   protocols you are not expecting.
-/// @param[in] noise_floor Pulses below this size (in usecs) will be removed or
-///   merged prior to any decoding. This is to try to remove noise/poor
-///   readings & slightly increase the chances of a successful decode but at the
-///   cost of data fidelity & integrity.
-///   (Defaults to 0 usecs. i.e. Don't filter; which is safe!)
-/// @warning DANGER: **Here Be Dragons!**
-///   If you set the `noise_floor` value too high, it **WILL** break decoding
-///   of some protocols. You have been warned!
-///   **Any** non-zero value has the potential to **cook** the captured raw data
-///   i.e. The raw data is going to lie to you.
-///   It may obscure hardware, circuit, & environment issues thus making it
-///   impossible to support you accurately or confidently.
-///     Values of <= 50 usecs will probably be safe.
-///     51 - 100 usecs **might** be okay.
-///     100 - 150 usecs is "Danger, Will Robinson!".
-///     150 - 200 usecs expect broken protocols.
-///     At 200+ usecs, you **have** protocols you can't decode!!
-/// @return A boolean indicating if an IR message is ready or not.
-bool IRrecv::decode(decode_results *results, irparams_t *save,
-                    uint8_t max_skip, uint16_t noise_floor) {
-  // Proceed only if an IR message been received.
-#ifndef UNIT_TEST
-  if (params.rcvstate != kStopState) return false;
-#endif
-
-  // Clear the entry we are currently pointing to when we got the timeout.
-  // i.e. Stopped collecting IR data.
-  // It's junk as we never wrote an entry to it and can only confuse decoding.
-  // This is done here rather than logically the best place in read_timeout()
-  // as it saves a few bytes of ICACHE_RAM as that routine is bound to an
-  // interrupt. decode() is not stored in ICACHE_RAM.
-  // Another better option would be to zero the entire irparams.rawbuf[] on
-  // resume() but that is a much more expensive operation compare to this.
-  // However, don't do this if rawbuf is already full as we stomp over the heap.
-  // See: https://github.com/crankyoldgit/IRremoteESP8266/issues/1516
-  // Also guard against rawlen == bufsize (with overflow still false), which
-  // occurs because the ISR increments rawlen *after* writing the last entry.
-  // Writing rawbuf[bufsize] would be an off-by-one heap overflow.
-  // See: https://github.com/crankyoldgit/IRremoteESP8266/issues/2198
-  if (!params.overflow && params.rawlen < params.bufsize)
-    params.rawbuf[params.rawlen] = 0;
-
-  bool resumed = false;  // Flag indicating if we have resumed.
-
-  // If we were requested to use a save buffer previously, do so.
-  if (save == NULL) save = params_save;
-
-  if (save == NULL) {
-    // We haven't been asked to copy it so use the existing memory.
-#ifndef UNIT_TEST
-    results->rawbuf = params.rawbuf;
-    results->rawlen = params.rawlen;
-    results->overflow = params.overflow;
-#endif
-  } else {
-    copyIrParams(&params, save);  // Duplicate the interrupt's memory.
-    resume();  // It's now safe to rearm. The IR message won't be overridden.
-    resumed = true;
-    // Point the results at the saved copy.
-    results->rawbuf = save->rawbuf;
-    results->rawlen = save->rawlen;
-    results->overflow = save->overflow;
-  }
-
-  // Reset any previously partially processed results.
-  results->decode_type = UNKNOWN;
-  results->bits = 0;
-  results->value = 0;
-  results->address = 0;
-  results->command = 0;
-  results->repeat = false;
-
-#if ENABLE_NOISE_FILTER_OPTION
-  crudeNoiseFilter(results, noise_floor);
-#endif  // ENABLE_NOISE_FILTER_OPTION
-  // Keep looking for protocols until we've run out of entries to skip or we
-  // find a valid protocol message.
-  for (uint16_t offset = kStartOffset;
-       offset <= (max_skip * 2) + kStartOffset;
-       offset += 2) {
+/// The ordered table of protocol decoders `decode()` tries at each offset.
+/// @note The order matters! Where protocols look alike, the more specific one
+///   must come first. See the comments on each entry, and the
+///   `TestDecodeTable` unit tests which enforce the important orderings.
+/// @note The header mark & space are only used to cheaply reject a decoder
+///   before calling it. They must be loose enough to never reject a message the
+///   decoder would accept. Use 0 for any decoder whose message doesn't start
+///   with a fixed timing (e.g. Manchester coded, or has alternate headers).
+/// @note Typically new protocols are added at the end of this table.
+const IRrecv::decoder_entry_t IRrecv::_decoders[] PROGMEM = {
 #if DECODE_AIWA_RC_T501
-    DPRINTLN("Attempting Aiwa RC T501 decode");
     // Try decodeAiwaRCT501() before decodeSanyoLC7461() & decodeNEC()
     // because the protocols are similar. This protocol is more specific than
     // those ones, so should go before them.
-    if (decodeAiwaRCT501(results, offset)) return true;
+    {AIWA_RC_T501, &IRrecv::decodeAiwaRCT501, kAiwaRcT501Bits, true,
+     kNecHdrMark, 0},
 #endif
 #if DECODE_SANYO
-    DPRINTLN("Attempting Sanyo LC7461 decode");
     // Try decodeSanyoLC7461() before decodeNEC() because the protocols are
     // similar in timings & structure, but the Sanyo one is much longer than the
     // NEC protocol (42 vs 32 bits) so this one should be tried first to try to
     // reduce false detection as a NEC packet.
-    if (decodeSanyoLC7461(results, offset)) return true;
+    {SANYO_LC7461, &IRrecv::decodeSanyoLC7461, kSanyoLC7461Bits, true,
+     kSanyoLc7461HdrMark, 0},
 #endif
 #if DECODE_CARRIER_AC
-    DPRINTLN("Attempting Carrier AC decode");
     // Try decodeCarrierAC() before decodeNEC() because the protocols are
     // similar in timings & structure, but the Carrier one is much longer than
     // the NEC protocol (3x32 bits vs 1x32 bits) so this one should be tried
     // first to try to reduce false detection as a NEC packet.
-    if (decodeCarrierAC(results, offset)) return true;
+    {CARRIER_AC, &IRrecv::decodeCarrierAC, kCarrierAcBits, true,
+     kCarrierAcHdrMark, kCarrierAcHdrSpace},
 #endif
 #if DECODE_PIONEER
-    DPRINTLN("Attempting Pioneer decode");
     // Try decodePioneer() before decodeNEC() because the protocols are
     // similar in timings & structure, but the Pioneer one is much longer than
     // the NEC protocol (2x32 bits vs 1x32 bits) so this one should be tried
     // first to try to reduce false detection as a NEC packet.
-    if (decodePioneer(results, offset)) return true;
+    {PIONEER, &IRrecv::decodePioneer, kPioneerBits, true,
+     kPioneerHdrMark, kPioneerHdrSpace},
 #endif
 #if DECODE_EPSON
-  DPRINTLN("Attempting Epson decode");
-  // Try decodeEpson() before decodeNEC() because the protocols are
-  // similar in timings & structure, but the Epson one is much longer than the
-  // NEC protocol (3x32 identical bits vs 1x32 bits) so this one should be tried
-  // first to try to reduce false detection as a NEC packet.
-  if (decodeEpson(results, offset)) return true;
+    // Try decodeEpson() before decodeNEC() because the protocols are
+    // similar in timings & structure, but the Epson one is much longer than the
+    // NEC protocol (3x32 identical bits vs 1x32 bits) so this one should be
+    // tried first to try to reduce false detection as a NEC packet.
+    {EPSON, &IRrecv::decodeEpson, kEpsonBits, true,
+     kNecHdrMark, kNecHdrSpace},
 #endif
 #if DECODE_NEC
-    DPRINTLN("Attempting NEC decode");
-    if (decodeNEC(results, offset)) return true;
+    {NEC, &IRrecv::decodeNEC, kNECBits, true, kNecHdrMark, 0},
 #endif
 #if DECODE_MILESTAG2
-    DPRINTLN("Attempting MilesTag2 decode");
-  // Try decodeMilestag2() before decodeSony() because the protocols are
-  // similar in timings & structure, but the Miles one differs in nbits
-  // so this one should be tried first to try to reduce false detection
-    if (decodeMilestag2(results, offset, kMilesTag2MsgBits) ||
-        decodeMilestag2(results, offset, kMilesTag2ShotBits)) return true;
-#endif
+    // Try decodeMilestag2() before decodeSony() because the protocols are
+    // similar in timings & structure, but the Miles one differs in nbits
+    // so this one should be tried first to try to reduce false detection
+    {MILESTAG2, &IRrecv::decodeMilestag2, kMilesTag2MsgBits, true,
+     kMilesTag2HdrMark, kMilesTag2Space},
+    {MILESTAG2, &IRrecv::decodeMilestag2, kMilesTag2ShotBits, true,
+     kMilesTag2HdrMark, kMilesTag2Space},
+#endif  // DECODE_MILESTAG2
 #if DECODE_SONY
-    DPRINTLN("Attempting Sony decode");
-    if (decodeSony(results, offset)) return true;
+    {SONY, &IRrecv::decodeSony, kSonyMinBits, false, kSonyHdrMark, 0},
 #endif
 #if DECODE_MITSUBISHI
-    DPRINTLN("Attempting Mitsubishi decode");
-    if (decodeMitsubishi(results, offset)) return true;
+    {MITSUBISHI, &IRrecv::decodeMitsubishi, kMitsubishiBits, true, 0, 0},
 #endif
 #if DECODE_MITSUBISHI_AC
-    DPRINTLN("Attempting Mitsubishi AC decode");
-    if (decodeMitsubishiAC(results, offset)) return true;
+    {MITSUBISHI_AC, &IRrecv::decodeMitsubishiAC, kMitsubishiACBits, false,
+     kMitsubishiAcHdrMark, kMitsubishiAcHdrSpace},
 #endif
 #if DECODE_MITSUBISHI2
-    DPRINTLN("Attempting Mitsubishi2 decode");
-    if (decodeMitsubishi2(results, offset)) return true;
+    {MITSUBISHI2, &IRrecv::decodeMitsubishi2, kMitsubishiBits, true,
+     kMitsubishi2HdrMark, kMitsubishi2HdrSpace},
 #endif
 #if DECODE_RC5
-    DPRINTLN("Attempting RC5 decode");
-    if (decodeRC5(results, offset)) return true;
+    {RC5, &IRrecv::decodeRC5, kRC5XBits, true, 0, 0},
 #endif
 #if DECODE_RC6
-    DPRINTLN("Attempting RC6 decode");
-    if (decodeRC6(results, offset)) return true;
+    {RC6, &IRrecv::decodeRC6, kRC6Mode0Bits, false, kRc6HdrMark, 0},
 #endif
 #if DECODE_RCMM
-    DPRINTLN("Attempting RC-MM decode");
-    if (decodeRCMM(results, offset)) return true;
+    {RCMM, &IRrecv::decodeRCMM, kRCMMBits, false, kRcmmHdrMark, 0},
 #endif
 #if DECODE_FUJITSU_AC
     // Fujitsu A/C needs to precede Panasonic and Denon as it has a short
     // message which looks exactly the same as a Panasonic/Denon message.
-    DPRINTLN("Attempting Fujitsu A/C decode");
-    if (decodeFujitsuAC(results, offset)) return true;
+    {FUJITSU_AC, &IRrecv::decodeFujitsuAC, kFujitsuAcBits, false,
+     kFujitsuAcHdrMark, kFujitsuAcHdrSpace},
 #endif
 #if DECODE_DENON
     // Denon needs to precede Panasonic as it is a special case of Panasonic.
-    DPRINTLN("Attempting Denon decode");
-    if (decodeDenon(results, offset, kDenon48Bits) ||
-        decodeDenon(results, offset, kDenonBits) ||
-        decodeDenon(results, offset, kDenonLegacyBits))
-      return true;
-#endif
+    {DENON, &IRrecv::decodeDenon, kDenon48Bits, true, 0, 0},
+    {DENON, &IRrecv::decodeDenon, kDenonBits, true, 0, 0},
+    {DENON, &IRrecv::decodeDenon, kDenonLegacyBits, true, 0, 0},
+#endif  // DECODE_DENON
 #if DECODE_PANASONIC
-    DPRINTLN("Attempting Panasonic (48-bit) decode");
-    if (decodePanasonic(results, offset)) return true;
-    DPRINTLN("Attempting Panasonic (40-bit) decode");
-    if (decodePanasonic(results, offset, kPanasonic40Bits, true,
-                        kPanasonic40Manufacturer)) return true;
+    {PANASONIC, &IRrecv::_decodePanasonic, kPanasonicBits, false,
+     kPanasonicHdrMark, kPanasonicHdrSpace},
+    {PANASONIC, &IRrecv::_decodePanasonic, kPanasonic40Bits, true,
+     kPanasonicHdrMark, kPanasonicHdrSpace},
 #endif  // DECODE_PANASONIC
 #if DECODE_LG
-    DPRINTLN("Attempting LG (28-bit) decode");
-    if (decodeLG(results, offset, kLgBits, true)) return true;
-    DPRINTLN("Attempting LG (32-bit) decode");
+    {LG, &IRrecv::decodeLG, kLgBits, true, 0, 0},
     // LG32 should be tried before Samsung
-    if (decodeLG(results, offset, kLg32Bits, true)) return true;
-#endif
+    {LG, &IRrecv::decodeLG, kLg32Bits, true, 0, 0},
+#endif  // DECODE_LG
 #if DECODE_GICABLE
     // Note: Needs to happen before JVC decode, because it looks similar except
     //       with a required NEC-like repeat code.
-    DPRINTLN("Attempting GICable decode");
-    if (decodeGICable(results, offset)) return true;
+    {GICABLE, &IRrecv::decodeGICable, kGicableBits, true,
+     kGicableHdrMark, kGicableHdrSpace},
 #endif
 #if DECODE_JVC
-    DPRINTLN("Attempting JVC decode");
-    if (decodeJVC(results, offset)) return true;
+    {JVC, &IRrecv::decodeJVC, kJvcBits, true, 0, 0},
 #endif
 #if DECODE_SAMSUNG
-    DPRINTLN("Attempting SAMSUNG decode");
-    if (decodeSAMSUNG(results, offset)) return true;
+    {SAMSUNG, &IRrecv::decodeSAMSUNG, kSamsungBits, true,
+     kSamsungHdrMark, kSamsungHdrSpace},
 #endif
 #if DECODE_SAMSUNG36
-    DPRINTLN("Attempting Samsung36 decode");
-    if (decodeSamsung36(results, offset)) return true;
+    {SAMSUNG36, &IRrecv::decodeSamsung36, kSamsung36Bits, true,
+     kSamsung36HdrMark, kSamsung36HdrSpace},
 #endif
 #if DECODE_WHYNTER
-    DPRINTLN("Attempting Whynter decode");
-    if (decodeWhynter(results, offset)) return true;
+    {WHYNTER, &IRrecv::decodeWhynter, kWhynterBits, true,
+     kWhynterBitMark, kWhynterZeroSpace},
 #endif
 #if DECODE_DISH
-    DPRINTLN("Attempting DISH decode");
-    if (decodeDISH(results, offset)) return true;
+    {DISH, &IRrecv::decodeDISH, kDishBits, true,
+     kDishHdrMark, kDishHdrSpace},
 #endif
 #if DECODE_SHARP
-    DPRINTLN("Attempting Sharp decode");
-    if (decodeSharp(results, offset)) return true;
+    {SHARP, &IRrecv::_decodeSharp, kSharpBits, true, 0, 0},
 #endif
 #if DECODE_BOSCH144
-    DPRINTLN("Attempting Bosch 144-bit decode");
     // Bosch is similar to Coolix, so it must be attempted before decodeCOOLIX.
-    if (decodeBosch144(results, offset)) return true;
-#endif  // DECODE_BOSCH144
+    {BOSCH144, &IRrecv::decodeBosch144, kBosch144Bits, true,
+     kBoschHdrMark, kBoschHdrSpace},
+#endif
 #if DECODE_COOLIX
-    DPRINTLN("Attempting Coolix 24-bit decode");
-    if (decodeCOOLIX(results, offset)) return true;
-#endif  // DECODE_COOLIX
+    {COOLIX, &IRrecv::decodeCOOLIX, kCoolixBits, true,
+     kCoolixHdrMark, kCoolixHdrSpace},
+#endif
 #if DECODE_NIKAI
-    DPRINTLN("Attempting Nikai decode");
-    if (decodeNikai(results, offset)) return true;
+    {NIKAI, &IRrecv::decodeNikai, kNikaiBits, true,
+     kNikaiHdrMark, kNikaiHdrSpace},
 #endif
 #if DECODE_KELVINATOR
     // Kelvinator based-devices use a similar code to Gree ones, to avoid false
     // matches this needs to happen before decodeGree().
-    DPRINTLN("Attempting Kelvinator decode");
-    if (decodeKelvinator(results, offset)) return true;
+    {KELVINATOR, &IRrecv::decodeKelvinator, kKelvinatorBits, true,
+     kKelvinatorHdrMark, kKelvinatorHdrSpace},
 #endif
 #if DECODE_DAIKIN
-    DPRINTLN("Attempting Daikin decode");
-    if (decodeDaikin(results, offset)) return true;
+    {DAIKIN, &IRrecv::decodeDaikin, kDaikinBits, true,
+     kDaikinBitMark, kDaikinZeroSpace},
 #endif
 #if DECODE_DAIKIN2
-    DPRINTLN("Attempting Daikin2 decode");
-    if (decodeDaikin2(results, offset)) return true;
+    {DAIKIN2, &IRrecv::decodeDaikin2, kDaikin2Bits, true,
+     kDaikin2LeaderMark, kDaikin2LeaderSpace},
 #endif
 #if DECODE_DAIKIN216
-    DPRINTLN("Attempting Daikin216 decode");
-    if (decodeDaikin216(results, offset)) return true;
+    {DAIKIN216, &IRrecv::decodeDaikin216, kDaikin216Bits, true,
+     kDaikin216HdrMark, kDaikin216HdrSpace},
 #endif
 #if DECODE_TOSHIBA_AC
-    DPRINTLN("Attempting Toshiba AC 72bit decode");
-    if (decodeToshibaAC(results, offset)) return true;
-    DPRINTLN("Attempting Toshiba AC 80bit decode");
-    if (decodeToshibaAC(results, offset, kToshibaACBitsLong)) return true;
-    DPRINTLN("Attempting Toshiba AC 56bit decode");
-    if (decodeToshibaAC(results, offset, kToshibaACBitsShort)) return true;
-#endif
+    {TOSHIBA_AC, &IRrecv::decodeToshibaAC, kToshibaACBits, true,
+     kToshibaAcHdrMark, kToshibaAcHdrSpace},
+    {TOSHIBA_AC, &IRrecv::decodeToshibaAC, kToshibaACBitsLong, true,
+     kToshibaAcHdrMark, kToshibaAcHdrSpace},
+    {TOSHIBA_AC, &IRrecv::decodeToshibaAC, kToshibaACBitsShort, true,
+     kToshibaAcHdrMark, kToshibaAcHdrSpace},
+#endif  // DECODE_TOSHIBA_AC
 #if DECODE_MIDEA
-    DPRINTLN("Attempting Midea decode");
-    if (decodeMidea(results, offset)) return true;
+    {MIDEA, &IRrecv::decodeMidea, kMideaBits, true,
+     kMideaHdrMark, kMideaHdrSpace},
 #endif
 #if DECODE_MAGIQUEST
-    DPRINTLN("Attempting Magiquest decode");
-    if (decodeMagiQuest(results, offset)) return true;
+    {MAGIQUEST, &IRrecv::decodeMagiQuest, kMagiquestBits, true, 0, 0},
 #endif
   /* NOTE: Disabled due to poor quality.
 #if DECODE_SANYO
     // The Sanyo S866500B decoder is very poor quality & depricated.
     // *IF* you are going to enable it, do it near last to avoid false positive
     // matches.
-    DPRINTLN("Attempting Sanyo SA8650B decode");
-    if (decodeSanyo(results, offset))
-      return true;
+    {SANYO, &IRrecv::decodeSanyo, kSanyoSA8650BBits, false, 0, 0},
 #endif
   */
 #if DECODE_NEC
@@ -847,467 +1243,1286 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // This needs to be done after all other codes that use strict and some
     // other protocols that are NEC-like as well, as turning off strict may
     // cause this to match other valid protocols.
-    DPRINTLN("Attempting NEC (non-strict) decode");
-    if (decodeNEC(results, offset, kNECBits, false)) {
-      results->decode_type = NEC_LIKE;
-      return true;
-    }
+    {NEC_LIKE, &IRrecv::_decodeNECLike, kNECBits, false,
+     kNecHdrMark, 0},
 #endif
 #if DECODE_LASERTAG
-    DPRINTLN("Attempting Lasertag decode");
-    if (decodeLasertag(results, offset)) return true;
+    {LASERTAG, &IRrecv::decodeLasertag, kLasertagBits, true, 0, 0},
 #endif
 #if DECODE_GREE
     // Gree based-devices use a similar code to Kelvinator ones, to avoid false
     // matches this needs to happen after decodeKelvinator().
-    DPRINTLN("Attempting Gree decode");
-    if (decodeGree(results, offset)) return true;
+    {GREE, &IRrecv::decodeGree, kGreeBits, true,
+     kGreeHdrMark, kGreeHdrSpace},
 #endif
 #if DECODE_HAIER_AC
-    DPRINTLN("Attempting Haier AC decode");
-    if (decodeHaierAC(results, offset)) return true;
+    {HAIER_AC, &IRrecv::decodeHaierAC, kHaierACBits, true,
+     kHaierAcHdr, kHaierAcHdr},
 #endif
 #if DECODE_HAIER_AC_YRW02
-    DPRINTLN("Attempting Haier AC YR-W02 decode");
-    if (decodeHaierACYRW02(results, offset)) return true;
+    {HAIER_AC_YRW02, &IRrecv::decodeHaierACYRW02, kHaierACYRW02Bits, true,
+     kHaierAcHdr, kHaierAcHdr},
 #endif
 #if DECODE_HAIER_AC176
-    DPRINTLN("Attempting Haier AC 176 bit decode");
-    if (decodeHaierAC176(results, offset)) return true;
+    {HAIER_AC176, &IRrecv::decodeHaierAC176, kHaierAC176Bits, true,
+     kHaierAcHdr, kHaierAcHdr},
 #endif  // DECODE_HAIER_AC176
 #if DECODE_HITACHI_AC424
     // HitachiAc424 should be checked before HitachiAC, HitachiAC2,
     // & HitachiAC184
-    DPRINTLN("Attempting Hitachi AC 424 decode");
-    if (decodeHitachiAc424(results, offset, kHitachiAc424Bits)) return true;
+    {HITACHI_AC424, &IRrecv::decodeHitachiAc424, kHitachiAc424Bits, true,
+     kHitachiAc424LdrMark, kHitachiAc424LdrSpace},
 #endif  // DECODE_HITACHI_AC424
 #if DECODE_MITSUBISHI136
     // Needs to happen before HitachiAc3 decode.
-    DPRINTLN("Attempting Mitsubishi136 decode");
-    if (decodeMitsubishi136(results, offset)) return true;
+    {MITSUBISHI136, &IRrecv::decodeMitsubishi136, kMitsubishi136Bits, true,
+     kMitsubishi136HdrMark, kMitsubishi136HdrSpace},
 #endif  // DECODE_MITSUBISHI136
 #if DECODE_HITACHI_AC3
     // HitachiAc3 should be checked before HitachiAC & HitachiAC2
     // Attempt normal before the short version.
-    DPRINTLN("Attempting Hitachi AC3 decode");
     // Order these in decreasing bit size, as it is more optimal.
-    if (decodeHitachiAc3(results, offset, kHitachiAc3Bits) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3Bits - 4 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3Bits - 6 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3MinBits + 2 * 8) ||
-        decodeHitachiAc3(results, offset, kHitachiAc3MinBits))
-      return true;
+    {HITACHI_AC3, &IRrecv::decodeHitachiAc3, kHitachiAc3Bits, true,
+     kHitachiAc3HdrMark, kHitachiAc3HdrSpace},
+    {HITACHI_AC3, &IRrecv::decodeHitachiAc3, kHitachiAc3Bits - 4 * 8, true,
+     kHitachiAc3HdrMark, kHitachiAc3HdrSpace},
+    {HITACHI_AC3, &IRrecv::decodeHitachiAc3, kHitachiAc3Bits - 6 * 8, true,
+     kHitachiAc3HdrMark, kHitachiAc3HdrSpace},
+    {HITACHI_AC3, &IRrecv::decodeHitachiAc3, kHitachiAc3MinBits + 2 * 8, true,
+     kHitachiAc3HdrMark, kHitachiAc3HdrSpace},
+    {HITACHI_AC3, &IRrecv::decodeHitachiAc3, kHitachiAc3MinBits, true,
+     kHitachiAc3HdrMark, kHitachiAc3HdrSpace},
 #endif  // DECODE_HITACHI_AC3
 #if DECODE_HITACHI_AC344
     // HitachiAC344 should be checked before HitachiAC
-    DPRINTLN("Attempting Hitachi AC344 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc344Bits, true, false))
-      return true;
+    {HITACHI_AC344, &IRrecv::_decodeHitachiAC, kHitachiAc344Bits, true,
+     kHitachiAcHdrMark, kHitachiAcHdrSpace},
 #endif  // DECODE_HITACHI_AC344
 #if DECODE_HITACHI_AC264
     // HitachiAC264 should be checked before HitachiAC
-    DPRINTLN("Attempting Hitachi AC264 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc264Bits, true, false))
-      return true;
+    {HITACHI_AC264, &IRrecv::_decodeHitachiAC, kHitachiAc264Bits, true,
+     kHitachiAcHdrMark, kHitachiAcHdrSpace},
 #endif  // DECODE_HITACHI_AC264
 #if DECODE_HITACHI_AC296
     // HitachiAC296 should be checked before HitachiAC
-    DPRINTLN("Attempting Hitachi AC296 decode");
-    if (decodeHitachiAc296(results, offset, kHitachiAc296Bits, true))
-      return true;
+    {HITACHI_AC296, &IRrecv::decodeHitachiAc296, kHitachiAc296Bits, true,
+     kHitachiAcHdrMark, kHitachiAcHdrSpace},
 #endif  // DECODE_HITACHI_AC296
 #if DECODE_HITACHI_AC2
     // HitachiAC2 should be checked before HitachiAC
-    DPRINTLN("Attempting Hitachi AC2 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc2Bits)) return true;
+    {HITACHI_AC2, &IRrecv::_decodeHitachiAC, kHitachiAc2Bits, true,
+     kHitachiAcHdrMark, kHitachiAcHdrSpace},
 #endif  // DECODE_HITACHI_AC2
 #if DECODE_HITACHI_AC
-    DPRINTLN("Attempting Hitachi AC decode");
-    if (decodeHitachiAC(results, offset, kHitachiAcBits)) return true;
+    {HITACHI_AC, &IRrecv::_decodeHitachiAC, kHitachiAcBits, true,
+     kHitachiAcHdrMark, kHitachiAcHdrSpace},
 #endif
 #if DECODE_HITACHI_AC1
-    DPRINTLN("Attempting Hitachi AC1 decode");
-    if (decodeHitachiAC(results, offset, kHitachiAc1Bits)) return true;
+    {HITACHI_AC1, &IRrecv::_decodeHitachiAC, kHitachiAc1Bits, true,
+     kHitachiAc1HdrMark, kHitachiAc1HdrSpace},
 #endif
 #if DECODE_WHIRLPOOL_AC
-    DPRINTLN("Attempting Whirlpool AC decode");
-    if (decodeWhirlpoolAC(results, offset)) return true;
+    {WHIRLPOOL_AC, &IRrecv::decodeWhirlpoolAC, kWhirlpoolAcBits, true,
+     kWhirlpoolAcHdrMark, kWhirlpoolAcHdrSpace},
 #endif
 #if DECODE_SAMSUNG_AC
-    DPRINTLN("Attempting Samsung AC (extended) decode");
     // Check the extended size first, as it should fail fast due to longer
     // length.
-    if (decodeSamsungAC(results, offset, kSamsungAcExtendedBits)) return true;
+    {SAMSUNG_AC, &IRrecv::decodeSamsungAC, kSamsungAcExtendedBits, true,
+     kSamsungAcBitMark, kSamsungAcHdrSpace},
     // Now check for the more common length.
-    DPRINTLN("Attempting Samsung AC decode");
-    if (decodeSamsungAC(results, offset, kSamsungAcBits)) return true;
-#endif
+    {SAMSUNG_AC, &IRrecv::decodeSamsungAC, kSamsungAcBits, true,
+     kSamsungAcBitMark, kSamsungAcHdrSpace},
+#endif  // DECODE_SAMSUNG_AC
 #if DECODE_ELECTRA_AC
-    DPRINTLN("Attempting Electra AC decode");
-    if (decodeElectraAC(results, offset)) return true;
+    {ELECTRA_AC, &IRrecv::decodeElectraAC, kElectraAcBits, true,
+     kElectraAcHdrMark, kElectraAcHdrSpace},
 #endif
 #if DECODE_PANASONIC_AC
-    DPRINTLN("Attempting Panasonic AC decode");
-    if (decodePanasonicAC(results, offset)) return true;
-    DPRINTLN("Attempting Panasonic AC short decode");
-    if (decodePanasonicAC(results, offset, kPanasonicAcShortBits)) return true;
-#endif
+    {PANASONIC_AC, &IRrecv::decodePanasonicAC, kPanasonicAcBits, true,
+     kPanasonicHdrMark, kPanasonicHdrSpace},
+    {PANASONIC_AC, &IRrecv::decodePanasonicAC, kPanasonicAcShortBits, true,
+     kPanasonicHdrMark, kPanasonicHdrSpace},
+#endif  // DECODE_PANASONIC_AC
 #if DECODE_LUTRON
-    DPRINTLN("Attempting Lutron decode");
-    if (decodeLutron(results, offset)) return true;
+    {LUTRON, &IRrecv::decodeLutron, kLutronBits, true, 0, 0},
 #endif
 #if DECODE_MWM
-    DPRINTLN("Attempting MWM decode");
-    if (decodeMWM(results, offset)) return true;
+    {MWM, &IRrecv::decodeMWM, 24, true, 0, 0},
 #endif
 #if DECODE_VESTEL_AC
-    DPRINTLN("Attempting Vestel AC decode");
-    if (decodeVestelAc(results, offset)) return true;
+    {VESTEL_AC, &IRrecv::decodeVestelAc, kVestelAcBits, true,
+     kVestelAcHdrMark, kVestelAcHdrSpace},
 #endif
 #if DECODE_MITSUBISHI112 || DECODE_TCL112AC
     // Mitsubish112 and Tcl112 share the same decoder.
-    DPRINTLN("Attempting Mitsubishi112/TCL112AC decode");
-    if (decodeMitsubishi112(results, offset)) return true;
+    {MITSUBISHI112, &IRrecv::decodeMitsubishi112, kMitsubishi112Bits, true,
+     0, 0},
 #endif  // DECODE_MITSUBISHI112 || DECODE_TCL112AC
 #if DECODE_TECO
-    DPRINTLN("Attempting Teco decode");
-    if (decodeTeco(results, offset)) return true;
+    {TECO, &IRrecv::decodeTeco, kTecoBits, false,
+     kTecoHdrMark, kTecoHdrSpace},
 #endif
 #if DECODE_LEGOPF
-    DPRINTLN("Attempting LEGOPF decode");
-    if (decodeLegoPf(results, offset)) return true;
+    {LEGOPF, &IRrecv::decodeLegoPf, kLegoPfBits, true,
+     kLegoPfBitMark, kLegoPfHdrSpace},
 #endif
 #if DECODE_MITSUBISHIHEAVY
-    DPRINTLN("Attempting MITSUBISHIHEAVY (152 bit) decode");
-    if (decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy152Bits))
-      return true;
-    DPRINTLN("Attempting MITSUBISHIHEAVY (88 bit) decode");
-    if (decodeMitsubishiHeavy(results, offset, kMitsubishiHeavy88Bits))
-      return true;
+    {MITSUBISHI_HEAVY_152, &IRrecv::decodeMitsubishiHeavy,
+     kMitsubishiHeavy152Bits, true, kMitsubishiHeavyHdrMark,
+     kMitsubishiHeavyHdrSpace},
+    {MITSUBISHI_HEAVY_88, &IRrecv::decodeMitsubishiHeavy,
+     kMitsubishiHeavy88Bits, true, kMitsubishiHeavyHdrMark,
+     kMitsubishiHeavyHdrSpace},
 #endif
 #if DECODE_ARGO
-  DPRINTLN("Attempting Argo WREM3 decode (AC Control)");
-  if (decodeArgoWREM3(results, offset, kArgo3AcControlStateLength * 8, true))
-    return true;
-  DPRINTLN("Attempting Argo WREM3 decode (iFeel report)");
-  if (decodeArgoWREM3(results, offset, kArgo3iFeelReportStateLength * 8, true))
-    return true;
-  DPRINTLN("Attempting Argo WREM3 decode (Config)");
-  if (decodeArgoWREM3(results, offset, kArgo3ConfigStateLength * 8, true))
-    return true;
-  DPRINTLN("Attempting Argo WREM3 decode (Timer)");
-  if (decodeArgoWREM3(results, offset, kArgo3TimerStateLength * 8, true))
-    return true;
-  DPRINTLN("Attempting Argo WREM2 decode");
-    if (decodeArgo(results, offset, kArgoBits) ||
-        decodeArgo(results, offset, kArgoShortBits, false)) return true;
+    {ARGO, &IRrecv::decodeArgoWREM3, kArgo3AcControlStateLength * 8, true,
+     kArgoHdrMark, kArgoHdrSpace},
+    {ARGO, &IRrecv::decodeArgoWREM3, kArgo3iFeelReportStateLength * 8, true,
+     kArgoHdrMark, kArgoHdrSpace},
+    {ARGO, &IRrecv::decodeArgoWREM3, kArgo3ConfigStateLength * 8, true,
+     kArgoHdrMark, kArgoHdrSpace},
+    {ARGO, &IRrecv::decodeArgoWREM3, kArgo3TimerStateLength * 8, true,
+     kArgoHdrMark, kArgoHdrSpace},
+    {ARGO, &IRrecv::decodeArgo, kArgoBits, true,
+     kArgoHdrMark, kArgoHdrSpace},
+    {ARGO, &IRrecv::decodeArgo, kArgoShortBits, false,
+     kArgoHdrMark, kArgoHdrSpace},
 #endif  // DECODE_ARGO
 #if DECODE_SHARP_AC
-    DPRINTLN("Attempting SHARP_AC decode");
-    if (decodeSharpAc(results, offset)) return true;
+    {SHARP_AC, &IRrecv::decodeSharpAc, kSharpAcBits, true,
+     kSharpAcHdrMark, kSharpAcHdrSpace},
 #endif
 #if DECODE_GOODWEATHER
-    DPRINTLN("Attempting GOODWEATHER decode");
-    if (decodeGoodweather(results, offset)) return true;
+    {GOODWEATHER, &IRrecv::decodeGoodweather, kGoodweatherBits, true,
+     kGoodweatherHdrMark, kGoodweatherHdrSpace},
 #endif  // DECODE_GOODWEATHER
 #if DECODE_INAX
-    DPRINTLN("Attempting Inax decode");
-    if (decodeInax(results, offset)) return true;
+    {INAX, &IRrecv::decodeInax, kInaxBits, true,
+     kInaxHdrMark, kInaxHdrSpace},
 #endif  // DECODE_INAX
 #if DECODE_TROTEC
-    DPRINTLN("Attempting Trotec decode");
-    if (decodeTrotec(results, offset)) return true;
+    {TROTEC, &IRrecv::decodeTrotec, kTrotecBits, true,
+     kTrotecHdrMark, kTrotecHdrSpace},
 #endif  // DECODE_TROTEC
 #if DECODE_TROTEC_3550
-    DPRINTLN("Attempting Trotec 3550 decode");
-    if (decodeTrotec3550(results, offset)) return true;
+    {TROTEC_3550, &IRrecv::decodeTrotec3550, kTrotecBits, true,
+     kTrotec3550HdrMark, kTrotec3550HdrSpace},
 #endif  // DECODE_TROTEC_3550
 #if DECODE_DAIKIN160
-    DPRINTLN("Attempting Daikin160 decode");
-    if (decodeDaikin160(results, offset)) return true;
+    {DAIKIN160, &IRrecv::decodeDaikin160, kDaikin160Bits, true,
+     kDaikin160HdrMark, kDaikin160HdrSpace},
 #endif  // DECODE_DAIKIN160
 #if DECODE_NEOCLIMA
-    DPRINTLN("Attempting Neoclima decode");
-    if (decodeNeoclima(results, offset)) return true;
+    {NEOCLIMA, &IRrecv::decodeNeoclima, kNeoclimaBits, true,
+     kNeoclimaHdrMark, kNeoclimaHdrSpace},
 #endif  // DECODE_NEOCLIMA
 #if DECODE_DAIKIN176
-    DPRINTLN("Attempting Daikin176 decode");
-    if (decodeDaikin176(results, offset)) return true;
+    {DAIKIN176, &IRrecv::decodeDaikin176, kDaikin176Bits, true,
+     kDaikin176HdrMark, kDaikin176HdrSpace},
 #endif  // DECODE_DAIKIN176
 #if DECODE_DAIKIN128
-    DPRINTLN("Attempting Daikin128 decode");
-    if (decodeDaikin128(results, offset)) return true;
+    {DAIKIN128, &IRrecv::decodeDaikin128, kDaikin128Bits, true,
+     kDaikin128LeaderMark, 0},
 #endif  // DECODE_DAIKIN128
 #if DECODE_AMCOR
-    DPRINTLN("Attempting Amcor decode");
-    if (decodeAmcor(results, offset)) return true;
+    {AMCOR, &IRrecv::decodeAmcor, kAmcorBits, true,
+     kAmcorHdrMark, kAmcorHdrSpace},
 #endif  // DECODE_AMCOR
 #if DECODE_DAIKIN152
-    DPRINTLN("Attempting Daikin152 decode");
-    if (decodeDaikin152(results, offset)) return true;
+    {DAIKIN152, &IRrecv::decodeDaikin152, kDaikin152Bits, true, 0, 0},
 #endif  // DECODE_DAIKIN152
 #if DECODE_SYMPHONY
-    DPRINTLN("Attempting Symphony decode");
-    if (decodeSymphony(results, offset)) return true;
+    {SYMPHONY, &IRrecv::decodeSymphony, kSymphonyBits, true, 0, 0},
 #endif  // DECODE_SYMPHONY
 #if DECODE_DAIKIN64
-    DPRINTLN("Attempting Daikin64 decode");
-    if (decodeDaikin64(results, offset)) return true;
+    {DAIKIN64, &IRrecv::decodeDaikin64, kDaikin64Bits, true, 0, 0},
 #endif  // DECODE_DAIKIN64
 #if DECODE_AIRWELL
-    DPRINTLN("Attempting Airwell decode");
-    if (decodeAirwell(results, offset)) return true;
+    {AIRWELL, &IRrecv::decodeAirwell, kAirwellBits, true, 0, 0},
 #endif  // DECODE_AIRWELL
 #if DECODE_DELONGHI_AC
-    DPRINTLN("Attempting Delonghi AC decode");
-    if (decodeDelonghiAc(results, offset)) return true;
+    {DELONGHI_AC, &IRrecv::decodeDelonghiAc, kDelonghiAcBits, true,
+     kDelonghiAcHdrMark, kDelonghiAcHdrSpace},
 #endif  // DECODE_DELONGHI_AC
 #if DECODE_DOSHISHA
-    DPRINTLN("Attempting Doshisha decode");
-    if (decodeDoshisha(results, offset)) return true;
+    {DOSHISHA, &IRrecv::decodeDoshisha, kDoshishaBits, true,
+     kDoshishaHdrMark, kDoshishaHdrSpace},
 #endif  // DECODE_DOSHISHA
 #if DECODE_TRUMA
     // Needs to happen before decodeMultibrackets() as they can appear similar.
-    DPRINTLN("Attempting Truma decode");
-    if (decodeTruma(results, offset)) return true;
+    {TRUMA, &IRrecv::decodeTruma, kTrumaBits, true,
+     kTrumaLdrMark, kTrumaLdrSpace},
 #endif  // DECODE_TRUMA
 #if DECODE_MULTIBRACKETS
-    DPRINTLN("Attempting Multibrackets decode");
-    if (decodeMultibrackets(results, offset)) return true;
+    {MULTIBRACKETS, &IRrecv::decodeMultibrackets, kMultibracketsBits, true,
+     0, 0},
 #endif  // DECODE_MULTIBRACKETS
 #if DECODE_CARRIER_AC40
-    DPRINTLN("Attempting Carrier 40bit decode");
-    if (decodeCarrierAC40(results, offset)) return true;
+    {CARRIER_AC40, &IRrecv::decodeCarrierAC40, kCarrierAc40Bits, true,
+     kCarrierAc40HdrMark, kCarrierAc40HdrSpace},
 #endif  // DECODE_CARRIER_AC40
 #if DECODE_CARRIER_AC64
-    DPRINTLN("Attempting Carrier 64bit decode");
-    if (decodeCarrierAC64(results, offset)) return true;
+    {CARRIER_AC64, &IRrecv::decodeCarrierAC64, kCarrierAc64Bits, true,
+     kCarrierAc64HdrMark, kCarrierAc64HdrSpace},
 #endif  // DECODE_CARRIER_AC64
 #if DECODE_TECHNIBEL_AC
-    DPRINTLN("Attempting Technibel AC decode");
-    if (decodeTechnibelAc(results, offset)) return true;
+    {TECHNIBEL_AC, &IRrecv::decodeTechnibelAc, kTechnibelAcBits, true,
+     kTechnibelAcHdrMark, kTechnibelAcHdrSpace},
 #endif  // DECODE_TECHNIBEL_AC
 #if DECODE_CORONA_AC
-    DPRINTLN("Attempting CoronaAc decode");
-    if (decodeCoronaAc(results, offset)) return true;
+    {CORONA_AC, &IRrecv::decodeCoronaAc, kCoronaAcBitsShort, true,
+     kCoronaAcHdrMark, kCoronaAcHdrSpace},
 #endif  // DECODE_CORONA_AC
 #if DECODE_MIDEA24
-    DPRINTLN("Attempting Midea-Nec decode");
-    if (decodeMidea24(results, offset)) return true;
+    {MIDEA24, &IRrecv::decodeMidea24, kMidea24Bits, true,
+     kNecHdrMark, kNecHdrSpace},
 #endif  // DECODE_MIDEA24
 #if DECODE_ZEPEAL
-    DPRINTLN("Attempting Zepeal decode");
-    if (decodeZepeal(results, offset)) return true;
+    {ZEPEAL, &IRrecv::decodeZepeal, kZepealBits, true,
+     kZepealHdrMark, kZepealHdrSpace},
 #endif  // DECODE_ZEPEAL
 #if DECODE_SANYO_AC
-    DPRINTLN("Attempting Sanyo AC decode");
-    if (decodeSanyoAc(results, offset)) return true;
+    {SANYO_AC, &IRrecv::decodeSanyoAc, kSanyoAcBits, true,
+     kSanyoAcHdrMark, kSanyoAcHdrSpace},
 #endif  // DECODE_SANYO_AC
 #if DECODE_VOLTAS
-  DPRINTLN("Attempting Voltas decode");
-  if (decodeVoltas(results)) return true;
+    {VOLTAS, &IRrecv::decodeVoltas, kVoltasBits, true, 0, 0},
 #endif  // DECODE_VOLTAS
 #if DECODE_METZ
-    DPRINTLN("Attempting Metz decode");
-    if (decodeMetz(results, offset)) return true;
+    {METZ, &IRrecv::decodeMetz, kMetzBits, true,
+     kMetzHdrMark, kMetzHdrSpace},
 #endif  // DECODE_METZ
 #if DECODE_TRANSCOLD
-    DPRINTLN("Attempting Transcold decode");
-    if (decodeTranscold(results, offset)) return true;
+    {TRANSCOLD, &IRrecv::decodeTranscold, kTranscoldBits, true,
+     kTranscoldHdrMark, kTranscoldHdrSpace},
 #endif  // DECODE_TRANSCOLD
 #if DECODE_MIRAGE
-    DPRINTLN("Attempting Mirage decode");
-    if (decodeMirage(results, offset)) return true;
+    {MIRAGE, &IRrecv::decodeMirage, kMirageBits, true,
+     kMirageHdrMark, kMirageHdrSpace},
 #endif  // DECODE_MIRAGE
 #if DECODE_ELITESCREENS
-    DPRINTLN("Attempting EliteScreens decode");
-    if (decodeElitescreens(results, offset)) return true;
+    {ELITESCREENS, &IRrecv::decodeElitescreens, kEliteScreensBits, true, 0, 0},
 #endif  // DECODE_ELITESCREENS
 #if DECODE_PANASONIC_AC32
-    DPRINTLN("Attempting Panasonic AC (32bit) long decode");
-    if (decodePanasonicAC32(results, offset, kPanasonicAc32Bits)) return true;
-    DPRINTLN("Attempting Panasonic AC (32bit) short decode");
-    if (decodePanasonicAC32(results, offset, kPanasonicAc32Bits / 2))
-      return true;
+    {PANASONIC_AC32, &IRrecv::decodePanasonicAC32, kPanasonicAc32Bits, true,
+     kPanasonicAc32HdrMark, kPanasonicAc32HdrSpace},
+    {PANASONIC_AC32, &IRrecv::decodePanasonicAC32, kPanasonicAc32Bits / 2, true,
+     kPanasonicAc32HdrMark, kPanasonicAc32HdrSpace},
 #endif  // DECODE_PANASONIC_AC32
 #if DECODE_ECOCLIM
-    DPRINTLN("Attempting Ecoclim decode");
-    if (decodeEcoclim(results, offset, kEcoclimBits) ||
-        decodeEcoclim(results, offset, kEcoclimShortBits)) return true;
+    {ECOCLIM, &IRrecv::decodeEcoclim, kEcoclimBits, true,
+     kEcoclimHdrMark, kEcoclimHdrSpace},
+    {ECOCLIM, &IRrecv::decodeEcoclim, kEcoclimShortBits, true,
+     kEcoclimHdrMark, kEcoclimHdrSpace},
 #endif  // DECODE_ECOCLIM
 #if DECODE_XMP
-    DPRINTLN("Attempting XMP decode");
-    if (decodeXmp(results, offset, kXmpBits)) return true;
+    {XMP, &IRrecv::decodeXmp, kXmpBits, true, 0, 0},
 #endif  // DECODE_XMP
 #if DECODE_TEKNOPOINT
-    DPRINTLN("Attempting Teknopoint decode");
-    if (decodeTeknopoint(results, offset)) return true;
+    {TEKNOPOINT, &IRrecv::decodeTeknopoint, kTeknopointBits, true,
+     kTeknopointHdrMark, kTeknopointHdrSpace},
 #endif  // DECODE_TEKNOPOINT
 #if DECODE_KELON168
-    DPRINTLN("Attempting Kelon 168-bit decode");
-    if (decodeKelon168(results, offset)) return true;
+    {KELON168, &IRrecv::decodeKelon168, kKelon168Bits, true,
+     kKelonHdrMark, kKelonHdrSpace},
 #endif  // DECODE_KELON168
 #if DECODE_KELON
-    DPRINTLN("Attempting Kelon 48-bit decode");
-    if (decodeKelon(results, offset)) return true;
+    {KELON, &IRrecv::decodeKelon, kKelonBits, true,
+     kKelonHdrMark, kKelonHdrSpace},
 #endif  // DECODE_KELON
 #if DECODE_SANYO_AC88
-    DPRINTLN("Attempting SanyoAc88 decode");
-    if (decodeSanyoAc88(results, offset)) return true;
+    {SANYO_AC88, &IRrecv::decodeSanyoAc88, kSanyoAc88Bits, true,
+     kSanyoAc88HdrMark, kSanyoAc88HdrSpace},
 #endif  // DECODE_SANYO_AC88
 #if DECODE_BOSE
-    DPRINTLN("Attempting Bose decode");
-    if (decodeBose(results, offset)) return true;
+    {BOSE, &IRrecv::decodeBose, kBoseBits, true,
+     kBoseHdrMark, kBoseHdrSpace},
 #endif  // DECODE_BOSE
 #if DECODE_ARRIS
-    DPRINTLN("Attempting Arris decode");
-    if (decodeArris(results, offset)) return true;
+    {ARRIS, &IRrecv::decodeArris, kArrisBits, true, kArrisHdrMark, 0},
 #endif  // DECODE_ARRIS
 #if DECODE_RHOSS
-    DPRINTLN("Attempting Rhoss decode");
-    if (decodeRhoss(results, offset)) return true;
+    {RHOSS, &IRrecv::decodeRhoss, kRhossBits, true,
+     kRhossHdrMark, kRhossHdrSpace},
 #endif  // DECODE_RHOSS
 #if DECODE_AIRTON
-    DPRINTLN("Attempting Airton decode");
-    if (decodeAirton(results, offset)) return true;
+    {AIRTON, &IRrecv::decodeAirton, kAirtonBits, true,
+     kAirtonHdrMark, kAirtonHdrSpace},
 #endif  // DECODE_AIRTON
 #if DECODE_COOLIX48
-    DPRINTLN("Attempting Coolix 48-bit decode");
-    if (decodeCoolix48(results, offset)) return true;
+    {COOLIX48, &IRrecv::decodeCoolix48, kCoolix48Bits, true,
+     kCoolixHdrMark, kCoolixHdrSpace},
 #endif  // DECODE_COOLIX48
 #if DECODE_DAIKIN200
-    DPRINTLN("Attempting Daikin 200-bit decode");
-    if (decodeDaikin200(results, offset)) return true;
+    {DAIKIN200, &IRrecv::decodeDaikin200, kDaikin200Bits, true,
+     kDaikin200HdrMark, kDaikin200HdrSpace},
 #endif  // DECODE_DAIKIN200
 #if DECODE_HAIER_AC160
-    DPRINTLN("Attempting Haier AC 160 bit decode");
-    if (decodeHaierAC160(results, offset)) return true;
+    {HAIER_AC160, &IRrecv::decodeHaierAC160, kHaierAC160Bits, true,
+     kHaierAcHdr, kHaierAcHdr},
 #endif  // DECODE_HAIER_AC160
 #if DECODE_CARRIER_AC128
-    DPRINTLN("Attempting Carrier AC 128-bit decode");
-    if (decodeCarrierAC128(results, offset)) return true;
+    {CARRIER_AC128, &IRrecv::decodeCarrierAC128, kCarrierAc128Bits, true,
+     kCarrierAc128HdrMark, kCarrierAc128HdrSpace},
 #endif  // DECODE_CARRIER_AC128
 #if DECODE_TOTO
-    DPRINTLN("Attempting Toto 48/24-bit decode");
-    if (decodeToto(results, offset, kTotoLongBits) ||  // Long needs to be first
-        decodeToto(results, offset, kTotoShortBits)) return true;
+    // Long needs to be first.
+    {TOTO, &IRrecv::decodeToto, kTotoLongBits, true,
+     kTotoHdrMark, kTotoHdrSpace},
+    {TOTO, &IRrecv::decodeToto, kTotoShortBits, true,
+     kTotoHdrMark, kTotoHdrSpace},
 #endif  // DECODE_TOTO
 #if DECODE_CLIMABUTLER
-    DPRINTLN("Attempting ClimaButler decode");
-    if (decodeClimaButler(results)) return true;
+    {CLIMABUTLER, &IRrecv::decodeClimaButler, kClimaButlerBits, true,
+     kClimaButlerHdrMark, kClimaButlerHdrSpace},
 #endif  // DECODE_CLIMABUTLER
 #if DECODE_TCL96AC
-    DPRINTLN("Attempting TCL AC 96-bit decode");
-    if (decodeTcl96Ac(results, offset)) return true;
+    {TCL96AC, &IRrecv::decodeTcl96Ac, kTcl96AcBits, true,
+     kTcl96AcHdrMark, kTcl96AcHdrSpace},
 #endif  // DECODE_TCL96AC
 #if DECODE_SANYO_AC152
-    DPRINTLN("Attempting Sanyo AC 152-bit decode");
-    if (decodeSanyoAc152(results, offset)) return true;
+    {SANYO_AC152, &IRrecv::decodeSanyoAc152, kSanyoAc152Bits, true,
+     kSanyoAc152HdrMark, kSanyoAc152HdrSpace},
 #endif  // DECODE_SANYO_AC152
 #if DECODE_DAIKIN312
-    DPRINTLN("Attempting Daikin 312-bit decode");
-    if (decodeDaikin312(results, offset)) return true;
+    {DAIKIN312, &IRrecv::decodeDaikin312, kDaikin312Bits, true, 0, 0},
 #endif  // DECODE_DAIKIN312
 #if DECODE_GORENJE
-    DPRINTLN("Attempting GORENJE decode");
-    if (decodeGorenje(results, offset)) return true;
+    {GORENJE, &IRrecv::decodeGorenje, kGorenjeBits, true, 0, 0},
 #endif  // DECODE_GORENJE
 #if DECODE_WOWWEE
-    DPRINTLN("Attempting WOWWEE decode");
-    if (decodeWowwee(results, offset)) return true;
+    {WOWWEE, &IRrecv::decodeWowwee, kWowweeBits, true,
+     kWowweeHdrMark, kWowweeHdrSpace},
 #endif  // DECODE_WOWWEE
 #if DECODE_CARRIER_AC84
-    DPRINTLN("Attempting Carrier A/C 84-bit decode");
-    if (decodeCarrierAC84(results, offset)) return true;
+    {CARRIER_AC84, &IRrecv::decodeCarrierAC84, kCarrierAc84Bits, true,
+     kCarrierAc84HdrMark, kCarrierAc84HdrSpace},
 #endif  // DECODE_CARRIER_AC84
 #if DECODE_YORK
-    DPRINTLN("Attempting York decode");
-    if (decodeYork(results, offset, kYorkBits)) return true;
+    {YORK, &IRrecv::decodeYork, kYorkBits, true,
+     kYorkHdrMark, kYorkHdrSpace},
 #endif  // DECODE_YORK
 #if DECODE_BLUESTARHEAVY
-    DPRINTLN("Attempting BluestarHeavy decode");
-    if (decodeBluestarHeavy(results, offset, kBluestarHeavyBits)) return true;
+    {BLUESTARHEAVY, &IRrecv::decodeBluestarHeavy, kBluestarHeavyBits, true,
+     kBluestarHeavyHdrMark, kBluestarHeavyHdrSpace},
 #endif  // DECODE_BLUESTARHEAVY
 #if DECODE_EUROM
-    DPRINTLN("Attempting Eurom decode");
-    if (decodeEurom(results, offset, kEuromBits)) return true;
+    {EUROM, &IRrecv::decodeEurom, kEuromBits, true,
+     kEuromHdrMark, kEuromHdrSpace},
 #endif  // DECODE_EUROM
-  // Typically new protocols are added above this line.
+    // Typically new protocols are added above this line.
+};
+
+/// Nr. of entries in the decoder table.
+const uint16_t IRrecv::_nrDecoders = sizeof(IRrecv::_decoders) /
+                                     sizeof(IRrecv::_decoders[0]);
+
+// `_hdrIndex` holds table positions in a byte.
+static_assert(sizeof(IRrecv::_decoders) / sizeof(IRrecv::_decoders[0]) <= 256,
+              "Too many decoders for IRrecv::_hdrIndex to index.");
+
+/// The positions of the decoders with a header mark in `_decoders`, sorted
+/// (i.e. bucketed) by that mark. Positions with the same mark stay in table
+/// order. Lets `decode()` find the few decoders a header could be for, without
+/// looking at every entry. Built by `_indexDecoders()`.
+uint8_t IRrecv::_hdrIndex[sizeof(IRrecv::_decoders) /
+                          sizeof(IRrecv::_decoders[0])];
+uint16_t IRrecv::_nrHdrIndex = 0;
+/// A bit per entry in `_decoders`, set if it has no header mark. i.e. It has to
+/// be considered whatever a capture starts with.
+uint8_t IRrecv::_headerless[(sizeof(IRrecv::_decoders) /
+                             sizeof(IRrecv::_decoders[0]) + 7) / 8];
+bool IRrecv::_indexed = false;
+
+/// Build the header mark index of the decoder table, if it isn't already.
+/// @note It only depends on the (constant) decoder table, so it is shared by
+///   every instance & only built once.
+void IRrecv::_indexDecoders(void) {
+  if (_indexed) return;
+  memset(_headerless, 0, sizeof(_headerless));
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < _nrDecoders; i++) {
+    uint16_t hdrmark;
+    memcpy_P(&hdrmark, &_decoders[i].hdrmark, sizeof(hdrmark));
+    if (!hdrmark) {
+      _headerless[i / 8] |= 1 << (i % 8);
+      continue;
+    }
+    // Insertion sort. Stable, so equal marks keep their table order.
+    uint16_t j = count++;
+    for (; j > 0; j--) {
+      uint16_t prev;
+      memcpy_P(&prev, &_decoders[_hdrIndex[j - 1]].hdrmark, sizeof(prev));
+      if (prev <= hdrmark) break;
+      _hdrIndex[j] = _hdrIndex[j - 1];
+    }
+    _hdrIndex[j] = i;
   }
-#if DECODE_HASH
-  // decodeHash returns a hash on any input.
-  // Thus, it needs to be last in the list.
-  // If you add any decodes, add them before this.
-  if (decodeHash(results)) {
-    return true;
+  _nrHdrIndex = count;
+  _indexed = true;
+}
+
+/// The fewest capture buffer entries (i.e. `rawlen`, including the leading
+/// gap) a strict decode of each protocol needs. One row per protocol, in
+/// `decode_type_t` order, so it can be indexed by it. 0 means don't screen on
+/// length.
+/// @note These are measured by truncating a variety of sent messages until
+///   each decoder fails. Protocols whose length depends on the data
+///   (e.g. Manchester encoded ones), or that are only tried non-strictly,
+///   are 0. There is deliberately no maximum, as decoders accept captures
+///   with trailing repeats or noise.
+///   Regenerate it with `tools/min_rawlen` when adding a protocol.
+///   The `TestDecodeTable.MinRawLenRows` unit test checks each row is in its
+///   protocol's place.
+const IRrecv::min_rawlen_t IRrecv::_minRawLen[] PROGMEM = {
+    {UNUSED, 0},
+    {RC5, 0},
+    {RC6, 0},
+    {NEC, 4},
+    {SONY, 0},
+    {PANASONIC, 84},
+    {JVC, 35},
+    {SAMSUNG, 68},
+    {WHYNTER, 71},
+    {AIWA_RC_T501, 88},
+    {LG, 60},
+    {SANYO, 0},
+    {MITSUBISHI, 34},
+    {DISH, 36},
+    {SHARP, 33},
+    {COOLIX, 100},
+    {DAIKIN, 584},
+    {DENON, 0},
+    {KELVINATOR, 280},
+    {SHERWOOD, 0},
+    {MITSUBISHI_AC, 0},
+    {RCMM, 0},
+    {SANYO_LC7461, 4},
+    {RC5X, 0},
+    {GREE, 140},
+    {PRONTO, 0},
+    {NEC_LIKE, 0},
+    {ARGO, 0},
+    {TROTEC, 151},
+    {NIKAI, 52},
+    {RAW, 0},
+    {GLOBALCACHE, 0},
+    {TOSHIBA_AC, 116},
+    {FUJITSU_AC, 0},
+    {MIDEA, 100},
+    {MAGIQUEST, 112},
+    {LASERTAG, 0},
+    {CARRIER_AC, 204},
+    {HAIER_AC, 150},
+    {MITSUBISHI2, 39},
+    {HITACHI_AC, 452},
+    {HITACHI_AC1, 212},
+    {HITACHI_AC2, 852},
+    {GICABLE, 36},
+    {HAIER_AC_YRW02, 230},
+    {WHIRLPOOL_AC, 344},
+    {SAMSUNG_AC, 234},
+    {LUTRON, 2},
+    {ELECTRA_AC, 212},
+    {PANASONIC_AC, 264},
+    {PIONEER, 136},
+    {LG2, 0},
+    {MWM, 0},
+    {DAIKIN2, 634},
+    {VESTEL_AC, 116},
+    {TECO, 0},
+    {SAMSUNG36, 78},
+    {TCL112AC, 0},
+    {LEGOPF, 36},
+    {MITSUBISHI_HEAVY_88, 180},
+    {MITSUBISHI_HEAVY_152, 308},
+    {DAIKIN216, 440},
+    {SHARP_AC, 212},
+    {GOODWEATHER, 198},
+    {INAX, 52},
+    {DAIKIN160, 328},
+    {NEOCLIMA, 198},
+    {DAIKIN176, 360},
+    {DAIKIN128, 266},
+    {AMCOR, 132},
+    {DAIKIN152, 320},
+    {MITSUBISHI136, 276},
+    {MITSUBISHI112, 228},
+    {HITACHI_AC424, 854},
+    {SONY_38K, 0},
+    {EPSON, 136},
+    {SYMPHONY, 24},
+    {HITACHI_AC3, 244},
+    {DAIKIN64, 137},
+    {AIRWELL, 0},
+    {DELONGHI_AC, 132},
+    {DOSHISHA, 0},
+    {MULTIBRACKETS, 0},
+    {CARRIER_AC40, 84},
+    {CARRIER_AC64, 132},
+    {HITACHI_AC344, 692},
+    {CORONA_AC, 116},
+    {MIDEA24, 100},
+    {ZEPEAL, 36},
+    {SANYO_AC, 148},
+    {VOLTAS, 162},
+    {METZ, 42},
+    {TRANSCOLD, 101},
+    {TECHNIBEL_AC, 116},
+    {MIRAGE, 244},
+    {ELITESCREENS, 64},
+    {PANASONIC_AC32, 202},
+    {MILESTAG2, 30},
+    {ECOCLIM, 98},
+    {XMP, 36},
+    {TRUMA, 118},
+    {HAIER_AC176, 358},
+    {TEKNOPOINT, 228},
+    {KELON, 100},
+    {TROTEC_3550, 148},
+    {SANYO_AC88, 0},
+    {BOSE, 36},
+    {ARRIS, 36},
+    {RHOSS, 197},
+    {AIRTON, 116},
+    {COOLIX48, 100},
+    {HITACHI_AC264, 532},
+    {KELON168, 344},
+    {HITACHI_AC296, 596},
+    {DAIKIN200, 408},
+    {HAIER_AC160, 326},
+    {CARRIER_AC128, 268},
+    {TOTO, 164},
+    {CLIMABUTLER, 109},
+    {TCL96AC, 100},
+    {BOSCH144, 300},
+    {SANYO_AC152, 308},
+    {DAIKIN312, 644},
+    {GORENJE, 18},
+    {WOWWEE, 26},
+    {CARRIER_AC84, 0},
+    {YORK, 276},
+    {BLUESTARHEAVY, 212},
+    {EUROM, 196},
+};
+static_assert(sizeof(IRrecv::_minRawLen) / sizeof(IRrecv::_minRawLen[0]) ==
+              kLastDecodeType + 1,
+              "IRrecv::_minRawLen[] needs exactly one row per protocol.");
+static_assert(kLastDecodeType <= UINT8_MAX,
+              "IRrecv::min_rawlen_t's type is too small for decode_type_t.");
+
+// Extra margin (uSecs) when screening decoders. More than any kMarkExcess used.
+const uint16_t kScreenDelta = 100;
+
+/// Cheaply check if the data at an offset could start with a given header.
+/// i.e. A quick pre-filter before we call a (potentially expensive) decoder.
+/// @param[in] results Ptr to the data to check.
+/// @param[in] offset The starting index to use in `results->rawbuf`.
+/// @param[in] hdrmark The header mark (uSecs) the protocol starts with.
+///   0 means accept anything.
+/// @param[in] hdrspace The header space (uSecs) that follows the mark.
+///   0 means don't check it.
+/// @return true if the decoder is worth trying, false if it can't match.
+/// @note This is deliberately more tolerant than any decoder. It may let a
+///   non-matching message through, but it must never reject a valid one.
+bool IRrecv::_plausibleHeader(const decode_results *results,
+                              const uint16_t offset,
+                              const uint16_t hdrmark,
+                              const uint16_t hdrspace) {
+  if (!hdrmark) return true;  // Nothing to screen on.
+  if (offset >= results->rawlen) return false;  // No data to match against.
+  const uint8_t tolerance = _screenTolerance();
+  if (!match(results->rawbuf[offset], hdrmark, tolerance, kScreenDelta))
+    return false;
+  if (hdrspace && offset + 1 < results->rawlen)
+    return match(results->rawbuf[offset + 1], hdrspace, tolerance,
+                 kScreenDelta);
+  return true;
+}
+
+/// Find which entries in the decoder table are worth looking at for a capture.
+/// i.e. The headerless ones, plus those in the header mark buckets that the
+/// mark at the offset is a plausible match for.
+/// @param[in] results Ptr to the data to check.
+/// @param[in] offset The starting index to use in `results->rawbuf`.
+/// @param[out] candidates A bit per `_decoders` entry. Set if worth a look.
+///   It must be `sizeof(_headerless)` bytes.
+/// @note This only screens on the header mark, with the same tolerance as
+///   `_plausibleHeader()`. The candidates still need to be checked with it.
+void IRrecv::_findCandidates(const decode_results *results,
+                             const uint16_t offset, uint8_t *candidates) {
+#ifdef UNIT_TEST
+  if (!_screenDecoders) {  // Look at everything.
+    memset(candidates, 0xFF, sizeof(_headerless));
+    return;
   }
-#endif  // DECODE_HASH
-  // Throw away and start over
-  if (!resumed)  // Check if we have already resumed.
-    resume();
-  return false;
-}  // NOLINT(readability/fn_size)
+#endif  // UNIT_TEST
+  memcpy(candidates, _headerless, sizeof(_headerless));
+  if (offset >= results->rawlen) return;  // No header to match against.
+  const uint16_t measured = results->rawbuf[offset];
+  const uint8_t tolerance = _screenTolerance();
+  // Both ends of a match window grow with the mark, so binary search for the
+  // first mark whose window isn't entirely below the measured one.
+  uint16_t low = 0;
+  uint16_t high = _nrHdrIndex;
+  while (low < high) {
+    const uint16_t mid = (low + high) / 2;
+    uint16_t hdrmark;
+    memcpy_P(&hdrmark, &_decoders[_hdrIndex[mid]].hdrmark, sizeof(hdrmark));
+    if (matchWindow(hdrmark, tolerance, kScreenDelta).high < measured)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  // Every mark from there, until the windows are entirely above it, matches.
+  for (uint16_t i = low; i < _nrHdrIndex; i++) {
+    uint16_t hdrmark;
+    memcpy_P(&hdrmark, &_decoders[_hdrIndex[i]].hdrmark, sizeof(hdrmark));
+    if (matchWindow(hdrmark, tolerance, kScreenDelta).low > measured) break;
+    candidates[_hdrIndex[i] / 8] |= 1 << (_hdrIndex[i] % 8);
+  }
+}
 
-/// Convert the tolerance percentage into something valid.
-/// @param[in] percentage An integer percentage.
-uint8_t IRrecv::_validTolerance(const uint8_t percentage) {
-    return (percentage > 100) ? _tolerance : percentage;
+/// Cheaply check if a decoder could possibly match a capture.
+/// @param[in] results Ptr to the data to check.
+/// @param[in] offset The starting index to use in `results->rawbuf`.
+/// @param[in] entry The decoder table entry to check.
+/// @return true if the decoder is worth trying, false if it can't match.
+bool IRrecv::_worthTrying(const decode_results *results, const uint16_t offset,
+                          const decoder_entry_t *entry) {
+#ifdef UNIT_TEST
+  if (!_screenDecoders) return true;
+#endif  // UNIT_TEST
+  // Skip any decoder whose header can't possibly match.
+  if (!_plausibleHeader(results, offset, entry->hdrmark, entry->hdrspace))
+    return false;
+  // Skip any strict decoder the capture is too short for.
+  if (entry->strict && !_longEnough(results, offset, entry->type))
+    return false;
+  // Without a header, skip it if the capture lacks the marks it needs.
+  if (!entry->hdrmark && _bitMark(entry->type) &&
+      !_hasMark(results, _bitMark(entry->type)))
+    return false;
+  return true;
 }
 
-/// Calculate the lower bound of the nr. of ticks.
-/// @param[in] usecs Nr. of uSeconds.
-/// @param[in] tolerance Percent as an integer. e.g. 10 is 10%
-/// @param[in] delta A non-scaling amount to reduce usecs by.
-/// @return Nr. of ticks.
-uint32_t IRrecv::ticksLow(const uint32_t usecs, const uint8_t tolerance,
-                          const uint16_t delta) {
-  // max() used to ensure the result can't drop below 0 before the cast.
-  return (static_cast<uint32_t>(std::max(
-      static_cast<int32_t>(usecs * (1.0 - _validTolerance(tolerance) / 100.0) -
-          delta),
-      static_cast<int32_t>(0))));
+/// Cheaply check if a capture is long enough for a strict decode of a protocol.
+/// @param[in] results Ptr to the data to check.
+/// @param[in] offset The starting index to use in `results->rawbuf`.
+/// @param[in] protocol The protocol to check for.
+/// @return true if the decoder is worth trying, false if it can't match.
+bool IRrecv::_longEnough(const decode_results *results, const uint16_t offset,
+                         const decode_type_t protocol) {
+  if (protocol <= UNUSED || protocol > kLastDecodeType) return true;
+  min_rawlen_t min;
+  memcpy_P(&min, &_minRawLen[protocol], sizeof(min));
+  // The table assumes we start at kStartOffset, so adjust for any skipping.
+  return results->rawlen + kStartOffset >= min.rawlen + offset;
 }
 
-/// Calculate the upper bound of the nr. of ticks.
-/// @param[in] usecs Nr. of uSeconds.
-/// @param[in] tolerance Percent as an integer. e.g. 10 is 10%
-/// @param[in] delta A non-scaling amount to increase usecs by.
-/// @return Nr. of ticks.
-uint32_t IRrecv::ticksHigh(const uint32_t usecs, const uint8_t tolerance,
-                           const uint16_t delta) {
-  return (static_cast<uint32_t>(usecs * (1.0 + _validTolerance(tolerance) /
-                                100.0)) + 1 + delta);
+/// The tolerance to use when screening out decoders that can't match.
+/// @return A percentage wider than the class tolerance plus any extra
+///   tolerance a decoder adds.
+uint8_t IRrecv::_screenTolerance(void) {
+  return std::min(static_cast<uint16_t>(std::max(_tolerance, kTolerance) + 25),
+                  static_cast<uint16_t>(100));
 }
 
-/// Check if we match a pulse(measured) with the desired within
-///   +/-tolerance percent and/or +/- a fixed delta range.
-/// @param[in] measured The recorded period of the signal pulse.
-/// @param[in] desired The expected period (in usecs) we are matching against.
-/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
-/// @param[in] delta A non-scaling (+/-) error margin (in useconds).
-/// @return A Boolean. true if it matches, false if it doesn't.
-bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
-                   uint16_t delta) {
-  measured *= kRawTick;  // Convert to uSecs.
+/// The mark that every data bit of a protocol uses, for protocols that don't
+/// have a header we can screen on.
+/// @param[in] protocol The protocol to look up.
+/// @return The bit mark in uSecs, or 0 if it doesn't have a fixed bit mark.
+uint16_t IRrecv::_bitMark(const decode_type_t protocol) {
+  switch (protocol) {
+    case DAIKIN64:      return kDaikin64BitMark;
+    case DAIKIN152:     return kDaikin152BitMark;
+    case DAIKIN312:     return kDaikin312BitMark;
+    case GORENJE:       return kGorenjeBitMark;
+    case JVC:           return kJvcBitMark;
+    case LG:            return kLgBitMark;  // N.B. kLg2BitMark is shorter.
+    case MITSUBISHI:    return kMitsubishiBitMark;
+    case SHARP:         return kSharpBitMark;
+    case VOLTAS:        return kVoltasBitMark;
+    case XMP:           return kXmpMark;
+    default:            return 0;
+  }
+}
+
+/// Add a pulse duration to a set of clusters of similar durations.
+/// @param[in] value The duration to add. (Ticks)
+/// @param[in,out] clusters The clusters to add it to.
+/// @param[in,out] nr The nr. of clusters in use.
+/// @return false if it needed a new cluster, but they are all in use.
+static bool clusterPulse(const uint16_t value, pulse_cluster_t *clusters,
+                         uint8_t *nr) {
+  uint8_t c = 0;
+  // Join the first cluster that is within approx. 25% of the value.
+  while (c < *nr && (value * 4UL < clusters[c].low * 3UL ||
+                     value * 3UL > clusters[c].high * 4UL))
+    c++;
+  if (c == *nr) {  // Nothing similar, so start a new cluster.
+    if (*nr == kMaxPulseClusters) return false;  // Too varied to be useful.
+    clusters[c].low = value;
+    clusters[c].high = value;
+    clusters[c].count = 0;
+    (*nr)++;
+  }
+  clusters[c].low = std::min(clusters[c].low, value);
+  clusters[c].high = std::max(clusters[c].high, value);
+  clusters[c].count++;
+  return true;
+}
+
+/// Build an index of the distinct mark & space durations in a capture.
+/// Similar durations are grouped into the same cluster. It is only built once
+/// per capture, and only as far as a decoder needs it.
+/// @param[in] results Ptr to the capture to index.
+/// @param[in] until Stop after indexing a mark in this window.
+///   NULL means index the whole capture.
+/// @return true if it stopped at a mark in the `until` window.
+bool IRrecv::_indexPulses(const decode_results *results,
+                          const match_window_t *until) {
+  if (!_pulses.valid) {  // Start a new index.
+    _pulses.valid = true;
+    _pulses.overflow = false;
+    _pulses.nmarks = 0;
+    _pulses.nspaces = 0;
+    _pulses.next = kStartOffset;
+  }
+  while (_pulses.next < results->rawlen && !_pulses.overflow) {
+    const uint16_t i = _pulses.next++;
+    const uint16_t value = results->rawbuf[i];
+    if (i % 2) {  // A mark.
+      _pulses.overflow = !clusterPulse(value, _pulses.marks, &_pulses.nmarks);
+      if (until != NULL && value >= until->low && value <= until->high)
+        return true;
+    } else {  // A space.
+      _pulses.overflow = !clusterPulse(value, _pulses.spaces,
+                                       &_pulses.nspaces);
+    }
+  }
+  return false;
+}
+
+/// Could a capture contain a given mark duration?
+/// @param[in] results Ptr to the capture being decoded.
+/// @param[in] usecs The mark duration (in uSecs) we are looking for.
+/// @return false if there is definitely no such mark, otherwise true.
+/// @note Most marks a decoder looks for are either near the start of the
+///   capture or not there at all. So only index as much as it takes to find it.
+bool IRrecv::_hasMark(const decode_results *results, const uint16_t usecs) {
+  const match_window_t window = matchWindow(usecs, _screenTolerance(),
+                                            kScreenDelta);
+  if (_pulses.valid) {  // Is it in what has been indexed already?
+    if (_pulses.overflow) return true;  // We can't tell.
+    for (uint8_t c = 0; c < _pulses.nmarks; c++)
+      if (_pulses.marks[c].high >= window.low &&
+          _pulses.marks[c].low <= window.high) return true;
+  }
+  if (_indexPulses(results, &window)) return true;  // Found in the rest.
+  if (_pulses.overflow) return true;  // We can't tell.
+  // The rest may have widened a cluster enough to overlap it.
+  for (uint8_t c = 0; c < _pulses.nmarks; c++)
+    if (_pulses.marks[c].high >= window.low &&
+        _pulses.marks[c].low <= window.high) return true;
+  return false;
+}
+
+#if DECODE_NEC
+/// Decode NEC-like messages that don't follow the true NEC spec.
+/// e.g. Apple TV remote etc. Used by the decoder table.
+/// @param[in,out] results Ptr to the data to decode & where to store the result
+/// @param[in] offset The starting index to use when attempting to decode the
+///   raw data. Typically/Defaults to kStartOffset.
+/// @param[in] nbits The number of data bits to expect.
+/// @param[in] strict Flag indicating if we should perform strict matching.
+/// @return A boolean. True if it can decode it, false if it can't.
+bool IRrecv::_decodeNECLike(decode_results *results, uint16_t offset,
+                            const uint16_t nbits, const bool strict) {
+  if (!decodeNEC(results, offset, nbits, strict)) return false;
+  results->decode_type = NEC_LIKE;
+  return true;
+}
+#endif  // DECODE_NEC
+
+#if DECODE_PANASONIC
+/// Decode Panasonic messages with the manufacturer code implied by the size.
+/// Used by the decoder table.
+/// @param[in,out] results Ptr to the data to decode & where to store the result
+/// @param[in] offset The starting index to use when attempting to decode the
+///   raw data. Typically/Defaults to kStartOffset.
+/// @param[in] nbits The number of data bits to expect.
+/// @param[in] strict Flag indicating if we should perform strict matching.
+/// @return A boolean. True if it can decode it, false if it can't.
+bool IRrecv::_decodePanasonic(decode_results *results, uint16_t offset,
+                              const uint16_t nbits, const bool strict) {
+  return decodePanasonic(results, offset, nbits, strict,
+                         (nbits == kPanasonic40Bits) ? kPanasonic40Manufacturer
+                                                     : kPanasonicManufacturer);
+}
+#endif  // DECODE_PANASONIC
+
+#if DECODE_SHARP
+/// Decode Sharp messages, with expansion. Used by the decoder table.
+/// @param[in,out] results Ptr to the data to decode & where to store the result
+/// @param[in] offset The starting index to use when attempting to decode the
+///   raw data. Typically/Defaults to kStartOffset.
+/// @param[in] nbits The number of data bits to expect.
+/// @param[in] strict Flag indicating if we should perform strict matching.
+/// @return A boolean. True if it can decode it, false if it can't.
+bool IRrecv::_decodeSharp(decode_results *results, uint16_t offset,
+                          const uint16_t nbits, const bool strict) {
+  return decodeSharp(results, offset, nbits, strict, true);
+}
+#endif  // DECODE_SHARP
+
+#if (DECODE_HITACHI_AC || DECODE_HITACHI_AC2 || DECODE_HITACHI_AC264 || \
+     DECODE_HITACHI_AC344)
+/// Decode Hitachi A/C messages with the bit order implied by the size.
+/// Used by the decoder table.
+/// @param[in,out] results Ptr to the data to decode & where to store the result
+/// @param[in] offset The starting index to use when attempting to decode the
+///   raw data. Typically/Defaults to kStartOffset.
+/// @param[in] nbits The number of data bits to expect.
+/// @param[in] strict Flag indicating if we should perform strict matching.
+/// @return A boolean. True if it can decode it, false if it can't.
+bool IRrecv::_decodeHitachiAC(decode_results *results, uint16_t offset,
+                              const uint16_t nbits, const bool strict) {
+  return decodeHitachiAC(results, offset, nbits, strict,
+                         nbits != kHitachiAc344Bits &&
+                         nbits != kHitachiAc264Bits);
+}
+#endif  // (DECODE_HITACHI_AC || DECODE_HITACHI_AC2 || DECODE_HITACHI_AC264 ||
+        //  DECODE_HITACHI_AC344)
+
+/// Decodes the received IR message.
+/// If the interrupt state is saved, we will immediately resume waiting
+/// for the next IR message to avoid missing messages.
+/// @note There is a trade-off here. Saving the state means less time lost until
+/// we can receiving the next message vs. using more RAM. Choose appropriately.
+/// @param[out] results A PTR to where the decoded IR message will be stored.
+/// @param[out] save A PTR to an irparams_t instance in which to save
+///   the interrupt's memory/state. NULL means don't save it.
+/// @param[in] max_skip Maximum Nr. of pulses at the begining of a capture we
+///   can skip when attempting to find a protocol we can successfully decode.
+///   This parameter can dramatically improve detection of protocols
+///   when there is light IR interference just before an incoming IR
+///   message, however, it comes at a steep performace price.
+///   (Default is 0. No skipping.)
+/// @warning Increasing the `max_skip` value will dramatically (linearly)
+///   increase the cpu time & usage to decode protocols.
+///   e.g. 0 -> 1 will be a 2x increase in cpu usage/time.
+///        0 -> 2 will be a 3x increase etc.
+///   If you are going to do this, consider disabling protocol decoding for
+///   protocols you are not expecting.
+/// @param[in] noise_floor Pulses below this size (in usecs) will be removed or
+///   merged prior to any decoding. This is to try to remove noise/poor
+///   readings & slightly increase the chances of a successful decode but at the
+///   cost of data fidelity & integrity.
+///   (Defaults to 0 usecs. i.e. Don't filter; which is safe!)
+/// @warning DANGER: **Here Be Dragons!**
+///   If you set the `noise_floor` value too high, it **WILL** break decoding
+///   of some protocols. You have been warned!
+///   **Any** non-zero value has the potential to **cook** the captured raw data
+///   i.e. The raw data is going to lie to you.
+///   It may obscure hardware, circuit, & environment issues thus making it
+///   impossible to support you accurately or confidently.
+///     Values of <= 50 usecs will probably be safe.
+///     51 - 100 usecs **might** be okay.
+///     100 - 150 usecs is "Danger, Will Robinson!".
+///     150 - 200 usecs expect broken protocols.
+///     At 200+ usecs, you **have** protocols you can't decode!!
+/// @return A boolean indicating if an IR message is ready or not.
+bool IRrecv::decode(decode_results *results, irparams_t *save,
+                    uint8_t max_skip, uint16_t noise_floor) {
+  // Proceed only if an IR message been received.
+#ifndef UNIT_TEST
+  if (!params.nslots && params.rcvstate != kStopState)
+    // Still capturing. Maybe we already have enough to decode a message.
+    return _early_decode ? _decodeEarly(results, save) : false;
+#endif
+
+  // Clear the entry we are currently pointing to when we got the timeout.
+  // i.e. Stopped collecting IR data.
+  // It's junk as we never wrote an entry to it and can only confuse decoding.
+  // This is done here rather than logically the best place in read_timeout()
+  // as it saves a few bytes of ICACHE_RAM as that routine is bound to an
+  // interrupt. decode() is not stored in ICACHE_RAM.
+  // Another better option would be to zero the entire irparams.rawbuf[] on
+  // resume() but that is a much more expensive operation compare to this.
+  // However, don't do this if rawbuf is already full as we stomp over the heap.
+  // See: https://github.com/crankyoldgit/IRremoteESP8266/issues/1516
+  // Also guard against rawlen == bufsize (with overflow still false), which
+  // occurs because the ISR increments rawlen *after* writing the last entry.
+  // Writing rawbuf[bufsize] would be an off-by-one heap overflow.
+  // See: https://github.com/crankyoldgit/IRremoteESP8266/issues/2198
+  // With capture slots, the ISR may be writing to it, so it's done per slot.
+  if (!params.nslots && !params.overflow && params.rawlen < params.bufsize)
+    params.rawbuf[params.rawlen] = 0;
+
+  bool resumed = false;  // Flag indicating if we have resumed.
+
+  if (params.nslots) {
+    // Use the oldest IR message waiting in the capture slots, if there is one.
+    if (!_readSlot(results, save)) return false;
+    resumed = (save != NULL);  // We have a copy, & the slot is released.
+  } else {
+    // If we were requested to use a save buffer previously, do so.
+    if (save == NULL) save = irparams_save;
+
+    if (save == NULL) {
+      // We haven't been asked to copy it so use the existing memory.
+#ifndef UNIT_TEST
+      results->rawbuf = params.rawbuf;
+      results->rawlen = params.rawlen;
+      results->overflow = params.overflow;
+#endif
+    } else {
+      copyIrParams(&params, save);  // Duplicate the interrupt's memory.
+      resume();  // It's now safe to rearm. The IR message won't be overridden.
+      resumed = true;
+      // Point the results at the saved copy.
+      results->rawbuf = save->rawbuf;
+      results->rawlen = save->rawlen;
+      results->overflow = save->overflow;
+    }
+  }
+
+  // Reset any previously partially processed results.
+  results->decode_type = UNKNOWN;
+  results->bits = 0;
+  results->value = 0;
+  results->address = 0;
+  results->command = 0;
+  results->repeat = false;
+
+#if ENABLE_NOISE_FILTER_OPTION
+  crudeNoiseFilter(results, noise_floor);
+#endif  // ENABLE_NOISE_FILTER_OPTION
+  // Keep looking for protocols until we've run out of entries to skip or we
+  // find a valid protocol message.
+  _pulses.valid = false;  // It's a new capture, so index it if needed.
+#ifdef UNIT_TEST
+  _decodeAttempts = 0;
+  _decodeCandidates = 0;
+#endif  // UNIT_TEST
+  uint8_t candidates[sizeof(_headerless)];
+  for (uint16_t offset = kStartOffset;
+       offset <= (max_skip * 2) + kStartOffset;
+       offset += 2) {
+    // Only look at the decoders in the bucket for this header mark, plus the
+    // headerless ones. They are still tried in table order.
+    _findCandidates(results, offset, candidates);
+    for (uint16_t i = 0; i < _nrDecoders; i++) {
+      if (!(candidates[i / 8] & (1 << (i % 8)))) continue;
+#ifdef UNIT_TEST
+      _decodeCandidates++;
+#endif  // UNIT_TEST
+      decoder_entry_t entry;
+      memcpy_P(&entry, &_decoders[i], sizeof(entry));
+      if (!_worthTrying(results, offset, &entry)) continue;
+      DPRINT("Attempting decode of ");
+      DPRINTLN(typeToString(entry.type));
+#ifdef UNIT_TEST
+      _decodeAttempts++;
+#endif  // UNIT_TEST
+#if ENABLE_DECODE_PROFILING
+      DecodeTimer timer;
+      _profile_reject = NULL;
+#endif  // ENABLE_DECODE_PROFILING
+      _traceDecoder(entry.type, offset);
+      const bool success = (this->*entry.decoder)(results, offset, entry.nbits,
+                                                  entry.strict);
+      _traceDecoder(UNKNOWN, 0);
+#if ENABLE_DECODE_PROFILING
+      decode_profile_t *profile = &_profile[entry.type];
+      profile->nsecs += timer.elapsed();
+      profile->attempts++;
+      if (success) {
+        profile->successes++;
+      } else if (_profile_reject != NULL) {
+        profile->rejects++;
+        profile->reject_offsets += _profile_reject - results->rawbuf;
+      }
+#endif  // ENABLE_DECODE_PROFILING
+      if (success) return true;
+    }
+  }
+#if DECODE_HASH
+  // decodeHash returns a hash on any input.
+  // Thus, it needs to be last in the list.
+  // If you add any decodes, add them before this.
+  if (decodeHash(results)) {
+    return true;
+  }
+#endif  // DECODE_HASH
+  // Throw away and start over
+  if (!resumed)  // Check if we have already resumed.
+    resume();
+  return false;
+}
+
+/// Can a protocol be decoded before the timeout tells us the message is over?
+/// i.e. It has a fixed length & ends with a mark, so we know when we have all
+/// of it.
+/// @param[in] protocol The protocol to check.
+/// @return true if it can, otherwise false.
+bool IRrecv::_canDecodeEarly(const decode_type_t protocol) {
+  switch (protocol) {
+    case NEC:
+    case SAMSUNG:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Try to decode a message that is still being captured. i.e. The timeout
+/// hasn't told us the message has finished yet.
+/// Only the decoders in the table for protocols we can decode early are tried.
+/// @param[out] results A PTR to where the decoded IR message will be stored.
+/// @param[out] save A PTR to an irparams_t instance in which to save
+///   the interrupt's memory/state. NULL means don't save it.
+/// @return A boolean indicating if an IR message is ready or not.
+/// @note If successful, capturing stops as if the timeout had occurred.
+///   Noise filtering & skipping of leading pulses are not performed.
+bool IRrecv::_decodeEarly(decode_results *results, irparams_t *save) {
+  // The ISR can add to the capture at any time, so work from a snapshot of the
+  // length. The entries before it won't change. Unlike `decode()`, we can't
+  // clear the entry after the last one, as the ISR may be writing to it.
+  const uint16_t rawlen = params.rawlen;
+  // A message can only have ended after a mark, i.e. at an even length.
+  // Don't try again if nothing has been added since the last attempt.
+  if (rawlen % 2 || rawlen == _early_rawlen || params.overflow) return false;
+  _early_rawlen = rawlen;
+
+  results->rawbuf = params.rawbuf;
+  results->rawlen = rawlen;
+  results->overflow = false;
+  results->decode_type = UNKNOWN;
+  results->bits = 0;
+  results->value = 0;
+  results->address = 0;
+  results->command = 0;
+  results->repeat = false;
+
+  uint8_t candidates[sizeof(_headerless)];
+  _findCandidates(results, kStartOffset, candidates);
+  for (uint16_t i = 0; i < _nrDecoders; i++) {
+    if (!(candidates[i / 8] & (1 << (i % 8)))) continue;
+    decoder_entry_t entry;
+    memcpy_P(&entry, &_decoders[i], sizeof(entry));
+    if (!_canDecodeEarly(entry.type) ||
+        !_plausibleHeader(results, kStartOffset, entry.hdrmark, entry.hdrspace))
+      continue;
+    DPRINT("Attempting early decode of ");
+    DPRINTLN(typeToString(entry.type));
+    // Always be strict, so we don't report the start of a longer message.
+    _traceDecoder(entry.type, kStartOffset);
+    const bool success = (this->*entry.decoder)(results, kStartOffset,
+                                                entry.nbits, true);
+    _traceDecoder(UNKNOWN, 0);
+    if (success) {
+      // Stop capturing, like the timeout does. The ISRs are still armed.
+      lockCapture();
+      params.rcvstate = kStopState;
+      unlockCapture();
+      if (save == NULL) save = irparams_save;
+      if (save != NULL) {
+        copyIrParams(&params, save);  // Duplicate the interrupt's memory.
+        save->rawlen = rawlen;  // Ignore anything added since the snapshot.
+        results->rawbuf = save->rawbuf;
+        resume();  // It's now safe to rearm.
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+// Record the details of a match, if we are tracing them.
+// The arguments aren't evaluated if we aren't, so tracing costs nothing.
+#if ENABLE_MATCH_TRACE || defined(DEBUG)
+#define TRACE_MATCH(measured, low, high, matched) \
+    _traceMatch(measured, low, high, matched)
+#else  // ENABLE_MATCH_TRACE || defined(DEBUG)
+#define TRACE_MATCH(measured, low, high, matched)
+#endif  // ENABLE_MATCH_TRACE || defined(DEBUG)
+
+#if ENABLE_MATCH_TRACE || defined(DEBUG)
+/// Record the details of a match in the trace, and/or print them if debugging.
+/// @param[in] measured The duration of the pulse. (uSecs)
+/// @param[in] low The shortest duration that matches. (uSecs)
+/// @param[in] high The longest duration that matches. (uSecs)
+///   UINT32_MAX means there is no limit.
+/// @param[in] matched Was it a match?
+void IRrecv::_traceMatch(const uint32_t measured, const uint32_t low,
+                         const uint32_t high, const bool matched) {
   DPRINT("Matching: ");
-  DPRINT(ticksLow(desired, tolerance, delta));
+  DPRINT(low);
   DPRINT(" <= ");
   DPRINT(measured);
   DPRINT(" <= ");
-  DPRINTLN(ticksHigh(desired, tolerance, delta));
+  DPRINT(high);
+  DPRINTLN((matched ? " Yes" : " No"));
+#if ENABLE_MATCH_TRACE
+  match_trace_t *trace = &_trace[_trace_count % kMatchTraceLength];
+  trace->protocol = _trace_protocol;
+  trace->offset = _trace_offset;
+  trace->step = _trace_step++;
+  trace->measured = measured;
+  trace->low = low;
+  trace->high = high;
+  trace->matched = matched;
+  _trace_count++;
+  if (_trace_count == 2 * kMatchTraceLength)  // Stop it from ever wrapping.
+    _trace_count = kMatchTraceLength;
+  if (_trace_hook != NULL) _trace_hook(trace);
+#endif  // ENABLE_MATCH_TRACE
+}
+#endif  // ENABLE_MATCH_TRACE || defined(DEBUG)
+
+/// Note which decoder is being tried, so its matches can be traced as such.
+/// @param[in] protocol The decoder's protocol. UNKNOWN if none.
+/// @param[in] offset The capture offset the decoder is starting at.
+void IRrecv::_traceDecoder(const decode_type_t protocol,
+                           const uint16_t offset) {
+#if ENABLE_MATCH_TRACE
+  _trace_protocol = protocol;
+  _trace_offset = offset;
+  _trace_step = 0;
+#else  // ENABLE_MATCH_TRACE
+  (void)protocol;
+  (void)offset;
+#endif  // ENABLE_MATCH_TRACE
+}
+
+/// Note where in the capture buffer a matcher gave up. (For profiling)
+/// @param[in] ptr Where in the capture buffer the matcher gave up.
+/// @return Always 0. i.e. A failed match, so matchers can `return` it.
+uint16_t IRrecv::_rejectAt(atomic_uint16_t *ptr) {
+#if ENABLE_DECODE_PROFILING
+  if (ptr > _profile_reject) _profile_reject = ptr;
+#else  // ENABLE_DECODE_PROFILING
+  (void)ptr;  // Unused.
+#endif  // ENABLE_DECODE_PROFILING
+  return 0;
+}
+
+/// Convert the tolerance percentage into something valid.
+/// @param[in] percentage An integer percentage.
+uint8_t IRrecv::_validTolerance(const uint8_t percentage) {
+    return (percentage > 100) ? _tolerance : percentage;
+}
+
+/// Calculate the lower bound of the nr. of ticks.
+/// @param[in] usecs Nr. of uSeconds.
+/// @param[in] tolerance Percent as an integer. e.g. 10 is 10%
+/// @param[in] delta A non-scaling amount to reduce usecs by.
+/// @return Nr. of ticks.
+uint32_t IRrecv::ticksLow(const uint32_t usecs, const uint8_t tolerance,
+                          const uint16_t delta) {
+  // Integer maths only, as floating point is very slow on most MCUs.
+  // i.e. usecs * (1.0 - tolerance / 100.0) - delta, rounded down, min. of 0.
+  const uint32_t reduced = usecs -
+      (usecs * _validTolerance(tolerance) + 99) / 100;
+  return (reduced > delta) ? reduced - delta : 0;
+}
+
+/// Calculate the upper bound of the nr. of ticks.
+/// @param[in] usecs Nr. of uSeconds.
+/// @param[in] tolerance Percent as an integer. e.g. 10 is 10%
+/// @param[in] delta A non-scaling amount to increase usecs by.
+/// @return Nr. of ticks.
+uint32_t IRrecv::ticksHigh(const uint32_t usecs, const uint8_t tolerance,
+                           const uint16_t delta) {
+  // Integer maths only. i.e. usecs * (1.0 + tolerance / 100.0) rounded down.
+  return usecs + usecs * _validTolerance(tolerance) / 100 + 1 + delta;
+}
+
+/// Calculate the range of capture buffer values that match a desired period
+///   within +/-tolerance percent and/or +/- a fixed delta range.
+/// @param[in] desired The expected period (in usecs) we are matching against.
+/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
+/// @param[in] delta A non-scaling (+/-) error margin (in useconds).
+/// @return The window of matching values, in capture buffer ticks.
+/// @note Calculate a window once, & then use it via `match(measured, window)`
+///   to make repeated matches against the same value as cheap as possible.
+match_window_t IRrecv::matchWindow(const uint32_t desired,
+                                   const uint8_t tolerance,
+                                   const uint16_t delta) {
+  const uint32_t low = ticksLow(desired, tolerance, delta);
+  const uint32_t high = ticksHigh(desired, tolerance, delta);
 #ifdef UNIT_TEST
   // Sanity checks that we don't have values that cause integer over/underflow.
   // Only performed during testing so there is no performance hit in normal
   // operation.
-  assert(ticksLow(desired, tolerance, delta) <= desired);
+  assert(desired <= UINT32_MAX / 100);
+  assert(low <= desired);
   // Check if we overflowed.  (UINT32_MAX >> 3 is approx 9 minutes!)
-  assert(ticksHigh(desired, tolerance, delta) < UINT32_MAX >> 3);
+  assert(high < UINT32_MAX >> 3);
   // Check if our high mark is below where we started. This could happen.
   // If there is a legit case, then this should be removed.
-  assert(ticksHigh(desired, tolerance, delta) >= desired);
+  assert(high >= desired);
 #endif  // UNIT_TEST
-  return (measured >= ticksLow(desired, tolerance, delta) &&
-          measured <= ticksHigh(desired, tolerance, delta));
+  match_window_t window;
+  // Convert to ticks. Round inwards so comparing a raw tick value gives the
+  // same answer as comparing it in uSecs.
+  window.low = (low + kRawTick - 1) / kRawTick;
+  window.high = high / kRawTick;
+  return window;
+}
+
+/// Calculate the range of capture buffer values that match a mark signal
+///   within +/-tolerance percent, after an expected is excess is added.
+/// @param[in] desired The expected period (in usecs) we are matching against.
+/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
+/// @param[in] excess A non-scaling amount to reduce usecs by.
+/// @return The window of matching values, in capture buffer ticks.
+match_window_t IRrecv::markWindow(const uint32_t desired,
+                                  const uint8_t tolerance,
+                                  const int16_t excess) {
+  // Don't let a negative excess wrap a tiny (or unused) value around.
+  return matchWindow(std::max(static_cast<int32_t>(desired) + excess,
+                              static_cast<int32_t>(0)), tolerance);
+}
+
+/// Calculate the range of capture buffer values that match a space signal
+///   within +/-tolerance percent, after an expected is excess is removed.
+/// @param[in] desired The expected period (in usecs) we are matching against.
+/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
+/// @param[in] excess A non-scaling amount to reduce usecs by.
+/// @return The window of matching values, in capture buffer ticks.
+match_window_t IRrecv::spaceWindow(const uint32_t desired,
+                                   const uint8_t tolerance,
+                                   const int16_t excess) {
+  // Don't let the excess wrap a tiny (or unused) value around.
+  return matchWindow(std::max(static_cast<int32_t>(desired) - excess,
+                              static_cast<int32_t>(0)), tolerance);
+}
+
+/// Check if we match a pulse(measured) with a precalculated window.
+/// @param[in] measured The recorded period of the signal pulse. (Ticks)
+/// @param[in] window The range of matching values. See `matchWindow()`.
+/// @return A Boolean. true if it matches, false if it doesn't.
+bool IRrecv::match(const uint32_t measured, const match_window_t window) {
+  const bool matched = measured >= window.low && measured <= window.high;
+  TRACE_MATCH(measured * kRawTick, window.low * kRawTick,
+              window.high * kRawTick, matched);
+  return matched;
+}
+
+/// Check if we match a pulse(measured) with the desired within
+///   +/-tolerance percent and/or +/- a fixed delta range.
+/// @param[in] measured The recorded period of the signal pulse.
+/// @param[in] desired The expected period (in usecs) we are matching against.
+/// @param[in] tolerance A percentage expressed as an integer. e.g. 10 is 10%.
+/// @param[in] delta A non-scaling (+/-) error margin (in useconds).
+/// @return A Boolean. true if it matches, false if it doesn't.
+bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
+                   uint16_t delta) {
+  return match(measured, matchWindow(desired, tolerance, delta));
 }
 
 /// Check if we match a pulse(measured) of at least desired within
@@ -1320,21 +2535,6 @@ bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
 bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
                           uint8_t tolerance, uint16_t delta) {
   measured *= kRawTick;  // Convert to uSecs.
-  DPRINT("Matching ATLEAST ");
-  DPRINT(measured);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(". Matching: ");
-  DPRINT(measured);
-  DPRINT(" >= ");
-  DPRINT(ticksLow(std::min(desired,
-                           static_cast<uint32_t>(MS_TO_USEC(params.timeout))),
-                  tolerance, delta));
-  DPRINT(" [min(");
-  DPRINT(ticksLow(desired, tolerance, delta));
-  DPRINT(", ");
-  DPRINT(ticksLow(MS_TO_USEC(params.timeout), tolerance, delta));
-  DPRINTLN(")]");
 #ifdef UNIT_TEST
   // Sanity checks that we don't have values that cause integer over/underflow.
   // Only performed during testing so there is no performance hit in normal
@@ -1349,9 +2549,11 @@ bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
   // We really should never get a value of 0, except as the last value
   // in the buffer. If that is the case, then assume infinity and return true.
   if (measured == 0) return true;
-  return measured >= ticksLow(std::min(
+  const uint32_t low = ticksLow(std::min(
       desired, static_cast<uint32_t>(MS_TO_USEC(params.timeout))), tolerance,
       delta);
+  TRACE_MATCH(measured, low, UINT32_MAX, measured >= low);
+  return measured >= low;
 }
 
 /// Check if we match a mark signal(measured) with the desired within
@@ -1363,13 +2565,6 @@ bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchMark(uint32_t measured, uint32_t desired, uint8_t tolerance,
                        int16_t excess) {
-  DPRINT("Matching MARK ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" + ");
-  DPRINT(excess);
-  DPRINT(". ");
   return match(measured, desired + excess, tolerance);
 }
 
@@ -1383,13 +2578,6 @@ bool IRrecv::matchMark(uint32_t measured, uint32_t desired, uint8_t tolerance,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchMarkRange(const uint32_t measured, const uint32_t desired,
                             const uint16_t range, const int16_t excess) {
-  DPRINT("Matching MARK ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" + ");
-  DPRINT(excess);
-  DPRINT(". ");
   return match(measured, desired + excess, 0, range);
 }
 
@@ -1402,13 +2590,6 @@ bool IRrecv::matchMarkRange(const uint32_t measured, const uint32_t desired,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchSpace(uint32_t measured, uint32_t desired, uint8_t tolerance,
                         int16_t excess) {
-  DPRINT("Matching SPACE ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" - ");
-  DPRINT(excess);
-  DPRINT(". ");
   return match(measured, desired - excess, tolerance);
 }
 
@@ -1422,26 +2603,36 @@ bool IRrecv::matchSpace(uint32_t measured, uint32_t desired, uint8_t tolerance,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchSpaceRange(const uint32_t measured, const uint32_t desired,
                              const uint16_t range, const int16_t excess) {
-  DPRINT("Matching SPACE ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" - ");
-  DPRINT(excess);
-  DPRINT(". ");
   return match(measured, desired - excess, 0, range);
 }
 
+/// Check if we match a mark signal(measured) with a precalculated window.
+/// @param[in] measured The recorded period of the signal pulse. (Ticks)
+/// @param[in] window The range of matching values. See `markWindow()`.
+/// @return A Boolean. true if it matches, false if it doesn't.
+bool IRrecv::matchMark(const uint32_t measured, const match_window_t window) {
+  return match(measured, window);
+}
+
+/// Check if we match a space signal(measured) with a precalculated window.
+/// @param[in] measured The recorded period of the signal pulse. (Ticks)
+/// @param[in] window The range of matching values. See `spaceWindow()`.
+/// @return A Boolean. true if it matches, false if it doesn't.
+bool IRrecv::matchSpace(const uint32_t measured, const match_window_t window) {
+  return match(measured, window);
+}
+
 #if DECODE_HASH
 /// Compare two tick values.
 /// @param[in] oldval Nr. of ticks.
 /// @param[in] newval Nr. of ticks.
 /// @return 0 if newval is shorter, 1 if it is equal, & 2 if it is longer.
-/// @note Use a tolerance of 20%
+/// @note Use a tolerance of 20%. i.e. `newval < oldval * 0.8` etc, but with
+///   integers. It gives the same results for every possible pair of values.
 uint16_t IRrecv::compare(const uint16_t oldval, const uint16_t newval) {
-  if (newval < oldval * 0.8)
+  if (newval * 5UL < oldval * 4UL)
     return 0;
-  else if (oldval < newval * 0.8)
+  else if (oldval * 5UL < newval * 4UL)
     return 2;
   else
     return 1;
@@ -1481,27 +2672,45 @@ bool IRrecv::decodeHash(decode_results *results) {
 }
 #endif  // DECODE_HASH
 
-/// Match & decode the typical data section of an IR message.
-/// The data value is stored in the least significant bits reguardless of the
-/// bit ordering requested.
-/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
-/// @param[in] nbits Nr. of data bits we expect.
+/// Calculate the match windows for the data bits of a message.
 /// @param[in] onemark Nr. of uSeconds in an expected mark signal for a '1' bit.
 /// @param[in] onespace Nr. of uSecs in an expected space signal for a '1' bit.
 /// @param[in] zeromark Nr. of uSecs in an expected mark signal for a '0' bit.
 /// @param[in] zerospace Nr. of uSecs in an expected space signal for a '0' bit.
-/// @param[in] tolerance Percentage error margin to allow. (Default: kUseDefTol)
-/// @param[in] excess Nr. of uSeconds. (Def: kMarkExcess)
-/// @param[in] MSBfirst Bit order to save the data in. (Def: true)
+/// @param[in] tolerance Percentage error margin to allow.
+/// @param[in] excess Nr. of uSeconds.
+/// @return A data_windows_t structure for use with `_matchData()` etc.
+data_windows_t IRrecv::_dataWindows(const uint16_t onemark,
+                                    const uint32_t onespace,
+                                    const uint16_t zeromark,
+                                    const uint32_t zerospace,
+                                    const uint8_t tolerance,
+                                    const int16_t excess) {
+  data_windows_t windows;
+  windows.onemark = markWindow(onemark, tolerance, excess);
+  windows.onespace = spaceWindow(onespace, tolerance, excess);
+  windows.zeromark = markWindow(zeromark, tolerance, excess);
+  windows.zerospace = spaceWindow(zerospace, tolerance, excess);
+  return windows;
+}
+
+/// Match & decode the typical data section of an IR message using
+/// precalculated match windows.
+/// The data value is stored in the least significant bits reguardless of the
+/// bit ordering requested.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[in] nbits Nr. of data bits we expect.
+/// @param[in] windows A ptr to the match windows for the bits.
+/// @param[in] MSBfirst Bit order to save the data in.
 ///   true is Most Significant Bit First Order, false is Least Significant First
 /// @param[in] expectlastspace Do we expect a space at the end of the message?
 /// @return A match_result_t structure containing the success (or not), the
 ///   data value, and how many buffer entries were used.
-match_result_t IRrecv::matchData(
-    atomic_uint16_t *data_ptr, const uint16_t nbits, const uint16_t onemark,
-    const uint32_t onespace, const uint16_t zeromark, const uint32_t zerospace,
-    const uint8_t tolerance, const int16_t excess, const bool MSBfirst,
-    const bool expectlastspace) {
+match_result_t IRrecv::_matchData(atomic_uint16_t *data_ptr,
+                                  const uint16_t nbits,
+                                  const data_windows_t *windows,
+                                  const bool MSBfirst,
+                                  const bool expectlastspace) {
   match_result_t result;
   result.success = false;  // Fail by default.
   result.data = 0;
@@ -1509,31 +2718,32 @@ match_result_t IRrecv::matchData(
     for (result.used = 0; result.used < nbits * 2;
          result.used += 2, data_ptr += 2) {
       // Is the bit a '1'?
-      if (matchMark(*data_ptr, onemark, tolerance, excess) &&
-          matchSpace(*(data_ptr + 1), onespace, tolerance, excess)) {
+      if (matchMark(*data_ptr, windows->onemark) &&
+          matchSpace(*(data_ptr + 1), windows->onespace)) {
         result.data = (result.data << 1) | 1;
-      } else if (matchMark(*data_ptr, zeromark, tolerance, excess) &&
-                 matchSpace(*(data_ptr + 1), zerospace, tolerance, excess)) {
+      } else if (matchMark(*data_ptr, windows->zeromark) &&
+                 matchSpace(*(data_ptr + 1), windows->zerospace)) {
         result.data <<= 1;  // The bit is a '0'.
       } else {
         if (!MSBfirst) result.data = reverseBits(result.data, result.used / 2);
+        _rejectAt(data_ptr);
         return result;  // It's neither, so fail.
       }
     }
     result.success = true;
   } else {  // We are expecting data without a final space.
     // Match all but the last bit, as it may not match easily.
-    result = matchData(data_ptr, nbits ? nbits - 1 : 0, onemark, onespace,
-                       zeromark, zerospace, tolerance, excess, true, true);
+    result = _matchData(data_ptr, nbits ? nbits - 1 : 0, windows, true, true);
     if (result.success) {
       // Is the bit a '1'?
-      if (matchMark(*(data_ptr + result.used), onemark, tolerance, excess))
+      if (matchMark(*(data_ptr + result.used), windows->onemark))
         result.data = (result.data << 1) | 1;
-      else if (matchMark(*(data_ptr + result.used), zeromark, tolerance,
-               excess))
+      else if (matchMark(*(data_ptr + result.used), windows->zeromark))
         result.data <<= 1;  // The bit is a '0'.
-      else
+      else {
+        _rejectAt(data_ptr + result.used);
         result.success = false;
+      }
       if (result.success) result.used++;
     }
   }
@@ -1541,6 +2751,143 @@ match_result_t IRrecv::matchData(
   return result;
 }
 
+/// Match & decode the typical data section of an IR message.
+/// The data value is stored in the least significant bits reguardless of the
+/// bit ordering requested.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[in] nbits Nr. of data bits we expect.
+/// @param[in] onemark Nr. of uSeconds in an expected mark signal for a '1' bit.
+/// @param[in] onespace Nr. of uSecs in an expected space signal for a '1' bit.
+/// @param[in] zeromark Nr. of uSecs in an expected mark signal for a '0' bit.
+/// @param[in] zerospace Nr. of uSecs in an expected space signal for a '0' bit.
+/// @param[in] tolerance Percentage error margin to allow. (Default: kUseDefTol)
+/// @param[in] excess Nr. of uSeconds. (Def: kMarkExcess)
+/// @param[in] MSBfirst Bit order to save the data in. (Def: true)
+///   true is Most Significant Bit First Order, false is Least Significant First
+/// @param[in] expectlastspace Do we expect a space at the end of the message?
+/// @return A match_result_t structure containing the success (or not), the
+///   data value, and how many buffer entries were used.
+match_result_t IRrecv::matchData(
+    atomic_uint16_t *data_ptr, const uint16_t nbits, const uint16_t onemark,
+    const uint32_t onespace, const uint16_t zeromark, const uint32_t zerospace,
+    const uint8_t tolerance, const int16_t excess, const bool MSBfirst,
+    const bool expectlastspace) {
+  const data_windows_t windows = _dataWindows(onemark, onespace,
+                                              zeromark, zerospace,
+                                              tolerance, excess);
+  return _matchData(data_ptr, nbits, &windows, MSBfirst, expectlastspace);
+}
+
+// Nr. of bits `_matchBytes()` classifies per pass.
+const uint16_t kSymbolBlock = 64;
+
+/// Is a capture buffer value within a precalculated window?
+/// @param[in] measured The recorded period of the signal pulse. (Ticks)
+/// @param[in] window The range of matching values.
+/// @return 1 if it matches, 0 if it doesn't.
+static inline uint8_t inWindow(const uint32_t measured,
+                               const match_window_t window) {
+  return (measured >= window.low) & (measured <= window.high);
+}
+
+/// Classify the data bits (mark & space pairs) of a message into symbols.
+/// @param[in] buf A ptr to the first mark of the bits in the capture buffer.
+/// @param[out] symbols Where to store the symbol class of each bit.
+///   Bit 0 is set if it matches a '1', and bit 1 is set if it matches a '0'.
+///   i.e. 0 means it is neither, so it is invalid.
+/// @param[in] nbits Nr. of bits to classify.
+/// @param[in] windows A ptr to the match windows for the bits.
+/// @note There are no branches or early exits, so the compiler is free to
+///   unroll and/or vectorise the loop.
+static void classifyBits(const uint16_t *buf, uint8_t *symbols,
+                         const uint16_t nbits, const data_windows_t *windows) {
+  const match_window_t onemark = windows->onemark;
+  const match_window_t onespace = windows->onespace;
+  const match_window_t zeromark = windows->zeromark;
+  const match_window_t zerospace = windows->zerospace;
+  for (uint16_t i = 0; i < nbits; i++) {
+    const uint16_t mark = buf[2 * i];
+    const uint16_t space = buf[2 * i + 1];
+    symbols[i] = (inWindow(mark, onemark) & inWindow(space, onespace)) |
+        ((inWindow(mark, zeromark) & inWindow(space, zerospace)) << 1);
+  }
+}
+
+/// Match & decode the typical data section of an IR message using
+/// precalculated match windows.
+/// The bytes are stored at result_ptr. The first byte in the result equates to
+/// the first byte encountered, and so on.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[out] result_ptr A ptr to where to start storing the bytes we decoded.
+/// @param[in] remaining The size of the capture buffer remaining.
+/// @param[in] nbytes Nr. of data bytes we expect.
+/// @param[in] windows A ptr to the match windows for the bits.
+/// @param[in] MSBfirst Bit order to save the data in.
+///   true is Most Significant Bit First Order, false is Least Significant First
+/// @param[in] expectlastspace Do we expect a space at the end of the message?
+/// @return If successful, how many buffer entries were used. Otherwise 0.
+/// @note Rather than matching a bit at a time, each block of pulses is first
+///   classified into symbols in a single pass, then packed into bytes
+///   eight bits at a time.
+uint16_t IRrecv::_matchBytes(atomic_uint16_t *data_ptr, uint8_t *result_ptr,
+                             const uint16_t remaining, const uint16_t nbytes,
+                             const data_windows_t *windows,
+                             const bool MSBfirst, const bool expectlastspace) {
+  // Check if there is enough capture buffer to possibly have the desired bytes.
+  if (remaining + expectlastspace < (nbytes * 8 * 2) + 1)
+    return _rejectAt(data_ptr + remaining);  // Nope, so abort.
+  // Nothing writes to a capture buffer while it is being decoded, so it is safe
+  // to read it as non-volatile, which lets the classification be optimised.
+  const uint16_t *buf = const_cast<const uint16_t *>(data_ptr);
+  const uint16_t nbits = nbytes * 8;
+  // Multiplying the lowest bit of each byte of a word by these gathers them
+  // into the top byte of the result, in the desired bit order.
+  const uint64_t gather = MSBfirst ? 0x8040201008040201ULL
+                                   : 0x0102040810204080ULL;
+  const uint64_t lowbits = 0x0101010101010101ULL;
+  uint8_t symbols[kSymbolBlock];
+  for (uint16_t bit = 0; bit < nbits; bit += kSymbolBlock) {
+    const uint16_t block = std::min((uint16_t)(nbits - bit), kSymbolBlock);
+    const bool last = (bit + block == nbits);
+    if (last && !expectlastspace) {
+      // The last bit has no space to match, so only classify its mark.
+      classifyBits(buf + 2 * bit, symbols, block - 1, windows);
+      const uint16_t mark = buf[2 * (nbits - 1)];
+      symbols[block - 1] = inWindow(mark, windows->onemark) |
+          (inWindow(mark, windows->zeromark) << 1);
+    } else {
+      classifyBits(buf + 2 * bit, symbols, block, windows);
+    }
+    // Pack the symbols into bytes, eight at a time.
+    for (uint16_t i = 0; i < block; i += 8) {
+      uint64_t word;
+      memcpy(&word, symbols + i, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      word = __builtin_bswap64(word);
+#endif  // __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      // Every bit needs to be either a '1' or a '0'. (A '1' takes precedence.)
+      if (((word | (word >> 1)) & lowbits) != lowbits) {
+        uint16_t failed = i;
+        while (symbols[failed]) failed++;
+        const uint16_t *pulse = buf + 2 * (bit + failed);
+        if (inWindow(pulse[0], windows->onemark)) {  // So the space was wrong.
+          TRACE_MATCH(pulse[1] * kRawTick, windows->onespace.low * kRawTick,
+                      windows->onespace.high * kRawTick, false);
+        } else if (inWindow(pulse[0], windows->zeromark)) {  // Ditto.
+          TRACE_MATCH(pulse[1] * kRawTick, windows->zerospace.low * kRawTick,
+                      windows->zerospace.high * kRawTick, false);
+        } else {  // The mark was neither.
+          TRACE_MATCH(pulse[0] * kRawTick, windows->zeromark.low * kRawTick,
+                      windows->zeromark.high * kRawTick, false);
+        }
+        return _rejectAt(data_ptr + 2 * (bit + failed));  // Fail
+      }
+      result_ptr[(bit + i) / 8] = ((word & lowbits) * gather) >> 56;
+    }
+  }
+  return nbits * 2 - !expectlastspace;
+}
+
 /// Match & decode the typical data section of an IR message.
 /// The bytes are stored at result_ptr. The first byte in the result equates to
 /// the first byte encountered, and so on.
@@ -1564,20 +2911,11 @@ uint16_t IRrecv::matchBytes(atomic_uint16_t *data_ptr, uint8_t *result_ptr,
                             const uint16_t zeromark, const uint32_t zerospace,
                             const uint8_t tolerance, const int16_t excess,
                             const bool MSBfirst, const bool expectlastspace) {
-  // Check if there is enough capture buffer to possibly have the desired bytes.
-  if (remaining + expectlastspace < (nbytes * 8 * 2) + 1)
-    return 0;  // Nope, so abort.
-  uint16_t offset = 0;
-  for (uint16_t byte_pos = 0; byte_pos < nbytes; byte_pos++) {
-    bool lastspace = (byte_pos + 1 == nbytes) ? expectlastspace : true;
-    match_result_t result = matchData(data_ptr + offset, 8, onemark, onespace,
-                                      zeromark, zerospace, tolerance, excess,
-                                      MSBfirst, lastspace);
-    if (result.success == false) return 0;  // Fail
-    result_ptr[byte_pos] = (uint8_t)result.data;
-    offset += result.used;
-  }
-  return offset;
+  const data_windows_t windows = _dataWindows(onemark, onespace,
+                                              zeromark, zerospace,
+                                              tolerance, excess);
+  return _matchBytes(data_ptr, result_ptr, remaining, nbytes, &windows,
+                     MSBfirst, expectlastspace);
 }
 
 /// Match & decode a generic/typical IR message.
@@ -1628,65 +2966,157 @@ uint16_t IRrecv::_matchGeneric(atomic_uint16_t *data_ptr,
                               const uint8_t tolerance,
                               const int16_t excess,
                               const bool MSBfirst) {
+  const ir_protocol_t protocol = {hdrmark, hdrspace, onemark, onespace,
+                                  zeromark, zerospace, footermark, footerspace,
+                                  0, 0, 0, MSBfirst, tolerance, excess};
+  // Calculate the timing windows once, rather than for every pulse.
+  const protocol_windows_t windows = protocolWindows(protocol, _tolerance);
+  return _matchProtocol(data_ptr, result_bits_ptr, result_bytes_ptr, use_bits,
+                        remaining, nbits, &protocol, &windows, atleast);
+}
+
+/// Match & decode a typical IR message described by an `ir_protocol_t`.
+/// The data is stored in result_bits_ptr or result_bytes_ptr depending on flag
+/// `use_bits`.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[out] result_bits_ptr A pointer to where to start storing the bits we
+///    decoded.
+/// @param[out] result_bytes_ptr A pointer to where to start storing the bytes
+///    we decoded.
+/// @param[in] use_bits A flag indicating if we are to decode bits or bytes.
+/// @param[in] remaining The size of the capture buffer remaining.
+/// @param[in] nbits Nr. of data bits we expect.
+/// @param[in] protocol A ptr to the description of the protocol.
+/// @param[in] windows A ptr to the protocol's match windows.
+/// @param[in] atleast Is the match on the gap a matchAtLeast or matchSpace?
+/// @return If successful, how many buffer entries were used. Otherwise 0.
+uint16_t IRrecv::_matchProtocol(atomic_uint16_t *data_ptr,
+                                uint64_t *result_bits_ptr,
+                                uint8_t *result_bytes_ptr,
+                                const bool use_bits,
+                                const uint16_t remaining,
+                                const uint16_t nbits,
+                                const ir_protocol_t *protocol,
+                                const protocol_windows_t *windows,
+                                const bool atleast) {
   // If we are expecting byte sizes, check it's a factor of 8 or fail.
   if (!use_bits && nbits % 8 != 0)  return 0;
   // Calculate if we expect a trailing space in the data section.
-  const bool kexpectspace = footermark || (onespace != zerospace);
+  const bool kexpectspace = protocol->footermark ||
+      (protocol->onespace != protocol->zerospace);
   // Calculate how much remaining buffer is required.
   uint16_t min_remaining = nbits * 2 - (kexpectspace ? 0 : 1);
 
-  if (hdrmark) min_remaining++;
-  if (hdrspace) min_remaining++;
-  if (footermark) min_remaining++;
+  if (protocol->hdrmark) min_remaining++;
+  if (protocol->hdrspace) min_remaining++;
+  if (protocol->footermark) min_remaining++;
   // Don't need to extend for footerspace because it could be the end of message
 
   // Check if there is enough capture buffer to possibly have the message.
-  if (remaining < min_remaining) return 0;  // Nope, so abort.
+  if (remaining < min_remaining)
+    return _rejectAt(data_ptr + remaining);  // Nope, so abort.
   uint16_t offset = 0;
 
   // Header
-  if (hdrmark && !matchMark(*(data_ptr + offset++), hdrmark, tolerance, excess))
-    return 0;
-  if (hdrspace && !matchSpace(*(data_ptr + offset++), hdrspace, tolerance,
-                              excess))
-    return 0;
+  if (protocol->hdrmark && !matchMark(*(data_ptr + offset++),
+                                      windows->hdrmark))
+    return _rejectAt(data_ptr + offset - 1);
+  if (protocol->hdrspace && !matchSpace(*(data_ptr + offset++),
+                                        windows->hdrspace))
+    return _rejectAt(data_ptr + offset - 1);
 
   // Data
   if (use_bits) {  // Bits.
-    match_result_t result = IRrecv::matchData(data_ptr + offset, nbits,
-                                              onemark, onespace,
-                                              zeromark, zerospace, tolerance,
-                                              excess, MSBfirst, kexpectspace);
+    match_result_t result = _matchData(data_ptr + offset, nbits,
+                                       &windows->data, protocol->MSBfirst,
+                                       kexpectspace);
     if (!result.success) return 0;
     *result_bits_ptr = result.data;
     offset += result.used;
   } else {  // bytes
-    uint16_t data_used = IRrecv::matchBytes(data_ptr + offset, result_bytes_ptr,
-                                            remaining - offset, nbits / 8,
-                                            onemark, onespace,
-                                            zeromark, zerospace, tolerance,
-                                            excess, MSBfirst, kexpectspace);
+    uint16_t data_used = _matchBytes(data_ptr + offset, result_bytes_ptr,
+                                     remaining - offset, nbits / 8,
+                                     &windows->data, protocol->MSBfirst,
+                                     kexpectspace);
     if (!data_used) return 0;
     offset += data_used;
   }
   // Footer
-  if (footermark && !matchMark(*(data_ptr + offset++), footermark, tolerance,
-                               excess))
-    return 0;
+  if (protocol->footermark && !matchMark(*(data_ptr + offset++),
+                                         windows->footermark))
+    return _rejectAt(data_ptr + offset - 1);
   // If we have something still to match & haven't reached the end of the buffer
-  if (footerspace && offset < remaining) {
+  if (protocol->gap && offset < remaining) {
       if (atleast) {
-        if (!matchAtLeast(*(data_ptr + offset), footerspace, tolerance, excess))
-          return 0;
+        if (!matchAtLeast(*(data_ptr + offset), protocol->gap,
+                          protocol->tolerance, protocol->excess))
+          return _rejectAt(data_ptr + offset);
       } else {
-        if (!matchSpace(*(data_ptr + offset), footerspace, tolerance, excess))
-          return 0;
+        if (!matchSpace(*(data_ptr + offset), windows->gap))
+          return _rejectAt(data_ptr + offset);
       }
       offset++;
   }
   return offset;
 }
 
+/// Match & decode a typical <= 64bit IR message described by an
+/// `ir_protocol_t`.
+/// The data is stored at result_ptr.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[out] result_ptr A ptr to where to start storing the bits we decoded.
+/// @param[in] remaining The size of the capture buffer remaining.
+/// @param[in] nbits Nr. of data bits we expect.
+/// @param[in] protocol The description of the protocol.
+/// @param[in] windows The protocol's match windows. Typically calculated at
+///   compile time. See `protocolWindows()`.
+/// @param[in] atleast Is the match on the gap a matchAtLeast or matchSpace?
+/// @return If successful, how many buffer entries were used. Otherwise 0.
+uint16_t IRrecv::matchProtocol(atomic_uint16_t *data_ptr,
+                               uint64_t *result_ptr,
+                               const uint16_t remaining, const uint16_t nbits,
+                               const ir_protocol_t &protocol,
+                               const protocol_windows_t &windows,
+                               const bool atleast) {
+  // Were the windows calculated for a different tolerance to ours?
+  if (protocol.tolerance > 100 && _tolerance != kTolerance) {
+    const protocol_windows_t actual = protocolWindows(protocol, _tolerance);
+    return _matchProtocol(data_ptr, result_ptr, NULL, true, remaining, nbits,
+                          &protocol, &actual, atleast);
+  }
+  return _matchProtocol(data_ptr, result_ptr, NULL, true, remaining, nbits,
+                        &protocol, &windows, atleast);
+}
+
+/// Match & decode a typical byte based IR message described by an
+/// `ir_protocol_t`.
+/// The bytes are stored at result_ptr. The first byte in the result equates to
+/// the first byte encountered, and so on.
+/// @param[in] data_ptr A pointer to where we are at in the capture buffer.
+/// @param[out] result_ptr A ptr to where to start storing the bytes we decoded.
+/// @param[in] remaining The size of the capture buffer remaining.
+/// @param[in] nbits Nr. of data bits we expect. (A multiple of 8)
+/// @param[in] protocol The description of the protocol.
+/// @param[in] windows The protocol's match windows. Typically calculated at
+///   compile time. See `protocolWindows()`.
+/// @param[in] atleast Is the match on the gap a matchAtLeast or matchSpace?
+/// @return If successful, how many buffer entries were used. Otherwise 0.
+uint16_t IRrecv::matchProtocol(atomic_uint16_t *data_ptr,
+                               uint8_t *result_ptr,
+                               const uint16_t remaining, const uint16_t nbits,
+                               const ir_protocol_t &protocol,
+                               const protocol_windows_t &windows,
+                               const bool atleast) {
+  // Were the windows calculated for a different tolerance to ours?
+  if (protocol.tolerance > 100 && _tolerance != kTolerance) {
+    const protocol_windows_t actual = protocolWindows(protocol, _tolerance);
+    return _matchProtocol(data_ptr, NULL, result_ptr, false, remaining, nbits,
+                          &protocol, &actual, atleast);
+  }
+  return _matchProtocol(data_ptr, NULL, result_ptr, false, remaining, nbits,
+                        &protocol, &windows, atleast);
+}
+
 /// Match & decode a generic/typical <= 64bit IR message.
 /// The data is stored at result_ptr.
 /// @note Values of 0 for hdrmark, hdrspace, footermark, or footerspace mean
@@ -2124,5 +3554,8 @@ uint16_t IRrecv::matchManchesterData(atomic_const_uint16_t *data_ptr,
 atomic_irparams_t *IRrecv::_getParamsPtr(void) {
   return &params;
 }
+
+/// Unit test helper to simulate the timeout interrupt occurring.
+void IRrecv::_timeout(void) { endCapture(&params); }
 #endif  // UNIT_TEST
 // End of IRrecv class -------------------
@@ -26,6 +26,10 @@ const uint16_t kRawBuf = 100;  // Default length of raw capture buffer
 const uint64_t kRepeat = UINT64_MAX;
 // Default min size of reported UNKNOWN messages.
 const uint16_t kUnknownThreshold = 6;
+// Max nr. of distinct mark (or space) durations we index in a capture.
+const uint8_t kMaxPulseClusters = 8;
+// Nr. of the most recent matches kept when ENABLE_MATCH_TRACE is set.
+const uint8_t kMatchTraceLength = 32;
 
 // receiver states
 const uint8_t kIdleState = 2;
@@ -72,6 +76,13 @@ const uint16_t kStateSizeMax = sizeof(uint64_t);
 
 // Types
 
+/// A capture buffer in the ring of capture slots.
+typedef struct {
+  uint16_t *rawbuf;  // raw data
+  uint16_t rawlen;   // counter of entries in rawbuf.
+  uint8_t overflow;  // Buffer overflow indicator.
+} capture_slot_t;
+
 /// Information for the interrupt handler
 typedef struct {
   uint8_t recvpin;   // pin for IR data from detector
@@ -84,6 +95,12 @@ typedef struct {
   uint16_t rawlen;   // counter of entries in rawbuf.
   uint8_t overflow;  // Buffer overflow indicator.
   uint8_t timeout;   // Nr. of milliSeconds before we give up.
+  capture_slot_t *slots;  // Ring of capture slots. NULL if not used.
+  uint8_t nslots;    // Nr. of capture slots in the ring.
+  uint8_t head;      // Slot being captured into. Only the ISR changes it.
+  uint8_t tail;      // Oldest captured slot. Only decode() etc. changes it.
+  uint16_t drops;    // Nr. of captures lost because all slots were in use.
+  uint16_t overflows;  // Nr. of captures that overflowed their slot.
 } irparams_t;
 
 typedef volatile irparams_t atomic_irparams_t;
@@ -95,6 +112,70 @@ typedef struct {
   uint16_t used;  // How many buffer positions were used.
 } match_result_t;
 
+/// A precalculated range of capture buffer values that match a pulse.
+typedef struct {
+  uint32_t low;   // Smallest matching value. (Ticks, inclusive)
+  uint32_t high;  // Largest matching value. (Ticks, inclusive)
+} match_window_t;
+
+/// Precalculated match windows for the data bits of a message.
+typedef struct {
+  match_window_t onemark;    // The mark of a '1' bit.
+  match_window_t onespace;   // The space of a '1' bit.
+  match_window_t zeromark;   // The mark of a '0' bit.
+  match_window_t zerospace;  // The space of a '0' bit.
+} data_windows_t;
+
+/// Precalculated match windows for a whole message. See `ir_protocol_t`.
+typedef struct {
+  match_window_t hdrmark;     // The header mark.
+  match_window_t hdrspace;    // The header space.
+  data_windows_t data;        // The data bits.
+  match_window_t footermark;  // The footer mark.
+  match_window_t gap;         // The space after the footer, if not "at least".
+} protocol_windows_t;
+
+/// A group of similar pulse durations found in a capture.
+typedef struct {
+  uint16_t low;    // Shortest pulse in the group. (Ticks)
+  uint16_t high;   // Longest pulse in the group. (Ticks)
+  uint16_t count;  // Nr. of pulses in the group.
+} pulse_cluster_t;
+
+/// An index of the distinct mark & space durations in a capture.
+typedef struct {
+  bool valid;     // Does it describe the capture currently being decoded?
+  bool overflow;  // Were there too many distinct durations to index?
+  uint16_t next;  // The next capture entry to index.
+  uint8_t nmarks;   // Nr. of mark clusters in use.
+  uint8_t nspaces;  // Nr. of space clusters in use.
+  pulse_cluster_t marks[kMaxPulseClusters];
+  pulse_cluster_t spaces[kMaxPulseClusters];
+} pulse_index_t;
+
+/// Decoding statistics for a protocol. (See: ENABLE_DECODE_PROFILING)
+typedef struct {
+  uint32_t attempts;   // Nr. of times its decoder was tried.
+  uint32_t successes;  // Nr. of times its decoder found a message.
+  uint64_t nsecs;      // Total time (nano-Seconds) spent in its decoder.
+  uint32_t rejects;    // Nr. of failed attempts where we know where they quit.
+  uint32_t reject_offsets;  // Sum of the offsets those rejects happened at.
+} decode_profile_t;
+
+/// The details of a single pulse match. (See: ENABLE_MATCH_TRACE)
+typedef struct {
+  decode_type_t protocol;  // The decoder being tried. UNKNOWN if not known.
+  uint16_t offset;    // The capture offset the decoder was started at.
+  uint16_t step;      // Nr. of matches the decoder made before this one.
+  uint32_t measured;  // Duration of the pulse. (uSecs)
+  uint32_t low;       // Shortest duration that matches. (uSecs)
+  uint32_t high;      // Longest duration that matches. (uSecs)
+  bool matched;       // Was it a match?
+} match_trace_t;
+
+/// A function to call with each match as it is traced.
+typedef void (*match_trace_hook_t)(const match_trace_t *trace);
+
 // Classes
 
 /// Results returned from the decoder
@@ -135,6 +216,8 @@ class IRrecv {
   ~IRrecv(void);                                                  // Destructor
   void setTolerance(const uint8_t percent = kTolerance);
   uint8_t getTolerance(void);
+  void setEarlyDecode(const bool enable = true);
+  bool getEarlyDecode(void);
   bool decode(decode_results *results, irparams_t *save = NULL,
               uint8_t max_skip = 0, uint16_t noise_floor = 0);
   void enableIRIn(const bool pullup = false);
@@ -142,6 +225,23 @@ class IRrecv {
   void pause(void);
   void resume(void);
   uint16_t getBufSize(void);
+  void setCaptureSlots(const uint8_t nr);
+  uint8_t getCaptureSlots(void);
+  uint16_t getDropCount(void);
+  uint16_t getOverflowCount(void);
+#if ENABLE_DECODE_PROFILING
+  decode_profile_t getDecodeProfile(const decode_type_t protocol);
+  void resetDecodeProfile(void);
+  String decodeProfileToString(void);
+  String decodeProfileToJson(void);
+#endif  // ENABLE_DECODE_PROFILING
+#if ENABLE_MATCH_TRACE
+  uint16_t getMatchTraceCount(void);
+  match_trace_t getMatchTrace(const uint16_t index);
+  void clearMatchTrace(void);
+  void setMatchTraceHook(const match_trace_hook_t hook);
+  String matchTraceToString(void);
+#endif  // ENABLE_MATCH_TRACE
 #if DECODE_HASH
   void setUnknownThreshold(const uint16_t length);
 #endif
@@ -160,12 +260,86 @@ class IRrecv {
   bool matchSpaceRange(const uint32_t measured, const uint32_t desired,
                        const uint16_t range = 100,
                        const int16_t excess = kMarkExcess);
+  match_window_t matchWindow(const uint32_t desired,
+                             const uint8_t tolerance = kUseDefTol,
+                             const uint16_t delta = 0);
+  match_window_t markWindow(const uint32_t desired,
+                            const uint8_t tolerance = kUseDefTol,
+                            const int16_t excess = kMarkExcess);
+  match_window_t spaceWindow(const uint32_t desired,
+                             const uint8_t tolerance = kUseDefTol,
+                             const int16_t excess = kMarkExcess);
+  bool match(const uint32_t measured, const match_window_t window);
+  bool matchMark(const uint32_t measured, const match_window_t window);
+  bool matchSpace(const uint32_t measured, const match_window_t window);
+  /// Calculate all the match windows for a protocol's messages.
+  /// Being `constexpr`, it can be done at compile time. e.g.
+  ///   `constexpr protocol_windows_t kFooWindows =
+  ///        IRrecv::protocolWindows(kFooProtocol);`
+  /// @param[in] protocol The description of the protocol.
+  /// @param[in] tolerance The percentage to use if the protocol's tolerance is
+  ///   kUseDefTol.
+  /// @return The windows. Same as `markWindow()` & `spaceWindow()` give.
+  static constexpr protocol_windows_t protocolWindows(
+      const ir_protocol_t protocol, const uint8_t tolerance = kTolerance) {
+    return _protocolWindows(protocol, (protocol.tolerance > 100) ?
+                                      tolerance : protocol.tolerance);
+  }
 #ifndef UNIT_TEST
 
  private:
 #endif
-  irparams_t *irparams_save;
+  /// `protocolWindows()` with the tolerance already resolved.
+  static constexpr protocol_windows_t _protocolWindows(
+      const ir_protocol_t p, const uint8_t tolerance) {
+    return {_constMarkWindow(p.hdrmark, tolerance, p.excess),
+            _constSpaceWindow(p.hdrspace, tolerance, p.excess),
+            {_constMarkWindow(p.onemark, tolerance, p.excess),
+             _constSpaceWindow(p.onespace, tolerance, p.excess),
+             _constMarkWindow(p.zeromark, tolerance, p.excess),
+             _constSpaceWindow(p.zerospace, tolerance, p.excess)},
+            _constMarkWindow(p.footermark, tolerance, p.excess),
+            _constSpaceWindow(p.gap, tolerance, p.excess)};
+  }
+  /// A `constexpr` version of `matchWindow()`, without a delta.
+  static constexpr match_window_t _constWindow(const uint32_t usecs,
+                                               const uint8_t tolerance) {
+    return {(usecs - (usecs * tolerance + 99) / 100 + kRawTick - 1) / kRawTick,
+            (usecs + usecs * tolerance / 100 + 1) / kRawTick};
+  }
+  /// A `constexpr` version of `markWindow()`.
+  static constexpr match_window_t _constMarkWindow(const uint32_t usecs,
+                                                   const uint8_t tolerance,
+                                                   const int16_t excess) {
+    return _constWindow((static_cast<int32_t>(usecs) + excess > 0) ?
+                        usecs + excess : 0, tolerance);
+  }
+  /// A `constexpr` version of `spaceWindow()`.
+  static constexpr match_window_t _constSpaceWindow(const uint32_t usecs,
+                                                    const uint8_t tolerance,
+                                                    const int16_t excess) {
+    return _constWindow((static_cast<int32_t>(usecs) - excess > 0) ?
+                        usecs - excess : 0, tolerance);
+  }
+  atomic_irparams_t params;  // The state of the capture. (Shared with the ISR)
+  irparams_t *irparams_save;  // A copy of `params` while decoding, or NULL.
   uint8_t _tolerance;
+  bool _early_decode;      // Try to decode messages before the timeout?
+  uint16_t _early_rawlen;  // The capture length we last tried to decode early.
+  bool _slot_in_use;       // Is decode() using the slot at the tail?
+  pulse_index_t _pulses;   // Pulse durations in the capture being decoded.
+#if ENABLE_DECODE_PROFILING
+  decode_profile_t _profile[kLastDecodeType + 1];  // Indexed by decode_type_t.
+  atomic_uint16_t *_profile_reject;  // Furthest point a matcher gave up at.
+#endif  // ENABLE_DECODE_PROFILING
+#if ENABLE_MATCH_TRACE
+  match_trace_t _trace[kMatchTraceLength];  // The most recent matches.
+  uint32_t _trace_count;           // Nr. of matches traced since cleared.
+  decode_type_t _trace_protocol;   // The decoder currently being tried.
+  uint16_t _trace_offset;          // The offset it was started at.
+  uint16_t _trace_step;            // Nr. of matches it has made so far.
+  match_trace_hook_t _trace_hook;  // Also call this with each match.
+#endif  // ENABLE_MATCH_TRACE
 #if defined(ESP32)
   uint8_t _timer_num;
 #endif  // defined(ESP32)
@@ -174,9 +348,64 @@ class IRrecv {
 #endif
 #ifdef UNIT_TEST
   atomic_irparams_t *_getParamsPtr(void);
+  void _timeout(void);
+  uint16_t _decodeAttempts;  // Nr. of decoders called by the last decode().
+  uint16_t _decodeCandidates;  // Nr. of table entries it looked at.
+  bool _screenDecoders;  // false = Try every decoder, like an unscreened chain.
 #endif  // UNIT_TEST
+  /// The call signature shared by the protocol decoders.
+  typedef bool (IRrecv::*decode_func_t)(decode_results *results,
+                                        uint16_t offset,
+                                        const uint16_t nbits,
+                                        const bool strict);
+  /// An entry in the ordered table of decoders that `decode()` tries.
+  typedef struct {
+    decode_type_t type;     // The protocol the entry is for.
+    decode_func_t decoder;  // The decoder to call.
+    uint16_t nbits;         // Nr. of bits to ask the decoder for.
+    bool strict;            // Ask the decoder for strict compliance?
+    uint16_t hdrmark;       // First mark (uSecs) it needs. 0 = Don't screen.
+    uint16_t hdrspace;      // First space (uSecs) it needs. 0 = Don't screen.
+  } decoder_entry_t;
+  static const decoder_entry_t _decoders[];
+  static const uint16_t _nrDecoders;
+  static uint8_t _hdrIndex[];    // `_decoders` with a header, by header mark.
+  static uint16_t _nrHdrIndex;   // Nr. of entries in `_hdrIndex`.
+  static uint8_t _headerless[];  // Bit per `_decoders` entry without a header.
+  static bool _indexed;          // Have the above been built yet?
+  /// A row of the table of the shortest captures each protocol can be in.
+  typedef struct {
+    uint8_t type;     // The protocol (decode_type_t) the row is for.
+    uint16_t rawlen;  // The fewest `rawlen` it needs. 0 = Don't screen.
+  } min_rawlen_t;
+  static const min_rawlen_t _minRawLen[];  // Indexed by decode_type_t.
   // These are called by decode
+  static void _indexDecoders(void);
+  void _findCandidates(const decode_results *results, const uint16_t offset,
+                       uint8_t *candidates);
+  bool _plausibleHeader(const decode_results *results, const uint16_t offset,
+                        const uint16_t hdrmark, const uint16_t hdrspace);
+  bool _worthTrying(const decode_results *results, const uint16_t offset,
+                    const decoder_entry_t *entry);
+  bool _longEnough(const decode_results *results, const uint16_t offset,
+                   const decode_type_t protocol);
+  uint8_t _screenTolerance(void);
+  static uint16_t _bitMark(const decode_type_t protocol);
+  bool _indexPulses(const decode_results *results,
+                    const match_window_t *until = NULL);
+  bool _hasMark(const decode_results *results, const uint16_t usecs);
+  static bool _canDecodeEarly(const decode_type_t protocol);
+  bool _decodeEarly(decode_results *results, irparams_t *save);
+  bool _readSlot(decode_results *results, irparams_t *save);
+  void _releaseSlot(void);
+  void _freeSlots(void);
   uint8_t _validTolerance(const uint8_t percentage);
+  uint16_t _rejectAt(atomic_uint16_t *ptr);
+#if ENABLE_MATCH_TRACE || defined(DEBUG)
+  void _traceMatch(const uint32_t measured, const uint32_t low,
+                   const uint32_t high, const bool matched);
+#endif  // ENABLE_MATCH_TRACE || defined(DEBUG)
+  void _traceDecoder(const decode_type_t protocol, const uint16_t offset);
   void copyIrParams(atomic_irparams_t *src, irparams_t *dst);
   uint16_t compare(const uint16_t oldval, const uint16_t newval);
   uint32_t ticksLow(const uint32_t usecs,
@@ -206,6 +435,38 @@ class IRrecv {
                          const uint8_t tolerance = kUseDefTol,
                          const int16_t excess = kMarkExcess,
                          const bool MSBfirst = true);
+  uint16_t _matchProtocol(atomic_uint16_t *data_ptr,
+                          uint64_t *result_bits_ptr,
+                          uint8_t *result_bytes_ptr,
+                          const bool use_bits,
+                          const uint16_t remaining,
+                          const uint16_t nbits,
+                          const ir_protocol_t *protocol,
+                          const protocol_windows_t *windows,
+                          const bool atleast);
+  uint16_t matchProtocol(atomic_uint16_t *data_ptr,
+                         uint64_t *result_ptr,
+                         const uint16_t remaining, const uint16_t nbits,
+                         const ir_protocol_t &protocol,
+                         const protocol_windows_t &windows,
+                         const bool atleast = true);
+  uint16_t matchProtocol(atomic_uint16_t *data_ptr,
+                         uint8_t *result_ptr,
+                         const uint16_t remaining, const uint16_t nbits,
+                         const ir_protocol_t &protocol,
+                         const protocol_windows_t &windows,
+                         const bool atleast = true);
+  data_windows_t _dataWindows(const uint16_t onemark, const uint32_t onespace,
+                              const uint16_t zeromark,
+                              const uint32_t zerospace,
+                              const uint8_t tolerance, const int16_t excess);
+  match_result_t _matchData(atomic_uint16_t *data_ptr, const uint16_t nbits,
+                            const data_windows_t *windows,
+                            const bool MSBfirst, const bool expectlastspace);
+  uint16_t _matchBytes(atomic_uint16_t *data_ptr, uint8_t *result_ptr,
+                       const uint16_t remaining, const uint16_t nbytes,
+                       const data_windows_t *windows,
+                       const bool MSBfirst, const bool expectlastspace);
   match_result_t matchData(atomic_uint16_t *data_ptr, const uint16_t nbits,
                            const uint16_t onemark, const uint32_t onespace,
                            const uint16_t zeromark, const uint32_t zerospace,
@@ -294,6 +555,10 @@ class IRrecv {
   bool decodeNEC(decode_results *results, uint16_t offset = kStartOffset,
                  const uint16_t nbits = kNECBits, const bool strict = true);
 #endif
+#if DECODE_NEC
+  bool _decodeNECLike(decode_results *results, uint16_t offset,
+                      const uint16_t nbits, const bool strict);
+#endif  // DECODE_NEC
 #if DECODE_ARGO
   bool decodeArgo(decode_results *results, uint16_t offset = kStartOffset,
                   const uint16_t nbits = kArgoBits, const bool strict = true);
@@ -400,6 +665,10 @@ class IRrecv {
                        const bool strict = false,
                        const uint32_t manufacturer = kPanasonicManufacturer);
 #endif
+#if DECODE_PANASONIC
+  bool _decodePanasonic(decode_results *results, uint16_t offset,
+                        const uint16_t nbits, const bool strict);
+#endif
 #if DECODE_LG
   bool decodeLG(decode_results *results, uint16_t offset = kStartOffset,
                 const uint16_t nbits = kLgBits,
@@ -460,6 +729,10 @@ class IRrecv {
                    const uint16_t nbits = kSharpBits,
                    const bool strict = true, const bool expansion = true);
 #endif
+#if DECODE_SHARP
+  bool _decodeSharp(decode_results *results, uint16_t offset,
+                    const uint16_t nbits, const bool strict);
+#endif  // DECODE_SHARP
 #if DECODE_SHARP_AC
   bool decodeSharpAc(decode_results *results, uint16_t offset = kStartOffset,
                      const uint16_t nbits = kSharpAcBits,
@@ -649,6 +922,8 @@ class IRrecv {
   bool decodeHitachiAC(decode_results *results, uint16_t offset = kStartOffset,
                        const uint16_t nbits = kHitachiAcBits,
                        const bool strict = true, const bool MSBfirst = true);
+  bool _decodeHitachiAC(decode_results *results, uint16_t offset,
+                        const uint16_t nbits, const bool strict);
 #endif  // (DECODE_HITACHI_AC || DECODE_HITACHI_AC2 || DECODE_HITACHI_AC264 ||
         //  DECODE_HITACHI_AC344)
 #if DECODE_HITACHI_AC1
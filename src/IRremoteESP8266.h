@@ -1029,6 +1029,28 @@ typedef volatile const uint16_t atomic_const_uint16_t;
 #define ENABLE_NOISE_FILTER_OPTION true
 #endif  // ENABLE_NOISE_FILTER_OPTION
 
+// Decode profiling. (Disabled by default)
+// Record, per protocol, how many times `IRrecv::decode()` tried its decoder,
+// how many times it succeeded, the time it took, and how far into the capture
+// the failed attempts got before they gave up. i.e. Data on which protocols you
+// should disable or reorder to reduce decoding time.
+// It costs about 24 bytes of RAM per protocol, and extra cpu time per decode.
+// See: `IRrecv::decodeProfileToString()` & `IRrecv::decodeProfileToJson()`.
+#ifndef ENABLE_DECODE_PROFILING
+#define ENABLE_DECODE_PROFILING false
+#endif  // ENABLE_DECODE_PROFILING
+
+// Match tracing. (Disabled by default)
+// Record the most recent pulse matches made by the decoders. i.e. Which
+// protocol was being tried, where, the pulse's duration, the range it needed to
+// be in, and if it matched. Cheap enough to leave on while working out why a
+// message won't decode. When disabled, the tracing compiles to nothing.
+// It costs about 24 bytes of RAM per entry kept. (See: `kMatchTraceLength`)
+// See: `IRrecv::matchTraceToString()` & `IRrecv::setMatchTraceHook()`.
+#ifndef ENABLE_MATCH_TRACE
+#define ENABLE_MATCH_TRACE false
+#endif  // ENABLE_MATCH_TRACE
+
 /// Enumerator for defining and numbering of supported IR protocol.
 /// @note Always add to the end of the list and should never remove entries
 ///  or change order. Projects may save the type number for later usage
@@ -1468,6 +1490,29 @@ const uint16_t kYorkStateLength = 17;
 const uint16_t kEuromStateLength = 12;
 const uint16_t kEuromBits = kEuromStateLength * 8;
 
+/// A description of the format of a typical protocol's messages. i.e. The
+/// values `sendGeneric()` & `matchGeneric()` are given, in one place.
+/// Declare them `constexpr` so everything derived from them (e.g. the match
+/// windows, see `IRrecv::protocolWindows()`) can be calculated at compile time.
+/// @note Values of 0 for `hdrmark`, `hdrspace`, `footermark`, or `gap` mean
+///   there isn't one.
+typedef struct {
+  uint16_t hdrmark;     // Header mark. (uSecs)
+  uint32_t hdrspace;    // Header space. (uSecs)
+  uint16_t onemark;     // Mark of a '1' bit. (uSecs)
+  uint32_t onespace;    // Space of a '1' bit. (uSecs)
+  uint16_t zeromark;    // Mark of a '0' bit. (uSecs)
+  uint32_t zerospace;   // Space of a '0' bit. (uSecs)
+  uint16_t footermark;  // Footer mark. (uSecs)
+  uint32_t gap;         // Space after the footer. (Min. uSecs)
+  uint32_t mesgtime;    // Min. time from the start of one message to the next.
+  uint16_t frequency;   // Carrier frequency. (Hz, or kHz if < 1000)
+  uint8_t dutycycle;    // Carrier duty cycle. (Percentage)
+  bool MSBfirst;        // Are the data bits sent Most Significant Bit first?
+  uint8_t tolerance;    // Percentage error margin when matching, or kUseDefTol
+  int16_t excess;       // Extra mark length when matching. e.g. kMarkExcess
+} ir_protocol_t;
+
 // Legacy defines. (Deprecated)
 #define AIWA_RC_T501_BITS             kAiwaRcT501Bits
 #define ARGO_COMMAND_LENGTH           kArgoStateLength
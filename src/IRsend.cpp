@@ -22,6 +22,8 @@
 std::vector<int> timingList;
 #endif  // SWIGLIB
 
+IRpulseBuffer *IRsend::_renderAll = NULL;
+
 /// Constructor for an IRsend object.
 /// @param[in] IRsendPin Which GPIO pin to use when sending an IR command.
 /// @param[in] inverted Optional flag to invert the output. (default = false)
@@ -33,7 +35,8 @@ std::vector<int> timingList;
 ///  i.e. If not, assume a 100% duty cycle. Ignore attempts to change the
 ///  duty cycle etc.
 IRsend::IRsend(uint16_t IRsendPin, bool inverted, bool use_modulation)
-    : IRpin(IRsendPin), periodOffset(kPeriodOffset) {
+    : _carrierHz(1), _periodNsecs(1000000000UL), _periodRem(0), _onNsecs(0),
+      _fractional(false), IRpin(IRsendPin), periodOffset(kPeriodOffset) {
   if (inverted) {
     outputOn = LOW;
     outputOff = HIGH;
@@ -46,6 +49,8 @@ IRsend::IRsend(uint16_t IRsendPin, bool inverted, bool use_modulation)
     _dutycycle = kDutyDefault;
   else
     _dutycycle = kDutyMax;
+  _render = NULL;
+  _rendered = 0;
 }
 
 /// Enable the pin for output.
@@ -113,6 +118,13 @@ void IRsend::enableIROut(uint32_t freq, uint8_t duty) {
   onTimePeriod = (period * _dutycycle) / kDutyMax;
   // Nr. of uSeconds the LED will be off per pulse.
   offTimePeriod = period - onTimePeriod;
+  // The same, but exact-ish, for when we schedule with fractional periods.
+  _carrierHz = std::max(freq, (uint32_t)1);
+  _periodNsecs = 1000000000UL / _carrierHz;
+  _periodRem = 1000000000UL % _carrierHz;
+  _onNsecs = (10000000UL * _dutycycle) / _carrierHz;  // i.e. 1e9 * duty% / Hz
+  IRpulseBuffer *render = _renderTarget();
+  if (render != NULL) render->addCarrier(freq, _dutycycle);
 }
 
 #if ALLOW_DELAY_CALLS
@@ -162,6 +174,14 @@ void IRsend::_delayMicroseconds(uint32_t usec) {
 /// Ref:
 ///   https://www.analysir.com/blog/2017/01/29/updated-esp8266-nodemcu-backdoor-upwm-hack-for-ir-signals/
 uint16_t IRsend::mark(uint16_t usec) {
+  IRpulseBuffer *render = _renderTarget();
+  if (render != NULL) {  // Record it, rather than send it.
+    render->addMark(usec);
+    _rendered += usec;
+    // The nr. of pulses it would have taken.
+    const uint16_t period = std::max(onTimePeriod + offTimePeriod, 1);
+    return (!modulation || _dutycycle >= 100) ? 1 : usec / period + 1;
+  }
 #ifdef SWIGLIB
   // std::cout << usec << " ";
   timingList.push_back(usec);
@@ -175,6 +195,8 @@ uint16_t IRsend::mark(uint16_t usec) {
     return 1;
   }
 
+  if (_fractional) return _markFractional(usec);
+
   // Not simple, so do it assuming frequency modulation.
   uint16_t counter = 0;
   IRtimer usecTimer = IRtimer();
@@ -202,11 +224,60 @@ uint16_t IRsend::mark(uint16_t usec) {
 #endif  // SWIGLIB
 }
 
+/// Modulate the IR LED for the given period (usec), scheduling each carrier
+/// cycle from the start of the mark using the exact (fractional) period.
+/// i.e. Cycle `n` starts at `n * period` rather than after `n` whole-uSec
+/// periods have elapsed, so rounding the period to whole uSecs doesn't skew the
+/// carrier frequency, nor does the time spent between delays.
+/// @param[in] usec The period of time to modulate the IR LED for, in
+///  microseconds.
+/// @return Nr. of pulses actually sent.
+/// @see setFractionalCarrier()
+uint16_t IRsend::_markFractional(const uint16_t usec) {
+  uint16_t counter = 0;
+  // nSecs from the start of the mark to the start of the current period, plus
+  // the fraction of a nSec it is short by, in 1/_carrierHz nSecs.
+  // i.e. counter * 1e9 / _carrierHz, without dividing for every period.
+  uint32_t start = 0;
+  uint32_t start_rem = 0;
+  IRtimer usecTimer = IRtimer();
+  while (true) {
+    const uint32_t on_at = start / 1000;
+    if (on_at >= usec) break;
+    uint32_t elapsed = usecTimer.elapsed();
+    if (elapsed < on_at) _delayMicroseconds(on_at - elapsed);
+    ledOn();
+    counter++;
+    const uint32_t off_at = std::min((start + _onNsecs) / 1000,
+                                     static_cast<uint32_t>(usec));
+    elapsed = usecTimer.elapsed();
+    if (elapsed < off_at) _delayMicroseconds(off_at - elapsed);
+    ledOff();
+    // Move on to the next period.
+    start += _periodNsecs;
+    start_rem += _periodRem;
+    if (start_rem >= _carrierHz) {
+      start_rem -= _carrierHz;
+      start++;
+    }
+  }
+  // Wait out whatever is left of the last period.
+  const uint32_t elapsed = usecTimer.elapsed();
+  if (elapsed < usec) _delayMicroseconds(usec - elapsed);
+  return counter;
+}
+
 /// Turn the pin (LED) off for a given time.
 /// Sends an IR space for the specified number of microseconds.
 /// A space is no output, so the PWM output is disabled.
 /// @param[in] time Time in microseconds (us).
 void IRsend::space(uint32_t time) {
+  IRpulseBuffer *render = _renderTarget();
+  if (render != NULL) {  // Record it, rather than send it.
+    render->addSpace(time);
+    _rendered += time;
+    return;
+  }
   ledOff();
   if (time == 0) return;
 #ifdef SWIGLIB
@@ -217,6 +288,599 @@ void IRsend::space(uint32_t time) {
 #endif  // SWIGLIB
 }
 
+/// Use the fractional carrier generator for marks.
+/// Rather than pulse the LED on & off for whole uSec periods (rounded from the
+/// carrier frequency), it schedules each cycle of the carrier against a timer
+/// using the exact period. This keeps the carrier frequency & nr. of cycles per
+/// mark accurate, which matters more at higher frequencies (e.g. 57.6kHz) & for
+/// long A/C messages.
+/// @param[in] enable Use it or not. Off by default.
+/// @note As it times against the clock, any offset found by `calibrate()` is
+///   not used, nor is it needed.
+void IRsend::setFractionalCarrier(const bool enable) { _fractional = enable; }
+
+/// Is the fractional carrier generator being used for marks?
+/// @return true if it is, false if not.
+bool IRsend::getFractionalCarrier(void) const { return _fractional; }
+
+/// Render messages sent from now on into a buffer, rather than sending them.
+/// The buffer can then be transmitted later, as often as needed, by `play()` or
+/// an IRtransmitter. e.g. So no time is spent calculating the message (e.g.
+/// checksums) while it is being transmitted, or to time/test/cache it.
+/// @param[in,out] pulses A Ptr to the buffer to add the messages to.
+///   NULL means go back to sending messages as normal.
+/// @note The buffer isn't cleared first, so messages can be appended.
+void IRsend::renderTo(IRpulseBuffer *pulses) { _render = pulses; }
+
+/// Render messages sent by every IRsend object from now on into a buffer,
+/// rather than sending them. e.g. Those used internally by the A/C classes.
+/// An object's own `renderTo()` buffer takes precedence.
+/// @param[in,out] pulses A Ptr to the buffer to add the messages to.
+///   NULL means go back to sending messages as normal.
+void IRsend::renderAllTo(IRpulseBuffer *pulses) { _renderAll = pulses; }
+
+/// Where should messages be rendered to?
+/// @return A Ptr to the buffer, or NULL if they should be sent.
+IRpulseBuffer *IRsend::_renderTarget(void) const {
+  return (_render != NULL) ? _render : _renderAll;
+}
+
+/// Class constructor. The timer starts from now.
+/// @param[in] irsend A Ptr to the IRsend whose messages are being timed.
+IRsendTimer::IRsendTimer(const IRsend *irsend) : _irsend(irsend) { reset(); }
+
+/// Reset the timer. i.e. Start timing again from now.
+void IRsendTimer::reset(void) {
+  _timer.reset();
+  _start = _irsend->_rendered;
+}
+
+/// Calculate how many microseconds have elapsed since the timer was started.
+/// i.e. How long the message has taken to send, or would take if rendering.
+/// @return Nr. of microseconds.
+uint32_t IRsendTimer::elapsed(void) {
+  if (_irsend->_renderTarget() != NULL) return _irsend->_rendered - _start;
+  return _timer.elapsed();
+}
+
+/// Transmit a rendered message via the GPIO.
+/// @param[in] pulses A Ptr to the rendered message.
+/// @param[in] start The first entry of the message to transmit.
+/// @param[in] end The entry to stop transmitting at. (Exclusive)
+///   Past the end of the message means transmit the rest of it.
+/// @return true if it was transmitted, false if it wasn't. e.g. The buffer
+///   overflowed while rendering, so it is incomplete.
+bool IRsend::play(const IRpulseBuffer *pulses, const uint16_t start,
+                  const uint16_t end) {
+  if (pulses == NULL || pulses->hasOverflowed()) return false;
+  IRpulseBuffer *render = _render;
+  IRpulseBuffer *render_all = _renderAll;
+  // Always transmit it, even if we are rendering.
+  _render = NULL;
+  _renderAll = NULL;
+  const uint16_t last = std::min(end, pulses->getLength());
+  for (uint16_t i = start; i < last; i++) {
+    const uint32_t entry = pulses->getEntry(i);
+    uint32_t value = entry & kPulseValueMask;
+    switch (entry & kPulseKindMask) {
+      case kPulseCarrier:
+        enableIROut(value & kPulseFreqMask, value >> kPulseDutyOffset);
+        break;
+      case kPulseMark:
+        for (; value > UINT16_MAX; value -= UINT16_MAX) mark(UINT16_MAX);
+        mark(value);
+        break;
+      default:
+        space(value);
+    }
+  }
+  ledOff();
+  _render = render;
+  _renderAll = render_all;
+  return true;
+}
+
+/// Class constructor.
+/// @param[in] size The max. nr. of entries the buffer can hold.
+///   Each mark, space, or change of carrier takes an entry.
+IRpulseBuffer::IRpulseBuffer(const uint16_t size) {
+  _entries = new uint32_t[size];
+  _size = (_entries == NULL) ? 0 : size;
+  clear();
+}
+
+/// Class destructor.
+IRpulseBuffer::~IRpulseBuffer(void) { delete[] _entries; }
+
+/// Empty the buffer.
+void IRpulseBuffer::clear(void) {
+  _length = 0;
+  _duration = 0;
+  _carrier = 0;
+  _overflow = false;
+}
+
+/// Add an entry to the buffer.
+/// @param[in] kind The kind of entry. e.g. `kPulseMark`
+/// @param[in] value The value of the entry.
+/// @return true if it was added, false if there wasn't room for it.
+bool IRpulseBuffer::_add(const uint32_t kind, const uint32_t value) {
+  if (_length >= _size) {
+    _overflow = true;
+    return false;
+  }
+  _entries[_length++] = kind | value;
+  return true;
+}
+
+/// Add a change of carrier to the buffer. It is ignored if it isn't a change.
+/// @param[in] freq The frequency of the carrier, in Hz.
+/// @param[in] duty The duty cycle of the carrier, as a percentage.
+/// @return true if it was added (or not needed), false if there wasn't room.
+bool IRpulseBuffer::addCarrier(const uint32_t freq, const uint8_t duty) {
+  const uint32_t value = std::min(freq, kPulseFreqMask) |
+      ((uint32_t)std::min(duty, kDutyMax) << kPulseDutyOffset);
+  if (value == _carrier) return true;  // No change.
+  _carrier = value;
+  // Replace the last carrier entry if nothing has used it.
+  if (_length && (_entries[_length - 1] & kPulseKindMask) == kPulseCarrier) {
+    _entries[_length - 1] = kPulseCarrier | value;
+    return true;
+  }
+  return _add(kPulseCarrier, value);
+}
+
+/// Add a mark to the buffer, merging it with any mark before it.
+/// @param[in] usecs The duration of the mark, in uSeconds.
+/// @return true if it was added, false if there wasn't room for it.
+bool IRpulseBuffer::addMark(const uint32_t usecs) {
+  if (!usecs) return true;  // Nothing to add.
+  _duration += usecs;
+  if (_length && (_entries[_length - 1] & kPulseKindMask) == kPulseMark &&
+      (_entries[_length - 1] & kPulseValueMask) + usecs <= kPulseValueMask) {
+    _entries[_length - 1] += usecs;
+    return true;
+  }
+  return _add(kPulseMark, std::min(usecs, kPulseValueMask));
+}
+
+/// Add a space to the buffer, merging it with any space before it.
+/// @param[in] usecs The duration of the space, in uSeconds.
+/// @return true if it was added, false if there wasn't room for it.
+bool IRpulseBuffer::addSpace(const uint32_t usecs) {
+  if (!usecs) return true;  // Nothing to add.
+  _duration += usecs;
+  if (_length && (_entries[_length - 1] & kPulseKindMask) == kPulseSpace &&
+      (_entries[_length - 1] & kPulseValueMask) + usecs <= kPulseValueMask) {
+    _entries[_length - 1] += usecs;
+    return true;
+  }
+  return _add(kPulseSpace, std::min(usecs, kPulseValueMask));
+}
+
+/// Get the nr. of entries in the buffer.
+/// @return The nr. of entries in use.
+uint16_t IRpulseBuffer::getLength(void) const { return _length; }
+
+/// Get an entry from the buffer.
+/// @param[in] index Which entry. 0 is the first.
+/// @return The entry. Its kind is `entry & kPulseKindMask`, and its value is
+///   `entry & kPulseValueMask`. An out of range index returns a 0uS mark.
+uint32_t IRpulseBuffer::getEntry(const uint16_t index) const {
+  return (index < _length) ? _entries[index] : kPulseMark;
+}
+
+/// Get how long it takes to transmit the buffer.
+/// @return The total duration of all the marks & spaces, in uSeconds.
+uint32_t IRpulseBuffer::getDuration(void) const { return _duration; }
+
+/// Did the buffer run out of room? i.e. It doesn't hold all it was given.
+/// @return true if it did, false if it didn't.
+bool IRpulseBuffer::hasOverflowed(void) const { return _overflow; }
+
+/// Get the max. nr. of entries the buffer can hold.
+/// @return The nr. of entries allocated.
+uint16_t IRpulseBuffer::getSize(void) const { return _size; }
+
+/// Replace the contents of the buffer with a copy of another buffer's.
+/// @param[in] source A Ptr to the buffer to copy.
+/// @return true if it all fitted, false if it didn't.
+bool IRpulseBuffer::copyFrom(const IRpulseBuffer *source) {
+  clear();
+  _length = std::min(source->_length, _size);
+  for (uint16_t i = 0; i < _length; i++) _entries[i] = source->_entries[i];
+  _duration = source->_duration;
+  _carrier = source->_carrier;
+  _overflow = source->_overflow || _length < source->_length;
+  return !_overflow;
+}
+
+/// Class constructor.
+/// @param[in] irsend A Ptr to the IRsend object that controls the GPIO.
+IRgpioTransmitter::IRgpioTransmitter(IRsend *irsend) : _irsend(irsend) {}
+
+/// Transmit a rendered message by bit-banging the GPIO.
+/// @param[in] pulses A Ptr to the rendered message.
+/// @return true if it was transmitted, false if it wasn't.
+bool IRgpioTransmitter::transmit(const IRpulseBuffer *pulses) {
+  return _irsend->play(pulses);
+}
+
+/// Class constructor.
+/// @param[in] irsend A Ptr to the IRsend object to send the messages with.
+/// @param[in] depth The max. nr. of messages that can be waiting at once.
+/// @param[in] yield_gap Spaces of this many uSecs or more are waited out by
+///   returning from `loop()`, rather than by delaying.
+/// @param[in] size The max. nr. of entries in each message. See IRpulseBuffer.
+IRsendQueue::IRsendQueue(IRsend *irsend, const uint8_t depth,
+                         const uint32_t yield_gap, const uint16_t size) {
+  _irsend = irsend;
+  _nslots = std::max(depth, (uint8_t)1);
+  _size = size;
+  _yield_gap = yield_gap;
+  _slots = new IRpulseBuffer*[_nslots];
+  for (uint8_t i = 0; i < _nslots; i++) _slots[i] = new IRpulseBuffer(size);
+  _callbacks = new send_callback_t[_nslots];
+  _ids = new uint16_t[_nslots];
+  _queued = new IRtimer[_nslots];
+  _next_id = 1;
+  clear();
+  resetStats();
+}
+
+/// Class destructor.
+IRsendQueue::~IRsendQueue(void) {
+  for (uint8_t i = 0; i < _nslots; i++) delete _slots[i];
+  delete[] _slots;
+  delete[] _callbacks;
+  delete[] _ids;
+  delete[] _queued;
+}
+
+/// Add a copy of a rendered message to the end of the queue.
+/// @param[in] pulses A Ptr to the rendered message. e.g. By `renderTo()`.
+/// @param[in] callback A function to call when it has been sent, or NULL.
+/// @return An id for the message (never 0), or 0 if it wasn't queued. e.g. The
+///   queue is full, or the message is incomplete or too big.
+uint16_t IRsendQueue::enqueue(const IRpulseBuffer *pulses,
+                              const send_callback_t callback) {
+  if (pulses == NULL || _count >= _nslots) {
+    _stats.dropped++;
+    return 0;
+  }
+  const uint8_t slot = (_head + _count) % _nslots;
+  if (!_slots[slot]->copyFrom(pulses)) {
+    _stats.dropped++;
+    return 0;
+  }
+  _callbacks[slot] = callback;
+  _ids[slot] = _next_id++;
+  if (!_next_id) _next_id = 1;  // 0 means not queued.
+  _queued[slot].reset();
+  _count++;
+  _stats.queued++;
+  _stats.max_depth = std::max(_stats.max_depth, _count);
+  return _ids[slot];
+}
+
+/// Send as much of the queued messages as can be sent without waiting out a
+/// long space. Call this often. e.g. From your sketch's `loop()`.
+/// @return true if there is still more to send, false if there isn't.
+bool IRsendQueue::loop(void) {
+  while (_count) {
+    if (_wait) {  // Are we waiting out a space?
+      if (_waited.elapsed() < _wait) return true;  // Not over yet.
+      _wait = 0;
+    }
+    const IRpulseBuffer *pulses = _slots[_head];
+    const uint16_t length = pulses->getLength();
+    if (_index < length) {
+      // Send up to the next long space, then start waiting it out.
+      uint16_t end = _index;
+      for (; end < length; end++) {
+        const uint32_t entry = pulses->getEntry(end);
+        if ((entry & kPulseKindMask) == kPulseSpace &&
+            (entry & kPulseValueMask) >= _yield_gap) break;
+      }
+      _irsend->play(pulses, _index, end);
+      _index = end;
+      if (_index < length) {
+        _wait = pulses->getEntry(_index++) & kPulseValueMask;
+        _waited.reset();
+        continue;
+      }
+    }
+    // The message has been sent.
+    const uint32_t latency = _queued[_head].elapsed();
+    _stats.sent++;
+    _stats.total_latency += latency;
+    _stats.max_latency = std::max(_stats.max_latency, latency);
+    const send_callback_t callback = _callbacks[_head];
+    const uint16_t id = _ids[_head];
+    _head = (_head + 1) % _nslots;
+    _count--;
+    _index = 0;
+    if (callback != NULL) callback(id);
+  }
+  return false;
+}
+
+/// Discard all the messages waiting to be sent, including any part sent one.
+/// Their callbacks aren't called.
+void IRsendQueue::clear(void) {
+  _head = 0;
+  _count = 0;
+  _index = 0;
+  _wait = 0;
+}
+
+/// Get the nr. of messages waiting to be sent.
+/// @return The nr. of messages, including any being sent.
+uint8_t IRsendQueue::getDepth(void) const { return _count; }
+
+/// Get the max. nr. of entries a queued message can have.
+/// @return The nr. of entries. See IRpulseBuffer.
+uint16_t IRsendQueue::getBufferSize(void) const { return _size; }
+
+/// Get the statistics about the messages handled since `resetStats()`.
+/// @return The statistics.
+send_queue_stats_t IRsendQueue::getStats(void) const { return _stats; }
+
+/// Reset the statistics about the messages handled.
+void IRsendQueue::resetStats(void) {
+  _stats.queued = 0;
+  _stats.sent = 0;
+  _stats.dropped = 0;
+  _stats.max_depth = _count;
+  _stats.max_latency = 0;
+  _stats.total_latency = 0;
+}
+
+/// Class constructor.
+/// @param[in] inverted Are the IR LEDs lit when the GPIO is LOW, not HIGH?
+/// @param[in] use_modulation Do we do frequency modulation during transmission?
+///  i.e. If not, assume a 100% duty cycle.
+IRmultiSend::IRmultiSend(const bool inverted, const bool use_modulation)
+    : _count(0), _inverted(inverted), _modulation(use_modulation) {}
+
+/// Add a rendered message to be sent, & the GPIO to send it from.
+/// @param[in] pin The GPIO to send it from.
+/// @param[in] pulses A Ptr to the rendered message. e.g. By `renderTo()`.
+///   It isn't copied, so it must still exist when `send()` is called.
+/// @return true if it was added, false if it wasn't. e.g. It is incomplete, or
+///   there are already kMultiSendMax messages to send.
+bool IRmultiSend::add(const uint16_t pin, const IRpulseBuffer *pulses) {
+  if (pulses == NULL || pulses->hasOverflowed() || _count >= kMultiSendMax)
+    return false;
+  _pins[_count] = pin;
+  _pulses[_count++] = pulses;
+  return true;
+}
+
+/// Forget all the messages that were added.
+void IRmultiSend::clear(void) { _count = 0; }
+
+/// Get the nr. of messages that have been added.
+/// @return The nr. of messages.
+uint8_t IRmultiSend::getCount(void) const { return _count; }
+
+/// Send all the messages that were added, each from its own GPIO.
+/// @return The nr. of passes it took. i.e. Nr. of times they had to be sent
+///   one after the other, rather than simultaneously. 0 if there was nothing.
+uint8_t IRmultiSend::send(void) {
+#ifndef UNIT_TEST
+  for (uint8_t i = 0; i < _count; i++) pinMode(_pins[i], OUTPUT);
+#endif  // UNIT_TEST
+  _setPins(0);
+  uint8_t passes = 0;
+  uint16_t pending = 0;  // The messages that can share a carrier.
+  uint32_t carriers[kMultiSendMax];
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_carrierOf(_pulses[i], &carriers[i])) {
+      pending |= 1 << i;
+    } else {  // It needs a pass of its own.
+      _sendTogether(1 << i, 0);
+      passes++;
+    }
+  }
+  while (pending) {
+    // Send everything with the same carrier as the first one left, together.
+    uint8_t first = 0;
+    while (!(pending & (1 << first))) first++;
+    uint16_t members = 0;
+    for (uint8_t i = first; i < _count; i++)
+      if ((pending & (1 << i)) && carriers[i] == carriers[first])
+        members |= 1 << i;
+    _sendTogether(members, carriers[first]);
+    pending &= ~members;
+    passes++;
+  }
+  return passes;
+}
+
+/// Find the carrier a rendered message uses.
+/// @param[in] pulses A Ptr to the rendered message.
+/// @param[out] carrier The value of its carrier entry. 0 if it has none.
+/// @return false if it changes carrier part way through, otherwise true.
+bool IRmultiSend::_carrierOf(const IRpulseBuffer *pulses, uint32_t *carrier) {
+  *carrier = 0;
+  for (uint16_t i = 0; i < pulses->getLength(); i++) {
+    const uint32_t entry = pulses->getEntry(i);
+    if ((entry & kPulseKindMask) != kPulseCarrier) continue;
+    const uint32_t value = entry & kPulseValueMask;
+    if (*carrier && value != *carrier) return false;
+    *carrier = value;
+  }
+  return true;
+}
+
+/// Send some of the messages simultaneously, from a single shared carrier.
+/// Each carrier cycle lights the LEDs of all the messages in a mark then.
+/// @param[in] members A bitmask of which messages to send.
+/// @param[in] carrier The value of the carrier entry they share, or 0 to use
+///   each message's own carrier entries. Only valid for a single message.
+void IRmultiSend::_sendTogether(const uint16_t members,
+                                const uint32_t carrier) {
+  uint16_t index[kMultiSendMax] = {0};  // The next entry of each message.
+  uint32_t ends[kMultiSendMax] = {0};  // When its current mark/space ends.
+  uint16_t marking = 0;  // Which messages are in a mark.
+  uint32_t freq = carrier & kPulseFreqMask;
+  uint8_t duty = carrier >> kPulseDutyOffset;
+  uint32_t started = 0;  // When the carrier was last changed. (uSecs)
+  // The carrier's period & on time, as whole uSecs, the nSecs left over, & the
+  // fraction of a nSec left over after that. (In 1/freq nSecs.)
+  // Worked out whenever the carrier changes.
+  uint32_t period_us = 0, period_ns = 0, period_rem = 0;
+  uint32_t on_us = 0, on_ns = 0;
+  // When the next cycle of the carrier starts, in the same units.
+  uint32_t cycle_us = 0, cycle_ns = 0, cycle_rem = 0;
+  bool stale = true;  // Does all that need working out again?
+  IRtimer timer;
+  while (true) {
+    const uint32_t now = timer.elapsed();
+    uint32_t next = UINT32_MAX;  // When the next mark or space starts.
+    uint32_t mark_end = UINT32_MAX;  // When the first mark in progress ends.
+    uint16_t active = 0;  // Which messages haven't finished yet.
+    for (uint8_t i = 0; i < _count; i++) {
+      const uint16_t bit = 1 << i;
+      if (!(members & bit)) continue;
+      const IRpulseBuffer *pulses = _pulses[i];
+      // Catch up with where this message should be by now.
+      while (ends[i] <= now && index[i] < pulses->getLength()) {
+        const uint32_t entry = pulses->getEntry(index[i]++);
+        const uint32_t value = entry & kPulseValueMask;
+        switch (entry & kPulseKindMask) {
+          case kPulseCarrier:
+            if (!carrier) {
+              freq = value & kPulseFreqMask;
+              duty = value >> kPulseDutyOffset;
+              started = ends[i];
+              stale = true;
+            }
+            break;
+          case kPulseMark:
+            ends[i] += value;
+            marking |= bit;
+            break;
+          default:
+            ends[i] += value;
+            marking &= ~bit;
+        }
+      }
+      if (ends[i] <= now) continue;  // It has finished.
+      active |= bit;
+      next = std::min(next, ends[i]);
+      if (marking & bit) mark_end = std::min(mark_end, ends[i]);
+    }
+    if (!active) break;
+    const uint16_t on = marking & active;
+    if (!freq) {  // No carrier entry, so use the usual default.
+      freq = 38000;
+      duty = kDutyDefault;
+    }
+    if (!on || !_modulation || duty >= kDutyMax) {
+      _setPins(on);
+      _delayMicroseconds(next - now);
+      continue;
+    }
+    if (stale) {
+      period_us = 1000000UL / freq;
+      period_ns = (1000000000UL / freq) % 1000;
+      period_rem = 1000000000UL % freq;
+      const uint32_t on_time = 10000000UL * duty / freq;  // nSecs
+      on_us = on_time / 1000;
+      on_ns = on_time % 1000;
+    }
+    if (stale || cycle_us < now) {
+      // Find the next cycle of the carrier, counting from when it began.
+      // Only needed after a carrier change or a space, or if we fell behind.
+      const uint64_t cycle = ((uint64_t)(now - started) * freq + 999999) /
+          1000000;
+      const uint64_t offset = cycle * 1000000000ULL;
+      const uint64_t start = started * 1000ULL + offset / freq;
+      cycle_us = start / 1000;
+      cycle_ns = start % 1000;
+      cycle_rem = offset % freq;
+      stale = false;
+    }
+    const uint32_t on_at = cycle_us;
+    if (on_at >= next) {  // Something changes before then.
+      _delayMicroseconds(next - now);
+      continue;
+    }
+    if (on_at > now) _delayMicroseconds(on_at - now);
+    _setPins(on);
+    // Turn them off after the duty cycle, or at the end of the first mark.
+    const uint32_t off_at = std::min(
+        std::max(on_at + on_us + (cycle_ns + on_ns >= 1000), on_at + 1),
+        mark_end);
+    // Step on to the next cycle.
+    cycle_us += period_us;
+    cycle_ns += period_ns;
+    cycle_rem += period_rem;
+    if (cycle_rem >= freq) {
+      cycle_rem -= freq;
+      cycle_ns++;
+    }
+    if (cycle_ns >= 1000) {
+      cycle_ns -= 1000;
+      cycle_us++;
+    }
+    const uint32_t elapsed = timer.elapsed();
+    if (elapsed < off_at) _delayMicroseconds(off_at - elapsed);
+    _setPins(0);
+  }
+  _setPins(0);
+}
+
+/// Turn the IR LEDs of the messages on or off.
+/// @param[in] on A bitmask of which messages' LEDs to turn on. The rest are
+///   turned off.
+void IRmultiSend::_setPins(const uint16_t on) {
+#ifndef UNIT_TEST
+#if defined(ESP8266)
+  // Change GPIO0-15 all at once, via the output set & clear registers.
+  uint32_t high = 0;
+  uint32_t low = 0;
+  for (uint8_t i = 0; i < _count; i++) {
+    const bool level = ((on >> i) & 1) != _inverted;
+    if (_pins[i] >= 16)  // e.g. GPIO16 isn't in those registers.
+      digitalWrite(_pins[i], level ? HIGH : LOW);
+    else if (level)
+      high |= 1UL << _pins[i];
+    else
+      low |= 1UL << _pins[i];
+  }
+  GPOS = high;
+  GPOC = low;
+#else  // ESP8266
+  for (uint8_t i = 0; i < _count; i++)
+    digitalWrite(_pins[i], (((on >> i) & 1) != _inverted) ? HIGH : LOW);
+#endif  // ESP8266
+#else
+  (void)on;
+#endif  // UNIT_TEST
+}
+
+/// A watch-dog timer friendly version of delayMicroseconds(), as IRsend has.
+/// @param[in] usec Nr. of uSeconds to delay for.
+void IRmultiSend::_delayMicroseconds(uint32_t usec) {
+#ifndef UNIT_TEST
+#if ALLOW_DELAY_CALLS
+  if (usec > kMaxAccurateUsecDelay) {
+    delay(usec / 1000UL);  // Delay for as many whole milliseconds as we can.
+    usec %= 1000UL;
+  }
+#else  // ALLOW_DELAY_CALLS
+  for (; usec > kMaxAccurateUsecDelay; usec -= kMaxAccurateUsecDelay)
+    delayMicroseconds(kMaxAccurateUsecDelay);
+#endif  // ALLOW_DELAY_CALLS
+  delayMicroseconds(static_cast<uint16_t>(usec));
+#else
+  (void)usec;
+#endif  // UNIT_TEST
+}
+
 /// Calculate & set any offsets to account for execution times during sending.
 ///
 /// @param[in] hz The frequency to calibrate at >= 1000Hz. Default is 38000Hz.
@@ -376,7 +1040,7 @@ void IRsend::sendGeneric(const uint16_t headermark, const uint32_t headerspace,
                          const uint8_t dutycycle) {
   // Setup
   enableIROut(frequency, dutycycle);
-  IRtimer usecs = IRtimer();
+  IRsendTimer usecs = IRsendTimer(this);
 
   // We always send a message, even for repeat=0, hence '<= repeat'.
   for (uint16_t r = 0; r <= repeat; r++) {
@@ -452,6 +1116,42 @@ void IRsend::sendGeneric(const uint16_t headermark, const uint32_t headerspace,
   }
 }
 
+/// Send a typical message described by an `ir_protocol_t`.
+/// Will send leading or trailing 0's if the nbits is larger than the number
+/// of bits in data.
+/// @param[in] protocol The description of the protocol.
+/// @param[in] data The data to be transmitted.
+/// @param[in] nbits Nr. of bits of data to be sent.
+/// @param[in] repeat Nr. of extra times the message will be sent.
+///   e.g. 0 = 1 message sent, 1 = 1 initial + 1 repeat = 2 messages
+void IRsend::sendProtocol(const ir_protocol_t &protocol, const uint64_t data,
+                          const uint16_t nbits, const uint16_t repeat) {
+  sendGeneric(protocol.hdrmark, protocol.hdrspace,
+              protocol.onemark, protocol.onespace,
+              protocol.zeromark, protocol.zerospace,
+              protocol.footermark, protocol.gap, protocol.mesgtime,
+              data, nbits, protocol.frequency, protocol.MSBfirst, repeat,
+              protocol.dutycycle);
+}
+
+/// Send a typical byte based message described by an `ir_protocol_t`.
+/// @param[in] protocol The description of the protocol.
+/// @param[in] dataptr Pointer to the data to be transmitted.
+/// @param[in] nbytes Nr. of bytes of data to be sent.
+/// @param[in] repeat Nr. of extra times the message will be sent.
+///   e.g. 0 = 1 message sent, 1 = 1 initial + 1 repeat = 2 messages
+/// @note The protocol's `mesgtime` isn't used.
+void IRsend::sendProtocol(const ir_protocol_t &protocol,
+                          const uint8_t *dataptr, const uint16_t nbytes,
+                          const uint16_t repeat) {
+  sendGeneric(protocol.hdrmark, protocol.hdrspace,
+              protocol.onemark, protocol.onespace,
+              protocol.zeromark, protocol.zerospace,
+              protocol.footermark, protocol.gap,
+              dataptr, nbytes, protocol.frequency, protocol.MSBfirst, repeat,
+              protocol.dutycycle);
+}
+
 /// Generic method for sending Manchester code data.
 /// Will send leading or trailing 0's if the nbits is larger than the number
 /// of bits in data.
@@ -10,6 +10,7 @@
 #include <vector>
 #endif  // SWIGLIB
 #include "IRremoteESP8266.h"
+#include "IRtimer.h"
 
 // Originally from https://github.com/shirriff/Arduino-IRremote/
 // Updated by markszabo (https://github.com/crankyoldgit/IRremoteESP8266) for
@@ -48,6 +49,27 @@ const uint8_t kDutyMax = 100;     // Percentage
 const uint16_t kMaxAccurateUsecDelay = 16383;
 //  Usecs to wait between messages we don't know the proper gap time.
 const uint32_t kDefaultMessageGap = 100000;
+// Default nr. of entries in an IRpulseBuffer.
+const uint16_t kPulseBufferSize = 512;
+// The kind of each IRpulseBuffer entry is held in its top two bits.
+const uint32_t kPulseMark = 0;
+const uint32_t kPulseSpace = 1UL << 30;
+const uint32_t kPulseCarrier = 2UL << 30;
+const uint32_t kPulseKindMask = 3UL << 30;
+const uint32_t kPulseValueMask = ~kPulseKindMask;  // uSecs, or freq & duty.
+// A carrier entry's value is the freq (Hz) in the lower bits, & the duty
+// cycle (percentage) above them.
+const uint8_t kPulseDutyOffset = 23;
+const uint32_t kPulseFreqMask = (1UL << kPulseDutyOffset) - 1;
+// Default nr. of messages an IRsendQueue can hold.
+const uint8_t kSendQueueDepth = 2;
+// Default nr. of entries in each of an IRsendQueue's buffers.
+const uint16_t kSendQueueBufferSize = 1024;
+// Default for the shortest space (uSecs) an IRsendQueue waits out in the
+// background, rather than by delaying.
+const uint32_t kSendQueueYieldGap = 20000;
+// Max. nr. of GPIOs an IRmultiSend can transmit from at once.
+const uint8_t kMultiSendMax = 16;
 /// Placeholder for missing sensor temp value
 /// @note Not using "-1" as it may be a valid external temp
 const float kNoTempValue = -100.0;
@@ -254,9 +276,83 @@ enum toshiba_ac_remote_model_t {
   // many remote models such as WA-TH03A, WA-TH04A etc.
 };
 
+class IRtextWriter;  // Forward declaration. See IRutils.h
+
 #ifndef SWIG
 // Classes
 
+/// A message rendered into a compact list of marks & spaces, with any changes
+/// of carrier frequency or duty cycle in between, ready to be transmitted.
+/// Consecutive marks (or spaces) are merged. i.e. It is run-length encoded.
+/// @see IRsend::renderTo(), IRsend::play() & IRtransmitter.
+class IRpulseBuffer {
+ public:
+  explicit IRpulseBuffer(const uint16_t size = kPulseBufferSize);
+  ~IRpulseBuffer(void);
+  // It owns its entries, so copies would delete them twice. See copyFrom().
+  IRpulseBuffer(const IRpulseBuffer &) = delete;
+  IRpulseBuffer &operator=(const IRpulseBuffer &) = delete;
+  void clear(void);
+  bool addCarrier(const uint32_t freq, const uint8_t duty);
+  bool addMark(const uint32_t usecs);
+  bool addSpace(const uint32_t usecs);
+  uint16_t getLength(void) const;
+  uint32_t getEntry(const uint16_t index) const;
+  uint32_t getDuration(void) const;
+  bool hasOverflowed(void) const;
+  uint16_t getSize(void) const;
+  bool copyFrom(const IRpulseBuffer *source);
+
+ private:
+  uint32_t *_entries;  ///< Each is a kind (kPulse*) & a value.
+  uint16_t _size;      ///< Nr. of entries allocated.
+  uint16_t _length;    ///< Nr. of entries in use.
+  uint32_t _duration;  ///< Total of the marks & spaces, in uSeconds.
+  uint32_t _carrier;   ///< The value of the last carrier entry added.
+  bool _overflow;      ///< Did we run out of entries?
+  bool _add(const uint32_t kind, const uint32_t value);
+};
+
+class IRsend;  // Forward declaration.
+
+/// Something that can transmit a message rendered into an IRpulseBuffer.
+/// e.g. A GPIO, a hardware peripheral, a file, or a loopback to a decoder.
+class IRtransmitter {
+ public:
+  virtual ~IRtransmitter(void) {}
+  /// Transmit a rendered message.
+  /// @param[in] pulses A Ptr to the rendered message.
+  /// @return true if it was transmitted, false if it wasn't.
+  virtual bool transmit(const IRpulseBuffer *pulses) = 0;
+};
+
+/// Transmits rendered messages by bit-banging a GPIO, via an IRsend object.
+class IRgpioTransmitter : public IRtransmitter {
+ public:
+  explicit IRgpioTransmitter(IRsend *irsend);
+  bool transmit(const IRpulseBuffer *pulses);
+
+ private:
+  IRsend *_irsend;  ///< Does the actual transmitting.
+};
+
+/// Times part of a message being sent by an IRsend, in uSeconds. e.g. So a
+/// protocol can pad its messages out to a fixed length.
+/// While the IRsend is rendering, rather than sending, nothing takes any real
+/// time, so it uses the IRsend's own (virtual) clock of the time rendered so
+/// far instead. The real clock, & thus any IRtimer, is left alone.
+class IRsendTimer {
+ public:
+  explicit IRsendTimer(const IRsend *irsend);
+  void reset(void);
+  uint32_t elapsed(void);
+
+ private:
+  const IRsend *_irsend;  ///< Whose messages we are timing.
+  IRtimer _timer;         ///< Times messages that are actually sent.
+  uint32_t _start;        ///< Rendered time when reset. (uSecs)
+};
+
 /// Class for sending all basic IR protocols.
 /// @note Originally from https://github.com/shirriff/Arduino-IRremote/
 ///  Updated by markszabo (https://github.com/crankyoldgit/IRremoteESP8266) for
@@ -271,6 +367,12 @@ class IRsend {
   VIRTUALMS uint16_t mark(uint16_t usec);
   VIRTUALMS void space(uint32_t usec);
   int8_t calibrate(uint16_t hz = 38000U);
+  void setFractionalCarrier(const bool enable);
+  bool getFractionalCarrier(void) const;
+  void renderTo(IRpulseBuffer *pulses);
+  static void renderAllTo(IRpulseBuffer *pulses);
+  bool play(const IRpulseBuffer *pulses, const uint16_t start = 0,
+            const uint16_t end = UINT16_MAX);
   void sendRaw(const uint16_t buf[], const uint16_t len, const uint16_t hz);
   void sendData(uint16_t onemark, uint32_t onespace, uint16_t zeromark,
                 uint32_t zerospace, uint64_t data, uint16_t nbits,
@@ -308,6 +410,10 @@ class IRsend {
                    const uint8_t *dataptr, const uint16_t nbytes,
                    const uint16_t frequency, const bool MSBfirst,
                    const uint16_t repeat, const uint8_t dutycycle);
+  void sendProtocol(const ir_protocol_t &protocol, const uint64_t data,
+                    const uint16_t nbits, const uint16_t repeat = kNoRepeat);
+  void sendProtocol(const ir_protocol_t &protocol, const uint8_t *dataptr,
+                    const uint16_t nbytes, const uint16_t repeat = kNoRepeat);
   static uint16_t minRepeats(const decode_type_t protocol);
   static uint16_t defaultBits(const decode_type_t protocol);
   bool send(const decode_type_t type, const uint64_t data,
@@ -946,15 +1052,122 @@ class IRsend {
 #endif  // UNIT_TEST
   uint16_t onTimePeriod;
   uint16_t offTimePeriod;
+  uint32_t _carrierHz;    ///< Exact carrier frequency. (Hz)
+  uint32_t _periodNsecs;  ///< Whole nSecs per carrier period.
+  uint32_t _periodRem;    ///< Rest of the period. (1/_carrierHz nSecs)
+  uint32_t _onNsecs;      ///< Exact time the LED is on per period. (nSecs)
+  bool _fractional;       ///< Schedule carrier cycles with _periodNsecs etc?
   uint16_t IRpin;
   int8_t periodOffset;
   uint8_t _dutycycle;
   bool modulation;
+  IRpulseBuffer *_render;  ///< Where to render messages. NULL means send them.
+  static IRpulseBuffer *_renderAll;  ///< Where every IRsend renders to.
+  uint32_t _rendered;  ///< Virtual clock. uSecs rendered so far. (Wraps)
+  IRpulseBuffer *_renderTarget(void) const;
   uint32_t calcUSecPeriod(uint32_t hz, bool use_offset = true);
+  uint16_t _markFractional(const uint16_t usec);
 #if SEND_SONY
   void _sendSony(const uint64_t data, const uint16_t nbits,
                  const uint16_t repeat, const uint16_t freq);
 #endif  // SEND_SONY
+  friend class IRsendTimer;
+};
+
+/// Statistics about the messages an IRsendQueue has handled.
+typedef struct {
+  uint32_t queued;    // Nr. of messages accepted.
+  uint32_t sent;      // Nr. of messages finished sending.
+  uint32_t dropped;   // Nr. of messages refused. e.g. The queue was full.
+  uint8_t max_depth;  // The most messages that have been waiting at once.
+  uint32_t max_latency;    // Longest time from queued to sent. (uSecs)
+  uint64_t total_latency;  // Total time from queued to sent. (uSecs)
+} send_queue_stats_t;
+
+/// A function to call when a queued message has finished sending.
+/// @param[in] id The id `IRsendQueue::enqueue()` returned for the message.
+typedef void (*send_callback_t)(const uint16_t id);
+
+/// A queue of rendered messages, sent in the background by `loop()`, so the
+/// caller doesn't have to wait for them to be sent.
+/// Each message is sent via an IRsend object by bit-banging, as usual, but any
+/// long spaces (e.g. the gaps between sections or repeats) are waited out by
+/// returning from `loop()` instead of by delaying.
+/// @note The waits are timed with IRtimer, so the queue can be driven in unit
+///   tests with `IRtimer::add()`. Rendering takes no time on that clock, so
+///   the next message can be rendered while a wait is under way.
+class IRsendQueue {
+ public:
+  explicit IRsendQueue(IRsend *irsend, const uint8_t depth = kSendQueueDepth,
+                       const uint32_t yield_gap = kSendQueueYieldGap,
+                       const uint16_t size = kSendQueueBufferSize);
+  ~IRsendQueue(void);
+  // It owns its buffers, so copies would delete them twice.
+  IRsendQueue(const IRsendQueue &) = delete;
+  IRsendQueue &operator=(const IRsendQueue &) = delete;
+  uint16_t enqueue(const IRpulseBuffer *pulses,
+                   const send_callback_t callback = NULL);
+  bool loop(void);
+  void clear(void);
+  uint8_t getDepth(void) const;
+  uint16_t getBufferSize(void) const;
+  send_queue_stats_t getStats(void) const;
+  void resetStats(void);
+
+ private:
+  IRsend *_irsend;  ///< What the messages are sent with.
+  IRpulseBuffer **_slots;  ///< The message buffers.
+  send_callback_t *_callbacks;  ///< What to call when each message is sent.
+  uint16_t *_ids;      ///< The id of each message.
+  IRtimer *_queued;    ///< When each message was queued.
+  uint8_t _nslots;     ///< Nr. of message buffers.
+  uint8_t _head;       ///< The slot of the message being sent.
+  uint8_t _count;      ///< Nr. of messages waiting, including the one sending.
+  uint16_t _size;      ///< Nr. of entries in each message buffer.
+  uint16_t _next_id;   ///< The id to give the next message.
+  uint16_t _index;     ///< The next entry to send in the message being sent.
+  uint32_t _yield_gap;  ///< Spaces this long or longer are waited out.
+  uint32_t _wait;      ///< How long the current wait is. (uSecs)
+  IRtimer _waited;     ///< When the current wait started.
+  send_queue_stats_t _stats;
+};
+
+/// Transmits several rendered messages at the same time, each from its own
+/// GPIO. e.g. To control many devices, each with its own IR LED, at once.
+/// Messages that share the same carrier frequency & duty cycle are sent
+/// simultaneously, by bit-banging all of their GPIOs from a single carrier.
+/// Each distinct carrier takes a pass of its own, one after the other.
+/// So, the time it takes approaches that of the longest message, rather than
+/// the sum of all of them, when they share a carrier.
+/// @note Marks start on the shared carrier's cycles. i.e. They can be up to one
+///   carrier period late, which is well within what decoders tolerate.
+/// @note A message that changes carrier part way through is sent on its own.
+class IRmultiSend {
+ public:
+  explicit IRmultiSend(const bool inverted = false,
+                       const bool use_modulation = true);
+  VIRTUAL ~IRmultiSend(void) {}
+  bool add(const uint16_t pin, const IRpulseBuffer *pulses);
+  void clear(void);
+  uint8_t getCount(void) const;
+  uint8_t send(void);
+#ifndef UNIT_TEST
+
+ protected:
+#endif  // UNIT_TEST
+  VIRTUAL void _delayMicroseconds(uint32_t usec);
+  VIRTUAL void _setPins(const uint16_t on);
+#ifndef UNIT_TEST
+
+ private:
+#endif  // UNIT_TEST
+  uint16_t _pins[kMultiSendMax];  ///< The GPIO each message is sent from.
+  const IRpulseBuffer *_pulses[kMultiSendMax];  ///< The messages to send.
+  uint8_t _count;  ///< Nr. of messages to send.
+  bool _inverted;  ///< IR LEDs are lit when the GPIO is LOW, not HIGH?
+  bool _modulation;  ///< Is frequency modulation to be used?
+  static bool _carrierOf(const IRpulseBuffer *pulses, uint32_t *carrier);
+  void _sendTogether(const uint16_t members, const uint32_t carrier);
 };
 #endif  // SWIG
 #endif  // IRSEND_H_
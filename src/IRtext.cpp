@@ -8,7 +8,9 @@
 #ifndef UNIT_TEST
 #include <Arduino.h>
 #endif  // UNIT_TEST
+#include <stddef.h>
 #include "IRremoteESP8266.h"
+#include "IRutils.h"
 #include "i18n.h"
 
 #include "IRmacros.h"
@@ -304,266 +306,363 @@ IRTEXT_CONST_STRING(kToshibaGenericRemoteBStr, D_STR_TOSHIBAGENERICREMOTEB);
                                // a question mark, check for length > 1
                                // to show only currently included protocols
 // Protocol Names
-// Needs to be in decode_type_t order.
+// Needs to be in decode_type_t order. (Checked at compile time.)
+// i.e. X(<decode_type_t>, <name>)
+// New protocols should be added to the end of this list.
+#define IRTEXT_PROTOCOL_NAMES(X) \
+    X(UNUSED, D_STR_UNUSED) \
+    X(RC5, COND(DECODE_RC5 || SEND_RC5, \
+            D_STR_RC5, D_STR_UNSUPPORTED)) \
+    X(RC6, COND(DECODE_RC6 || SEND_RC6, \
+            D_STR_RC6, D_STR_UNSUPPORTED)) \
+    X(NEC, COND(DECODE_NEC || SEND_NEC, \
+            D_STR_NEC, D_STR_UNSUPPORTED)) \
+    X(SONY, COND(DECODE_SONY || SEND_SONY, \
+            D_STR_SONY, D_STR_UNSUPPORTED)) \
+    X(PANASONIC, COND(DECODE_PANASONIC || SEND_PANASONIC, \
+            D_STR_PANASONIC, D_STR_UNSUPPORTED)) \
+    X(JVC, COND(DECODE_JVC || SEND_JVC, \
+            D_STR_JVC, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG, COND(DECODE_SAMSUNG || SEND_SAMSUNG, \
+            D_STR_SAMSUNG, D_STR_UNSUPPORTED)) \
+    X(WHYNTER, COND(DECODE_WHYNTER || SEND_WHYNTER, \
+            D_STR_WHYNTER, D_STR_UNSUPPORTED)) \
+    X(AIWA_RC_T501, COND(DECODE_AIWA_RC_T501 || SEND_AIWA_RC_T501, \
+            D_STR_AIWA_RC_T501, D_STR_UNSUPPORTED)) \
+    X(LG, COND(DECODE_LG || SEND_LG, \
+            D_STR_LG, D_STR_UNSUPPORTED)) \
+    X(SANYO, COND(DECODE_SANYO || SEND_SANYO, \
+            D_STR_SANYO, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI, COND(DECODE_MITSUBISHI || SEND_MITSUBISHI, \
+            D_STR_MITSUBISHI, D_STR_UNSUPPORTED)) \
+    X(DISH, COND(DECODE_DISH || SEND_DISH, \
+            D_STR_DISH, D_STR_UNSUPPORTED)) \
+    X(SHARP, COND(DECODE_SHARP || SEND_SHARP, \
+            D_STR_SHARP, D_STR_UNSUPPORTED)) \
+    X(COOLIX, COND(DECODE_COOLIX || SEND_COOLIX, \
+            D_STR_COOLIX, D_STR_UNSUPPORTED)) \
+    X(DAIKIN, COND(DECODE_DAIKIN || SEND_DAIKIN, \
+            D_STR_DAIKIN, D_STR_UNSUPPORTED)) \
+    X(DENON, COND(DECODE_DENON || SEND_DENON, \
+            D_STR_DENON, D_STR_UNSUPPORTED)) \
+    X(KELVINATOR, COND(DECODE_KELVINATOR || SEND_KELVINATOR, \
+            D_STR_KELVINATOR, D_STR_UNSUPPORTED)) \
+    X(SHERWOOD, COND(SEND_SHERWOOD, \
+            D_STR_SHERWOOD, D_STR_UNSUPPORTED))  /* SEND-ONLY */ \
+    X(MITSUBISHI_AC, COND(DECODE_MITSUBISHI_AC || SEND_MITSUBISHI_AC, \
+            D_STR_MITSUBISHI_AC, D_STR_UNSUPPORTED)) \
+    X(RCMM, COND(DECODE_RCMM || SEND_RCMM, \
+            D_STR_RCMM, D_STR_UNSUPPORTED)) \
+    X(SANYO_LC7461, COND(DECODE_SANYO || SEND_SANYO, \
+            D_STR_SANYO_LC7461, D_STR_UNSUPPORTED)) \
+    X(RC5X, COND(DECODE_RC5 || SEND_RC5, \
+            D_STR_RC5X, D_STR_UNSUPPORTED)) \
+    X(GREE, COND(DECODE_GREE || SEND_GREE, \
+            D_STR_GREE, D_STR_UNSUPPORTED)) \
+    X(PRONTO, COND(SEND_PRONTO, \
+            D_STR_PRONTO, D_STR_UNSUPPORTED))  /* SEND-ONLY */ \
+    X(NEC_LIKE, COND(DECODE_NEC || SEND_NEC, \
+            D_STR_NEC_LIKE, D_STR_UNSUPPORTED)) \
+    X(ARGO, COND(DECODE_ARGO || SEND_ARGO, \
+            D_STR_ARGO, D_STR_UNSUPPORTED)) \
+    X(TROTEC, COND(DECODE_TROTEC || SEND_TROTEC, \
+            D_STR_TROTEC, D_STR_UNSUPPORTED)) \
+    X(NIKAI, COND(DECODE_NIKAI || SEND_NIKAI, \
+            D_STR_NIKAI, D_STR_UNSUPPORTED)) \
+    X(RAW, COND(SEND_RAW, \
+            D_STR_RAW, D_STR_UNSUPPORTED))  /* SEND-ONLY */ \
+    X(GLOBALCACHE, COND(SEND_GLOBALCACHE, \
+            D_STR_GLOBALCACHE, D_STR_UNSUPPORTED))  /* SEND */ \
+    X(TOSHIBA_AC, COND(DECODE_TOSHIBA_AC || SEND_TOSHIBA_AC, \
+            D_STR_TOSHIBA_AC, D_STR_UNSUPPORTED)) \
+    X(FUJITSU_AC, COND(DECODE_FUJITSU_AC || SEND_FUJITSU_AC, \
+            D_STR_FUJITSU_AC, D_STR_UNSUPPORTED)) \
+    X(MIDEA, COND(DECODE_MIDEA || SEND_MIDEA, \
+            D_STR_MIDEA, D_STR_UNSUPPORTED)) \
+    X(MAGIQUEST, COND(DECODE_MAGIQUEST || SEND_MAGIQUEST, \
+            D_STR_MAGIQUEST, D_STR_UNSUPPORTED)) \
+    X(LASERTAG, COND(DECODE_LASERTAG || SEND_LASERTAG, \
+            D_STR_LASERTAG, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC, COND(DECODE_CARRIER_AC || SEND_CARRIER_AC, \
+            D_STR_CARRIER_AC, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC, COND(DECODE_HAIER_AC || SEND_HAIER_AC, \
+            D_STR_HAIER_AC, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI2, COND(DECODE_MITSUBISHI2 || SEND_MITSUBISHI2, \
+            D_STR_MITSUBISHI2, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC, COND(DECODE_HITACHI_AC || SEND_HITACHI_AC, \
+            D_STR_HITACHI_AC, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC1, COND(DECODE_HITACHI_AC1 || SEND_HITACHI_AC1, \
+            D_STR_HITACHI_AC1, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC2, COND(DECODE_HITACHI_AC2 || SEND_HITACHI_AC2, \
+            D_STR_HITACHI_AC2, D_STR_UNSUPPORTED)) \
+    X(GICABLE, COND(DECODE_GICABLE || SEND_GICABLE, \
+            D_STR_GICABLE, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC_YRW02, COND(DECODE_HAIER_AC_YRW02 || SEND_HAIER_AC_YRW02, \
+            D_STR_HAIER_AC_YRW02, D_STR_UNSUPPORTED)) \
+    X(WHIRLPOOL_AC, COND(DECODE_WHIRLPOOL_AC || SEND_WHIRLPOOL_AC, \
+            D_STR_WHIRLPOOL_AC, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG_AC, COND(DECODE_SAMSUNG_AC || SEND_SAMSUNG_AC, \
+            D_STR_SAMSUNG_AC, D_STR_UNSUPPORTED)) \
+    X(LUTRON, COND(DECODE_LUTRON || SEND_LUTRON, \
+            D_STR_LUTRON, D_STR_UNSUPPORTED)) \
+    X(ELECTRA_AC, COND(DECODE_ELECTRA_AC || SEND_ELECTRA_AC, \
+            D_STR_ELECTRA_AC, D_STR_UNSUPPORTED)) \
+    X(PANASONIC_AC, COND(DECODE_PANASONIC_AC || SEND_PANASONIC_AC, \
+            D_STR_PANASONIC_AC, D_STR_UNSUPPORTED)) \
+    X(PIONEER, COND(DECODE_PIONEER || SEND_PIONEER, \
+            D_STR_PIONEER, D_STR_UNSUPPORTED)) \
+    X(LG2, COND(DECODE_LG || SEND_LG, \
+            D_STR_LG2, D_STR_UNSUPPORTED)) \
+    X(MWM, COND(DECODE_MWM || SEND_MWM, \
+            D_STR_MWM, D_STR_UNSUPPORTED)) \
+    X(DAIKIN2, COND(DECODE_DAIKIN2 || SEND_DAIKIN2, \
+            D_STR_DAIKIN2, D_STR_UNSUPPORTED)) \
+    X(VESTEL_AC, COND(DECODE_VESTEL_AC || SEND_VESTEL_AC, \
+            D_STR_VESTEL_AC, D_STR_UNSUPPORTED)) \
+    X(TECO, COND(DECODE_TECO || SEND_TECO, \
+            D_STR_TECO, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG36, COND(DECODE_SAMSUNG36 || SEND_SAMSUNG36, \
+            D_STR_SAMSUNG36, D_STR_UNSUPPORTED)) \
+    X(TCL112AC, COND(DECODE_TCL112AC || SEND_TCL112AC, \
+            D_STR_TCL112AC, D_STR_UNSUPPORTED)) \
+    X(LEGOPF, COND(DECODE_LEGOPF || SEND_LEGOPF, \
+            D_STR_LEGOPF, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI_HEAVY_88, COND(DECODE_MITSUBISHIHEAVY || \
+                SEND_MITSUBISHIHEAVY, \
+            D_STR_MITSUBISHI_HEAVY_88, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI_HEAVY_152, COND(DECODE_MITSUBISHIHEAVY || \
+                SEND_MITSUBISHIHEAVY, \
+            D_STR_MITSUBISHI_HEAVY_152, D_STR_UNSUPPORTED)) \
+    X(DAIKIN216, COND(DECODE_DAIKIN216 || SEND_DAIKIN216, \
+            D_STR_DAIKIN216, D_STR_UNSUPPORTED)) \
+    X(SHARP_AC, COND(DECODE_SHARP_AC || SEND_SHARP_AC, \
+            D_STR_SHARP_AC, D_STR_UNSUPPORTED)) \
+    X(GOODWEATHER, COND(DECODE_GOODWEATHER || SEND_GOODWEATHER, \
+            D_STR_GOODWEATHER, D_STR_UNSUPPORTED)) \
+    X(INAX, COND(DECODE_INAX || SEND_INAX, \
+            D_STR_INAX, D_STR_UNSUPPORTED)) \
+    X(DAIKIN160, COND(DECODE_DAIKIN160 || SEND_DAIKIN160, \
+            D_STR_DAIKIN160, D_STR_UNSUPPORTED)) \
+    X(NEOCLIMA, COND(DECODE_NEOCLIMA || SEND_NEOCLIMA, \
+            D_STR_NEOCLIMA, D_STR_UNSUPPORTED)) \
+    X(DAIKIN176, COND(DECODE_DAIKIN176 || SEND_DAIKIN176, \
+            D_STR_DAIKIN176, D_STR_UNSUPPORTED)) \
+    X(DAIKIN128, COND(DECODE_DAIKIN128 || SEND_DAIKIN128, \
+            D_STR_DAIKIN128, D_STR_UNSUPPORTED)) \
+    X(AMCOR, COND(DECODE_AMCOR || SEND_AMCOR, \
+            D_STR_AMCOR, D_STR_UNSUPPORTED)) \
+    X(DAIKIN152, COND(DECODE_DAIKIN152 || SEND_DAIKIN152, \
+            D_STR_DAIKIN152, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI136, COND(DECODE_MITSUBISHI136 || SEND_MITSUBISHI136, \
+            D_STR_MITSUBISHI136, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI112, COND(DECODE_MITSUBISHI112 || SEND_MITSUBISHI112, \
+            D_STR_MITSUBISHI112, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC424, COND(DECODE_HITACHI_AC424 || SEND_HITACHI_AC424, \
+            D_STR_HITACHI_AC424, D_STR_UNSUPPORTED)) \
+    X(SONY_38K, COND(SEND_SONY, \
+            D_STR_SONY_38K, D_STR_UNSUPPORTED)) \
+    X(EPSON, COND(DECODE_EPSON || SEND_EPSON, \
+            D_STR_EPSON, D_STR_UNSUPPORTED)) \
+    X(SYMPHONY, COND(DECODE_SYMPHONY || SEND_SYMPHONY, \
+            D_STR_SYMPHONY, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC3, COND(DECODE_HITACHI_AC3 || SEND_HITACHI_AC3, \
+            D_STR_HITACHI_AC3, D_STR_UNSUPPORTED)) \
+    X(DAIKIN64, COND(DECODE_DAIKIN64 || SEND_DAIKIN64, \
+            D_STR_DAIKIN64, D_STR_UNSUPPORTED)) \
+    X(AIRWELL, COND(DECODE_AIRWELL || SEND_AIRWELL, \
+            D_STR_AIRWELL, D_STR_UNSUPPORTED)) \
+    X(DELONGHI_AC, COND(DECODE_DELONGHI_AC || SEND_DELONGHI_AC, \
+            D_STR_DELONGHI_AC, D_STR_UNSUPPORTED)) \
+    X(DOSHISHA, COND(DECODE_DOSHISHA || SEND_DOSHISHA, \
+            D_STR_DOSHISHA, D_STR_UNSUPPORTED)) \
+    X(MULTIBRACKETS, COND(DECODE_MULTIBRACKETS || SEND_MULTIBRACKETS, \
+            D_STR_MULTIBRACKETS, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC40, COND(DECODE_CARRIER_AC40 || SEND_CARRIER_AC40, \
+            D_STR_CARRIER_AC40, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC64, COND(DECODE_CARRIER_AC64 || SEND_CARRIER_AC64, \
+            D_STR_CARRIER_AC64, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC344, COND(DECODE_HITACHI_AC344 || SEND_HITACHI_AC344, \
+            D_STR_HITACHI_AC344, D_STR_UNSUPPORTED)) \
+    X(CORONA_AC, COND(DECODE_CORONA_AC || SEND_CORONA_AC, \
+            D_STR_CORONA_AC, D_STR_UNSUPPORTED)) \
+    X(MIDEA24, COND(DECODE_MIDEA24 || SEND_MIDEA24, \
+            D_STR_MIDEA24, D_STR_UNSUPPORTED)) \
+    X(ZEPEAL, COND(DECODE_ZEPEAL || SEND_ZEPEAL, \
+            D_STR_ZEPEAL, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC, COND(DECODE_SANYO_AC || SEND_SANYO_AC, \
+            D_STR_SANYO_AC, D_STR_UNSUPPORTED)) \
+    X(VOLTAS, COND(DECODE_VOLTAS || SEND_VOLTAS, \
+            D_STR_VOLTAS, D_STR_UNSUPPORTED)) \
+    X(METZ, COND(DECODE_METZ || SEND_METZ, \
+            D_STR_METZ, D_STR_UNSUPPORTED)) \
+    X(TRANSCOLD, COND(DECODE_TRANSCOLD || SEND_TRANSCOLD, \
+            D_STR_TRANSCOLD, D_STR_UNSUPPORTED)) \
+    X(TECHNIBEL_AC, COND(DECODE_TECHNIBEL_AC || SEND_TECHNIBEL_AC, \
+            D_STR_TECHNIBEL_AC, D_STR_UNSUPPORTED)) \
+    X(MIRAGE, COND(DECODE_MIRAGE || SEND_MIRAGE, \
+            D_STR_MIRAGE, D_STR_UNSUPPORTED)) \
+    X(ELITESCREENS, COND(DECODE_ELITESCREENS || SEND_ELITESCREENS, \
+            D_STR_ELITESCREENS, D_STR_UNSUPPORTED)) \
+    X(PANASONIC_AC32, COND(DECODE_PANASONIC_AC32 || SEND_PANASONIC_AC32, \
+            D_STR_PANASONIC_AC32, D_STR_UNSUPPORTED)) \
+    X(MILESTAG2, COND(DECODE_MILESTAG2 || SEND_MILESTAG2, \
+            D_STR_MILESTAG2, D_STR_UNSUPPORTED)) \
+    X(ECOCLIM, COND(DECODE_ECOCLIM || SEND_ECOCLIM, \
+            D_STR_ECOCLIM, D_STR_UNSUPPORTED)) \
+    X(XMP, COND(DECODE_XMP || SEND_XMP, \
+            D_STR_XMP, D_STR_UNSUPPORTED)) \
+    X(TRUMA, COND(DECODE_TRUMA || SEND_TRUMA, \
+            D_STR_TRUMA, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC176, COND(DECODE_HAIER_AC176 || SEND_HAIER_AC176, \
+            D_STR_HAIER_AC176, D_STR_UNSUPPORTED)) \
+    X(TEKNOPOINT, COND(DECODE_TEKNOPOINT || SEND_TEKNOPOINT, \
+            D_STR_TEKNOPOINT, D_STR_UNSUPPORTED)) \
+    X(KELON, COND(DECODE_KELON || SEND_KELON, \
+            D_STR_KELON, D_STR_UNSUPPORTED)) \
+    X(TROTEC_3550, COND(DECODE_TROTEC_3550 || SEND_TROTEC_3550, \
+            D_STR_TROTEC_3550, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC88, COND(DECODE_SANYO_AC88 || SEND_SANYO_AC88, \
+            D_STR_SANYO_AC88, D_STR_UNSUPPORTED)) \
+    X(BOSE, COND(DECODE_BOSE || SEND_BOSE, \
+            D_STR_BOSE, D_STR_UNSUPPORTED)) \
+    X(ARRIS, COND(DECODE_ARRIS || SEND_ARRIS, \
+            D_STR_ARRIS, D_STR_UNSUPPORTED)) \
+    X(RHOSS, COND(DECODE_RHOSS || SEND_RHOSS, \
+            D_STR_RHOSS, D_STR_UNSUPPORTED)) \
+    X(AIRTON, COND(DECODE_AIRTON || SEND_AIRTON, \
+            D_STR_AIRTON, D_STR_UNSUPPORTED)) \
+    X(COOLIX48, COND(DECODE_COOLIX48 || SEND_COOLIX48, \
+            D_STR_COOLIX48, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC264, COND(DECODE_HITACHI_AC264 || SEND_HITACHI_AC264, \
+            D_STR_HITACHI_AC264, D_STR_UNSUPPORTED)) \
+    X(KELON168, COND(DECODE_KELON168 || SEND_KELON168, \
+            D_STR_KELON168, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC296, COND(DECODE_HITACHI_AC296 || SEND_HITACHI_AC296, \
+            D_STR_HITACHI_AC296, D_STR_UNSUPPORTED)) \
+    X(DAIKIN200, COND(DECODE_DAIKIN200 || SEND_DAIKIN200, \
+            D_STR_DAIKIN200, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC160, COND(DECODE_HAIER_AC160 || SEND_HAIER_AC160, \
+            D_STR_HAIER_AC160, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC128, COND(DECODE_CARRIER_AC128 || SEND_CARRIER_AC128, \
+            D_STR_CARRIER_AC128, D_STR_UNSUPPORTED)) \
+    X(TOTO, COND(DECODE_TOTO || SEND_TOTO, \
+            D_STR_TOTO, D_STR_UNSUPPORTED)) \
+    X(CLIMABUTLER, COND(DECODE_CLIMABUTLER || SEND_CLIMABUTLER, \
+            D_STR_CLIMABUTLER, D_STR_UNSUPPORTED)) \
+    X(TCL96AC, COND(DECODE_TCL96AC || SEND_TCL96AC, \
+            D_STR_TCL96AC, D_STR_UNSUPPORTED)) \
+    X(BOSCH144, COND(DECODE_BOSCH144 || SEND_BOSCH144, \
+            D_STR_BOSCH144, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC152, COND(DECODE_SANYO_AC152 || SEND_SANYO_AC152, \
+            D_STR_SANYO_AC152, D_STR_UNSUPPORTED)) \
+    X(DAIKIN312, COND(DECODE_DAIKIN312 || SEND_DAIKIN312, \
+            D_STR_DAIKIN312, D_STR_UNSUPPORTED)) \
+    X(GORENJE, COND(DECODE_GORENJE || SEND_GORENJE, \
+            D_STR_GORENJE, D_STR_UNSUPPORTED)) \
+    X(WOWWEE, COND(DECODE_WOWWEE || SEND_WOWWEE, \
+            D_STR_WOWWEE, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC84, COND(DECODE_CARRIER_AC84 || SEND_CARRIER_AC84, \
+            D_STR_CARRIER_AC84, D_STR_UNSUPPORTED)) \
+    X(YORK, COND(DECODE_YORK || SEND_YORK, \
+            D_STR_YORK, D_STR_UNSUPPORTED)) \
+    X(BLUESTARHEAVY, COND(DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY, \
+            D_STR_BLUESTARHEAVY, D_STR_UNSUPPORTED)) \
+    X(EUROM, COND(DECODE_EUROM || SEND_EUROM, \
+            D_STR_EUROM, D_STR_UNSUPPORTED))
+
+/// @cond IGNORE
+#define IRTEXT_PROTOCOL_NAME_STR(TYPE, NAME) NAME "\x0"
+#define IRTEXT_PROTOCOL_NAME_MEMBER(TYPE, NAME) char TYPE[sizeof(NAME)];
+#define IRTEXT_PROTOCOL_NAME_TYPE(TYPE, NAME) TYPE,
+#define IRTEXT_PROTOCOL_NAME_OFFSET(TYPE, NAME)\
+    offsetof(irtext_protocol_names_t, TYPE),
+#define IRTEXT_PROTOCOL_NAME_HASH(TYPE, NAME)\
+    irutils::caseInsensitiveHash(NAME),
+#define IRTEXT_PROTOCOL_NAME_NEXT(TYPE, NAME)\
+    protocolNameChain(protocolNameBucket(TYPE), TYPE + 1),
+#define IRTEXT_PROTOCOL_NAME_HEAD(B) protocolNameChain(B, 0),
+/// @endcond
+
 IRTEXT_CONST_BLOB_DECL(kAllProtocolNamesStr) {
-    D_STR_UNUSED "\x0"
-    COND(DECODE_RC5 || SEND_RC5,
-            D_STR_RC5, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RC6 || SEND_RC6,
-            D_STR_RC6, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NEC || SEND_NEC,
-            D_STR_NEC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SONY || SEND_SONY,
-            D_STR_SONY, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC || SEND_PANASONIC,
-            D_STR_PANASONIC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_JVC || SEND_JVC,
-            D_STR_JVC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG || SEND_SAMSUNG,
-            D_STR_SAMSUNG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WHYNTER || SEND_WHYNTER,
-            D_STR_WHYNTER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIWA_RC_T501 || SEND_AIWA_RC_T501,
-            D_STR_AIWA_RC_T501, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LG || SEND_LG,
-            D_STR_LG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO || SEND_SANYO,
-            D_STR_SANYO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI || SEND_MITSUBISHI,
-            D_STR_MITSUBISHI, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DISH || SEND_DISH,
-            D_STR_DISH, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SHARP || SEND_SHARP,
-            D_STR_SHARP, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_COOLIX || SEND_COOLIX,
-            D_STR_COOLIX, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN || SEND_DAIKIN,
-            D_STR_DAIKIN, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DENON || SEND_DENON,
-            D_STR_DENON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELVINATOR || SEND_KELVINATOR,
-            D_STR_KELVINATOR, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_SHERWOOD,
-            D_STR_SHERWOOD, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(DECODE_MITSUBISHI_AC || SEND_MITSUBISHI_AC,
-            D_STR_MITSUBISHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RCMM || SEND_RCMM,
-            D_STR_RCMM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO || SEND_SANYO,
-            D_STR_SANYO_LC7461, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RC5 || SEND_RC5,
-            D_STR_RC5X, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GREE || SEND_GREE,
-            D_STR_GREE, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_PRONTO,
-            D_STR_PRONTO, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(DECODE_NEC || SEND_NEC,
-            D_STR_NEC_LIKE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ARGO || SEND_ARGO,
-            D_STR_ARGO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TROTEC || SEND_TROTEC,
-            D_STR_TROTEC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NIKAI || SEND_NIKAI,
-            D_STR_NIKAI, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_RAW,
-            D_STR_RAW, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(SEND_GLOBALCACHE,
-            D_STR_GLOBALCACHE, D_STR_UNSUPPORTED) "\x0"  // SEND
-    COND(DECODE_TOSHIBA_AC || SEND_TOSHIBA_AC,
-            D_STR_TOSHIBA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_FUJITSU_AC || SEND_FUJITSU_AC,
-            D_STR_FUJITSU_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIDEA || SEND_MIDEA,
-            D_STR_MIDEA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MAGIQUEST || SEND_MAGIQUEST,
-            D_STR_MAGIQUEST, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LASERTAG || SEND_LASERTAG,
-            D_STR_LASERTAG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC || SEND_CARRIER_AC,
-            D_STR_CARRIER_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC || SEND_HAIER_AC,
-            D_STR_HAIER_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI2 || SEND_MITSUBISHI2,
-            D_STR_MITSUBISHI2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC || SEND_HITACHI_AC,
-            D_STR_HITACHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC1 || SEND_HITACHI_AC1,
-            D_STR_HITACHI_AC1, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC2 || SEND_HITACHI_AC2,
-            D_STR_HITACHI_AC2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GICABLE || SEND_GICABLE,
-            D_STR_GICABLE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC_YRW02 || SEND_HAIER_AC_YRW02,
-            D_STR_HAIER_AC_YRW02, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WHIRLPOOL_AC || SEND_WHIRLPOOL_AC,
-            D_STR_WHIRLPOOL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG_AC || SEND_SAMSUNG_AC,
-            D_STR_SAMSUNG_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LUTRON || SEND_LUTRON,
-            D_STR_LUTRON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ELECTRA_AC || SEND_ELECTRA_AC,
-            D_STR_ELECTRA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC_AC || SEND_PANASONIC_AC,
-            D_STR_PANASONIC_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PIONEER || SEND_PIONEER,
-            D_STR_PIONEER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LG || SEND_LG,
-            D_STR_LG2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MWM || SEND_MWM,
-            D_STR_MWM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN2 || SEND_DAIKIN2,
-            D_STR_DAIKIN2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_VESTEL_AC || SEND_VESTEL_AC,
-            D_STR_VESTEL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TECO || SEND_TECO,
-            D_STR_TECO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG36 || SEND_SAMSUNG36,
-            D_STR_SAMSUNG36, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TCL112AC || SEND_TCL112AC,
-            D_STR_TCL112AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LEGOPF || SEND_LEGOPF,
-            D_STR_LEGOPF, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY,
-            D_STR_MITSUBISHI_HEAVY_88, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY,
-            D_STR_MITSUBISHI_HEAVY_152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN216 || SEND_DAIKIN216,
-            D_STR_DAIKIN216, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SHARP_AC || SEND_SHARP_AC,
-            D_STR_SHARP_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GOODWEATHER || SEND_GOODWEATHER,
-            D_STR_GOODWEATHER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_INAX || SEND_INAX,
-            D_STR_INAX, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN160 || SEND_DAIKIN160,
-            D_STR_DAIKIN160, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NEOCLIMA || SEND_NEOCLIMA,
-            D_STR_NEOCLIMA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN176 || SEND_DAIKIN176,
-            D_STR_DAIKIN176, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN128 || SEND_DAIKIN128,
-            D_STR_DAIKIN128, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AMCOR || SEND_AMCOR,
-            D_STR_AMCOR, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN152 || SEND_DAIKIN152,
-            D_STR_DAIKIN152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI136 || SEND_MITSUBISHI136,
-            D_STR_MITSUBISHI136, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI112 || SEND_MITSUBISHI112,
-            D_STR_MITSUBISHI112, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC424 || SEND_HITACHI_AC424,
-            D_STR_HITACHI_AC424, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_SONY,
-            D_STR_SONY_38K, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_EPSON || SEND_EPSON,
-            D_STR_EPSON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SYMPHONY || SEND_SYMPHONY,
-            D_STR_SYMPHONY, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC3 || SEND_HITACHI_AC3,
-            D_STR_HITACHI_AC3, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN64 || SEND_DAIKIN64,
-            D_STR_DAIKIN64, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIRWELL || SEND_AIRWELL,
-            D_STR_AIRWELL, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DELONGHI_AC || SEND_DELONGHI_AC,
-            D_STR_DELONGHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DOSHISHA || SEND_DOSHISHA,
-            D_STR_DOSHISHA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MULTIBRACKETS || SEND_MULTIBRACKETS,
-            D_STR_MULTIBRACKETS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC40 || SEND_CARRIER_AC40,
-            D_STR_CARRIER_AC40, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC64 || SEND_CARRIER_AC64,
-            D_STR_CARRIER_AC64, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC344 || SEND_HITACHI_AC344,
-            D_STR_HITACHI_AC344, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CORONA_AC || SEND_CORONA_AC,
-            D_STR_CORONA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIDEA24 || SEND_MIDEA24,
-            D_STR_MIDEA24, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ZEPEAL || SEND_ZEPEAL,
-            D_STR_ZEPEAL, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC || SEND_SANYO_AC,
-            D_STR_SANYO_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_VOLTAS || SEND_VOLTAS,
-            D_STR_VOLTAS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_METZ || SEND_METZ,
-            D_STR_METZ, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TRANSCOLD || SEND_TRANSCOLD,
-            D_STR_TRANSCOLD, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TECHNIBEL_AC || SEND_TECHNIBEL_AC,
-            D_STR_TECHNIBEL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIRAGE || SEND_MIRAGE,
-            D_STR_MIRAGE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ELITESCREENS || SEND_ELITESCREENS,
-            D_STR_ELITESCREENS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC_AC32 || SEND_PANASONIC_AC32,
-            D_STR_PANASONIC_AC32, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MILESTAG2 || SEND_MILESTAG2,
-            D_STR_MILESTAG2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ECOCLIM || SEND_ECOCLIM,
-            D_STR_ECOCLIM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_XMP || SEND_XMP,
-            D_STR_XMP, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TRUMA || SEND_TRUMA,
-            D_STR_TRUMA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC176 || SEND_HAIER_AC176,
-            D_STR_HAIER_AC176, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TEKNOPOINT || SEND_TEKNOPOINT,
-            D_STR_TEKNOPOINT, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELON || SEND_KELON,
-            D_STR_KELON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TROTEC_3550 || SEND_TROTEC_3550,
-            D_STR_TROTEC_3550, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC88 || SEND_SANYO_AC88,
-            D_STR_SANYO_AC88, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BOSE || SEND_BOSE,
-            D_STR_BOSE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ARRIS || SEND_ARRIS,
-            D_STR_ARRIS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RHOSS || SEND_RHOSS,
-            D_STR_RHOSS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIRTON || SEND_AIRTON,
-            D_STR_AIRTON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_COOLIX48 || SEND_COOLIX48,
-            D_STR_COOLIX48, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC264 || SEND_HITACHI_AC264,
-            D_STR_HITACHI_AC264, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELON168 || SEND_KELON168,
-            D_STR_KELON168, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC296 || SEND_HITACHI_AC296,
-            D_STR_HITACHI_AC296, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN200 || SEND_DAIKIN200,
-            D_STR_DAIKIN200, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC160 || SEND_HAIER_AC160,
-            D_STR_HAIER_AC160, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC128 || SEND_CARRIER_AC128,
-            D_STR_CARRIER_AC128, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TOTO || SEND_TOTO,
-            D_STR_TOTO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CLIMABUTLER || SEND_CLIMABUTLER,
-            D_STR_CLIMABUTLER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TCL96AC || SEND_TCL96AC,
-            D_STR_TCL96AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BOSCH144 || SEND_BOSCH144,
-            D_STR_BOSCH144, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC152 || SEND_SANYO_AC152,
-            D_STR_SANYO_AC152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN312 || SEND_DAIKIN312,
-            D_STR_DAIKIN312, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GORENJE || SEND_GORENJE,
-            D_STR_GORENJE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WOWWEE || SEND_WOWWEE,
-            D_STR_WOWWEE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC84 || SEND_CARRIER_AC84,
-            D_STR_CARRIER_AC84, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_YORK || SEND_YORK,
-            D_STR_YORK, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY,
-            D_STR_BLUESTARHEAVY, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_EUROM || SEND_EUROM,
-            D_STR_EUROM, D_STR_UNSUPPORTED) "\x0"
-    ///< New protocol (macro) strings should be added just above this line.
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_STR)
     "\x0"  ///< This string requires double null termination.
 };
 IRTEXT_CONST_BLOB_PTR(kAllProtocolNamesStr);
+
+/// The layout of `kAllProtocolNamesStr`. It is never instantiated. It lets
+/// the compiler work out where each protocol's name starts.
+struct irtext_protocol_names_t {
+  IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_MEMBER)
+};
+
+/// The decode_type_t of each entry in `kAllProtocolNamesStr`.
+static constexpr decode_type_t kProtocolNameTypes[] = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_TYPE)
+};
+/// The case insensitive hash of each entry in `kAllProtocolNamesStr`.
+static constexpr uint32_t kProtocolNameHash[] = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_HASH)
+};
+/// Nr. of entries in `kAllProtocolNamesStr`.
+static constexpr uint16_t kNrProtocolNames =
+    sizeof(kProtocolNameTypes) / sizeof(kProtocolNameTypes[0]);
+
+/// Are the entries from `index` onwards in decode_type_t order?
+/// @param[in] index The entry to start checking from.
+/// @return true, if they are. Otherwise, false.
+static constexpr bool protocolNamesInOrder(const uint16_t index) {
+  return index >= kNrProtocolNames ||
+      (kProtocolNameTypes[index] == index && protocolNamesInOrder(index + 1));
+}
+
+static_assert(kNrProtocolNames == kLastDecodeType + 1,
+              "kAllProtocolNamesStr needs a name for every decode_type_t.");
+static_assert(protocolNamesInOrder(0),
+              "kAllProtocolNamesStr needs to be in decode_type_t order.");
+static_assert(kNrProtocolNames < kNoProtocolName,
+              "Too many protocols for a uint8_t index.");
+static_assert(kProtocolNameHashSize == 256,
+              "kProtocolNameHeads is built with REPEAT256().");
+
+/// Which hash table bucket an entry in `kAllProtocolNamesStr` is in.
+/// @param[in] index The entry.
+/// @return The bucket.
+static constexpr uint16_t protocolNameBucket(const uint16_t index) {
+  return kProtocolNameHash[index] % kProtocolNameHashSize;
+}
+
+/// Find the first entry, from `index` onwards, in a hash table bucket.
+/// Unsupported protocols aren't in any bucket, as they all share a name.
+/// @param[in] bucket The bucket.
+/// @param[in] index The entry to start looking from.
+/// @return The index of the entry, or `kNoProtocolName` if there isn't one.
+static constexpr uint8_t protocolNameChain(const uint16_t bucket,
+                                           const uint16_t index) {
+  return (index >= kNrProtocolNames) ? kNoProtocolName :
+      (protocolNameBucket(index) == bucket &&
+       kProtocolNameHash[index] !=
+           irutils::caseInsensitiveHash(D_STR_UNSUPPORTED)) ? index :
+      protocolNameChain(bucket, index + 1);
+}
+
+// Lookup tables, built at compile time, for the names in
+// `kAllProtocolNamesStr`. See `typeToString()` & `strToDecodeType()`.
+/// Where each protocol's name starts in `kAllProtocolNamesStr`.
+/// Indexed by decode_type_t.
+const uint16_t kProtocolNameOffsets[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_OFFSET)
+};
+/// The case insensitive hash of each protocol's name.
+/// @see irutils::caseInsensitiveHash()
+const uint32_t kProtocolNameHashes[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_HASH)
+};
+/// The first protocol in each bucket of the name hash table.
+const uint8_t kProtocolNameHeads[] PROGMEM = {
+    REPEAT256(IRTEXT_PROTOCOL_NAME_HEAD, 0)
+};
+/// The next protocol in the same bucket of the name hash table.
+/// Indexed by decode_type_t.
+const uint8_t kProtocolNameNext[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_NEXT)
+};
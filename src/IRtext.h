@@ -7,6 +7,7 @@
 #ifndef IRTEXT_H_
 #define IRTEXT_H_
 
+#include <stdint.h>
 #include "i18n.h"
 
 // Constant text to be shared across all object files.
@@ -23,6 +24,10 @@ class __FlashStringHelper;
 #endif  // ESP8266
 
 extern const char kTimeSep;
+extern const uint16_t kProtocolNameOffsets[];
+extern const uint32_t kProtocolNameHashes[];
+extern const uint8_t kProtocolNameHeads[];
+extern const uint8_t kProtocolNameNext[];
 extern IRTEXT_CONST_PTR(k0Str);
 extern IRTEXT_CONST_PTR(k10CHeatStr);
 extern IRTEXT_CONST_PTR(k122lzfStr);
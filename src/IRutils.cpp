@@ -38,6 +38,107 @@
 #ifndef FPSTR
 #define FPSTR(X) X
 #endif  // FPSTR
+#ifndef MEMCPY
+#if defined(ESP8266)
+#define MEMCPY(DST, SRC, LEN) memcpy_P(DST, SRC, LEN)
+#else  // ESP8266
+#define MEMCPY(DST, SRC, LEN) memcpy(DST, SRC, LEN)
+#endif  // ESP8266
+#endif  // MEMCPY
+// Reading the lookup tables stored in the flash address space.
+#ifndef pgm_read_byte
+#define pgm_read_byte(ADDR) (*(ADDR))
+#endif  // pgm_read_byte
+#ifndef pgm_read_word
+#define pgm_read_word(ADDR) (*(ADDR))
+#endif  // pgm_read_word
+#ifndef pgm_read_dword
+#define pgm_read_dword(ADDR) (*(ADDR))
+#endif  // pgm_read_dword
+
+// Some of the helpers below work on a machine word of bytes at a time, rather
+// than a byte, or a bit, at a time. i.e. SWAR (SIMD Within A Register).
+#if UINTPTR_MAX > UINT32_MAX
+typedef uint64_t irutils_word_t;
+#else  // UINTPTR_MAX > UINT32_MAX
+typedef uint32_t irutils_word_t;
+#endif  // UINTPTR_MAX > UINT32_MAX
+const uint8_t kWordSize = sizeof(irutils_word_t);
+const uint8_t kWordBits = kWordSize * 8;
+const irutils_word_t kEveryByte = ~(irutils_word_t)0 / UINT8_MAX;  // 0x0101..
+const irutils_word_t kEveryUint16 = ~(irutils_word_t)0 / UINT16_MAX;  // 0x01..
+const irutils_word_t kEvenBytes = kEveryUint16 * UINT8_MAX;  // 0x00FF00FF..
+// The bytes of a word that were loaded from odd memory addresses/offsets.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const irutils_word_t kOddAddressBytes = kEvenBytes;
+#else  // __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const irutils_word_t kOddAddressBytes = kEvenBytes << 8;
+#endif  // __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+// Nr. of words of bytes we can spread into 16-bit lanes before the total of
+// all the lanes could exceed 16 bits.
+const uint16_t kMaxWordsPerLaneSum = UINT16_MAX / (kWordSize * UINT8_MAX);
+
+/// Fetch a word of bytes from memory, regardless of its alignment.
+/// @param[in] ptr A ptr to the first byte of the word.
+/// @return The word. Byte order doesn't matter to the callers.
+static inline irutils_word_t _loadWord(const uint8_t * const ptr) {
+  irutils_word_t word;
+  memcpy(&word, ptr, kWordSize);
+  return word;
+}
+
+/// Store a word of bytes to memory, regardless of its alignment.
+/// @param[out] ptr A ptr to where to store the first byte of the word.
+/// @param[in] word The word to store.
+static inline void _storeWord(uint8_t * const ptr, const irutils_word_t word) {
+  memcpy(ptr, &word, kWordSize);
+}
+
+/// Swap the bytes of each 16-bit lane in a word.
+/// @param[in] word The word of bytes.
+/// @return The word with each pair of bytes swapped.
+static inline irutils_word_t _swapBytePairs(const irutils_word_t word) {
+  return ((word & kEvenBytes) << 8) | ((word >> 8) & kEvenBytes);
+}
+
+/// Reverse the order of the bits within each byte of an integer.
+/// @param[in] data The integer.
+/// @return The integer with the bits of each byte reversed.
+template <typename T>
+static inline T _reverseBitsInBytes(const T data) {
+  const T every_byte = ~static_cast<T>(0) / UINT8_MAX;  // i.e. 0x0101..
+  T result = ((data >> 1) & (every_byte * 0x55)) |
+      ((data & (every_byte * 0x55)) << 1);  // Swap adjacent bits.
+  result = ((result >> 2) & (every_byte * 0x33)) |
+      ((result & (every_byte * 0x33)) << 2);  // Swap pairs of bits.
+  return ((result >> 4) & (every_byte * 0x0F)) |
+      ((result & (every_byte * 0x0F)) << 4);  // Swap nibbles.
+}
+
+/// Add each pair of bytes in a word together, into a 16-bit lane.
+/// @param[in] word The word of bytes.
+/// @return The word of 16-bit lanes.
+static inline irutils_word_t _spreadBytes(const irutils_word_t word) {
+  return (word & kEvenBytes) + ((word >> 8) & kEvenBytes);
+}
+
+/// Add all the 16-bit lanes of a word together.
+/// @param[in] lanes The word of 16-bit lanes. Their total must fit in 16 bits.
+/// @return The total of all the lanes.
+static inline uint16_t _sumLanes(const irutils_word_t lanes) {
+  return (lanes * kEveryUint16) >> (kWordBits - 16);
+}
+
+/// Count the `1` bits in a word.
+/// @param[in] word The word to count the set bits of.
+/// @return The nr. of set bits.
+static inline uint8_t _popCount(irutils_word_t word) {
+  word -= (word >> 1) & (kEveryByte * 0x55);  // Count per 2 bits.
+  word = (word & (kEveryByte * 0x33)) +
+      ((word >> 2) & (kEveryByte * 0x33));  // Count per nibble.
+  word = (word + (word >> 4)) & (kEveryByte * 0x0F);  // Count per byte.
+  return (word * kEveryByte) >> (kWordBits - 8);  // Total of all the bytes.
+}
 
 /// Reverse the order of the requested least significant nr. of bits.
 /// @param[in] input Bit pattern/integer to reverse.
@@ -45,16 +146,17 @@
 /// @return The reversed bit pattern.
 uint64_t reverseBits(uint64_t input, uint16_t nbits) {
   if (nbits <= 1) return input;  // Reversing <= 1 bits makes no change at all.
-  // Cap the nr. of bits to rotate to the max nr. of bits in the input.
-  nbits = std::min(nbits, static_cast<uint16_t>((sizeof(input) * 8)));
-  uint64_t output = 0;
-  for (uint16_t i = 0; i < nbits; i++) {
-    output <<= 1;
-    output |= (input & 1);
-    input >>= 1;
+  // Reverse the bits in each byte, then the order of the bytes, of the smallest
+  // integer that holds them all. That leaves them at the top of that integer.
+  if (nbits <= 32) {
+    const uint32_t reversed = __builtin_bswap32(
+        _reverseBitsInBytes(static_cast<uint32_t>(input))) >> (32 - nbits);
+    // Merge any remaining unreversed bits back to the top of the reversed bits.
+    return ((input >> nbits) << nbits) | reversed;
   }
-  // Merge any remaining unreversed bits back to the top of the reversed bits.
-  return (input << nbits) | output;
+  const uint64_t reversed = __builtin_bswap64(_reverseBitsInBytes(input));
+  if (nbits >= 64) return reversed;
+  return ((input >> nbits) << nbits) | (reversed >> (64 - nbits));
 }
 
 /// Convert a uint64_t (unsigned long long) to a string.
@@ -64,29 +166,10 @@ uint64_t reverseBits(uint64_t input, uint16_t nbits) {
 /// @returns A String representation of the integer.
 /// @note Based on Arduino's Print::printNumber()
 String uint64ToString(uint64_t input, uint8_t base) {
-  String result = "";
-  // prevent issues if called with base <= 1
-  if (base < 2) base = 10;
-  // Check we have a base that we can actually print.
-  // i.e. [0-9A-Z] == 36
-  if (base > 36) base = 10;
-
-  // Reserve some string space to reduce fragmentation.
-  // 16 bytes should store a uint64 in hex text which is the likely worst case.
-  // 64 bytes would be the worst case (base 2).
-  result.reserve(16);
-
-  do {
-    char c = input % base;
-    input /= base;
-
-    if (c < 10)
-      c += '0';
-    else
-      c += 'A' - 10;
-    result = c + result;
-  } while (input);
-  return result;
+  char result[65];  // Enough for a uint64 in base 2, & the NUL.
+  IRtextWriter out(result, sizeof(result));
+  out.writeUint64(input, base);
+  return String(result);
 }
 
 /// Convert a int64_t (signed long long) to a string.
@@ -95,13 +178,10 @@ String uint64ToString(uint64_t input, uint8_t base) {
 /// @param[in] base The output base.
 /// @returns A String representation of the integer.
 String int64ToString(int64_t input, uint8_t base) {
-  if (input < 0) {
-    // Using String(kDashStr) to keep compatible with old arduino
-    // frameworks. Not needed with 3.0.2.
-    ///> @see https://github.com/crankyoldgit/IRremoteESP8266/issues/1639#issuecomment-944906016
-    return String(kDashStr) + uint64ToString(-input, base);
-  }
-  return uint64ToString(input, base);
+  char result[66];  // Enough for a "-" & a uint64 in base 2, & the NUL.
+  IRtextWriter out(result, sizeof(result));
+  out.writeInt64(input, base);
+  return String(result);
 }
 
 #ifdef ARDUINO
@@ -114,22 +194,32 @@ void serialPrintUint64(uint64_t input, uint8_t base) {
 }
 #endif
 
+/// Get the name of a protocol from `kAllProtocolNamesStr`.
+/// @param[in] protocol Nr. (enum) of the protocol. Must be a valid one.
+/// @return A Ptr to the name. It may be in the flash address space.
+static const char *_protocolName(const decode_type_t protocol) {
+  return reinterpret_cast<const char*>(kAllProtocolNamesStr) +
+      pgm_read_word(kProtocolNameOffsets + protocol);
+}
+
 /// Convert a C-style string to a decode_type_t.
+/// @note Names are found via a hash table built at compile time, so it takes
+///   constant time. See `kProtocolNameHeads` in IRtext.cpp.
 /// @param[in] str A C-style string containing a protocol name or number.
 /// @return A decode_type_t enum. (decode_type_t::UNKNOWN if no match.)
 decode_type_t strToDecodeType(const char * const str) {
-  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-  uint16_t length = STRLEN(ptr);
-  for (uint16_t i = 0; length; i++) {
-    if (!STRCASECMP(str, ptr)) return (decode_type_t)i;
-    ptr += length + 1;
-    length = STRLEN(ptr);
-  }
-  // Handle integer values of the type by converting to a string and back again.
-  decode_type_t result = strToDecodeType(
-      typeToString((decode_type_t)atoi(str)).c_str());
-  if (result > 0)
-    return result;
+  const uint32_t hash = irutils::caseInsensitiveHash(str);
+  for (uint8_t i = pgm_read_byte(kProtocolNameHeads +
+                                 hash % kProtocolNameHashSize);
+       i != kNoProtocolName; i = pgm_read_byte(kProtocolNameNext + i))
+    if (pgm_read_dword(kProtocolNameHashes + i) == hash &&
+        !STRCASECMP(str, _protocolName((decode_type_t)i)))
+      return (decode_type_t)i;
+  // Handle integer values of the type, if we support that protocol.
+  const int protocol = atoi(str);
+  if (protocol > 0 && protocol <= kLastDecodeType &&
+      STRLEN(_protocolName((decode_type_t)protocol)) > 1)
+    return (decode_type_t)protocol;
 
   return decode_type_t::UNKNOWN;
 }
@@ -141,24 +231,27 @@ decode_type_t strToDecodeType(const char * const str) {
 String typeToString(const decode_type_t protocol, const bool isRepeat) {
   String result = "";
   result.reserve(30);  // Size of longest protocol name + " (Repeat)"
+  IRtextWriter out(&result);
+  typeToString(&out, protocol, isRepeat);
+  return result;
+}
+
+/// Write the human readable name of a protocol type (enum etc).
+/// @param[out] out Where to write the text.
+/// @param[in] protocol Nr. (enum) of the protocol.
+/// @param[in] isRepeat A flag indicating if it is a repeat message.
+void typeToString(IRtextWriter *out, const decode_type_t protocol,
+                  const bool isRepeat) {
   if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN) {
-    result = kUnknownStr;
+    *out += kUnknownStr;
   } else {
-    auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-    for (uint16_t i = 0; i <= protocol && STRLEN(ptr); i++) {
-      if (i == protocol) {
-        result = FPSTR(ptr);
-        break;
-      }
-      ptr += STRLEN(ptr) + 1;
-    }
+    *out += FPSTR(_protocolName(protocol));
   }
   if (isRepeat) {
-    result += kSpaceLBraceStr;
-    result += kRepeatStr;
-    result += ')';
+    *out += kSpaceLBraceStr;
+    *out += kRepeatStr;
+    *out += ')';
   }
-  return result;
 }
 
 /// Does the given protocol use a complex state as part of the decode?
@@ -266,56 +359,70 @@ String resultToSourceCode(const decode_results * const results) {
   //   "uint64_t data = 0xDEADBEEFDEADBEEF;" = ~116 chars max.
   output.reserve(55 + (length * 7) + hasState ? 25 + (results->bits / 8) * 6
                                               : 116);
+  IRtextWriter out(&output);
+  resultToSourceCode(&out, results);
+  return output;
+}
+
+/// Write the key values of a decode_results structure in a C/C++ code style
+/// format.
+/// @param[out] out Where to write the text.
+/// @param[in] results A ptr to a decode_results structure.
+void resultToSourceCode(IRtextWriter *out,
+                        const decode_results * const results) {
+  const uint16_t length = getCorrectedRawLength(results);
+  const bool hasState = hasACState(results->decode_type);
   // Start declaration
-  output += F("uint16_t ");  // variable type
-  output += F("rawData[");   // array name
-  output += uint64ToString(length, 10);
+  *out += F("uint16_t ");  // variable type
+  *out += F("rawData[");   // array name
+  out->writeUint64(length);
   // array size
-  output += F("] = {");  // Start declaration
+  *out += F("] = {");  // Start declaration
 
   // Dump data
   for (uint16_t i = 1; i < results->rawlen; i++) {
     uint32_t usecs;
     for (usecs = results->rawbuf[i] * kRawTick; usecs > UINT16_MAX;
          usecs -= UINT16_MAX) {
-      output += uint64ToString(UINT16_MAX);
+      out->writeUint64(UINT16_MAX);
       if (i % 2)
-        output += F(", 0,  ");
+        *out += F(", 0,  ");
       else
-        output += F(",  0, ");
+        *out += F(",  0, ");
     }
-    output += uint64ToString(usecs, 10);
+    out->writeUint64(usecs);
     if (i < results->rawlen - 1)
-      output += kCommaSpaceStr;            // ',' not needed on the last one
-    if (i % 2 == 0) output += ' ';  // Extra if it was even.
+      *out += kCommaSpaceStr;            // ',' not needed on the last one
+    if (i % 2 == 0) *out += ' ';  // Extra if it was even.
   }
 
   // End declaration
-  output += F("};");
+  *out += F("};");
 
   // Comment
-  output += F("  // ");
-  output += typeToString(results->decode_type, results->repeat);
+  *out += F("  // ");
+  typeToString(out, results->decode_type, results->repeat);
   // Only display the value if the decode type doesn't have an A/C state.
-  if (!hasState)
-    output += ' ' + uint64ToString(results->value, 16);
-  output += F("\n");
+  if (!hasState) {
+    *out += ' ';
+    out->writeUint64(results->value, 16);
+  }
+  *out += F("\n");
 
   // Now dump "known" codes
   if (results->decode_type != UNKNOWN) {
     if (hasState) {
 #if DECODE_AC
       uint16_t nbytes = ceil(static_cast<float>(results->bits) / 8.0);
-      output += F("uint8_t state[");
-      output += uint64ToString(nbytes);
-      output += F("] = {");
+      *out += F("uint8_t state[");
+      out->writeUint64(nbytes);
+      *out += F("] = {");
       for (uint16_t i = 0; i < nbytes; i++) {
-        output += F("0x");
-        if (results->state[i] < 0x10) output += '0';
-        output += uint64ToString(results->state[i], 16);
-        if (i < nbytes - 1) output += kCommaSpaceStr;
+        *out += F("0x");
+        out->writeUint64(results->state[i], 16, 2, '0');
+        if (i < nbytes - 1) *out += kCommaSpaceStr;
       }
-      output += F("};\n");
+      *out += F("};\n");
 #endif  // DECODE_AC
     } else {
       // Simple protocols
@@ -323,20 +430,19 @@ String resultToSourceCode(const decode_results * const results) {
       // NOTE: It will ignore the atypical case when a message has been
       // decoded but the address & the command are both 0.
       if (results->address > 0 || results->command > 0) {
-        output += F("uint32_t address = 0x");
-        output += uint64ToString(results->address, 16);
-        output += F(";\n");
-        output += F("uint32_t command = 0x");
-        output += uint64ToString(results->command, 16);
-        output += F(";\n");
+        *out += F("uint32_t address = 0x");
+        out->writeUint64(results->address, 16);
+        *out += F(";\n");
+        *out += F("uint32_t command = 0x");
+        out->writeUint64(results->command, 16);
+        *out += F(";\n");
       }
       // Most protocols have data
-      output += F("uint64_t data = 0x");
-      output += uint64ToString(results->value, 16);
-      output += F(";\n");
+      *out += F("uint64_t data = 0x");
+      out->writeUint64(results->value, 16);
+      *out += F(";\n");
     }
   }
-  return output;
 }
 
 /// Dump out the decode_results structure.
@@ -345,51 +451,64 @@ String resultToSourceCode(const decode_results * const results) {
 /// @deprecated This is only for those that want this legacy format.
 String resultToTimingInfo(const decode_results * const results) {
   String output = "";
-  String value = "";
   // Reserve some space for the string to reduce heap fragmentation.
   // "Raw Timing[NNNN]:\n\n" = 19 chars
   // "   +123456, " / "-123456, " = ~12 chars on avg per raw entry.
   output.reserve(19 + 12 * results->rawlen);  // Should be less than this.
-  value.reserve(6);  // Max value should be 2^17 = 131072
-  output += F("Raw Timing[");
-  output += uint64ToString(results->rawlen - 1, 10);
-  output += F("]:\n");
+  IRtextWriter out(&output);
+  resultToTimingInfo(&out, results);
+  return output;
+}
+
+/// Write the timings of a decode_results structure in a human readable format.
+/// @param[out] out Where to write the text.
+/// @param[in] results A ptr to a decode_results structure.
+void resultToTimingInfo(IRtextWriter *out,
+                        const decode_results * const results) {
+  *out += F("Raw Timing[");
+  out->writeUint64(results->rawlen - 1);
+  *out += F("]:\n");
 
   for (uint16_t i = 1; i < results->rawlen; i++) {
     if (i % 2 == 0)
-      output += kDashStr;  // even
+      *out += kDashStr;  // even
     else
-      output += F("   +");  // odd
-    value = uint64ToString(results->rawbuf[i] * kRawTick);
+      *out += F("   +");  // odd
     // Space pad the value till it is at least 6 chars long.
-    while (value.length() < 6) value = ' ' + value;
-    output += value;
+    out->writeUint64(results->rawbuf[i] * kRawTick, 10, 6);
     if (i < results->rawlen - 1)
-      output += kCommaSpaceStr;  // ',' not needed for last one
-    if (!(i % 8)) output += '\n';  // Newline every 8 entries.
+      *out += kCommaSpaceStr;  // ',' not needed for last one
+    if (!(i % 8)) *out += '\n';  // Newline every 8 entries.
   }
-  output += '\n';
-  return output;
+  *out += '\n';
 }
 
 /// Convert the decode_results structure's value/state to simple hexadecimal.
 /// @param[in] result A ptr to a decode_results structure.
 /// @return A String containing the output.
 String resultToHexidecimal(const decode_results * const result) {
-  String output = F("0x");
+  String output = "";
   // Reserve some space for the string to reduce heap fragmentation.
   output.reserve(2 * kStateSizeMax + 2);  // Should cover worst cases.
+  IRtextWriter out(&output);
+  resultToHexidecimal(&out, result);
+  return output;
+}
+
+/// Write the decode_results structure's value/state as simple hexadecimal.
+/// @param[out] out Where to write the text.
+/// @param[in] result A ptr to a decode_results structure.
+void resultToHexidecimal(IRtextWriter *out,
+                         const decode_results * const result) {
+  *out += F("0x");
   if (hasACState(result->decode_type)) {
 #if DECODE_AC
-    for (uint16_t i = 0; result->bits > i * 8; i++) {
-      if (result->state[i] < 0x10) output += '0';  // Zero pad
-      output += uint64ToString(result->state[i], 16);
-    }
+    for (uint16_t i = 0; result->bits > i * 8; i++)
+      out->writeUint64(result->state[i], 16, 2, '0');  // Zero pad
 #endif  // DECODE_AC
   } else {
-    output += uint64ToString(result->value, 16);
+    out->writeUint64(result->value, 16);
   }
-  return output;
 }
 
 /// Dump out the decode_results structure into a human readable format.
@@ -401,22 +520,31 @@ String resultToHumanReadableBasic(const decode_results * const results) {
   // "Protocol  : LONGEST_PROTOCOL_NAME (Repeat)\n"
   // "Code      : 0x (NNNN Bits)\n" = 70 chars
   output.reserve(2 * kStateSizeMax + 70);  // Should cover most cases.
+  IRtextWriter out(&output);
+  resultToHumanReadableBasic(&out, results);
+  return output;
+}
+
+/// Write the decode_results structure in a human readable format.
+/// @param[out] out Where to write the text.
+/// @param[in] results A ptr to a decode_results structure.
+void resultToHumanReadableBasic(IRtextWriter *out,
+                                const decode_results * const results) {
   // Show Encoding standard
-  output += kProtocolStr;
-  output += F("  : ");
-  output += typeToString(results->decode_type, results->repeat);
-  output += '\n';
+  *out += kProtocolStr;
+  *out += F("  : ");
+  typeToString(out, results->decode_type, results->repeat);
+  *out += '\n';
 
   // Show Code & length
-  output += kCodeStr;
-  output += F("      : ");
-  output += resultToHexidecimal(results);
-  output += kSpaceLBraceStr;
-  output += uint64ToString(results->bits);
-  output += ' ';
-  output += kBitsStr;
-  output +=  F(")\n");
-  return output;
+  *out += kCodeStr;
+  *out += F("      : ");
+  resultToHexidecimal(out, results);
+  *out += kSpaceLBraceStr;
+  out->writeUint64(results->bits);
+  *out += ' ';
+  *out += kBitsStr;
+  *out += F(")\n");
 }
 
 /// Convert a decode_results into an array suitable for `sendRaw()`.
@@ -442,6 +570,37 @@ uint16_t* resultToRawArray(const decode_results * const decode) {
   return result;
 }
 
+/// Sum the masked nibbles of each byte of an array, a word at a time.
+/// i.e. Each byte adds `(byte & lowmask) + ((byte >> 4) & highmask)`.
+/// @param[in] start A ptr to the start of the byte array to calculate over.
+/// @param[in] length How many bytes to use in the calculation.
+/// @param[in] init Starting value of the calculation to use.
+/// @param[in] lowmask The mask to apply to each byte.
+/// @param[in] highmask The mask to apply to the upper nibble of each byte.
+/// @return The 8-bit calculated result of all the bytes and init value.
+static uint8_t _sumMaskedBytes(const uint8_t * const start,
+                               const uint16_t length, const uint8_t init,
+                               const uint8_t lowmask, const uint8_t highmask) {
+  const irutils_word_t lows = kEveryByte * lowmask;
+  const irutils_word_t highs = kEveryByte * highmask;
+  const uint8_t *ptr = start;
+  uint16_t remaining = length;
+  uint8_t sum = init;
+  while (remaining >= kWordSize) {
+    irutils_word_t lanes = 0;
+    for (uint16_t i = 0; i < kMaxWordsPerLaneSum && remaining >= kWordSize;
+         i++, ptr += kWordSize, remaining -= kWordSize) {
+      const irutils_word_t word = _loadWord(ptr);
+      // No byte can exceed 255 here, so they can't carry into each other.
+      lanes += _spreadBytes((word & lows) + ((word >> 4) & highs));
+    }
+    sum += _sumLanes(lanes);
+  }
+  for (; remaining; remaining--, ptr++)
+    sum += (*ptr & lowmask) + ((*ptr >> 4) & highmask);
+  return sum;
+}
+
 /// Sum all the bytes of an array and return the least significant 8-bits of
 /// the result.
 /// @param[in] start A ptr to the start of the byte array to calculate over.
@@ -450,10 +609,7 @@ uint16_t* resultToRawArray(const decode_results * const decode) {
 /// @return The 8-bit calculated result of all the bytes and init value.
 uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
                  const uint8_t init) {
-  uint8_t checksum = init;
-  const uint8_t *ptr;
-  for (ptr = start; ptr - start < length; ptr++) checksum += *ptr;
-  return checksum;
+  return _sumMaskedBytes(start, length, init, UINT8_MAX, 0);
 }
 
 /// Calculate a rolling XOR of all the bytes of an array.
@@ -463,9 +619,16 @@ uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
 /// @return The 8-bit calculated result of all the bytes and init value.
 uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
                  const uint8_t init) {
-  uint8_t checksum = init;
-  const uint8_t *ptr;
-  for (ptr = start; ptr - start < length; ptr++) checksum ^= *ptr;
+  const uint8_t *ptr = start;
+  uint16_t remaining = length;
+  irutils_word_t word = 0;
+  for (; remaining >= kWordSize; remaining -= kWordSize, ptr += kWordSize)
+    word ^= _loadWord(ptr);
+  // Fold the word in half until it is only a byte wide.
+  for (uint8_t shift = kWordBits / 2; shift >= 8; shift /= 2)
+    word ^= word >> shift;
+  uint8_t checksum = init ^ static_cast<uint8_t>(word);
+  for (; remaining; remaining--, ptr++) checksum ^= *ptr;
   return checksum;
 }
 
@@ -477,12 +640,12 @@ uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
 /// @return The nr. of bits found of the given type found in the array.
 uint16_t countBits(const uint8_t * const start, const uint16_t length,
                    const bool ones, const uint16_t init) {
+  const uint8_t *ptr = start;
+  uint16_t remaining = length;
   uint16_t count = init;
-  for (uint16_t offset = 0; offset < length; offset++)
-    for (uint8_t currentbyte = *(start + offset);
-         currentbyte;
-         currentbyte >>= 1)
-      if (currentbyte & 1) count++;
+  for (; remaining >= kWordSize; remaining -= kWordSize, ptr += kWordSize)
+    count += _popCount(_loadWord(ptr));
+  for (; remaining; remaining--, ptr++) count += _popCount(*ptr);
   if (ones || length == 0)
     return count;
   else
@@ -497,11 +660,11 @@ uint16_t countBits(const uint8_t * const start, const uint16_t length,
 /// @return The nr. of bits found of the given type found in the Integer.
 uint16_t countBits(const uint64_t data, const uint8_t length, const bool ones,
                    const uint16_t init) {
-  uint16_t count = init;
-  uint8_t bitsSoFar = length;
-  for (uint64_t remainder = data; remainder && bitsSoFar;
-       remainder >>= 1, bitsSoFar--)
-      if (remainder & 1) count++;
+  uint64_t bits = data;
+  if (length < 64) bits &= (1ULL << length) - 1;
+  uint16_t count = init + _popCount(static_cast<irutils_word_t>(bits));
+  if (kWordSize < 8)  // The upper half, when words are only 32 bits wide.
+    count += _popCount(static_cast<irutils_word_t>(bits >> 32));
   if (ones || length == 0)
     return count;
   else
@@ -528,6 +691,163 @@ float celsiusToFahrenheit(const float deg) { return (deg * 9.0) / 5.0 + 32.0; }
 /// Convert degrees Fahrenheit to degrees Celsius.
 float fahrenheitToCelsius(const float deg) { return (deg - 32.0) * 5.0 / 9.0; }
 
+/// Constructor for writing to a fixed size buffer.
+/// @param[out] buffer The buffer to write to. It is always NUL terminated.
+/// @param[in] size The size of the buffer, including room for the NUL.
+IRtextWriter::IRtextWriter(char *buffer, const uint16_t size) {
+  _init();
+  if (buffer != NULL && size) {
+    _buffer = buffer;
+    _size = size;
+    _buffer[0] = '\0';
+  }
+}
+
+/// Constructor for appending to a String.
+/// @param[in,out] string The String to append to.
+IRtextWriter::IRtextWriter(String *string) {
+  _init();
+  _string = string;
+}
+
+/// Constructor for writing to a stream.
+/// @param[in] stream The stream to write to. e.g. `&Serial`, or `stdout`.
+#ifdef ARDUINO
+IRtextWriter::IRtextWriter(Print *stream) {
+#else  // ARDUINO
+IRtextWriter::IRtextWriter(FILE *stream) {
+#endif  // ARDUINO
+  _init();
+  _stream = stream;
+}
+
+/// Reset everything to a writer that goes nowhere.
+void IRtextWriter::_init(void) {
+  _buffer = NULL;
+  _size = 0;
+  _used = 0;
+  _string = NULL;
+  _stream = NULL;
+  _length = 0;
+  _overflow = false;
+}
+
+/// Write some text to wherever we are writing to.
+/// @param[in] str A NUL terminated string.
+/// @param[in] length The nr. of chars in `str`, excluding the NUL.
+void IRtextWriter::_append(const char *str, const uint16_t length) {
+  _length += length;
+  if (_string != NULL) {
+    *_string += str;
+  } else if (_stream != NULL) {
+#ifdef ARDUINO
+    _stream->print(str);
+#else  // ARDUINO
+    fputs(str, _stream);
+#endif  // ARDUINO
+  } else if (_buffer != NULL) {
+    const uint16_t fits = std::min(length, (uint16_t)(_size - 1 - _used));
+    memcpy(_buffer + _used, str, fits);
+    _used += fits;
+    _buffer[_used] = '\0';
+    if (fits < length) _overflow = true;
+  }
+}
+
+/// Write a character.
+/// @param[in] c The character.
+/// @return This writer.
+IRtextWriter &IRtextWriter::operator+=(const char c) {
+  const char str[2] = {c, '\0'};
+  _append(str, 1);
+  return *this;
+}
+
+/// Write a NUL terminated string.
+/// @param[in] str The string.
+/// @return This writer.
+IRtextWriter &IRtextWriter::operator+=(const char *str) {
+  _append(str, strlen(str));
+  return *this;
+}
+
+/// Write a String.
+/// @param[in] str The String.
+/// @return This writer.
+IRtextWriter &IRtextWriter::operator+=(const String &str) {
+  _append(str.c_str(), str.length());
+  return *this;
+}
+
+#ifdef ARDUINO
+/// Write a string stored in Flash (PROGMEM) memory. e.g. `F("text")`
+/// @param[in] str The string.
+/// @return This writer.
+IRtextWriter &IRtextWriter::operator+=(const __FlashStringHelper *str) {
+  PGM_P ptr = reinterpret_cast<PGM_P>(str);
+  const uint16_t length = strlen_P(ptr);
+  _length += length;
+  if (_string != NULL) {
+    *_string += str;
+  } else if (_stream != NULL) {
+    _stream->print(str);
+  } else if (_buffer != NULL) {
+    const uint16_t fits = std::min(length, (uint16_t)(_size - 1 - _used));
+    memcpy_P(_buffer + _used, ptr, fits);
+    _used += fits;
+    _buffer[_used] = '\0';
+    if (fits < length) _overflow = true;
+  }
+  return *this;
+}
+#endif  // ARDUINO
+
+/// Write an unsigned integer.
+/// @param[in] value The integer to write.
+/// @param[in] base The output base. e.g. 16 for hexadecimal.
+/// @param[in] width Pad it with `pad` till it is at least this many chars.
+/// @param[in] pad The character to pad it with.
+void IRtextWriter::writeUint64(uint64_t value, uint8_t base,
+                               const uint8_t width, const char pad) {
+  // prevent issues if called with base <= 1
+  if (base < 2) base = 10;
+  // Check we have a base that we can actually print.
+  // i.e. [0-9A-Z] == 36
+  if (base > 36) base = 10;
+  char digits[65];  // Enough for a uint64 in base 2, & the NUL.
+  uint8_t start = sizeof(digits) - 1;
+  digits[start] = '\0';
+  do {
+    char c = value % base;
+    value /= base;
+    digits[--start] = (c < 10) ? c + '0' : c + 'A' - 10;
+  } while (value);
+  const uint8_t length = sizeof(digits) - 1 - start;
+  for (uint8_t i = length; i < width; i++) *this += pad;
+  _append(digits + start, length);
+}
+
+/// Write a signed integer.
+/// @param[in] value The integer to write.
+/// @param[in] base The output base. e.g. 16 for hexadecimal.
+void IRtextWriter::writeInt64(const int64_t value, const uint8_t base) {
+  if (value < 0) {
+    *this += kDashStr;
+    writeUint64(-value, base);
+  } else {
+    writeUint64(value, base);
+  }
+}
+
+/// Get the nr. of characters written so far.
+/// @return The nr. of characters, including any that didn't fit in the
+///   buffer. i.e. How big a buffer would need to be, excluding the NUL.
+uint32_t IRtextWriter::getLength(void) const { return _length; }
+
+/// Was anything dropped because it didn't fit in the buffer?
+/// @return true if it was, false if it wasn't.
+bool IRtextWriter::hasOverflowed(void) const { return _overflow; }
+
 namespace irutils {
 /// Create a String with a colon separated "label: value" pair suitable for
 /// Humans.
@@ -592,13 +912,90 @@ String addSignedIntToString(const int16_t value, const String label,
   return addLabeledString(int64ToString(value), label, precomma);
 }
 
+/// Write the label of a "label: value" pair.
+/// @param[out] out Where to write the text.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+static void _addLabel(IRtextWriter *out, const irtext_ptr_t label,
+                      const bool precomma) {
+  if (precomma) *out += kCommaSpaceStr;
+  *out += label;
+  *out += kColonSpaceStr;
+}
+
+/// Write a colon separated "label: value" pair suitable for Humans.
+/// @param[out] out Where to write the text.
+/// @param[in] value The value to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addLabeledString(IRtextWriter *out, const String &value,
+                      const irtext_ptr_t label, const bool precomma) {
+  _addLabel(out, label, precomma);
+  *out += value;
+}
 
-/// Generate the model string for a given Protocol/Model pair.
+/// Write a colon separated "label: value" pair suitable for Humans.
+/// @param[out] out Where to write the text.
+/// @param[in] value The value to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addLabeledString(IRtextWriter *out, const irtext_ptr_t value,
+                      const irtext_ptr_t label, const bool precomma) {
+  _addLabel(out, label, precomma);
+  *out += value;
+}
+
+/// Write a colon separated flag suitable for Humans. e.g. "Power: On"
+/// @param[out] out Where to write the text.
+/// @param[in] value The value to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addBoolToString(IRtextWriter *out, const bool value,
+                     const irtext_ptr_t label, const bool precomma) {
+  addLabeledString(out, value ? kOnStr : kOffStr, label, precomma);
+}
+
+/// Write a colon separated toggle flag suitable for Humans.
+/// e.g. "Light: Toggle", "Light: -"
+/// @param[out] out Where to write the text.
+/// @param[in] toggle The value of the toggle to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addToggleToString(IRtextWriter *out, const bool toggle,
+                       const irtext_ptr_t label, const bool precomma) {
+  addLabeledString(out, toggle ? kToggleStr : kDashStr, label, precomma);
+}
+
+/// Write a colon separated labeled Integer suitable for Humans. e.g. "Foo: 23"
+/// @param[out] out Where to write the text.
+/// @param[in] value The value to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addIntToString(IRtextWriter *out, const uint16_t value,
+                    const irtext_ptr_t label, const bool precomma) {
+  _addLabel(out, label, precomma);
+  out->writeUint64(value);
+}
+
+/// Write a colon separated labeled Integer suitable for Humans. e.g. "Foo: -3"
+/// @param[out] out Where to write the text.
+/// @param[in] value The value to come after the label.
+/// @param[in] label The label to precede the value.
+/// @param[in] precomma Should the output start with ", " or not?
+void addSignedIntToString(IRtextWriter *out, const int16_t value,
+                          const irtext_ptr_t label, const bool precomma) {
+  _addLabel(out, label, precomma);
+  out->writeInt64(value);
+}
+
+
+/// Get the text of the model name for a given Protocol/Model pair.
 /// @param[in] protocol The IR protocol.
 /// @param[in] model The model number for that protocol.
-/// @return The resulting String.
+/// @return A Ptr to the text of its name.
 /// @note After adding a new model you should update IRac::strToModel() too.
-String modelToStr(const decode_type_t protocol, const int16_t model) {
+static irtext_ptr_t _modelToText(const decode_type_t protocol,
+                                const int16_t model) {
   switch (protocol) {
     case decode_type_t::FUJITSU_AC:
       switch (model) {
@@ -716,6 +1113,14 @@ String modelToStr(const decode_type_t protocol, const int16_t model) {
   }
 }
 
+/// Generate the model string for a given Protocol/Model pair.
+/// @param[in] protocol The IR protocol.
+/// @param[in] model The model number for that protocol.
+/// @return The resulting String.
+String modelToStr(const decode_type_t protocol, const int16_t model) {
+  return _modelToText(protocol, model);
+}
+
 /// Create a String of human output for a given protocol model number.
 /// e.g. "Model: JKE"
 /// @param[in] protocol The IR protocol.
@@ -727,10 +1132,23 @@ String addModelToString(const decode_type_t protocol, const int16_t model,
   String result = "";
   // ", Model: NNN (BlahBlahEtc)" = ~40 chars for longest model name.
   result.reserve(40);
-  result += addIntToString(model, kModelStr, precomma);
-  result += kSpaceLBraceStr;
-  result += modelToStr(protocol, model);
-  return result + ')';
+  IRtextWriter out(&result);
+  addModelToString(&out, protocol, model, precomma);
+  return result;
+}
+
+/// Write the human output for a given protocol model number.
+/// e.g. "Model: JKE"
+/// @param[out] out Where to write the text.
+/// @param[in] protocol The IR protocol.
+/// @param[in] model The model number for that protocol.
+/// @param[in] precomma Should the output start with ", " or not?
+void addModelToString(IRtextWriter *out, const decode_type_t protocol,
+                      const int16_t model, const bool precomma) {
+  addIntToString(out, model, kModelStr, precomma);
+  *out += kSpaceLBraceStr;
+  *out += _modelToText(protocol, model);
+  *out += ')';
 }
 
 /// Create a String of human output for a given temperature.
@@ -743,12 +1161,28 @@ String addModelToString(const decode_type_t protocol, const int16_t model,
 /// @return The resulting String.
 String addTempToString(const uint16_t degrees, const bool celsius,
                        const bool precomma, const bool isSensorTemp) {
-  String result = addIntToString(degrees, (isSensorTemp)?
-                                 kSensorTempStr : kTempStr, precomma);
-  result += celsius ? 'C' : 'F';
+  String result = "";
+  IRtextWriter out(&result);
+  addTempToString(&out, degrees, celsius, precomma, isSensorTemp);
   return result;
 }
 
+/// Write the human output for a given temperature.
+/// e.g. "Temp: 25C"
+/// @param[out] out Where to write the text.
+/// @param[in] degrees The temperature in degrees.
+/// @param[in] celsius Is the temp Celsius or Fahrenheit.
+///  true is C, false is F
+/// @param[in] precomma Should the output start with ", " or not?
+/// @param[in] isSensorTemp Is the value a room (ambient) temp. or target?
+void addTempToString(IRtextWriter *out, const uint16_t degrees,
+                     const bool celsius, const bool precomma,
+                     const bool isSensorTemp) {
+  addIntToString(out, degrees, isSensorTemp ? kSensorTempStr : kTempStr,
+                 precomma);
+  *out += celsius ? 'C' : 'F';
+}
+
 /// Create a String of human output for a given temperature.
 /// e.g. "Temp: 25.5C"
 /// @param[in] degrees The temperature in degrees.
@@ -761,13 +1195,28 @@ String addTempFloatToString(const float degrees, const bool celsius,
                             const bool precomma, const bool isSensorTemp) {
   String result = "";
   result.reserve(21);  // Assuming ", Sensor Temp: XXX.5F" is the largest.
-  result += addIntToString(degrees, (isSensorTemp)?
-                           kSensorTempStr : kTempStr, precomma);
+  IRtextWriter out(&result);
+  addTempFloatToString(&out, degrees, celsius, precomma, isSensorTemp);
+  return result;
+}
+
+/// Write the human output for a given temperature.
+/// e.g. "Temp: 25.5C"
+/// @param[out] out Where to write the text.
+/// @param[in] degrees The temperature in degrees.
+/// @param[in] celsius Is the temp Celsius or Fahrenheit.
+///  true is C, false is F
+/// @param[in] precomma Should the output start with ", " or not?
+/// @param[in] isSensorTemp Is the value a room (ambient) temp. or target?
+void addTempFloatToString(IRtextWriter *out, const float degrees,
+                          const bool celsius, const bool precomma,
+                          const bool isSensorTemp) {
+  addIntToString(out, degrees, isSensorTemp ? kSensorTempStr : kTempStr,
+                 precomma);
   // Is it a half degree?
   if (static_cast<uint16_t>(2 * degrees) & 1)
-    result += F(".5");
-  result += celsius ? 'C' : 'F';
-  return result;
+    *out += F(".5");
+  *out += celsius ? 'C' : 'F';
 }
 
 /// Create a String of human output for the given operating mode.
@@ -784,16 +1233,33 @@ String addModeToString(const uint8_t mode, const uint8_t automatic,
                        const uint8_t dry, const uint8_t fan) {
   String result = "";
   result.reserve(22);  // ", Mode: NNN (UNKNOWN)"
-  result += addIntToString(mode, kModeStr);
-  result += kSpaceLBraceStr;
-  if (mode == automatic) result += kAutoStr;
-  else if (mode == cool) result += kCoolStr;
-  else if (mode == heat) result += kHeatStr;
-  else if (mode == dry)  result += kDryStr;
-  else if (mode == fan)  result += kFanStr;
+  IRtextWriter out(&result);
+  addModeToString(&out, mode, automatic, cool, heat, dry, fan);
+  return result;
+}
+
+/// Write the human output for the given operating mode.
+/// e.g. "Mode: 1 (Cool)"
+/// @param[out] out Where to write the text.
+/// @param[in] mode The operating mode to display.
+/// @param[in] automatic The numeric value for Auto mode.
+/// @param[in] cool The numeric value for Cool mode.
+/// @param[in] heat The numeric value for Heat mode.
+/// @param[in] dry The numeric value for Dry mode.
+/// @param[in] fan The numeric value for Fan mode.
+void addModeToString(IRtextWriter *out, const uint8_t mode,
+                     const uint8_t automatic, const uint8_t cool,
+                     const uint8_t heat, const uint8_t dry, const uint8_t fan) {
+  addIntToString(out, mode, kModeStr);
+  *out += kSpaceLBraceStr;
+  if (mode == automatic) *out += kAutoStr;
+  else if (mode == cool) *out += kCoolStr;
+  else if (mode == heat) *out += kHeatStr;
+  else if (mode == dry)  *out += kDryStr;
+  else if (mode == fan)  *out += kFanStr;
   else
-    result += kUnknownStr;
-  return result + ')';
+    *out += kUnknownStr;
+  *out += ')';
 }
 
 /// Create a String of the 3-letter day of the week from a numerical day of
@@ -808,10 +1274,34 @@ String addDayToString(const uint8_t day_of_week, const int8_t offset,
                       const bool precomma) {
   String result = "";
   result.reserve(19);  // ", Day: N (UNKNOWN)"
-  result += addIntToString(day_of_week, kDayStr, precomma);
-  result += kSpaceLBraceStr;
-  result += dayToString(day_of_week, offset);
-  return result + ')';
+  IRtextWriter out(&result);
+  addDayToString(&out, day_of_week, offset, precomma);
+  return result;
+}
+
+/// Write the 3-letter day of the week from a numerical day of the week.
+/// e.g. "Day: 1 (Mon)"
+/// @param[out] out Where to write the text.
+/// @param[in] day_of_week A numerical version of the sequential day of the
+///  week. e.g. Saturday = 7 etc.
+/// @param[in] offset Days to offset by.
+///  e.g. For different day starting the week.
+/// @param[in] precomma Should the output start with ", " or not?
+void addDayToString(IRtextWriter *out, const uint8_t day_of_week,
+                    const int8_t offset, const bool precomma) {
+  addIntToString(out, day_of_week, kDayStr, precomma);
+  *out += kSpaceLBraceStr;
+  const uint8_t day = day_of_week + offset;
+  if (day < 7) {
+    char text[4] = {0};  // The 3-letter day, & a NUL.
+    MEMCPY(text,
+           reinterpret_cast<const char*>(kThreeLetterDayOfWeekStr) + day * 3,
+           3);
+    *out += text;
+  } else {
+    *out += kUnknownStr;
+  }
+  *out += ')';
 }
 
 /// Create a String of the 3-letter day of the week from a numerical day of
@@ -852,18 +1342,41 @@ String addFanToString(const uint8_t speed, const uint8_t high,
                       const uint8_t maximum, const uint8_t medium_high) {
   String result = "";
   result.reserve(21);  // ", Fan: NNN (UNKNOWN)"
-  result += addIntToString(speed, kFanStr);
-  result += kSpaceLBraceStr;
-  if (speed == high)              result += kHighStr;
-  else if (speed == low)          result += kLowStr;
-  else if (speed == automatic)    result += kAutoStr;
-  else if (speed == quiet)        result += kQuietStr;
-  else if (speed == medium)       result += kMediumStr;
-  else if (speed == maximum)      result += kMaximumStr;
-  else if (speed == medium_high)  result += kMedHighStr;
+  IRtextWriter out(&result);
+  addFanToString(&out, speed, high, low, automatic, quiet, medium, maximum,
+                 medium_high);
+  return result;
+}
+
+/// Write the human output for the given fan speed.
+/// e.g. "Fan: 0 (Auto)"
+/// @param[out] out Where to write the text.
+/// @param[in] speed The numeric speed of the fan to display.
+/// @param[in] high The numeric value for High speed. (second highest)
+/// @param[in] low The numeric value for Low speed.
+/// @param[in] automatic The numeric value for Auto speed.
+/// @param[in] quiet The numeric value for Quiet speed.
+/// @param[in] medium The numeric value for Medium speed.
+/// @param[in] maximum The numeric value for Highest speed. (if > high)
+/// @param[in] medium_high The numeric value for third-highest speed.
+///                        (if > medium)
+void addFanToString(IRtextWriter *out, const uint8_t speed,
+                    const uint8_t high, const uint8_t low,
+                    const uint8_t automatic, const uint8_t quiet,
+                    const uint8_t medium, const uint8_t maximum,
+                    const uint8_t medium_high) {
+  addIntToString(out, speed, kFanStr);
+  *out += kSpaceLBraceStr;
+  if (speed == high)              *out += kHighStr;
+  else if (speed == low)          *out += kLowStr;
+  else if (speed == automatic)    *out += kAutoStr;
+  else if (speed == quiet)        *out += kQuietStr;
+  else if (speed == medium)       *out += kMediumStr;
+  else if (speed == maximum)      *out += kMaximumStr;
+  else if (speed == medium_high)  *out += kMedHighStr;
   else
-    result += kUnknownStr;
-  return result + ')';
+    *out += kUnknownStr;
+  *out += ')';
 }
 
 /// Create a String of human output for the given horizontal swing setting.
@@ -890,38 +1403,67 @@ String addSwingHToString(const uint8_t position, const uint8_t automatic,
                          const uint8_t threed, const uint8_t wide) {
   String result = "";
   result.reserve(30);  // ", Swing(H): NNN (Left Right)"
-  result += addIntToString(position, kSwingHStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  addSwingHToString(&out, position, automatic, maxleft, left, middle, right,
+                    maxright, off, leftright, rightleft, threed, wide);
+  return result;
+}
+
+/// Write the human output for the given horizontal swing setting.
+/// e.g. "Swing(H): 0 (Auto)"
+/// @param[out] out Where to write the text.
+/// @param[in] position The numeric position of the swing to display.
+/// @param[in] automatic The numeric value for Auto position.
+/// @param[in] maxleft The numeric value for most left position.
+/// @param[in] left The numeric value for Left position.
+/// @param[in] middle The numeric value for Middle position.
+/// @param[in] right The numeric value for Right position.
+/// @param[in] maxright The numeric value for most right position.
+/// @param[in] off The numeric value for Off position.
+/// @param[in] leftright The numeric value for "left right" position.
+/// @param[in] rightleft The numeric value for "right left" position.
+/// @param[in] threed The numeric value for 3D setting.
+/// @param[in] wide The numeric value for Wide position.
+void addSwingHToString(IRtextWriter *out, const uint8_t position,
+                       const uint8_t automatic,
+                       const uint8_t maxleft, const uint8_t left,
+                       const uint8_t middle,
+                       const uint8_t right, const uint8_t maxright,
+                       const uint8_t off,
+                       const uint8_t leftright, const uint8_t rightleft,
+                       const uint8_t threed, const uint8_t wide) {
+  addIntToString(out, position, kSwingHStr);
+  *out += kSpaceLBraceStr;
   if (position == automatic) {
-    result += kAutoStr;
+    *out += kAutoStr;
   } else if (position == left) {
-    result += kLeftStr;
+    *out += kLeftStr;
   } else if (position == middle) {
-    result += kMiddleStr;
+    *out += kMiddleStr;
   } else if (position == right) {
-    result += kRightStr;
+    *out += kRightStr;
   } else if (position == maxleft) {
-    result += kMaxLeftStr;
+    *out += kMaxLeftStr;
   } else if (position == maxright) {
-    result += kMaxRightStr;
+    *out += kMaxRightStr;
   } else if (position == off) {
-    result += kOffStr;
+    *out += kOffStr;
   } else if (position == leftright) {
-    result += kLeftStr;
-    result += ' ';
-    result += kRightStr;
+    *out += kLeftStr;
+    *out += ' ';
+    *out += kRightStr;
   } else if (position == rightleft) {
-    result += kRightStr;
-    result += ' ';
-    result += kLeftStr;
+    *out += kRightStr;
+    *out += ' ';
+    *out += kLeftStr;
   } else if (position == threed) {
-    result += k3DStr;
+    *out += k3DStr;
   } else if (position == wide) {
-    result += kWideStr;
+    *out += kWideStr;
   } else {
-    result += kUnknownStr;
+    *out += kUnknownStr;
   }
-  return result + ')';
+  *out += ')';
 }
 
 /// Create a String of human output for the given vertical swing setting.
@@ -950,40 +1492,72 @@ String addSwingVToString(const uint8_t position, const uint8_t automatic,
                          const uint8_t breeze, const uint8_t circulate) {
   String result = "";
   result.reserve(31);  // ", Swing(V): NNN (Upper Middle)"
-  result += addIntToString(position, kSwingVStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  addSwingVToString(&out, position, automatic, highest, high, uppermiddle,
+                    middle, lowermiddle, low, lowest, off, swing, breeze,
+                    circulate);
+  return result;
+}
+
+/// Write the human output for the given vertical swing setting.
+/// e.g. "Swing(V): 0 (Auto)"
+/// @param[out] out Where to write the text.
+/// @param[in] position The numeric position of the swing to display.
+/// @param[in] automatic The numeric value for Auto position.
+/// @param[in] highest The numeric value for Highest position.
+/// @param[in] high The numeric value for High position.
+/// @param[in] uppermiddle The numeric value for Upper Middle position.
+/// @param[in] middle The numeric value for Middle position.
+/// @param[in] lowermiddle The numeric value for Lower Middle position.
+/// @param[in] low The numeric value for Low position.
+/// @param[in] lowest The numeric value for Low position.
+/// @param[in] off The numeric value for Off position.
+/// @param[in] swing The numeric value for Swing setting.
+/// @param[in] breeze The numeric value for Breeze setting.
+/// @param[in] circulate The numeric value for Circulate setting.
+void addSwingVToString(IRtextWriter *out, const uint8_t position,
+                       const uint8_t automatic,
+                       const uint8_t highest, const uint8_t high,
+                       const uint8_t uppermiddle,
+                       const uint8_t middle,
+                       const uint8_t lowermiddle,
+                       const uint8_t low, const uint8_t lowest,
+                       const uint8_t off, const uint8_t swing,
+                       const uint8_t breeze, const uint8_t circulate) {
+  addIntToString(out, position, kSwingVStr);
+  *out += kSpaceLBraceStr;
   if (position == automatic) {
-    result += kAutoStr;
+    *out += kAutoStr;
   } else if (position == highest) {
-    result += kHighestStr;
+    *out += kHighestStr;
   } else if (position == high) {
-    result += kHighStr;
+    *out += kHighStr;
   } else if (position == middle) {
-    result += kMiddleStr;
+    *out += kMiddleStr;
   } else if (position == low) {
-    result += kLowStr;
+    *out += kLowStr;
   } else if (position == lowest) {
-    result += kLowestStr;
+    *out += kLowestStr;
   } else if (position == off) {
-    result += kOffStr;
+    *out += kOffStr;
   } else if (position == uppermiddle) {
-    result += kUpperStr;
-    result += ' ';
-    result += kMiddleStr;
+    *out += kUpperStr;
+    *out += ' ';
+    *out += kMiddleStr;
   } else if (position == lowermiddle) {
-    result += kLowerStr;
-    result += ' ';
-    result += kMiddleStr;
+    *out += kLowerStr;
+    *out += ' ';
+    *out += kMiddleStr;
   } else if (position == swing) {
-    result += kSwingStr;
+    *out += kSwingStr;
   } else if (position == breeze) {
-    result += kBreezeStr;
+    *out += kBreezeStr;
   } else if (position == circulate) {
-    result += kCirculateStr;
+    *out += kCirculateStr;
   } else {
-    result += kUnknownStr;
+    *out += kUnknownStr;
   }
-  return result + ')';
+  *out += ')';
 }
 
 /// @brief Create a String of human output for the given timer setting.
@@ -1002,25 +1576,45 @@ String addTimerModeToString(const uint8_t timerMode, const uint8_t noTimer,
                             const bool precomma) {
   String result = "";
   result.reserve(28);  // ", Timer Mode: 2 (Schedule 1)"
-  result += addIntToString(timerMode, kTimerModeStr, precomma);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  addTimerModeToString(&out, timerMode, noTimer, delayTimer, schedule1,
+                       schedule2, schedule3, precomma);
+  return result;
+}
+
+/// @brief Write the human output for the given timer setting.
+///        e.g. "Timer Mode: 2 (Schedule 1)"
+/// @param[out] out Where to write the text.
+/// @param[in] timerMode The numeric value of the timer mode to display.
+/// @param[in] noTimer The numeric value for no timer (off)
+/// @param[in] delayTimer The numeric value for delay (sleep) timer
+/// @param[in] schedule1 The numeric value for schedule timer #1
+/// @param[in] schedule2 The numeric value for schedule timer #2
+/// @param[in] schedule3 The numeric value for schedule timer #3
+/// @param[in] precomma Should the output start with ", " or not?
+void addTimerModeToString(IRtextWriter *out, const uint8_t timerMode,
+                          const uint8_t noTimer, const uint8_t delayTimer,
+                          const uint8_t schedule1, const uint8_t schedule2,
+                          const uint8_t schedule3, const bool precomma) {
+  addIntToString(out, timerMode, kTimerModeStr, precomma);
+  *out += kSpaceLBraceStr;
   if (timerMode == noTimer) {
-    result += kOffStr;
+    *out += kOffStr;
   } else if (timerMode == delayTimer) {
-    result += kSleepTimerStr;
+    *out += kSleepTimerStr;
   } else if (timerMode == schedule1) {
-    result += kScheduleStr;
-    result += '1';
+    *out += kScheduleStr;
+    *out += '1';
   } else if (timerMode == schedule2) {
-    result += kScheduleStr;
-    result += '2';
+    *out += kScheduleStr;
+    *out += '2';
   } else if (timerMode == schedule3) {
-    result += kScheduleStr;
-    result += '3';
+    *out += kScheduleStr;
+    *out += '3';
   } else {
-    result += kUnknownStr;
+    *out += kUnknownStr;
   }
-  return result + ')';
+  *out += ')';
 }
 
 /// @brief Create a String of human output for the given channel
@@ -1161,13 +1755,21 @@ String msToString(uint32_t const msecs) {
 String minsToString(const uint16_t mins) {
   String result = "";
   result.reserve(5);  // 23:59 is the typical worst case.
-  if (mins / 60 < 10) result += '0';  // Zero pad the hours
-  result += uint64ToString(mins / 60) + kTimeSep;
-  if (mins % 60 < 10) result += '0';  // Zero pad the minutes.
-  result += uint64ToString(mins % 60);
+  IRtextWriter out(&result);
+  minsToString(&out, mins);
   return result;
 }
 
+/// Write a nr. of minutes in a 24h clock format Human-readable form.
+/// e.g. "23:59"
+/// @param[out] out Where to write the text.
+/// @param[in] mins Nr. of Minutes.
+void minsToString(IRtextWriter *out, const uint16_t mins) {
+  out->writeUint64(mins / 60, 10, 2, '0');  // Zero pad the hours
+  *out += kTimeSep;
+  out->writeUint64(mins % 60, 10, 2, '0');  // Zero pad the minutes.
+}
+
 /// Sum all the nibbles together in a series of bytes.
 /// @param[in] start A ptr to the start of the byte array to calculate over.
 /// @param[in] length How many bytes to use in the calculation.
@@ -1175,11 +1777,27 @@ String minsToString(const uint16_t mins) {
 /// @return The 8-bit calculated result of all the bytes and init value.
 uint8_t sumNibbles(const uint8_t * const start, const uint16_t length,
                    const uint8_t init) {
-  uint8_t sum = init;
-  const uint8_t *ptr;
-  for (ptr = start; ptr - start < length; ptr++)
-    sum += (*ptr >> 4) + (*ptr & 0xF);
-  return sum;
+  return _sumMaskedBytes(start, length, init, 0xF, 0xF);
+}
+
+/// Sum the lower nibble of each byte in a series of bytes.
+/// @param[in] start A ptr to the start of the byte array to calculate over.
+/// @param[in] length How many bytes to use in the calculation.
+/// @param[in] init Starting value of the calculation to use. (Default is 0)
+/// @return The 8-bit calculated result of all the nibbles and init value.
+uint8_t sumLowNibbles(const uint8_t * const start, const uint16_t length,
+                      const uint8_t init) {
+  return _sumMaskedBytes(start, length, init, 0xF, 0);
+}
+
+/// Sum the upper nibble of each byte in a series of bytes.
+/// @param[in] start A ptr to the start of the byte array to calculate over.
+/// @param[in] length How many bytes to use in the calculation.
+/// @param[in] init Starting value of the calculation to use. (Default is 0)
+/// @return The 8-bit calculated result of all the nibbles and init value.
+uint8_t sumHighNibbles(const uint8_t * const start, const uint16_t length,
+                       const uint8_t init) {
+  return _sumMaskedBytes(start, length, init, 0, 0xF);
 }
 
 /// Sum all the nibbles together in an integer.
@@ -1190,10 +1808,13 @@ uint8_t sumNibbles(const uint8_t * const start, const uint16_t length,
 /// @return The 4/8-bit calculated result of all the nibbles and init value.
 uint8_t sumNibbles(const uint64_t data, const uint8_t count,
                    const uint8_t init, const bool nibbleonly) {
-  uint8_t sum = init;
   uint64_t copy = data;
-  const uint8_t nrofnibbles = (count < 16) ? count : (64 / 4);
-  for (uint8_t i = 0; i < nrofnibbles; i++, copy >>= 4) sum += copy & 0xF;
+  if (count < 16) copy &= (1ULL << (count * 4)) - 1;
+  // Add the two nibbles of each byte together. i.e. At most 30 per byte.
+  copy = (copy & 0x0F0F0F0F0F0F0F0FULL) +
+      ((copy >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+  // The total of all the bytes is at most 240, so there is no carry.
+  const uint8_t sum = init + ((copy * 0x0101010101010101ULL) >> 56);
   return nibbleonly ? sum & 0xF : sum;
 }
 
@@ -1205,13 +1826,34 @@ uint8_t sumNibbles(const uint64_t data, const uint8_t count,
 /// @return The 8/16-bit calculated result of all the bytes and init value.
 uint16_t sumBytes(const uint64_t data, const uint8_t count,
                   const uint8_t init, const bool byteonly) {
-  uint16_t sum = init;
   uint64_t copy = data;
-  const uint8_t nrofbytes = (count < 8) ? count : (64 / 8);
-  for (uint8_t i = 0; i < nrofbytes; i++, copy >>= 8) sum += (copy & 0xFF);
+  if (count < 8) copy &= (1ULL << (count * 8)) - 1;
+  // Add pairs of bytes into 16-bit lanes. i.e. At most 510 per lane.
+  copy = (copy & 0x00FF00FF00FF00FFULL) +
+      ((copy >> 8) & 0x00FF00FF00FF00FFULL);
+  // The total of all the lanes is at most 2040, so there is no carry.
+  const uint16_t sum = init + ((copy * 0x0001000100010001ULL) >> 48);
   return byteonly ? sum & 0xFF : sum;
 }
 
+/// Calculate a reflected (LSB first) 16-bit Cyclic Redundancy Check of an
+/// array of bytes. The default values give the CRC-16/ARC (aka. CRC-16/IBM).
+/// @param[in] start A ptr to the start of the byte array to calculate over.
+/// @param[in] length How many bytes to use in the calculation.
+/// @param[in] init Starting value of the calculation to use. (Default is 0)
+/// @param[in] poly The bit reversed polynomial to use. (Default is 0xA001)
+/// @return The 16-bit CRC of all the bytes and init value.
+uint16_t crc16(const uint8_t * const start, const uint16_t length,
+               const uint16_t init, const uint16_t poly) {
+  uint16_t crc = init;
+  for (uint16_t i = 0; i < length; i++) {
+    crc ^= start[i];
+    for (uint8_t bit = 0; bit < 8; bit++)  // Branch free, a bit at a time.
+      crc = (crc >> 1) ^ (poly & -(crc & 1));
+  }
+  return crc;
+}
+
 /// Convert a byte of Binary Coded Decimal(BCD) into an Integer.
 /// @param[in] bcd The BCD value.
 /// @return A normal Integer value.
@@ -1371,10 +2013,18 @@ void setBits(uint64_t * const dst, const uint8_t offset, const uint8_t nbits,
 /// @note A length of `<= 1` will do nothing.
 /// @return A ptr to the modified array.
 uint8_t * invertBytePairs(uint8_t *ptr, const uint16_t length) {
-  for (uint16_t i = 1; i < length; i += 2) {
+  uint8_t *pair = ptr;
+  uint16_t remaining = length;
+  // A word always holds whole pairs, so do as many as we can a word at a time.
+  for (; remaining >= kWordSize; remaining -= kWordSize, pair += kWordSize) {
+    const irutils_word_t word = _loadWord(pair);
+    _storeWord(pair, (word & ~kOddAddressBytes) |
+                     (~_swapBytePairs(word) & kOddAddressBytes));
+  }
+  for (uint16_t i = 1; i < remaining; i += 2) {
     // Code done this way to avoid a compiler warning bug.
-    uint8_t inv = ~*(ptr + i - 1);
-    *(ptr + i) = inv;
+    uint8_t inv = ~*(pair + i - 1);
+    *(pair + i) = inv;
   }
   return ptr;
 }
@@ -1387,14 +2037,77 @@ uint8_t * invertBytePairs(uint8_t *ptr, const uint16_t length) {
 /// @return true, if every second byte is inverted. Otherwise false.
 bool checkInvertedBytePairs(const uint8_t * const ptr,
                             const uint16_t length) {
-  for (uint16_t i = 1; i < length; i += 2) {
+  const uint8_t *pair = ptr;
+  uint16_t remaining = length;
+  for (; remaining >= kWordSize; remaining -= kWordSize, pair += kWordSize) {
+    const irutils_word_t word = _loadWord(pair);
+    // Every bit of a pair XOR'ed with the other byte of the pair must be set.
+    if ((word ^ _swapBytePairs(word)) != ~static_cast<irutils_word_t>(0))
+      return false;
+  }
+  for (uint16_t i = 1; i < remaining; i += 2) {
     // Code done this way to avoid a compiler warning bug.
-    uint8_t inv = ~*(ptr + i - 1);
-    if (*(ptr + i) != inv) return false;
+    uint8_t inv = ~*(pair + i - 1);
+    if (*(pair + i) != inv) return false;
   }
   return true;
 }
 
+/// The lower bytes of the whole 16-bit pairs in the lower bits of an integer.
+/// @param[in] nbits Nr. of bits, from the LSB, the pairs occupy.
+/// @return A mask of the second/lower byte of each whole pair.
+static uint64_t _lowerBytesOfPairs(const uint16_t nbits) {
+  const uint16_t pairs = std::min(nbits, static_cast<uint16_t>(64)) / 16;
+  const uint64_t mask = (pairs * 16 < 64) ? (1ULL << (pairs * 16)) - 1
+                                          : UINT64_MAX;
+  return mask & 0x00FF00FF00FF00FFULL;
+}
+
+/// Create byte pairs in an integer where the second/lower byte of each 16-bit
+/// pair is a bit inverted/flipped copy of the first/upper byte of the pair.
+/// i.e. The integer equivalent of the array version, for MSB first data.
+/// @param[in] data The integer to modify. The pairs start at the LSB.
+/// @param[in] nbits Nr. of bits, from the LSB, to use. Only whole pairs count.
+/// @return The modified integer.
+uint64_t invertBytePairs(const uint64_t data, const uint16_t nbits) {
+  const uint64_t lower = _lowerBytesOfPairs(nbits);
+  return (data & ~lower) | (~(data >> 8) & lower);
+}
+
+/// Check an integer to see if the second/lower byte of each 16-bit pair is a
+/// bit inverted/flipped copy of the first/upper byte of the pair.
+/// i.e. The integer equivalent of the array version, for MSB first data.
+/// @param[in] data The integer to check. The pairs start at the LSB.
+/// @param[in] nbits Nr. of bits, from the LSB, to use. Only whole pairs count.
+/// @return true, if every second byte is inverted. Otherwise false.
+bool checkInvertedBytePairs(const uint64_t data, const uint16_t nbits) {
+  const uint64_t lower = _lowerBytesOfPairs(nbits);
+  return ((data ^ (data >> 8)) & lower) == lower;
+}
+
+/// Reverse the order of the bits within each byte of an array.
+/// e.g. To convert between LSB first & MSB first byte orders.
+/// @param[in,out] ptr A pointer to the start of array to modify.
+/// @param[in] length The byte size of the array.
+/// @return A ptr to the modified array.
+uint8_t * reverseBitsInBytes(uint8_t * const ptr, const uint16_t length) {
+  uint8_t *byte = ptr;
+  uint16_t remaining = length;
+  for (; remaining >= kWordSize; remaining -= kWordSize, byte += kWordSize)
+    _storeWord(byte, _reverseBitsInBytes(_loadWord(byte)));
+  for (; remaining; remaining--, byte++)
+    *byte = _reverseBitsInBytes(static_cast<uint32_t>(*byte));
+  return ptr;
+}
+
+/// Reverse the order of the bits within each byte of an integer.
+/// The order of the bytes is unchanged.
+/// @param[in] data The integer to reverse the bits of each byte of.
+/// @return The integer with the bits of each byte reversed.
+uint64_t reverseBitsInBytes(const uint64_t data) {
+  return _reverseBitsInBytes(data);
+}
+
 /// Perform a low level bit manipulation sanity check for the given cpu
 /// architecture and the compiler operation. Calls to this should return
 /// 0 if everything is as expected, anything else means the library won't work
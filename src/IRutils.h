@@ -9,6 +9,7 @@
 #define __STDC_LIMIT_MACROS
 #include <stdint.h>
 #ifndef ARDUINO
+#include <stdio.h>
 #include <string>
 #endif
 #include "IRremoteESP8266.h"
@@ -18,6 +19,61 @@ const uint8_t kNibbleSize = 4;
 const uint8_t kLowNibble = 0;
 const uint8_t kHighNibble = 4;
 const uint8_t kModeBitsSize = 3;
+/// Nr. of buckets in the protocol name hash table. See `strToDecodeType()`.
+const uint16_t kProtocolNameHashSize = 256;
+/// Marks the end of a chain of protocols in the protocol name hash table.
+const uint8_t kNoProtocolName = 0xFF;
+
+/// The type of a Ptr to one of the shared, constant, texts. e.g. kPowerStr
+/// @see IRtext.h
+#ifdef ESP8266
+typedef const __FlashStringHelper* irtext_ptr_t;
+#else  // ESP8266
+typedef const char* irtext_ptr_t;
+#endif  // ESP8266
+
+/// Somewhere to write text to, without building it out of temporary Strings.
+/// i.e. A fixed size buffer supplied by the caller, a stream (e.g. `Serial`,
+/// or a `FILE*` when not on an Arduino), or an existing String.
+/// A fixed size buffer is always NUL terminated. Anything that doesn't fit in
+/// it is dropped, & `hasOverflowed()` says so.
+class IRtextWriter {
+ public:
+  IRtextWriter(char *buffer, const uint16_t size);
+  explicit IRtextWriter(String *string);
+#ifdef ARDUINO
+  explicit IRtextWriter(Print *stream);
+#else  // ARDUINO
+  explicit IRtextWriter(FILE *stream);
+#endif  // ARDUINO
+  IRtextWriter &operator+=(const char c);
+  IRtextWriter &operator+=(const char *str);
+  IRtextWriter &operator+=(const String &str);
+#ifdef ARDUINO
+  IRtextWriter &operator+=(const __FlashStringHelper *str);
+#endif  // ARDUINO
+  void writeUint64(uint64_t value, uint8_t base = 10, const uint8_t width = 0,
+                   const char pad = ' ');
+  void writeInt64(const int64_t value, const uint8_t base = 10);
+  uint32_t getLength(void) const;
+  bool hasOverflowed(void) const;
+
+ private:
+  char *_buffer;  ///< The fixed size buffer to write to, or NULL.
+  uint16_t _size;  ///< The size of `_buffer`, including the NUL.
+  uint16_t _used;  ///< Nr. of chars in `_buffer`, excluding the NUL.
+  String *_string;  ///< The String to append to, or NULL.
+#ifdef ARDUINO
+  Print *_stream;  ///< The stream to write to, or NULL.
+#else  // ARDUINO
+  FILE *_stream;  ///< The stream to write to, or NULL.
+#endif  // ARDUINO
+  uint32_t _length;  ///< Nr. of chars written, including any dropped.
+  bool _overflow;  ///< Were any chars dropped?
+  void _init(void);
+  void _append(const char *str, const uint16_t length);
+};
+
 uint64_t reverseBits(uint64_t input, uint16_t nbits);
 String uint64ToString(uint64_t input, uint8_t base = 10);
 String int64ToString(int64_t input, uint8_t base = 10);
@@ -28,6 +84,16 @@ String resultToSourceCode(const decode_results * const results);
 String resultToTimingInfo(const decode_results * const results);
 String resultToHumanReadableBasic(const decode_results * const results);
 String resultToHexidecimal(const decode_results * const result);
+void typeToString(IRtextWriter *out, const decode_type_t protocol,
+                  const bool isRepeat = false);
+void resultToSourceCode(IRtextWriter *out,
+                        const decode_results * const results);
+void resultToTimingInfo(IRtextWriter *out,
+                        const decode_results * const results);
+void resultToHumanReadableBasic(IRtextWriter *out,
+                                const decode_results * const results);
+void resultToHexidecimal(IRtextWriter *out,
+                         const decode_results * const result);
 bool hasACState(const decode_type_t protocol);
 uint16_t getCorrectedRawLength(const decode_results * const results);
 uint16_t *resultToRawArray(const decode_results * const decode);
@@ -46,6 +112,19 @@ float fahrenheitToCelsius(const float deg);
 /// Namespace for covering common functions & procedures for advancd protocol
 /// handlers
 namespace irutils {
+/// A case insensitive (ASCII only) 32-bit FNV-1a hash of a string.
+/// @note Being `constexpr`, it can be used to build tables at compile time.
+/// @param[in] str A NUL terminated string.
+/// @param[in] hash The hash of any earlier part of the string.
+/// @return The hash of the string.
+constexpr uint32_t caseInsensitiveHash(const char * const str,
+                                       const uint32_t hash = 2166136261UL) {
+  return *str ? caseInsensitiveHash(
+      str + 1,
+      (hash ^ static_cast<uint8_t>((*str >= 'a' && *str <= 'z') ?
+                                   *str - ('a' - 'A') : *str)) * 16777619UL)
+              : hash;
+}
 String addBoolToString(const bool value, const String label,
                        const bool precomma = true);
 String addToggleToString(const bool toggle, const String label,
@@ -106,12 +185,75 @@ String channelToString(const uint8_t channel);
 String htmlEscape(const String unescaped);
 String msToString(uint32_t const msecs);
 String minsToString(const uint16_t mins);
+// Versions of the above that write to an IRtextWriter instead.
+void addLabeledString(IRtextWriter *out, const String &value,
+                      const irtext_ptr_t label, const bool precomma = true);
+void addLabeledString(IRtextWriter *out, const irtext_ptr_t value,
+                      const irtext_ptr_t label, const bool precomma = true);
+void addBoolToString(IRtextWriter *out, const bool value,
+                     const irtext_ptr_t label, const bool precomma = true);
+void addToggleToString(IRtextWriter *out, const bool toggle,
+                       const irtext_ptr_t label, const bool precomma = true);
+void addIntToString(IRtextWriter *out, const uint16_t value,
+                    const irtext_ptr_t label, const bool precomma = true);
+void addSignedIntToString(IRtextWriter *out, const int16_t value,
+                          const irtext_ptr_t label,
+                          const bool precomma = true);
+void addModelToString(IRtextWriter *out, const decode_type_t protocol,
+                      const int16_t model, const bool precomma = true);
+void addTempToString(IRtextWriter *out, const uint16_t degrees,
+                     const bool celsius = true, const bool precomma = true,
+                     const bool isSensorTemp = false);
+void addTempFloatToString(IRtextWriter *out, const float degrees,
+                          const bool celsius = true,
+                          const bool precomma = true,
+                          const bool isSensorTemp = false);
+void addModeToString(IRtextWriter *out, const uint8_t mode,
+                     const uint8_t automatic, const uint8_t cool,
+                     const uint8_t heat, const uint8_t dry, const uint8_t fan);
+void addFanToString(IRtextWriter *out, const uint8_t speed,
+                    const uint8_t high, const uint8_t low,
+                    const uint8_t automatic, const uint8_t quiet,
+                    const uint8_t medium, const uint8_t maximum = 0xFF,
+                    const uint8_t medium_high = 0xFF);
+void addSwingHToString(IRtextWriter *out, const uint8_t position,
+                       const uint8_t automatic,
+                       const uint8_t maxleft, const uint8_t left,
+                       const uint8_t middle,
+                       const uint8_t right, const uint8_t maxright,
+                       const uint8_t off,
+                       const uint8_t leftright, const uint8_t rightleft,
+                       const uint8_t threed, const uint8_t wide);
+void addSwingVToString(IRtextWriter *out, const uint8_t position,
+                       const uint8_t automatic,
+                       const uint8_t highest, const uint8_t high,
+                       const uint8_t uppermiddle,
+                       const uint8_t middle,
+                       const uint8_t lowermiddle,
+                       const uint8_t low, const uint8_t lowest,
+                       const uint8_t off, const uint8_t swing,
+                       const uint8_t breeze, const uint8_t circulate);
+void addDayToString(IRtextWriter *out, const uint8_t day_of_week,
+                    const int8_t offset = 0, const bool precomma = true);
+void addTimerModeToString(IRtextWriter *out, const uint8_t timerType,
+                          const uint8_t noTimer, const uint8_t delayTimer,
+                          const uint8_t schedule1 = 0xFF,
+                          const uint8_t schedule2 = 0xFF,
+                          const uint8_t schedule3 = 0xFF,
+                          const bool precomma = true);
+void minsToString(IRtextWriter *out, const uint16_t mins);
 uint8_t sumNibbles(const uint8_t * const start, const uint16_t length,
                    const uint8_t init = 0);
 uint8_t sumNibbles(const uint64_t data, const uint8_t count = 16,
                    const uint8_t init = 0, const bool nibbleonly = true);
+uint8_t sumLowNibbles(const uint8_t * const start, const uint16_t length,
+                      const uint8_t init = 0);
+uint8_t sumHighNibbles(const uint8_t * const start, const uint16_t length,
+                       const uint8_t init = 0);
 uint16_t sumBytes(const uint64_t data, const uint8_t count = 8,
                   const uint8_t init = 0, const bool byteonly = true);
+uint16_t crc16(const uint8_t * const start, const uint16_t length,
+               const uint16_t init = 0, const uint16_t poly = 0xA001);
 uint8_t bcdToUint8(const uint8_t bcd);
 uint8_t uint8ToBcd(const uint8_t integer);
 bool getBit(const uint64_t data, const uint8_t position,
@@ -151,6 +293,10 @@ void setBits(uint64_t * const dst, const uint8_t offset, const uint8_t nbits,
              const uint64_t data);
 uint8_t * invertBytePairs(uint8_t *ptr, const uint16_t length);
 bool checkInvertedBytePairs(const uint8_t * const ptr, const uint16_t length);
+uint64_t invertBytePairs(const uint64_t data, const uint16_t nbits);
+bool checkInvertedBytePairs(const uint64_t data, const uint16_t nbits);
+uint8_t * reverseBitsInBytes(uint8_t * const ptr, const uint16_t length);
+uint64_t reverseBitsInBytes(const uint64_t data);
 uint8_t lowLevelSanityCheck(void);
 }  // namespace irutils
 #endif  // IRUTILS_H_
@@ -10,9 +10,7 @@
 #include "IRtext.h"
 #include "IRutils.h"
 
-const uint16_t kAirtonHdrMark = 6630;
 const uint16_t kAirtonBitMark = 400;
-const uint16_t kAirtonHdrSpace = 3350;
 const uint16_t kAirtonOneSpace = 1260;
 const uint16_t kAirtonZeroSpace = 430;
 const uint16_t kAirtonFreq = 38000;  // Hz. (Just a guess)
@@ -345,18 +343,25 @@ stdAc::state_t IRAirtonAc::toCommon(void) const {
 String IRAirtonAc::toString(void) const {
   String result = "";
   result.reserve(135);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kAirtonAuto, kAirtonCool,
-                            kAirtonHeat, kAirtonDry, kAirtonFan);
-  result += addFanToString(_.Fan, kAirtonFanHigh, kAirtonFanLow,
-                           kAirtonFanAuto, kAirtonFanMin, kAirtonFanMed,
-                           kAirtonFanMax);
-  result += addTempToString(getTemp());
-  result += addBoolToString(getSwingV(), kSwingVStr);
-  result += addBoolToString(getEcono(), kEconoStr);
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(getLight(), kLightStr);
-  result += addBoolToString(getHealth(), kHealthStr);
-  result += addBoolToString(getSleep(), kSleepStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRAirtonAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kAirtonAuto, kAirtonCool,
+                  kAirtonHeat, kAirtonDry, kAirtonFan);
+  addFanToString(out, _.Fan, kAirtonFanHigh, kAirtonFanLow,
+                 kAirtonFanAuto, kAirtonFanMin, kAirtonFanMed,
+                 kAirtonFanMax);
+  addTempToString(out, getTemp());
+  addBoolToString(out, getSwingV(), kSwingVStr);
+  addBoolToString(out, getEcono(), kEconoStr);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, getLight(), kLightStr);
+  addBoolToString(out, getHealth(), kHealthStr);
+  addBoolToString(out, getSleep(), kSleepStr);
+}
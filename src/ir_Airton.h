@@ -54,6 +54,8 @@ union AirtonProtocol{
 };
 
 // Constants
+const uint16_t kAirtonHdrMark = 6630;
+const uint16_t kAirtonHdrSpace = 3350;
 const uint8_t kAirtonAuto =    0b000;  // 0
 const uint8_t kAirtonCool =    0b001;  // 1
 const uint8_t kAirtonDry =     0b010;  // 2
@@ -119,6 +121,7 @@ class IRAirtonAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -275,12 +275,19 @@ stdAc::state_t IRAirwellAc::toCommon(const stdAc::state_t *prev) const {
 String IRAirwellAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.PowerToggle, kPowerToggleStr, false);
-  result += addModeToString(_.Mode, kAirwellAuto, kAirwellCool,
-                            kAirwellHeat, kAirwellDry, kAirwellFan);
-  result += addFanToString(_.Fan, kAirwellFanHigh, kAirwellFanLow,
-                           kAirwellFanAuto, kAirwellFanAuto,
-                           kAirwellFanMedium);
-  result += addTempToString(getTemp());
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRAirwellAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.PowerToggle, kPowerToggleStr, false);
+  addModeToString(out, _.Mode, kAirwellAuto, kAirwellCool,
+                  kAirwellHeat, kAirwellDry, kAirwellFan);
+  addFanToString(out, _.Fan, kAirwellFanHigh, kAirwellFanLow,
+                 kAirwellFanAuto, kAirwellFanAuto,
+                 kAirwellFanMedium);
+  addTempToString(out, getTemp());
+}
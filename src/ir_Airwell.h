@@ -87,6 +87,7 @@ class IRAirwellAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString() const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -14,8 +14,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kAmcorHdrMark = 8200;
-const uint16_t kAmcorHdrSpace = 4200;
 const uint16_t kAmcorOneMark = 1500;
 const uint16_t kAmcorZeroMark = 600;
 const uint16_t kAmcorOneSpace = kAmcorZeroMark;
@@ -342,13 +340,20 @@ stdAc::state_t IRAmcorAc::toCommon(void) const {
 String IRAmcorAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kAmcorAuto, kAmcorCool,
-                            kAmcorHeat, kAmcorDry, kAmcorFan);
-  result += addFanToString(_.Fan, kAmcorFanMax, kAmcorFanMin,
-                           kAmcorFanAuto, kAmcorFanAuto,
-                           kAmcorFanMed);
-  result += addTempToString(_.Temp);
-  result += addBoolToString(getMax(), kMaxStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRAmcorAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kAmcorAuto, kAmcorCool,
+                  kAmcorHeat, kAmcorDry, kAmcorFan);
+  addFanToString(out, _.Fan, kAmcorFanMax, kAmcorFanMin,
+                 kAmcorFanAuto, kAmcorFanAuto,
+                 kAmcorFanMed);
+  addTempToString(out, _.Temp);
+  addBoolToString(out, getMax(), kMaxStr);
+}
@@ -56,6 +56,8 @@ union AmcorProtocol{
 };
 
 // Constants
+const uint16_t kAmcorHdrMark = 8200;
+const uint16_t kAmcorHdrSpace = 4200;
 
 // Fan Control
 const uint8_t kAmcorFanMin =   0b001;
@@ -126,6 +128,7 @@ class IRAmcorAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -23,8 +23,6 @@
 
 // Constants
 // using SPACE modulation. MARK is always const 400u
-const uint16_t kArgoHdrMark = 6400;
-const uint16_t kArgoHdrSpace = 3300;
 const uint16_t kArgoBitMark = 400;
 const uint16_t kArgoOneSpace = 2200;
 const uint16_t kArgoZeroSpace = 900;
@@ -1328,68 +1326,75 @@ constexpr typename std::underlying_type<E>::type to_underlying(E e) noexcept {
 String IRArgoAC::toString(void) const {
   String result = "";
   result.reserve(118);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRArgoAC::toString(IRtextWriter *out) const {
     // E.g.:  Model: 1 (WREM2), Power: On, Mode: 0 (Cool), Fan: 0 (Auto),
     //        Temp: 20C, Room Temp: 21C, Max: On, IFeel: On, Night: On
-  result += addModelToString(decode_type_t::ARGO,
-                             argo_ac_remote_model_t::SAC_WREM2, false);
+  addModelToString(out, decode_type_t::ARGO,
+                   argo_ac_remote_model_t::SAC_WREM2, false);
   if (_messageType == argoIrMessageType_t::IFEEL_TEMP_REPORT) {
-    result += addIntToString(getSensorTemp(), kSensorTempStr);
-    result += 'C';
+    addIntToString(out, getSensorTemp(), kSensorTempStr);
+    *out += 'C';
   } else {
-    result += addBoolToString(_.Power, kPowerStr);
-    result += addIntToString(_.Mode, kModeStr);
-    result += kSpaceLBraceStr;
+    addBoolToString(out, _.Power, kPowerStr);
+    addIntToString(out, _.Mode, kModeStr);
+    *out += kSpaceLBraceStr;
     switch (_.Mode) {
       case kArgoAuto:
-        result += kAutoStr;
+        *out += kAutoStr;
         break;
       case kArgoCool:
-        result += kCoolStr;
+        *out += kCoolStr;
         break;
       case kArgoHeat:
-        result += kHeatStr;
+        *out += kHeatStr;
         break;
       case kArgoDry:
-        result += kDryStr;
+        *out += kDryStr;
         break;
       case kArgoHeatAuto:
-        result += kHeatStr;
-        result += ' ';
-        result += kAutoStr;
+        *out += kHeatStr;
+        *out += ' ';
+        *out += kAutoStr;
         break;
       case kArgoOff:
-        result += kOffStr;
+        *out += kOffStr;
         break;
       default:
-        result += kUnknownStr;
+        *out += kUnknownStr;
     }
-    result += ')';
-    result += addIntToString(_.Fan, kFanStr);
-    result += kSpaceLBraceStr;
+    *out += ')';
+    addIntToString(out, _.Fan, kFanStr);
+    *out += kSpaceLBraceStr;
     switch (_.Fan) {
       case kArgoFanAuto:
-        result += kAutoStr;
+        *out += kAutoStr;
         break;
       case kArgoFan3:
-        result += kMaxStr;
+        *out += kMaxStr;
         break;
       case kArgoFan1:
-        result += kMinStr;
+        *out += kMinStr;
         break;
       case kArgoFan2:
-        result += kMedStr;
+        *out += kMedStr;
         break;
       default:
-        result += kUnknownStr;
+        *out += kUnknownStr;
     }
-    result += ')';
-    result += addTempToString(getTemp());
-    result += addTempToString(getSensorTemp(), true, true, true);
-    result += addBoolToString(_.Max, kMaxStr);
-    result += addBoolToString(_.iFeel, kIFeelStr);
-    result += addBoolToString(_.Night, kNightStr);
+    *out += ')';
+    addTempToString(out, getTemp());
+    addTempToString(out, getSensorTemp(), true, true, true);
+    addBoolToString(out, _.Max, kMaxStr);
+    addBoolToString(out, _.iFeel, kIFeelStr);
+    addBoolToString(out, _.Night, kNightStr);
   }
-  return result;
 }
 
 /// @brief Set current clock (as minutes, counted from 0:00)
@@ -1575,6 +1580,14 @@ String commandTypeToString(argoIrMessageType_t type, uint8_t channel) {
 String IRArgoAC_WREM3::toString(void) const {
   String result = "";
   result.reserve(190);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRArgoAC_WREM3::toString(IRtextWriter *out) const {
   // E.g.:  Command[CH#0]: Model: 2 (WREM3), Power: On, Mode: 1 (Cool),
   //        Temp: 22C, Room: 26C, Fan: 0 (Auto), Swing(V): 7 (Breeze),
   //        IFeel: Off, Night: Off, Econo: Off, Max: Off, Filter: Off, Light: On
@@ -1583,87 +1596,86 @@ String IRArgoAC_WREM3::toString(void) const {
   argoIrMessageType_t commandType = this->getMessageType();
   argo_ac_remote_model_t model = getModel();
 
-  result += commandTypeToString(commandType, getChannel());
-  result += addModelToString(decode_type_t::ARGO, model, false);
+  *out += commandTypeToString(commandType, getChannel());
+  addModelToString(out, decode_type_t::ARGO, model, false);
 
   switch (commandType) {
     case argoIrMessageType_t::IFEEL_TEMP_REPORT:
-      result += addTempToString(getSensorTemp(), true, true, true);
+      addTempToString(out, getSensorTemp(), true, true, true);
       break;
 
     case argoIrMessageType_t::AC_CONTROL:
-      result += addBoolToString(getPower(), kPowerStr);
-      result += addModeToString(to_underlying(getModeEx()),
-                                to_underlying(argoMode_t::AUTO),
-                                to_underlying(argoMode_t::COOL),
-                                to_underlying(argoMode_t::HEAT),
-                                to_underlying(argoMode_t::DRY),
-                                to_underlying(argoMode_t::FAN));
-      result += addTempToString(getTemp());
-      result += addTempToString(getSensorTemp(), true, true, true);
-      result += addFanToString(to_underlying(getFanEx()),
-                              to_underlying(argoFan_t::FAN_HIGH),
-                              to_underlying(argoFan_t::FAN_LOWER),
-                              to_underlying(argoFan_t::FAN_AUTO),
-                              to_underlying(argoFan_t::FAN_LOWEST),
-                              to_underlying(argoFan_t::FAN_LOW),
-                              to_underlying(argoFan_t::FAN_HIGHEST),
-                              to_underlying(argoFan_t::FAN_MEDIUM));
-      result += addSwingVToString(to_underlying(getFlapEx()),
-                                  to_underlying(argoFlap_t::FLAP_AUTO),
-                                  to_underlying(argoFlap_t::FLAP_1),
-                                  to_underlying(argoFlap_t::FLAP_2),
-                                  to_underlying(argoFlap_t::FLAP_3),
-                                  to_underlying(argoFlap_t::FLAP_4), -1,
-                                  to_underlying(argoFlap_t::FLAP_5),
-                                  to_underlying(argoFlap_t::FLAP_6), -1, -1,
-                                  to_underlying(argoFlap_t::FLAP_FULL), -1);
-      result += addBoolToString(getiFeel(), kIFeelStr);
-      result += addBoolToString(getNight(), kNightStr);
-      result += addBoolToString(getEco(), kEconoStr);
-      result += addBoolToString(getMax(), kMaxStr);  // Turbo
-      result += addBoolToString(getFilter(), kFilterStr);
-      result += addBoolToString(getLight(), kLightStr);
+      addBoolToString(out, getPower(), kPowerStr);
+      addModeToString(out, to_underlying(getModeEx()),
+                      to_underlying(argoMode_t::AUTO),
+                      to_underlying(argoMode_t::COOL),
+                      to_underlying(argoMode_t::HEAT),
+                      to_underlying(argoMode_t::DRY),
+                      to_underlying(argoMode_t::FAN));
+      addTempToString(out, getTemp());
+      addTempToString(out, getSensorTemp(), true, true, true);
+      addFanToString(out, to_underlying(getFanEx()),
+                    to_underlying(argoFan_t::FAN_HIGH),
+                    to_underlying(argoFan_t::FAN_LOWER),
+                    to_underlying(argoFan_t::FAN_AUTO),
+                    to_underlying(argoFan_t::FAN_LOWEST),
+                    to_underlying(argoFan_t::FAN_LOW),
+                    to_underlying(argoFan_t::FAN_HIGHEST),
+                    to_underlying(argoFan_t::FAN_MEDIUM));
+      addSwingVToString(out, to_underlying(getFlapEx()),
+                        to_underlying(argoFlap_t::FLAP_AUTO),
+                        to_underlying(argoFlap_t::FLAP_1),
+                        to_underlying(argoFlap_t::FLAP_2),
+                        to_underlying(argoFlap_t::FLAP_3),
+                        to_underlying(argoFlap_t::FLAP_4), -1,
+                        to_underlying(argoFlap_t::FLAP_5),
+                        to_underlying(argoFlap_t::FLAP_6), -1, -1,
+                        to_underlying(argoFlap_t::FLAP_FULL), -1);
+      addBoolToString(out, getiFeel(), kIFeelStr);
+      addBoolToString(out, getNight(), kNightStr);
+      addBoolToString(out, getEco(), kEconoStr);
+      addBoolToString(out, getMax(), kMaxStr);  // Turbo
+      addBoolToString(out, getFilter(), kFilterStr);
+      addBoolToString(out, getLight(), kLightStr);
       break;
 
   case argoIrMessageType_t::TIMER_COMMAND:
-    result += addBoolToString(_.timer.IsOn, kPowerStr);
-    result += addTimerModeToString(to_underlying(getTimerType()),
-        to_underlying(argoTimerType_t::NO_TIMER),
-        to_underlying(argoTimerType_t::DELAY_TIMER),
-        to_underlying(argoTimerType_t::SCHEDULE_TIMER_1),
-        to_underlying(argoTimerType_t::SCHEDULE_TIMER_2),
-        to_underlying(argoTimerType_t::SCHEDULE_TIMER_3));
-    result += addLabeledString(minsToString(getCurrentTimeMinutes()),
-                               kClockStr);
-    result += addDayToString(to_underlying(getCurrentDayOfWeek()));
+    addBoolToString(out, _.timer.IsOn, kPowerStr);
+    addTimerModeToString(out, to_underlying(getTimerType()),
+      to_underlying(argoTimerType_t::NO_TIMER),
+      to_underlying(argoTimerType_t::DELAY_TIMER),
+      to_underlying(argoTimerType_t::SCHEDULE_TIMER_1),
+      to_underlying(argoTimerType_t::SCHEDULE_TIMER_2),
+      to_underlying(argoTimerType_t::SCHEDULE_TIMER_3));
+    addLabeledString(out, minsToString(getCurrentTimeMinutes()),
+                     kClockStr);
+    addDayToString(out, to_underlying(getCurrentDayOfWeek()));
     switch (getTimerType()) {
       case argoTimerType_t::NO_TIMER:
-        result += addLabeledString(kOffStr, kTimerStr);
+        addLabeledString(out, kOffStr, kTimerStr);
         break;
       case argoTimerType_t::DELAY_TIMER:
-        result += addLabeledString(minsToString(getDelayTimerMinutes()),
-                                   kTimerStr);
+        addLabeledString(out, minsToString(getDelayTimerMinutes()),
+                         kTimerStr);
         break;
       default:
-        result += addLabeledString(minsToString(getScheduleTimerStartMinutes()),
-                                   kOnTimerStr);
-        result += addLabeledString(minsToString(getScheduleTimerStopMinutes()),
-                                   kOffTimerStr);
+        addLabeledString(out, minsToString(getScheduleTimerStartMinutes()),
+                         kOnTimerStr);
+        addLabeledString(out, minsToString(getScheduleTimerStopMinutes()),
+                         kOffTimerStr);
 
-        result += addLabeledString(daysBitmaskToString(
+        addLabeledString(out, daysBitmaskToString(
           getTimerActiveDaysBitmap()), kTimerActiveDaysStr);
         break;
     }
     break;
 
   case argoIrMessageType_t::CONFIG_PARAM_SET:
-    result += addIntToString(_.config.Key, kKeyStr);
-    result += addIntToString(_.config.Value, kValueStr);
+    addIntToString(out, _.config.Key, kKeyStr);
+    addIntToString(out, _.config.Value, kValueStr);
     break;
   }
 
-  return result;
 }
 
 /// @brief Check if raw ARGO state starts with valid WREM3 preamble
@@ -158,6 +158,8 @@ union ArgoProtocolWREM3 {
 };
 
 // Constants (WREM-2). Store MSB left.
+const uint16_t kArgoHdrMark = 6400;
+const uint16_t kArgoHdrSpace = 3300;
 const uint8_t  kArgoHeatBit    = 0b00100000;
 const uint8_t  kArgoPreamble1  = 0b10101100;
 const uint8_t  kArgoPreamble2  = 0b11110101;
@@ -430,6 +432,8 @@ class IRArgoAC : public IRArgoACBase<ArgoProtocol> {
   #endif  // SEND_ARGO
 
     String toString(void) const;
+
+    void toString(IRtextWriter *out) const;
     stdAc::state_t toCommon(void) const;
 
     using IRArgoACBase<ArgoProtocol>::setMode;
@@ -507,6 +511,8 @@ class IRArgoAC_WREM3 : public IRArgoACBase<ArgoProtocolWREM3> {
   static argoIrMessageType_t getMessageType(const ArgoProtocolWREM3& raw);
 
   String toString(void) const;
+
+  void toString(IRtextWriter *out) const;
   stdAc::state_t toCommon(void) const;
 
   static bool hasValidPreamble(const uint8_t state[], const uint16_t length);
@@ -2,6 +2,7 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Arris.h"
 
 /// @file
 /// @brief Arris "Manchester code" based protocol.
@@ -12,8 +13,6 @@
 //   Brand: Arris,  Model: 120A V1.0 A18 remote
 
 const uint8_t kArrisOverhead = 2;
-const uint16_t kArrisHalfClockPeriod = 320;  // uSeconds
-const uint16_t kArrisHdrMark = 8 * kArrisHalfClockPeriod;  // uSeconds
 const uint16_t kArrisHdrSpace = 6 * kArrisHalfClockPeriod;  // uSeconds
 /// @see https://github.com/crankyoldgit/IRremoteESP8266/issues/1595#issuecomment-913755841
 // aka. 77184 uSeconds.
@@ -0,0 +1,16 @@
+// Copyright 2021 David Conran
+
+/// @file
+/// @brief Arris "Manchester code" based protocol.
+
+#ifndef IR_ARRIS_H_
+#define IR_ARRIS_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kArrisHalfClockPeriod = 320;  // uSeconds
+const uint16_t kArrisHdrMark = 8 * kArrisHalfClockPeriod;  // uSeconds
+
+#endif  // IR_ARRIS_H_
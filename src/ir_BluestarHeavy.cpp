@@ -8,10 +8,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_BluestarHeavy.h"
 
-const uint16_t kBluestarHeavyHdrMark = 4912;
 const uint16_t kBluestarHeavyBitMark = 465;
-const uint16_t kBluestarHeavyHdrSpace = 5058;
 const uint16_t kBluestarHeavyOneSpace = 572;
 const uint16_t kBluestarHeavyZeroSpace = 1548;
 const uint16_t kBluestarHeavyFreq = 38000;
@@ -0,0 +1,16 @@
+// Copyright 2024 Harsh Bhosale (harshbhosale01)
+
+/// @file
+/// @brief Support for BluestarHeavy protocol
+
+#ifndef IR_BLUESTARHEAVY_H_
+#define IR_BLUESTARHEAVY_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kBluestarHeavyHdrMark = 4912;
+const uint16_t kBluestarHeavyHdrSpace = 5058;
+
+#endif  // IR_BLUESTARHEAVY_H_
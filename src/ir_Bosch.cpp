@@ -278,27 +278,32 @@ stdAc::state_t IRBosch144AC::toCommon(void) const {
 /// Convert the current internal state into a human readable string.
 /// @return A human readable string.
 String IRBosch144AC::toString(void) const {
-  uint8_t mode = getMode();
-  uint8_t fan = static_cast<int>(toCommonFanSpeed(getFan()));
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(mode, kBosch144Auto, kBosch144Cool,
-                            kBosch144Heat, kBosch144Dry, kBosch144Fan);
-  result += addFanToString(fan, static_cast<int>(stdAc::fanspeed_t::kMax),
-                           static_cast<int>(stdAc::fanspeed_t::kMin),
-                           static_cast<int>(stdAc::fanspeed_t::kAuto),
-                           static_cast<int>(stdAc::fanspeed_t::kAuto),
-                           static_cast<int>(stdAc::fanspeed_t::kMedium));
-  result += addTempToString(getTemp(), !getUseFahrenheit());
-  result += addBoolToString(_.Quiet, kQuietStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRBosch144AC::toString(IRtextWriter *out) const {
+  uint8_t mode = getMode();
+  uint8_t fan = static_cast<int>(toCommonFanSpeed(getFan()));
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, mode, kBosch144Auto, kBosch144Cool,
+                  kBosch144Heat, kBosch144Dry, kBosch144Fan);
+  addFanToString(out, fan, static_cast<int>(stdAc::fanspeed_t::kMax),
+                 static_cast<int>(stdAc::fanspeed_t::kMin),
+                 static_cast<int>(stdAc::fanspeed_t::kAuto),
+                 static_cast<int>(stdAc::fanspeed_t::kAuto),
+                 static_cast<int>(stdAc::fanspeed_t::kMedium));
+  addTempToString(out, getTemp(), !getUseFahrenheit());
+  addBoolToString(out, _.Quiet, kQuietStr);
+}
+
 void IRBosch144AC::setInvertBytes() {
-  for (uint8_t i = 0; i <= 10; i += 2) {
-    _.raw[i + 1] = ~_.raw[i];
-  }
+  irutils::invertBytePairs(_.raw, 12);  // Bytes 0-11 are inverted pairs.
 }
 
 void IRBosch144AC::setCheckSumS3() {
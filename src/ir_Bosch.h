@@ -213,6 +213,7 @@ class IRBosch144AC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint16_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
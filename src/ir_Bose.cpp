@@ -11,9 +11,8 @@
 
 #include "IRrecv.h"
 #include "IRsend.h"
+#include "ir_Bose.h"
 
-const uint16_t kBoseHdrMark = 1100;
-const uint16_t kBoseHdrSpace = 1350;
 const uint16_t kBoseBitMark = 555;
 const uint16_t kBoseOneSpace = 1435;
 const uint16_t kBoseZeroSpace = 500;
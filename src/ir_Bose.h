@@ -0,0 +1,17 @@
+// Copyright 2021 parsnip42
+// Copyright 2021 David Conran
+
+/// @file
+/// @brief Support for Bose protocols.
+
+#ifndef IR_BOSE_H_
+#define IR_BOSE_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kBoseHdrMark = 1100;
+const uint16_t kBoseHdrSpace = 1350;
+
+#endif  // IR_BOSE_H_
@@ -23,40 +23,29 @@ using irutils::minsToString;
 using irutils::sumNibbles;
 
 // Constants
-const uint16_t kCarrierAcHdrMark = 8532;
-const uint16_t kCarrierAcHdrSpace = 4228;
 const uint16_t kCarrierAcBitMark = 628;
 const uint16_t kCarrierAcOneSpace = 1320;
 const uint16_t kCarrierAcZeroSpace = 532;
 const uint16_t kCarrierAcGap = 20000;
 const uint16_t kCarrierAcFreq = 38;  // kHz. (An educated guess)
 
-const uint16_t kCarrierAc40HdrMark = 8402;
-const uint16_t kCarrierAc40HdrSpace = 4166;
 const uint16_t kCarrierAc40BitMark = 547;
 const uint16_t kCarrierAc40OneSpace = 1540;
 const uint16_t kCarrierAc40ZeroSpace = 497;
 const uint32_t kCarrierAc40Gap = 150000;  ///<
 ///< @see https://github.com/crankyoldgit/IRremoteESP8266/issues/1190#issuecomment-643380155
 
-const uint16_t kCarrierAc64HdrMark = 8940;
-const uint16_t kCarrierAc64HdrSpace = 4556;
 const uint16_t kCarrierAc64BitMark = 503;
 const uint16_t kCarrierAc64OneSpace = 1736;
 const uint16_t kCarrierAc64ZeroSpace = 615;
 const uint32_t kCarrierAc64Gap = kDefaultMessageGap;  // A guess.
 
 //< @see: https://github.com/crankyoldgit/IRremoteESP8266/issues/1943#issue-1519570772
-const uint16_t kCarrierAc84HdrMark = 5850;
-const uint16_t kCarrierAc84Zero = 1175;
 const uint16_t kCarrierAc84One = 430;
-const uint16_t kCarrierAc84HdrSpace = kCarrierAc84Zero;
 const uint32_t kCarrierAc84Gap = kDefaultMessageGap;  // A guess.
 const uint8_t  kCarrierAc84ExtraBits = 4;
 const uint8_t  kCarrierAc84ExtraTolerance = 5;
 
-const uint16_t kCarrierAc128HdrMark = 4600;
-const uint16_t kCarrierAc128HdrSpace = 2600;
 const uint16_t kCarrierAc128Hdr2Mark = 9300;
 const uint16_t kCarrierAc128Hdr2Space = 5000;
 const uint16_t kCarrierAc128BitMark = 340;
@@ -258,10 +247,7 @@ uint8_t IRCarrierAc64::calcChecksum(const uint64_t state) {
   uint64_t data = GETBITS64(state,
       kCarrierAc64ChecksumOffset + kCarrierAc64ChecksumSize, kCarrierAc64Bits -
       (kCarrierAc64ChecksumOffset + kCarrierAc64ChecksumSize));
-  uint8_t result = 0;
-  for (; data; data >>= 4)  // Add each nibble together.
-    result += GETBITS64(data, 0, 4);
-  return result & 0xF;
+  return sumNibbles(data);  // Add each nibble together.
 }
 
 /// Verify the checksum is valid for a given state.
@@ -510,24 +496,31 @@ void IRCarrierAc64::setOffTimer(const uint16_t nr_of_mins) {
 String IRCarrierAc64::toString(void) const {
   String result = "";
   result.reserve(120);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, 0xFF, kCarrierAc64Cool,
-                            kCarrierAc64Heat, 0xFF, kCarrierAc64Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kCarrierAc64FanHigh, kCarrierAc64FanLow,
-                           kCarrierAc64FanAuto, kCarrierAc64FanAuto,
-                           kCarrierAc64FanMedium);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addLabeledString(getOnTimer()
-                             ? minsToString(getOnTimer()) : kOffStr,
-                             kOnTimerStr);
-  result += addLabeledString(getOffTimer()
-                             ? minsToString(getOffTimer()) : kOffStr,
-                             kOffTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRCarrierAc64::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, 0xFF, kCarrierAc64Cool,
+                  kCarrierAc64Heat, 0xFF, kCarrierAc64Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kCarrierAc64FanHigh, kCarrierAc64FanLow,
+                 kCarrierAc64FanAuto, kCarrierAc64FanAuto,
+                 kCarrierAc64FanMedium);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addLabeledString(out, getOnTimer()
+                   ? minsToString(getOnTimer()) : kOffStr,
+                   kOnTimerStr);
+  addLabeledString(out, getOffTimer()
+                   ? minsToString(getOffTimer()) : kOffStr,
+                   kOffTimerStr);
+}
+
 /// Convert the A/C state to it's common stdAc::state_t equivalent.
 /// @return A stdAc::state_t state.
 stdAc::state_t IRCarrierAc64::toCommon(void) const {
@@ -66,6 +66,17 @@ union CarrierProtocol {
 };
 
 // Constants
+const uint16_t kCarrierAcHdrMark = 8532;
+const uint16_t kCarrierAcHdrSpace = 4228;
+const uint16_t kCarrierAc40HdrMark = 8402;
+const uint16_t kCarrierAc40HdrSpace = 4166;
+const uint16_t kCarrierAc64HdrMark = 8940;
+const uint16_t kCarrierAc64HdrSpace = 4556;
+const uint16_t kCarrierAc84HdrMark = 5850;
+const uint16_t kCarrierAc84Zero = 1175;
+const uint16_t kCarrierAc84HdrSpace = kCarrierAc84Zero;
+const uint16_t kCarrierAc128HdrMark = 4600;
+const uint16_t kCarrierAc128HdrSpace = 2600;
 
 // CARRIER_AC64
 const uint8_t kCarrierAc64ChecksumOffset = 16;
@@ -129,6 +140,7 @@ class IRCarrierAc64 {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -11,11 +11,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_ClimaButler.h"
 
 
-const uint16_t kClimaButlerBitMark = 511;    // uSeconds
-const uint16_t kClimaButlerHdrMark = kClimaButlerBitMark;
-const uint16_t kClimaButlerHdrSpace = 3492;  // uSeconds
 const uint16_t kClimaButlerOneSpace = 1540;  // uSeconds
 const uint16_t kClimaButlerZeroSpace = 548;  // uSeconds
 const uint32_t kClimaButlerGap = kDefaultMessageGap;  // uSeconds (A guess.)
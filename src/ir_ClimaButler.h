@@ -0,0 +1,18 @@
+// Copyright 2022 benjy3gg
+// Copyright 2022 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for Clima-Butler protocol
+
+#ifndef IR_CLIMABUTLER_H_
+#define IR_CLIMABUTLER_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kClimaButlerBitMark = 511;    // uSeconds
+const uint16_t kClimaButlerHdrMark = kClimaButlerBitMark;
+const uint16_t kClimaButlerHdrSpace = 3492;  // uSeconds
+
+#endif  // IR_CLIMABUTLER_H_
@@ -19,17 +19,12 @@
 // Pulse parms are *50-100 for the Mark and *50+100 for the space
 // First MARK is the one after the long gap
 // pulse parameters in usec
-const uint16_t kCoolixTick = 276;  // Approximately 10.5 cycles at 38kHz
 const uint16_t kCoolixBitMarkTicks = 2;
 const uint16_t kCoolixBitMark = kCoolixBitMarkTicks * kCoolixTick;  // 552us
 const uint16_t kCoolixOneSpaceTicks = 6;
 const uint16_t kCoolixOneSpace = kCoolixOneSpaceTicks * kCoolixTick;  // 1656us
 const uint16_t kCoolixZeroSpaceTicks = 2;
 const uint16_t kCoolixZeroSpace = kCoolixZeroSpaceTicks * kCoolixTick;  // 552us
-const uint16_t kCoolixHdrMarkTicks = 17;
-const uint16_t kCoolixHdrMark = kCoolixHdrMarkTicks * kCoolixTick;  // 4692us
-const uint16_t kCoolixHdrSpaceTicks = 16;
-const uint16_t kCoolixHdrSpace = kCoolixHdrSpaceTicks * kCoolixTick;  // 4416us
 const uint16_t kCoolixMinGapTicks = kCoolixHdrMarkTicks + kCoolixZeroSpaceTicks;
 const uint16_t kCoolixMinGap = kCoolixMinGapTicks * kCoolixTick;  // 5244us
 const uint8_t  kCoolixExtraTolerance = 5;  // Percent
@@ -645,69 +640,76 @@ stdAc::state_t IRCoolixAC::toCommon(const stdAc::state_t *prev) const {
 String IRCoolixAC::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  if (!getPower()) return result;  // If it's off, there is no other info.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRCoolixAC::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  if (!getPower()) return;  // If it's off, there is no other info.
   if (isSpecialState()) {
     // Special modes.
-    result += kCommaSpaceStr;
-    if (getSwing()) result += kSwingStr;
-    else if (getSwingVStep()) result += kSwingVStr;
-    else if (getSleep()) result += kSleepStr;
-    else if (getTurbo()) result += kTurboStr;
-    else if (getLed()) result += kLightStr;
-    else if (getClean()) result += kCleanStr;
-
-    result += kColonSpaceStr;
+    *out += kCommaSpaceStr;
+    if (getSwing()) *out += kSwingStr;
+    else if (getSwingVStep()) *out += kSwingVStr;
+    else if (getSleep()) *out += kSleepStr;
+    else if (getTurbo()) *out += kTurboStr;
+    else if (getLed()) *out += kLightStr;
+    else if (getClean()) *out += kCleanStr;
+
+    *out += kColonSpaceStr;
     if (getSwingVStep())
-      result += kStepStr;
+      *out += kStepStr;
     else
-      result += kToggleStr;
-    return result;
+      *out += kToggleStr;
+    return;
   }
-  result += addModeToString(getMode(), kCoolixAuto, kCoolixCool, kCoolixHeat,
-                            kCoolixDry, kCoolixFan);
-  result += addIntToString(getFan(), kFanStr);
-  result += kSpaceLBraceStr;
+  addModeToString(out, getMode(), kCoolixAuto, kCoolixCool, kCoolixHeat,
+                  kCoolixDry, kCoolixFan);
+  addIntToString(out, getFan(), kFanStr);
+  *out += kSpaceLBraceStr;
   switch (getFan()) {
     case kCoolixFanAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kCoolixFanAuto0:
-      result += kAutoStr;
-      result += '0';
+      *out += kAutoStr;
+      *out += '0';
       break;
     case kCoolixFanMax:
-      result += kMaxStr;
+      *out += kMaxStr;
       break;
     case kCoolixFanMin:
-      result += kMinStr;
+      *out += kMinStr;
       break;
     case kCoolixFanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kCoolixFanZoneFollow:
-      result += kZoneFollowStr;
+      *out += kZoneFollowStr;
       break;
     case kCoolixFanFixed:
-      result += kFixedStr;
+      *out += kFixedStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
+  *out += ')';
   // Fan mode doesn't have a temperature.
   bool celcius = true;
   if (tempHighF || tempLowF) celcius = false;
-  if (getMode() != kCoolixFan) result += addTempToString(getTemp(), celcius);
-  result += addBoolToString(getZoneFollow(), kZoneFollowStr);
-  result += addLabeledString(
+  if (getMode() != kCoolixFan) addTempToString(out, getTemp(), celcius);
+  addBoolToString(out, getZoneFollow(), kZoneFollowStr);
+  addLabeledString(out,
       (getSensorTemp() == kCoolixSensorTempIgnoreCode)
           // Encasing with String(blah) to keep compatible with old arduino
           // frameworks. Not needed with 3.0.2.
           ///> @see https://github.com/crankyoldgit/IRremoteESP8266/issues/1639#issuecomment-944906016
           ? kOffStr : String(uint64ToString(getSensorTemp()) + 'C'),
       kSensorTempStr);
-  return result;
 }
 
 #if DECODE_COOLIX
@@ -773,16 +775,14 @@ bool IRrecv::decodeCOOLIX(decode_results *results, uint16_t offset,
       !matchAtLeast(results->rawbuf[offset], kCoolixMinGap)) return false;
 
   // Compliance
-  uint64_t orig = data;  // Save a copy of the data.
-  if (strict) {
-    for (uint16_t i = 0; i < nbits; i += 8, data >>= 8, inverted >>= 8)
-      if ((data & 0xFF) != ((inverted & 0xFF) ^ 0xFF)) return false;
-  }
+  // Every byte must have been followed by a bit inverted copy of itself.
+  if (strict && (data ^ inverted) != GETBITS64(UINT64_MAX, 0, nbits))
+    return false;
 
   // Success
   results->decode_type = COOLIX;
   results->bits = nbits;
-  results->value = orig;
+  results->value = data;
   results->address = 0;
   results->command = 0;
   return true;
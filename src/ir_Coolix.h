@@ -43,6 +43,11 @@
 #endif
 
 // Constants
+const uint16_t kCoolixTick = 276;  // Approximately 10.5 cycles at 38kHz
+const uint16_t kCoolixHdrMarkTicks = 17;
+const uint16_t kCoolixHdrMark = kCoolixHdrMarkTicks * kCoolixTick;  // 4692us
+const uint16_t kCoolixHdrSpaceTicks = 16;
+const uint16_t kCoolixHdrSpace = kCoolixHdrSpaceTicks * kCoolixTick;  // 4416us
 // Modes
 const uint8_t kCoolixCool = 0b000;
 const uint8_t kCoolixDry = 0b001;
@@ -207,6 +212,7 @@ class IRCoolixAC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
   void setZoneFollow(const bool on);
 #ifndef UNIT_TEST
 
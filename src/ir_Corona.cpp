@@ -23,8 +23,6 @@ using irutils::minsToString;
 using irutils::setBits;
 
 // Constants
-const uint16_t kCoronaAcHdrMark = 3500;
-const uint16_t kCoronaAcHdrSpace = 1680;
 const uint16_t kCoronaAcBitMark = 450;
 const uint16_t kCoronaAcOneSpace = 1270;
 const uint16_t kCoronaAcZeroSpace = 420;
@@ -527,26 +525,33 @@ void IRCoronaAc::setOffTimer(const uint16_t nr_of_mins) {
 String IRCoronaAc::toString(void) const {
   String result = "";
   result.reserve(140);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addBoolToString(_.PowerButton, kPowerButtonStr);
-  result += addModeToString(_.Mode, 0xFF, kCoronaAcModeCool,
-                            kCoronaAcModeHeat, kCoronaAcModeDry,
-                            kCoronaAcModeFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kCoronaAcFanHigh, kCoronaAcFanLow,
-                           kCoronaAcFanAuto, kCoronaAcFanAuto,
-                           kCoronaAcFanMedium);
-  result += addBoolToString(_.SwingVToggle, kSwingVToggleStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addLabeledString(getOnTimer()
-                             ? minsToString(getOnTimer()) : kOffStr,
-                             kOnTimerStr);
-  result += addLabeledString(getOffTimer()
-                             ? minsToString(getOffTimer()) : kOffStr,
-                             kOffTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRCoronaAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addBoolToString(out, _.PowerButton, kPowerButtonStr);
+  addModeToString(out, _.Mode, 0xFF, kCoronaAcModeCool,
+                  kCoronaAcModeHeat, kCoronaAcModeDry,
+                  kCoronaAcModeFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kCoronaAcFanHigh, kCoronaAcFanLow,
+                 kCoronaAcFanAuto, kCoronaAcFanAuto,
+                 kCoronaAcFanMedium);
+  addBoolToString(out, _.SwingVToggle, kSwingVToggleStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addLabeledString(out, getOnTimer()
+                   ? minsToString(getOnTimer()) : kOffStr,
+                   kOnTimerStr);
+  addLabeledString(out, getOffTimer()
+                   ? minsToString(getOffTimer()) : kOffStr,
+                   kOffTimerStr);
+}
+
 /// Convert the A/C state to it's common stdAc::state_t equivalent.
 /// @return A stdAc::state_t state.
 stdAc::state_t IRCoronaAc::toCommon() const {
@@ -69,6 +69,8 @@ union CoronaProtocol {
 };
 
 // Constants
+const uint16_t kCoronaAcHdrMark = 3500;
+const uint16_t kCoronaAcHdrSpace = 1680;
 
 // CORONA_AC
 const uint8_t kCoronaAcSectionBytes = 7;  // kCoronaAcStateLengthShort
@@ -149,6 +151,7 @@ class IRCoronaAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
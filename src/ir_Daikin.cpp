@@ -56,6 +56,47 @@ using irutils::setBits;
 using irutils::sumNibbles;
 using irutils::uint8ToBcd;
 
+/// The format of the preamble of a Daikin message.
+constexpr ir_protocol_t kDaikinPreambleProtocol = {
+    0, 0,  // No header for the header
+    kDaikinBitMark, kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
+    kDaikinBitMark, kDaikinZeroSpace + kDaikinGap, 0,
+    38, 50, false, kDaikinTolerance, kDaikinMarkExcess};
+/// The format of each section of a Daikin message.
+constexpr ir_protocol_t kDaikinProtocol = {
+    kDaikinHdrMark, kDaikinHdrSpace,
+    kDaikinBitMark, kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
+    kDaikinBitMark, kDaikinZeroSpace + kDaikinGap, 0,
+    38, 50, false, kDaikinTolerance, kDaikinMarkExcess};
+/// The format of each section of a Daikin216 message.
+constexpr ir_protocol_t kDaikin216Protocol = {
+    kDaikin216HdrMark, kDaikin216HdrSpace,
+    kDaikin216BitMark, kDaikin216OneSpace,
+    kDaikin216BitMark, kDaikin216ZeroSpace,
+    kDaikin216BitMark, kDaikin216Gap, 0,
+    kDaikin216Freq, kDutyDefault, false, kDaikinTolerance, kDaikinMarkExcess};
+/// The format of each section of a Daikin160 message.
+constexpr ir_protocol_t kDaikin160Protocol = {
+    kDaikin160HdrMark, kDaikin160HdrSpace,
+    kDaikin160BitMark, kDaikin160OneSpace,
+    kDaikin160BitMark, kDaikin160ZeroSpace,
+    kDaikin160BitMark, kDaikin160Gap, 0,
+    kDaikin160Freq, kDutyDefault, false, kDaikinTolerance, kDaikinMarkExcess};
+/// The format of each section of a Daikin176 message.
+constexpr ir_protocol_t kDaikin176Protocol = {
+    kDaikin176HdrMark, kDaikin176HdrSpace,
+    kDaikin176BitMark, kDaikin176OneSpace,
+    kDaikin176BitMark, kDaikin176ZeroSpace,
+    kDaikin176BitMark, kDaikin176Gap, 0,
+    kDaikin176Freq, kDutyDefault, false, kDaikinTolerance, kDaikinMarkExcess};
+/// The format of each section of a Daikin200 message.
+constexpr ir_protocol_t kDaikin200Protocol = {
+    kDaikin200HdrMark, kDaikin200HdrSpace,
+    kDaikin200BitMark, kDaikin200OneSpace,
+    kDaikin200BitMark, kDaikin200ZeroSpace,
+    kDaikin200BitMark, kDaikin200Gap, 0,
+    kDaikin200Freq, kDutyDefault, false, kDaikinTolerance, 0};
+
 #if SEND_DAIKIN
 /// Send a Daikin 280-bit A/C formatted message.
 /// Status: STABLE
@@ -72,36 +113,21 @@ void IRsend::sendDaikin(const unsigned char data[], const uint16_t nbytes,
   for (uint16_t r = 0; r <= repeat; r++) {
     uint16_t offset = 0;
     // Send the header, 0b00000
-    sendGeneric(0, 0,  // No header for the header
-                kDaikinBitMark, kDaikinOneSpace, kDaikinBitMark,
-                kDaikinZeroSpace, kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                static_cast<uint64_t>(0b00000), kDaikinHeaderLength, 38, false,
-                0, 50);
+    sendProtocol(kDaikinPreambleProtocol, static_cast<uint64_t>(0b00000),
+                 kDaikinHeaderLength);
     // Data #1
     if (nbytes < kDaikinStateLength) {  // Are we using the legacy size?
       // Do this as a constant to save RAM and keep in flash memory
-      sendGeneric(kDaikinHdrMark, kDaikinHdrSpace, kDaikinBitMark,
-                  kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
-                  kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                  kDaikinFirstHeader64, 64, 38, false, 0, 50);
+      sendProtocol(kDaikinProtocol, kDaikinFirstHeader64, 64);
     } else {  // We are using the newer/more correct size.
-      sendGeneric(kDaikinHdrMark, kDaikinHdrSpace, kDaikinBitMark,
-                  kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
-                  kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                  data, kDaikinSection1Length, 38, false, 0, 50);
+      sendProtocol(kDaikinProtocol, data, kDaikinSection1Length);
       offset += kDaikinSection1Length;
     }
     // Data #2
-    sendGeneric(kDaikinHdrMark, kDaikinHdrSpace, kDaikinBitMark,
-                kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
-                kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                data + offset, kDaikinSection2Length, 38, false, 0, 50);
+    sendProtocol(kDaikinProtocol, data + offset, kDaikinSection2Length);
     offset += kDaikinSection2Length;
     // Data #3
-    sendGeneric(kDaikinHdrMark, kDaikinHdrSpace, kDaikinBitMark,
-                kDaikinOneSpace, kDaikinBitMark, kDaikinZeroSpace,
-                kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                data + offset, nbytes - offset, 38, false, 0, 50);
+    sendProtocol(kDaikinProtocol, data + offset, nbytes - offset);
   }
 }
 #endif  // SEND_DAIKIN
@@ -563,32 +589,44 @@ stdAc::state_t IRDaikinESP::toCommon(void) const {
 String IRDaikinESP::toString(void) const {
   String result = "";
   result.reserve(230);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempFloatToString(getTemp());
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addBoolToString(_.Powerful, kPowerfulStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(getSensor(), kSensorStr);
-  result += addBoolToString(_.Mold, kMouldStr);
-  result += addBoolToString(_.Comfort, kComfortStr);
-  result += addBoolToString(_.SwingH, kSwingHStr);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addLabeledString(minsToString(_.CurrentTime), kClockStr);
-  result += addDayToString(_.CurrentDay, -1);
-  result += addLabeledString(_.OnTimer
-                             ? minsToString(_.OnTime) : kOffStr,
-                             kOnTimerStr);
-  result += addLabeledString(_.OffTimer
-                             ? minsToString(_.OffTime) : kOffStr,
-                             kOffTimerStr);
-  result += addBoolToString(getWeeklyTimerEnable(), kWeeklyTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikinESP::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempFloatToString(out, getTemp());
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addBoolToString(out, _.Powerful, kPowerfulStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, getSensor(), kSensorStr);
+  addBoolToString(out, _.Mold, kMouldStr);
+  addBoolToString(out, _.Comfort, kComfortStr);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addLabeledString(out, minsToString(_.CurrentTime), kClockStr);
+  addDayToString(out, _.CurrentDay, -1);
+  addLabeledString(out, _.OnTimer
+                   ? minsToString(_.OnTime) : kOffStr,
+                   kOnTimerStr);
+  addLabeledString(out, _.OffTimer
+                   ? minsToString(_.OffTime) : kOffStr,
+                   kOffTimerStr);
+  addBoolToString(out, getWeeklyTimerEnable(), kWeeklyTimerStr);
+}
+
 #if DECODE_DAIKIN
+constexpr protocol_windows_t kDaikinPreambleWindows =
+    IRrecv::protocolWindows(kDaikinPreambleProtocol);
+constexpr protocol_windows_t kDaikinWindows =
+    IRrecv::protocolWindows(kDaikinProtocol);
+
 /// Decode the supplied Daikin 280-bit message. (DAIKIN)
 /// Status: STABLE / Reported as working.
 /// @param[in,out] results Ptr to the data to decode & where to store the decode
@@ -610,36 +648,25 @@ bool IRrecv::decodeDaikin(decode_results *results, uint16_t offset,
   // Compliance
   if (strict && nbits != kDaikinBits) return false;
 
-  match_result_t data_result;
-
   // Header #1 - Doesn't count as data.
-  data_result = matchData(&(results->rawbuf[offset]), kDaikinHeaderLength,
-                          kDaikinBitMark, kDaikinOneSpace,
-                          kDaikinBitMark, kDaikinZeroSpace,
-                          kDaikinTolerance, kDaikinMarkExcess, false);
-  offset += data_result.used;
-  if (data_result.success == false) return false;  // Fail
-  if (data_result.data) return false;  // The header bits should be zero.
-  // Footer
-  if (!matchMark(results->rawbuf[offset++], kDaikinBitMark,
-                 kDaikinTolerance, kDaikinMarkExcess)) return false;
-  if (!matchSpace(results->rawbuf[offset++], kDaikinZeroSpace + kDaikinGap,
-                  kDaikinTolerance, kDaikinMarkExcess)) return false;
+  uint64_t preamble = 0;
+  uint16_t used = matchProtocol(results->rawbuf + offset, &preamble,
+                                results->rawlen - offset, kDaikinHeaderLength,
+                                kDaikinPreambleProtocol,
+                                kDaikinPreambleWindows, false);
+  if (!used) return false;  // Fail
+  if (preamble) return false;  // The header bits should be zero.
+  offset += used;
   // Sections
   const uint8_t ksectionSize[kDaikinSections] = {
       kDaikinSection1Length, kDaikinSection2Length, kDaikinSection3Length};
   uint16_t pos = 0;
   for (uint8_t section = 0; section < kDaikinSections; section++) {
-    uint16_t used;
     // Section Header + Section Data (7 bytes) + Section Footer
-    used = matchGeneric(results->rawbuf + offset, results->state + pos,
-                        results->rawlen - offset, ksectionSize[section] * 8,
-                        kDaikinHdrMark, kDaikinHdrSpace,
-                        kDaikinBitMark, kDaikinOneSpace,
-                        kDaikinBitMark, kDaikinZeroSpace,
-                        kDaikinBitMark, kDaikinZeroSpace + kDaikinGap,
-                        section >= kDaikinSections - 1,
-                        kDaikinTolerance, kDaikinMarkExcess, false);
+    used = matchProtocol(results->rawbuf + offset, results->state + pos,
+                         results->rawlen - offset, ksectionSize[section] * 8,
+                         kDaikinProtocol, kDaikinWindows,
+                         section >= kDaikinSections - 1);
     if (used == 0) return false;
     offset += used;
     pos += ksectionSize[section];
@@ -1231,96 +1258,103 @@ stdAc::state_t IRDaikin2::toCommon(void) const {
 String IRDaikin2::toString(void) const {
   String result = "";
   result.reserve(330);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempToString(_.Temp);
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addSwingVToString(_.SwingV, kDaikin2SwingVAuto,
-                              kDaikin2SwingVHighest, kDaikin2SwingVHigh,
-                              kDaikin2SwingVUpperMiddle,
-                              kDaikin2SwingVAuto,  // Middle is unused.
-                              kDaikin2SwingVLowerMiddle,
-                              kDaikin2SwingVLow, kDaikin2SwingVLowest,
-                              kDaikin2SwingVOff,  // Off is unused
-                              kDaikin2SwingVSwing, kDaikin2SwingVBreeze,
-                              kDaikin2SwingVCirculate);
-  result += addSwingHToString(_.SwingH, kDaikin2SwingHAuto,
-                              kDaikin2SwingHLeftMax,
-                              kDaikin2SwingHLeft,
-                              kDaikin2SwingHMiddle,
-                              kDaikin2SwingHRight,
-                              kDaikin2SwingHRightMax,
-                              kDaikin2SwingHOff,
-                              kDaikin2SwingHAuto,  // Unused
-                              kDaikin2SwingHAuto,  // Unused
-                              kDaikin2SwingHAuto,  // Unused
-                              kDaikin2SwingHWide);
-  result += addLabeledString(minsToString(_.CurrentTime), kClockStr);
-  result += addLabeledString(
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin2::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempToString(out, _.Temp);
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addSwingVToString(out, _.SwingV, kDaikin2SwingVAuto,
+                    kDaikin2SwingVHighest, kDaikin2SwingVHigh,
+                    kDaikin2SwingVUpperMiddle,
+                    kDaikin2SwingVAuto,  // Middle is unused.
+                    kDaikin2SwingVLowerMiddle,
+                    kDaikin2SwingVLow, kDaikin2SwingVLowest,
+                    kDaikin2SwingVOff,  // Off is unused
+                    kDaikin2SwingVSwing, kDaikin2SwingVBreeze,
+                    kDaikin2SwingVCirculate);
+  addSwingHToString(out, _.SwingH, kDaikin2SwingHAuto,
+                    kDaikin2SwingHLeftMax,
+                    kDaikin2SwingHLeft,
+                    kDaikin2SwingHMiddle,
+                    kDaikin2SwingHRight,
+                    kDaikin2SwingHRightMax,
+                    kDaikin2SwingHOff,
+                    kDaikin2SwingHAuto,  // Unused
+                    kDaikin2SwingHAuto,  // Unused
+                    kDaikin2SwingHAuto,  // Unused
+                    kDaikin2SwingHWide);
+  addLabeledString(out, minsToString(_.CurrentTime), kClockStr);
+  addLabeledString(out,
       _.OnTimer ? minsToString(_.OnTime) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.OffTimer ? minsToString(_.OffTime) : kOffStr,
       kOffTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.SleepTimer ? minsToString(getSleepTime()) : kOffStr,
       kSleepTimerStr);
-  result += addIntToString(_.Beep, kBeepStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, _.Beep, kBeepStr);
+  *out += kSpaceLBraceStr;
   switch (_.Beep) {
     case kDaikinBeepLoud:
-      result += kLoudStr;
+      *out += kLoudStr;
       break;
     case kDaikinBeepQuiet:
-      result += kQuietStr;
+      *out += kQuietStr;
       break;
     case kDaikinBeepOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addIntToString(_.Light, kLightStr);
-  result += kSpaceLBraceStr;
+  *out += ')';
+  addIntToString(out, _.Light, kLightStr);
+  *out += kSpaceLBraceStr;
   switch (_.Light) {
     case kDaikinLightBright:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kDaikinLightDim:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kDaikinLightOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addBoolToString(_.Mold, kMouldStr);
-  result += addBoolToString(_.Clean, kCleanStr);
-  result += addLabeledString(
+  *out += ')';
+  addBoolToString(out, _.Mold, kMouldStr);
+  addBoolToString(out, _.Clean, kCleanStr);
+  addLabeledString(out,
       _.FreshAir ? (_.FreshAirHigh ? kHighStr : kOnStr) : kOffStr,
       kFreshStr);
-  result += addBoolToString(_.Eye, kEyeStr);
-  result += addBoolToString(_.EyeAuto, kEyeAutoStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(_.Powerful, kPowerfulStr);
-  result += addBoolToString(_.Purify, kPurifyStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addIntToString(_.Humidity, kHumidStr);
+  addBoolToString(out, _.Eye, kEyeStr);
+  addBoolToString(out, _.EyeAuto, kEyeAutoStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, _.Powerful, kPowerfulStr);
+  addBoolToString(out, _.Purify, kPurifyStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addIntToString(out, _.Humidity, kHumidStr);
   switch (_.Humidity) {
     case kDaikin2HumidityOff:
     case kDaikin2HumidityAuto:
-      result += kSpaceLBraceStr;
-      result += _.Humidity ? kAutoStr : kOffStr;
-      result += ')';
+      *out += kSpaceLBraceStr;
+      *out += _.Humidity ? kAutoStr : kOffStr;
+      *out += ')';
       break;
     default:
-      result += '%';
+      *out += '%';
   }
-  return result;
 }
 
 #if DECODE_DAIKIN2
@@ -1401,18 +1435,10 @@ void IRsend::sendDaikin216(const unsigned char data[], const uint16_t nbytes,
 
   for (uint16_t r = 0; r <= repeat; r++) {
     // Section #1
-    sendGeneric(kDaikin216HdrMark, kDaikin216HdrSpace, kDaikin216BitMark,
-                kDaikin216OneSpace, kDaikin216BitMark, kDaikin216ZeroSpace,
-                kDaikin216BitMark, kDaikin216Gap, data,
-                kDaikin216Section1Length,
-                kDaikin216Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin216Protocol, data, kDaikin216Section1Length);
     // Section #2
-    sendGeneric(kDaikin216HdrMark, kDaikin216HdrSpace, kDaikin216BitMark,
-                kDaikin216OneSpace, kDaikin216BitMark, kDaikin216ZeroSpace,
-                kDaikin216BitMark, kDaikin216Gap,
-                data + kDaikin216Section1Length,
-                nbytes - kDaikin216Section1Length,
-                kDaikin216Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin216Protocol, data + kDaikin216Section1Length,
+                 nbytes - kDaikin216Section1Length);
   }
 }
 #endif  // SEND_DAIKIN216
@@ -1655,20 +1681,30 @@ stdAc::state_t IRDaikin216::toCommon(void) const {
 String IRDaikin216::toString(void) const {
   String result = "";
   result.reserve(120);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempToString(_.Temp);
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addBoolToString(_.SwingH, kSwingHStr);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addBoolToString(_.Powerful, kPowerfulStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin216::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempToString(out, _.Temp);
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addBoolToString(out, _.Powerful, kPowerfulStr);
+}
+
 #if DECODE_DAIKIN216
+constexpr protocol_windows_t kDaikin216Windows =
+    IRrecv::protocolWindows(kDaikin216Protocol);
+
 /// Decode the supplied Daikin 216-bit message. (DAIKIN216)
 /// Status: STABLE / Should be working.
 /// @param[in,out] results Ptr to the data to decode & where to store the decode
@@ -1695,14 +1731,10 @@ bool IRrecv::decodeDaikin216(decode_results *results, uint16_t offset,
   for (uint8_t section = 0; section < kDaikin216Sections; section++) {
     uint16_t used;
     // Section Header + Section Data + Section Footer
-    used = matchGeneric(results->rawbuf + offset, results->state + pos,
-                        results->rawlen - offset, ksectionSize[section] * 8,
-                        kDaikin216HdrMark, kDaikin216HdrSpace,
-                        kDaikin216BitMark, kDaikin216OneSpace,
-                        kDaikin216BitMark, kDaikin216ZeroSpace,
-                        kDaikin216BitMark, kDaikin216Gap,
-                        section >= kDaikin216Sections - 1,
-                        kDaikinTolerance, kDaikinMarkExcess, false);
+    used = matchProtocol(results->rawbuf + offset, results->state + pos,
+                         results->rawlen - offset, ksectionSize[section] * 8,
+                         kDaikin216Protocol, kDaikin216Windows,
+                         section >= kDaikin216Sections - 1);
     if (used == 0) return false;
     offset += used;
     pos += ksectionSize[section];
@@ -1738,18 +1770,10 @@ void IRsend::sendDaikin160(const unsigned char data[], const uint16_t nbytes,
 
   for (uint16_t r = 0; r <= repeat; r++) {
     // Section #1
-    sendGeneric(kDaikin160HdrMark, kDaikin160HdrSpace, kDaikin160BitMark,
-                kDaikin160OneSpace, kDaikin160BitMark, kDaikin160ZeroSpace,
-                kDaikin160BitMark, kDaikin160Gap, data,
-                kDaikin160Section1Length,
-                kDaikin160Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin160Protocol, data, kDaikin160Section1Length);
     // Section #2
-    sendGeneric(kDaikin160HdrMark, kDaikin160HdrSpace, kDaikin160BitMark,
-                kDaikin160OneSpace, kDaikin160BitMark, kDaikin160ZeroSpace,
-                kDaikin160BitMark, kDaikin160Gap,
-                data + kDaikin160Section1Length,
-                nbytes - kDaikin160Section1Length,
-                kDaikin160Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin160Protocol, data + kDaikin160Section1Length,
+                 nbytes - kDaikin160Section1Length);
   }
 }
 #endif  // SEND_DAIKIN160
@@ -2003,28 +2027,38 @@ stdAc::state_t IRDaikin160::toCommon(void) const {
 String IRDaikin160::toString(void) const {
   String result = "";
   result.reserve(150);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addIntToString(_.SwingV, kSwingVStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin160::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addIntToString(out, _.SwingV, kSwingVStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingV) {
-    case kDaikin160SwingVHighest: result += kHighestStr; break;
-    case kDaikin160SwingVHigh:    result += kHighStr; break;
-    case kDaikin160SwingVMiddle:  result += kMiddleStr; break;
-    case kDaikin160SwingVLow:     result += kLowStr; break;
-    case kDaikin160SwingVLowest:  result += kLowestStr; break;
-    case kDaikin160SwingVAuto:    result += kAutoStr; break;
-    default:                      result += kUnknownStr;
+    case kDaikin160SwingVHighest: *out += kHighestStr; break;
+    case kDaikin160SwingVHigh:    *out += kHighStr; break;
+    case kDaikin160SwingVMiddle:  *out += kMiddleStr; break;
+    case kDaikin160SwingVLow:     *out += kLowStr; break;
+    case kDaikin160SwingVLowest:  *out += kLowestStr; break;
+    case kDaikin160SwingVAuto:    *out += kAutoStr; break;
+    default:                      *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 #if DECODE_DAIKIN160
+constexpr protocol_windows_t kDaikin160Windows =
+    IRrecv::protocolWindows(kDaikin160Protocol);
+
 /// Decode the supplied Daikin 160-bit message. (DAIKIN160)
 /// Status: STABLE / Confirmed working.
 /// @param[in,out] results Ptr to the data to decode & where to store the decode
@@ -2051,14 +2085,10 @@ bool IRrecv::decodeDaikin160(decode_results *results, uint16_t offset,
   for (uint8_t section = 0; section < kDaikin160Sections; section++) {
     uint16_t used;
     // Section Header + Section Data (7 bytes) + Section Footer
-    used = matchGeneric(results->rawbuf + offset, results->state + pos,
-                        results->rawlen - offset, ksectionSize[section] * 8,
-                        kDaikin160HdrMark, kDaikin160HdrSpace,
-                        kDaikin160BitMark, kDaikin160OneSpace,
-                        kDaikin160BitMark, kDaikin160ZeroSpace,
-                        kDaikin160BitMark, kDaikin160Gap,
-                        section >= kDaikin160Sections - 1,
-                        kDaikinTolerance, kDaikinMarkExcess, false);
+    used = matchProtocol(results->rawbuf + offset, results->state + pos,
+                         results->rawlen - offset, ksectionSize[section] * 8,
+                         kDaikin160Protocol, kDaikin160Windows,
+                         section >= kDaikin160Sections - 1);
     if (used == 0) return false;
     offset += used;
     pos += ksectionSize[section];
@@ -2092,18 +2122,10 @@ void IRsend::sendDaikin176(const unsigned char data[], const uint16_t nbytes,
 
   for (uint16_t r = 0; r <= repeat; r++) {
     // Section #1
-    sendGeneric(kDaikin176HdrMark, kDaikin176HdrSpace, kDaikin176BitMark,
-                kDaikin176OneSpace, kDaikin176BitMark, kDaikin176ZeroSpace,
-                kDaikin176BitMark, kDaikin176Gap, data,
-                kDaikin176Section1Length,
-                kDaikin176Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin176Protocol, data, kDaikin176Section1Length);
     // Section #2
-    sendGeneric(kDaikin176HdrMark, kDaikin176HdrSpace, kDaikin176BitMark,
-                kDaikin176OneSpace, kDaikin176BitMark, kDaikin176ZeroSpace,
-                kDaikin176BitMark, kDaikin176Gap,
-                data + kDaikin176Section1Length,
-                nbytes - kDaikin176Section1Length,
-                kDaikin176Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin176Protocol, data + kDaikin176Section1Length,
+                 nbytes - kDaikin176Section1Length);
   }
 }
 #endif  // SEND_DAIKIN176
@@ -2395,29 +2417,39 @@ stdAc::state_t IRDaikin176::toCommon(void) const {
 String IRDaikin176::toString(void) const {
   String result = "";
   result.reserve(90);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikin176Auto, kDaikin176Cool,
-                            kDaikin176Heat, kDaikin176Dry, kDaikin176Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kDaikin176FanMax, kDaikinFanMin,
-                           kDaikinFanMin, kDaikinFanMin, kDaikinFanMin);
-  result += addSwingHToString(_.SwingH, kDaikin176SwingHAuto,
-                              kDaikin176SwingHAuto,  // maxleft Unused
-                              kDaikin176SwingHAuto,  // left Unused
-                              kDaikin176SwingHAuto,  // middle Unused
-                              kDaikin176SwingHAuto,  // right Unused
-                              kDaikin176SwingHAuto,  // maxright Unused
-                              kDaikin176SwingHOff,
-                              // Below are unused.
-                              kDaikin176SwingHAuto,
-                              kDaikin176SwingHAuto,
-                              kDaikin176SwingHAuto,
-                              kDaikin176SwingHAuto);
-  result += addIntToString(_.Id1, kIdStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin176::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikin176Auto, kDaikin176Cool,
+                  kDaikin176Heat, kDaikin176Dry, kDaikin176Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kDaikin176FanMax, kDaikinFanMin,
+                 kDaikinFanMin, kDaikinFanMin, kDaikinFanMin);
+  addSwingHToString(out, _.SwingH, kDaikin176SwingHAuto,
+                    kDaikin176SwingHAuto,  // maxleft Unused
+                    kDaikin176SwingHAuto,  // left Unused
+                    kDaikin176SwingHAuto,  // middle Unused
+                    kDaikin176SwingHAuto,  // right Unused
+                    kDaikin176SwingHAuto,  // maxright Unused
+                    kDaikin176SwingHOff,
+                    // Below are unused.
+                    kDaikin176SwingHAuto,
+                    kDaikin176SwingHAuto,
+                    kDaikin176SwingHAuto,
+                    kDaikin176SwingHAuto);
+  addIntToString(out, _.Id1, kIdStr);
+}
+
 #if DECODE_DAIKIN176
+constexpr protocol_windows_t kDaikin176Windows =
+    IRrecv::protocolWindows(kDaikin176Protocol);
+
 /// Decode the supplied Daikin 176-bit message. (DAIKIN176)
 /// Status: STABLE / Expected to work.
 /// @param[in,out] results Ptr to the data to decode & where to store the decode
@@ -2444,14 +2476,10 @@ bool IRrecv::decodeDaikin176(decode_results *results, uint16_t offset,
   for (uint8_t section = 0; section < kDaikin176Sections; section++) {
     uint16_t used;
     // Section Header + Section Data (7 bytes) + Section Footer
-    used = matchGeneric(results->rawbuf + offset, results->state + pos,
-                        results->rawlen - offset, ksectionSize[section] * 8,
-                        kDaikin176HdrMark, kDaikin176HdrSpace,
-                        kDaikin176BitMark, kDaikin176OneSpace,
-                        kDaikin176BitMark, kDaikin176ZeroSpace,
-                        kDaikin176BitMark, kDaikin176Gap,
-                        section >= kDaikin176Sections - 1,
-                        kDaikinTolerance, kDaikinMarkExcess, false);
+    used = matchProtocol(results->rawbuf + offset, results->state + pos,
+                         results->rawlen - offset, ksectionSize[section] * 8,
+                         kDaikin176Protocol, kDaikin176Windows,
+                         section >= kDaikin176Sections - 1);
     if (used == 0) return false;
     offset += used;
     pos += ksectionSize[section];
@@ -2854,33 +2882,40 @@ uint8_t IRDaikin128::getLightToggle(void) const {
 String IRDaikin128::toString(void) const {
   String result = "";
   result.reserve(240);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerToggleStr, false);
-  result += addModeToString(_.Mode, kDaikin128Auto, kDaikin128Cool,
-                            kDaikin128Heat, kDaikin128Dry, kDaikin128Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kDaikin128FanHigh, kDaikin128FanLow,
-                           kDaikin128FanAuto, kDaikin128FanQuiet,
-                           kDaikin128FanMed);
-  result += addBoolToString(getPowerful(), kPowerfulStr);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
-  result += addBoolToString(_.OnTimer, kOnTimerStr);
-  result += addLabeledString(minsToString(getOnTimer()), kOnTimerStr);
-  result += addBoolToString(_.OffTimer, kOffTimerStr);
-  result += addLabeledString(minsToString(getOffTimer()), kOffTimerStr);
-  result += addIntToString(getLightToggle(), kLightToggleStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin128::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerToggleStr, false);
+  addModeToString(out, _.Mode, kDaikin128Auto, kDaikin128Cool,
+                  kDaikin128Heat, kDaikin128Dry, kDaikin128Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kDaikin128FanHigh, kDaikin128FanLow,
+                 kDaikin128FanAuto, kDaikin128FanQuiet,
+                 kDaikin128FanMed);
+  addBoolToString(out, getPowerful(), kPowerfulStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+  addBoolToString(out, _.OnTimer, kOnTimerStr);
+  addLabeledString(out, minsToString(getOnTimer()), kOnTimerStr);
+  addBoolToString(out, _.OffTimer, kOffTimerStr);
+  addLabeledString(out, minsToString(getOffTimer()), kOffTimerStr);
+  addIntToString(out, getLightToggle(), kLightToggleStr);
+  *out += kSpaceLBraceStr;
   switch (getLightToggle()) {
-    case kDaikin128BitCeiling: result += kCeilingStr; break;
-    case kDaikin128BitWall: result += kWallStr; break;
-    case 0: result += kOffStr; break;
-    default: result += kUnknownStr;
+    case kDaikin128BitCeiling: *out += kCeilingStr; break;
+    case kDaikin128BitWall: *out += kWallStr; break;
+    case 0: *out += kOffStr; break;
+    default: *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 /// Convert the current internal state into its stdAc::state_t equivalent.
@@ -3318,21 +3353,28 @@ stdAc::state_t IRDaikin152::toCommon(void) const {
 String IRDaikin152::toString(void) const {
   String result = "";
   result.reserve(180);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempToString(_.Temp);
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.Powerful, kPowerfulStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addBoolToString(_.Sensor, kSensorStr);
-  result += addBoolToString(_.Comfort, kComfortStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin152::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempToString(out, _.Temp);
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.Powerful, kPowerfulStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addBoolToString(out, _.Sensor, kSensorStr);
+  addBoolToString(out, _.Comfort, kComfortStr);
+}
+
 #if SEND_DAIKIN64
 /// Send a Daikin64 (64-bit) A/C formatted message.
 /// Status: Beta / Probably Working.
@@ -3437,11 +3479,8 @@ void IRDaikin64::send(const uint16_t repeat) {
 /// @param[in] state The value to calc the checksum of.
 /// @return The 4-bit checksum stored in a uint_8.
 uint8_t IRDaikin64::calcChecksum(const uint64_t state) {
-  uint64_t data = GETBITS64(state, 0, kDaikin64ChecksumOffset);
-  uint8_t result = 0;
-  for (; data; data >>= 4)  // Add each nibble together.
-    result += GETBITS64(data, 0, 4);
-  return result & 0xF;
+  // Add each nibble together.
+  return sumNibbles(state, kDaikin64ChecksumOffset / 4);
 }
 
 /// Verify the checksum is valid for a given state.
@@ -3683,32 +3722,39 @@ void IRDaikin64::setOffTime(const uint16_t mins_since_midnight) {
 String IRDaikin64::toString(void) const {
   String result = "";
   result.reserve(120);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerToggleStr, false);
-  result += addModeToString(_.Mode, 0xFF, kDaikin64Cool,
-                            kDaikin64Heat, kDaikin64Dry, kDaikin64Fan);
-  result += addTempToString(getTemp());
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin64::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerToggleStr, false);
+  addModeToString(out, _.Mode, 0xFF, kDaikin64Cool,
+                  kDaikin64Heat, kDaikin64Dry, kDaikin64Fan);
+  addTempToString(out, getTemp());
   if (!getTurbo()) {
-    result += addFanToString(_.Fan, kDaikin64FanHigh, kDaikin64FanLow,
-                             kDaikin64FanAuto, kDaikin64FanQuiet,
-                             kDaikin64FanMed);
+    addFanToString(out, _.Fan, kDaikin64FanHigh, kDaikin64FanLow,
+                   kDaikin64FanAuto, kDaikin64FanQuiet,
+                   kDaikin64FanMed);
   } else {
-    result += addIntToString(_.Fan, kFanStr);
-    result += kSpaceLBraceStr;
-    result += kTurboStr;
-    result += ')';
+    addIntToString(out, _.Fan, kFanStr);
+    *out += kSpaceLBraceStr;
+    *out += kTurboStr;
+    *out += ')';
   }
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
-  result += addLabeledString(_.OnTimer
-                             ? minsToString(getOnTime()) : kOffStr,
-                             kOnTimerStr);
-  result += addLabeledString(_.OffTimer
-                             ? minsToString(getOffTime()) : kOffStr,
-                             kOffTimerStr);
-  return result;
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+  addLabeledString(out, _.OnTimer
+                   ? minsToString(getOnTime()) : kOffStr,
+                   kOnTimerStr);
+  addLabeledString(out, _.OffTimer
+                   ? minsToString(getOffTime()) : kOffStr,
+                   kOffTimerStr);
 }
 
 /// Convert the current internal state into its stdAc::state_t equivalent.
@@ -3753,23 +3799,18 @@ void IRsend::sendDaikin200(const unsigned char data[], const uint16_t nbytes,
 
   for (uint16_t r = 0; r <= repeat; r++) {
     // Section #1
-    sendGeneric(kDaikin200HdrMark, kDaikin200HdrSpace, kDaikin200BitMark,
-                kDaikin200OneSpace, kDaikin200BitMark, kDaikin200ZeroSpace,
-                kDaikin200BitMark, kDaikin200Gap, data,
-                kDaikin200Section1Length,
-                kDaikin200Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin200Protocol, data, kDaikin200Section1Length);
     // Section #2
-    sendGeneric(kDaikin200HdrMark, kDaikin200HdrSpace, kDaikin200BitMark,
-                kDaikin200OneSpace, kDaikin200BitMark, kDaikin200ZeroSpace,
-                kDaikin200BitMark, kDaikin200Gap,
-                data + kDaikin200Section1Length,
-                nbytes - kDaikin200Section1Length,
-                kDaikin200Freq, false, 0, kDutyDefault);
+    sendProtocol(kDaikin200Protocol, data + kDaikin200Section1Length,
+                 nbytes - kDaikin200Section1Length);
   }
 }
 #endif  // SEND_DAIKIN200
 
 #if DECODE_DAIKIN200
+constexpr protocol_windows_t kDaikin200Windows =
+    IRrecv::protocolWindows(kDaikin200Protocol);
+
 /// Decode the supplied Daikin 200-bit message. (DAIKIN200)
 /// Status: STABLE / Known to be working.
 /// @param[in,out] results Ptr to the data to decode & where to store the decode
@@ -3795,14 +3836,10 @@ bool IRrecv::decodeDaikin200(decode_results *results, uint16_t offset,
   for (uint8_t section = 0; section < kDaikin200Sections; section++) {
     uint16_t used;
     // Section Header + Section Data + Section Footer
-    used = matchGeneric(results->rawbuf + offset, results->state + pos,
-                        results->rawlen - offset, ksectionSize[section] * 8,
-                        kDaikin200HdrMark, kDaikin200HdrSpace,
-                        kDaikin200BitMark, kDaikin200OneSpace,
-                        kDaikin200BitMark, kDaikin200ZeroSpace,
-                        kDaikin200BitMark, kDaikin200Gap,
-                        section >= kDaikin200Sections - 1,
-                        kDaikinTolerance, 0, false);
+    used = matchProtocol(results->rawbuf + offset, results->state + pos,
+                         results->rawlen - offset, ksectionSize[section] * 8,
+                         kDaikin200Protocol, kDaikin200Windows,
+                         section >= kDaikin200Sections - 1);
     if (used == 0) return false;
     offset += used;
     pos += ksectionSize[section];
@@ -4403,96 +4440,103 @@ stdAc::state_t IRDaikin312::toCommon(void) const {
 String IRDaikin312::toString(void) const {
   String result = "";
   result.reserve(330);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
-                            kDaikinDry, kDaikinFan);
-  result += addTempFloatToString(getTemp());
-  result += addFanToString(getFan(), kDaikinFanMax, kDaikinFanMin,
-                           kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
-  result += addSwingVToString(_.SwingV, kDaikin312SwingVAuto,
-                              kDaikin312SwingVHighest, kDaikin312SwingVHigh,
-                              kDaikin312SwingVUpperMiddle,
-                              kDaikin312SwingVAuto,  // Middle is unused.
-                              kDaikin312SwingVLowerMiddle,
-                              kDaikin312SwingVLow, kDaikin312SwingVLowest,
-                              kDaikin312SwingVOff,  // Off is unused
-                              kDaikin312SwingVSwing, kDaikin312SwingVBreeze,
-                              kDaikin312SwingVCirculate);
-  result += addSwingHToString(_.SwingH, kDaikin2SwingHAuto,
-                              kDaikin312SwingHLeftMax,
-                              kDaikin312SwingHLeft,
-                              kDaikin312SwingHMiddle,
-                              kDaikin312SwingHRight,
-                              kDaikin312SwingHRightMax,
-                              kDaikin312SwingHOff,
-                              kDaikin312SwingHAuto,  // Unused
-                              kDaikin312SwingHAuto,  // Unused
-                              kDaikin312SwingHAuto,  // Unused
-                              kDaikin312SwingHWide);
-  result += addLabeledString(minsToString(_.CurrentTime), kClockStr);
-  result += addLabeledString(
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDaikin312::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kDaikinAuto, kDaikinCool, kDaikinHeat,
+                  kDaikinDry, kDaikinFan);
+  addTempFloatToString(out, getTemp());
+  addFanToString(out, getFan(), kDaikinFanMax, kDaikinFanMin,
+                 kDaikinFanAuto, kDaikinFanQuiet, kDaikinFanMed);
+  addSwingVToString(out, _.SwingV, kDaikin312SwingVAuto,
+                    kDaikin312SwingVHighest, kDaikin312SwingVHigh,
+                    kDaikin312SwingVUpperMiddle,
+                    kDaikin312SwingVAuto,  // Middle is unused.
+                    kDaikin312SwingVLowerMiddle,
+                    kDaikin312SwingVLow, kDaikin312SwingVLowest,
+                    kDaikin312SwingVOff,  // Off is unused
+                    kDaikin312SwingVSwing, kDaikin312SwingVBreeze,
+                    kDaikin312SwingVCirculate);
+  addSwingHToString(out, _.SwingH, kDaikin2SwingHAuto,
+                    kDaikin312SwingHLeftMax,
+                    kDaikin312SwingHLeft,
+                    kDaikin312SwingHMiddle,
+                    kDaikin312SwingHRight,
+                    kDaikin312SwingHRightMax,
+                    kDaikin312SwingHOff,
+                    kDaikin312SwingHAuto,  // Unused
+                    kDaikin312SwingHAuto,  // Unused
+                    kDaikin312SwingHAuto,  // Unused
+                    kDaikin312SwingHWide);
+  addLabeledString(out, minsToString(_.CurrentTime), kClockStr);
+  addLabeledString(out,
       _.OnTimer ? minsToString(_.OnTime) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.OffTimer ? minsToString(_.OffTime) : kOffStr,
       kOffTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.SleepTimer ? minsToString(getSleepTime()) : kOffStr,
       kSleepTimerStr);
-  result += addIntToString(_.Beep, kBeepStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, _.Beep, kBeepStr);
+  *out += kSpaceLBraceStr;
   switch (_.Beep) {
     case kDaikinBeepLoud:
-      result += kLoudStr;
+      *out += kLoudStr;
       break;
     case kDaikinBeepQuiet:
-      result += kQuietStr;
+      *out += kQuietStr;
       break;
     case kDaikinBeepOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addIntToString(_.Light, kLightStr);
-  result += kSpaceLBraceStr;
+  *out += ')';
+  addIntToString(out, _.Light, kLightStr);
+  *out += kSpaceLBraceStr;
   switch (_.Light) {
     case kDaikinLightBright:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kDaikinLightDim:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kDaikinLightOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addBoolToString(_.Mold, kMouldStr);
-  result += addBoolToString(_.Clean, kCleanStr);
-  result += addLabeledString(
+  *out += ')';
+  addBoolToString(out, _.Mold, kMouldStr);
+  addBoolToString(out, _.Clean, kCleanStr);
+  addLabeledString(out,
       _.FreshAir ? (_.FreshAirHigh ? kHighStr : kOnStr) : kOffStr,
       kFreshStr);
-  result += addBoolToString(_.Eye, kEyeStr);
-  result += addBoolToString(_.EyeAuto, kEyeAutoStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(_.Powerful, kPowerfulStr);
-  result += addBoolToString(_.Purify, kPurifyStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addIntToString(_.Humidity, kHumidStr);
+  addBoolToString(out, _.Eye, kEyeStr);
+  addBoolToString(out, _.EyeAuto, kEyeAutoStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, _.Powerful, kPowerfulStr);
+  addBoolToString(out, _.Purify, kPurifyStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addIntToString(out, _.Humidity, kHumidStr);
   switch (_.Humidity) {
     case kDaikin312HumidityOff:
     case kDaikin312HumidityAuto:
-      result += kSpaceLBraceStr;
-      result += _.Humidity ? kAutoStr : kOffStr;
-      result += ')';
+      *out += kSpaceLBraceStr;
+      *out += _.Humidity ? kAutoStr : kOffStr;
+      *out += ')';
       break;
     default:
-      result += '%';
+      *out += '%';
   }
-  return result;
 }
 
 #if SEND_DAIKIN312
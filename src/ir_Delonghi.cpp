@@ -15,10 +15,9 @@ using irutils::addFanToString;
 using irutils::addLabeledString;
 using irutils::addTempToString;
 using irutils::minsToString;
+using irutils::sumBytes;
 
-const uint16_t kDelonghiAcHdrMark = 8984;
 const uint16_t kDelonghiAcBitMark = 572;
-const uint16_t kDelonghiAcHdrSpace = 4200;
 const uint16_t kDelonghiAcOneSpace = 1558;
 const uint16_t kDelonghiAcZeroSpace = 510;
 const uint32_t kDelonghiAcGap = kDefaultMessageGap;  // A totally made-up guess.
@@ -109,12 +108,8 @@ void IRDelonghiAc::send(const uint16_t repeat) {
 /// @param[in] state The value to calc the checksum of.
 /// @return A valid checksum value.
 uint8_t IRDelonghiAc::calcChecksum(const uint64_t state) {
-  uint8_t sum = 0;
   // Add up all the 8 bit chunks except for Most-significant 8 bits.
-  for (uint8_t offset = 0; offset < kDelonghiAcChecksumOffset; offset += 8) {
-    sum += GETBITS64(state, offset, 8);
-  }
-  return sum;
+  return sumBytes(state, kDelonghiAcChecksumOffset / 8);
 }
 
 /// Verify the checksum is valid for a given state.
@@ -449,22 +444,29 @@ stdAc::state_t IRDelonghiAc::toCommon(void) const {
 String IRDelonghiAc::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kDelonghiAcAuto, kDelonghiAcCool,
-                            kDelonghiAcAuto, kDelonghiAcDry, kDelonghiAcFan);
-  result += addFanToString(_.Fan, kDelonghiAcFanHigh, kDelonghiAcFanLow,
-                           kDelonghiAcFanAuto, kDelonghiAcFanAuto,
-                           kDelonghiAcFanMedium);
-  result += addTempToString(getTemp(), !_.Fahrenheit);
-  result += addBoolToString(_.Boost, kTurboStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRDelonghiAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kDelonghiAcAuto, kDelonghiAcCool,
+                  kDelonghiAcAuto, kDelonghiAcDry, kDelonghiAcFan);
+  addFanToString(out, _.Fan, kDelonghiAcFanHigh, kDelonghiAcFanLow,
+                 kDelonghiAcFanAuto, kDelonghiAcFanAuto,
+                 kDelonghiAcFanMedium);
+  addTempToString(out, getTemp(), !_.Fahrenheit);
+  addBoolToString(out, _.Boost, kTurboStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
   uint16_t mins = getOnTimer();
-  result += addLabeledString((mins && _.OnTimer) ? minsToString(mins)
-                                                 : kOffStr,
-                             kOnTimerStr);
+  addLabeledString(out, (mins && _.OnTimer) ? minsToString(mins)
+                                       : kOffStr,
+                   kOnTimerStr);
   mins = getOffTimer();
-  result += addLabeledString((mins && _.OffTimer) ? minsToString(mins)
-                                                  : kOffStr,
-                             kOffTimerStr);
-  return result;
+  addLabeledString(out, (mins && _.OffTimer) ? minsToString(mins)
+                                        : kOffStr,
+                   kOffTimerStr);
 }
@@ -50,6 +50,8 @@ union DelonghiProtocol{
 };
 
 // Constants
+const uint16_t kDelonghiAcHdrMark = 8984;
+const uint16_t kDelonghiAcHdrSpace = 4200;
 const uint8_t kDelonghiAcTempMinC = 18;  // Deg C
 const uint8_t kDelonghiAcTempMaxC = 32;  // Deg C
 const uint8_t kDelonghiAcTempMinF = 64;  // Deg F
@@ -119,6 +121,7 @@ class IRDelonghiAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -13,14 +13,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Dish.h"
 
 
 // Constants
-const uint16_t kDishTick = 100;
-const uint16_t kDishHdrMarkTicks = 4;
-const uint16_t kDishHdrMark = kDishHdrMarkTicks * kDishTick;
-const uint16_t kDishHdrSpaceTicks = 61;
-const uint16_t kDishHdrSpace = kDishHdrSpaceTicks * kDishTick;
 const uint16_t kDishBitMarkTicks = 4;
 const uint16_t kDishBitMark = kDishBitMarkTicks * kDishTick;
 const uint16_t kDishOneSpaceTicks = 17;
@@ -0,0 +1,20 @@
+// Copyright Todd Treece
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief DISH Network protocol support
+
+#ifndef IR_DISH_H_
+#define IR_DISH_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kDishTick = 100;
+const uint16_t kDishHdrMarkTicks = 4;
+const uint16_t kDishHdrMark = kDishHdrMarkTicks * kDishTick;
+const uint16_t kDishHdrSpaceTicks = 61;
+const uint16_t kDishHdrSpace = kDishHdrSpaceTicks * kDishTick;
+
+#endif  // IR_DISH_H_
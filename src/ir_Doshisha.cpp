@@ -12,10 +12,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Doshisha.h"
 
 
-const uint16_t kDoshishaHdrMark = 3412;
-const uint16_t kDoshishaHdrSpace = 1722;
 const uint16_t kDoshishaBitMark = 420;
 const uint16_t kDoshishaOneSpace = 1310;
 const uint16_t kDoshishaZeroSpace = 452;
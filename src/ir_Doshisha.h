@@ -0,0 +1,16 @@
+// Copyright 2020 Christian (nikize)
+
+/// @file
+/// @brief Doshisha protocol support
+
+#ifndef IR_DOSHISHA_H_
+#define IR_DOSHISHA_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kDoshishaHdrMark = 3412;
+const uint16_t kDoshishaHdrSpace = 1722;
+
+#endif  // IR_DOSHISHA_H_
@@ -16,8 +16,6 @@
 // Constants
 const uint8_t  kEcoclimSections = 3;
 const uint8_t  kEcoclimExtraTolerance = 5;  ///< Percentage (extra)
-const uint16_t kEcoclimHdrMark = 5730;     ///< uSeconds
-const uint16_t kEcoclimHdrSpace = 1935;    ///< uSeconds
 const uint16_t kEcoclimBitMark = 440;      ///< uSeconds
 const uint16_t kEcoclimOneSpace = 1739;    ///< uSeconds
 const uint16_t kEcoclimZeroSpace = 637;    ///< uSeconds
@@ -415,37 +413,44 @@ stdAc::state_t IREcoclimAc::toCommon(void) const {
 String IREcoclimAc::toString(void) const {
   String result = "";
   result.reserve(140);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IREcoclimAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
   // Custom Mode output as this protocol has Recycle and Sleep as modes.
-  result += addIntToString(_.Mode, kModeStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, _.Mode, kModeStr);
+  *out += kSpaceLBraceStr;
   switch (_.Mode) {
-    case kEcoclimAuto:    result += kAutoStr; break;
-    case kEcoclimCool:    result += kCoolStr; break;
-    case kEcoclimHeat:    result += kHeatStr; break;
-    case kEcoclimDry:     result += kDryStr; break;
-    case kEcoclimFan:     result += kFanStr; break;
-    case kEcoclimRecycle: result += kRecycleStr; break;
-    case kEcoclimSleep:   result += kSleepStr; break;
-    default:              result += kUnknownStr;
+    case kEcoclimAuto:    *out += kAutoStr; break;
+    case kEcoclimCool:    *out += kCoolStr; break;
+    case kEcoclimHeat:    *out += kHeatStr; break;
+    case kEcoclimDry:     *out += kDryStr; break;
+    case kEcoclimFan:     *out += kFanStr; break;
+    case kEcoclimRecycle: *out += kRecycleStr; break;
+    case kEcoclimSleep:   *out += kSleepStr; break;
+    default:              *out += kUnknownStr;
   }
-  result += ')';
-  result += addTempToString(getTemp());
-  result += kCommaSpaceStr;
-  result += kSensorStr;
-  result += addTempToString(getSensorTemp(), true, false);
-  result += addFanToString(_.Fan, kEcoclimFanMax,
-                           kEcoclimFanMin,
-                           kEcoclimFanAuto,
-                           kEcoclimFanAuto,  // Unused (No Quiet)
-                           kEcoclimFanMed,
-                           kEcoclimFanMax);
-  result += addLabeledString(minsToString(_.Clock), kClockStr);
-  result += addLabeledString(
+  *out += ')';
+  addTempToString(out, getTemp());
+  *out += kCommaSpaceStr;
+  *out += kSensorStr;
+  addTempToString(out, getSensorTemp(), true, false);
+  addFanToString(out, _.Fan, kEcoclimFanMax,
+                 kEcoclimFanMin,
+                 kEcoclimFanAuto,
+                 kEcoclimFanAuto,  // Unused (No Quiet)
+                 kEcoclimFanMed,
+                 kEcoclimFanMax);
+  addLabeledString(out, minsToString(_.Clock), kClockStr);
+  addLabeledString(out,
       isOnTimerEnabled() ? minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       isOffTimerEnabled() ? minsToString(getOffTimer()) : kOffStr,
       kOffTimerStr);
-  result += addIntToString(_.DipConfig, kTypeStr);
-  return result;
+  addIntToString(out, _.DipConfig, kTypeStr);
 }
@@ -23,6 +23,8 @@
 #endif
 
 // Constants
+const uint16_t kEcoclimHdrMark = 5730;     ///< uSeconds
+const uint16_t kEcoclimHdrSpace = 1935;    ///< uSeconds
 // Modes
 const uint8_t kEcoclimAuto =    0b000;  ///< 0. a.k.a Slave
 const uint8_t kEcoclimCool =    0b001;  ///< 1
@@ -129,6 +131,7 @@ class IREcoclimAc {
   bool isOffTimerEnabled(void) const;
   void disableOffTimer(void);
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -15,9 +15,7 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kElectraAcHdrMark = 9166;
 const uint16_t kElectraAcBitMark = 646;
-const uint16_t kElectraAcHdrSpace = 4470;
 const uint16_t kElectraAcOneSpace = 1647;
 const uint16_t kElectraAcZeroSpace = 547;
 const uint32_t kElectraAcMessageGap = kDefaultMessageGap;  // Just a guess.
@@ -403,27 +401,34 @@ stdAc::state_t IRElectraAc::toCommon(void) const {
 String IRElectraAc::toString(void) const {
   String result = "";
   result.reserve(160);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRElectraAc::toString(IRtextWriter *out) const {
   if (!_.SensorUpdate) {
-    result += addBoolToString(_.Power, kPowerStr, false);
-    result += addModeToString(_.Mode, kElectraAcAuto, kElectraAcCool,
-                              kElectraAcHeat, kElectraAcDry, kElectraAcFan);
-    result += addTempToString(getTemp());
-    result += addFanToString(_.Fan, kElectraAcFanHigh, kElectraAcFanLow,
-                             kElectraAcFanAuto, kElectraAcFanAuto,
-                             kElectraAcFanMed);
-    result += addBoolToString(getSwingV(), kSwingVStr);
-    result += addBoolToString(getSwingH(), kSwingHStr);
-    result += addToggleToString(getLightToggle(), kLightStr);
-    result += addBoolToString(_.Clean, kCleanStr);
-    result += addBoolToString(_.Turbo, kTurboStr);
-    result += addBoolToString(_.Quiet, kQuietStr);
-    result += addBoolToString(_.IFeel, kIFeelStr);
+    addBoolToString(out, _.Power, kPowerStr, false);
+    addModeToString(out, _.Mode, kElectraAcAuto, kElectraAcCool,
+                    kElectraAcHeat, kElectraAcDry, kElectraAcFan);
+    addTempToString(out, getTemp());
+    addFanToString(out, _.Fan, kElectraAcFanHigh, kElectraAcFanLow,
+                   kElectraAcFanAuto, kElectraAcFanAuto,
+                   kElectraAcFanMed);
+    addBoolToString(out, getSwingV(), kSwingVStr);
+    addBoolToString(out, getSwingH(), kSwingHStr);
+    addToggleToString(out, getLightToggle(), kLightStr);
+    addBoolToString(out, _.Clean, kCleanStr);
+    addBoolToString(out, _.Turbo, kTurboStr);
+    addBoolToString(out, _.Quiet, kQuietStr);
+    addBoolToString(out, _.IFeel, kIFeelStr);
   }
   if (_.IFeel || _.SensorUpdate) {
-    result += addIntToString(getSensorTemp(), kSensorTempStr, !_.SensorUpdate);
-    result += 'C';
+    addIntToString(out, getSensorTemp(), kSensorTempStr, !_.SensorUpdate);
+    *out += 'C';
   }
-  return result;
 }
 
 #if DECODE_ELECTRA_AC
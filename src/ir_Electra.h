@@ -80,6 +80,8 @@ union ElectraProtocol {
 };
 
 // Constants
+const uint16_t kElectraAcHdrMark = 9166;
+const uint16_t kElectraAcHdrSpace = 4470;
 const uint8_t kElectraAcMinTemp = 16;   // 16C
 const uint8_t kElectraAcMaxTemp = 32;   // 32C
 const uint8_t kElectraAcTempDelta = 8;
@@ -163,6 +165,7 @@ class IRElectraAc {
   static uint8_t calcChecksum(const uint8_t state[],
                               const uint16_t length = kElectraAcStateLength);
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
   static uint8_t convertMode(const stdAc::opmode_t mode);
   static uint8_t convertFan(const stdAc::fanspeed_t speed);
   static stdAc::opmode_t toCommonMode(const uint8_t mode);
@@ -468,22 +468,29 @@ stdAc::state_t IREuromAc::toCommon(void) const {
 String IREuromAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(getMode(), 0xFF, kEuromCool,
-                            kEuromHeat, kEuromDehumidify, kEuromVentilate);
-  result += addTempToString(getTemp(), !getTempIsFahrenheit());
-  result += addFanToString(getFan(), kEuromFanHigh, kEuromFanLow,
-                           0xFF, 0xFF,
-                           kEuromFanMed);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
 
-  result += addBoolToString(getSwing(), kSwingVStr);
-  result += addBoolToString(getSleep(), kSleepStr);
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IREuromAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, getMode(), 0xFF, kEuromCool,
+                  kEuromHeat, kEuromDehumidify, kEuromVentilate);
+  addTempToString(out, getTemp(), !getTempIsFahrenheit());
+  addFanToString(out, getFan(), kEuromFanHigh, kEuromFanLow,
+                 0xFF, 0xFF,
+                 kEuromFanMed);
+
+  addBoolToString(out, getSwing(), kSwingVStr);
+  addBoolToString(out, getSleep(), kSleepStr);
 
   uint8_t off_timer_min = getOffTimer() * 60;
   uint8_t on_timer_min = getOnTimer() * 60;
   String off_timer_str = off_timer_min ? minsToString(off_timer_min) : kOffStr;
   String on_timer_str = on_timer_min ? minsToString(on_timer_min) : kOffStr;
-  result += addLabeledString(off_timer_str, kOffTimerStr);
-  result += addLabeledString(on_timer_str, kOnTimerStr);
-  return result;
+  addLabeledString(out, off_timer_str, kOffTimerStr);
+  addLabeledString(out, on_timer_str, kOnTimerStr);
 }
@@ -22,8 +22,6 @@
 
 // Ref:
 // These values are based on averages of measurements
-const uint16_t kFujitsuAcHdrMark = 3324;
-const uint16_t kFujitsuAcHdrSpace = 1574;
 const uint16_t kFujitsuAcBitMark = 448;
 const uint16_t kFujitsuAcOneSpace = 1182;
 const uint16_t kFujitsuAcZeroSpace = 390;
@@ -862,23 +860,31 @@ stdAc::state_t IRFujitsuAC::toCommon(const stdAc::state_t *prev) {
 String IRFujitsuAC::toString(void) const {
   String result = "";
   result.reserve(180);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRFujitsuAC::toString(IRtextWriter *out) const {
   fujitsu_ac_remote_model_t model = _model;
-  result += addModelToString(decode_type_t::FUJITSU_AC, model, false);
-  result += addIntToString(_.Id, kIdStr);
-  result += addBoolToString(getPower(), kPowerStr);
+  addModelToString(out, decode_type_t::FUJITSU_AC, model, false);
+  addIntToString(out, _.Id, kIdStr);
+  addBoolToString(out, getPower(), kPowerStr);
   if (_rawstatemodified || isLongCode()) {
-    result += addModeToString(_.Mode, kFujitsuAcModeAuto, kFujitsuAcModeCool,
-                              kFujitsuAcModeHeat, kFujitsuAcModeDry,
-                              kFujitsuAcModeFan);
+    addModeToString(out, _.Mode, kFujitsuAcModeAuto, kFujitsuAcModeCool,
+                    kFujitsuAcModeHeat, kFujitsuAcModeDry,
+                    kFujitsuAcModeFan);
     {
       const bool isCelsius = getCelsius();
       const float minHeat = isCelsius ? kFujitsuAcMinHeat : kFujitsuAcMinHeatF;
-      result += addTempFloatToString(get10CHeat() ? minHeat : getTemp(),
-                                     isCelsius);
+      addTempFloatToString(out, get10CHeat() ? minHeat : getTemp(),
+                           isCelsius);
     }
-    result += addFanToString(_.Fan, kFujitsuAcFanHigh, kFujitsuAcFanLow,
-                             kFujitsuAcFanAuto, kFujitsuAcFanQuiet,
-                             kFujitsuAcFanMed);
+    addFanToString(out, _.Fan, kFujitsuAcFanHigh, kFujitsuAcFanLow,
+                   kFujitsuAcFanAuto, kFujitsuAcFanQuiet,
+                   kFujitsuAcFanMed);
     switch (model) {
       // These models have no internal swing, clean. or filter state.
       case fujitsu_ac_remote_model_t::ARDB1:
@@ -888,81 +894,81 @@ String IRFujitsuAC::toString(void) const {
       case fujitsu_ac_remote_model_t::ARRAH2E:
       case fujitsu_ac_remote_model_t::ARREB1E:
       case fujitsu_ac_remote_model_t::ARRY4:
-        result += addBoolToString(getClean(), kCleanStr);
-        result += addBoolToString(getFilter(), kFilterStr);
+        addBoolToString(out, getClean(), kCleanStr);
+        addBoolToString(out, getFilter(), kFilterStr);
         // FALL THRU
       default:   // e.g. ARREW4E
         switch (model) {
           case fujitsu_ac_remote_model_t::ARRAH2E:
           case fujitsu_ac_remote_model_t::ARREW4E:
-            result += addBoolToString(get10CHeat(), k10CHeatStr);
+            addBoolToString(out, get10CHeat(), k10CHeatStr);
             break;
           default:
             break;
         }
-        result += addIntToString(_.Swing, kSwingStr);
-        result += kSpaceLBraceStr;
+        addIntToString(out, _.Swing, kSwingStr);
+        *out += kSpaceLBraceStr;
         switch (_.Swing) {
           case kFujitsuAcSwingOff:
-            result += kOffStr;
+            *out += kOffStr;
             break;
           case kFujitsuAcSwingVert:
-            result += kSwingVStr;
+            *out += kSwingVStr;
             break;
           case kFujitsuAcSwingHoriz:
-            result += kSwingHStr;
+            *out += kSwingHStr;
             break;
           case kFujitsuAcSwingBoth:
-            result += kSwingVStr;
-            result += '+';
-            result += kSwingHStr;
+            *out += kSwingVStr;
+            *out += '+';
+            *out += kSwingHStr;
             break;
           default:
-            result += kUnknownStr;
+            *out += kUnknownStr;
         }
-        result += ')';
+        *out += ')';
     }
   }
-  result += kCommaSpaceStr;
-  result += kCommandStr;
-  result += kColonSpaceStr;
+  *out += kCommaSpaceStr;
+  *out += kCommandStr;
+  *out += kColonSpaceStr;
   switch (_cmd) {
     case kFujitsuAcCmdStepHoriz:
-      result += kStepStr;
-      result += ' ';
-      result += kSwingHStr;
+      *out += kStepStr;
+      *out += ' ';
+      *out += kSwingHStr;
       break;
     case kFujitsuAcCmdStepVert:
-      result += kStepStr;
-      result += ' ';
-      result += kSwingVStr;
+      *out += kStepStr;
+      *out += ' ';
+      *out += kSwingVStr;
       break;
     case kFujitsuAcCmdToggleSwingHoriz:
-      result += kToggleStr;
-      result += ' ';
-      result += kSwingHStr;
+      *out += kToggleStr;
+      *out += ' ';
+      *out += kSwingHStr;
       break;
     case kFujitsuAcCmdToggleSwingVert:
-      result += kToggleStr;
-      result += ' ';
-      result += kSwingVStr;
+      *out += kToggleStr;
+      *out += ' ';
+      *out += kSwingVStr;
       break;
     case kFujitsuAcCmdEcono:
-      result += kEconoStr;
+      *out += kEconoStr;
       break;
     case kFujitsuAcCmdPowerful:
-      result += kPowerfulStr;
+      *out += kPowerfulStr;
       break;
     default:
-      result += kNAStr;
+      *out += kNAStr;
   }
   if (_rawstatemodified || isLongCode()) {
     uint16_t mins = 0;
-    String type_str = kTimerStr;
+    irtext_ptr_t type_str = kTimerStr;
     switch (model) {
       case fujitsu_ac_remote_model_t::ARREB1E:
       case fujitsu_ac_remote_model_t::ARREW4E:
-        result += addBoolToString(getOutsideQuiet(), kOutsideQuietStr);
+        addBoolToString(out, getOutsideQuiet(), kOutsideQuietStr);
         // FALL THRU
       // These models seem to have timer support.
       case fujitsu_ac_remote_model_t::ARRAH2E:
@@ -980,14 +986,15 @@ String IRFujitsuAC::toString(void) const {
             mins = getOffSleepTimer();
             break;
         }
-        result += addLabeledString(mins ? minsToString(mins) : kOffStr,
-                                   type_str);
+        if (mins)
+          addLabeledString(out, minsToString(mins), type_str);
+        else
+          addLabeledString(out, kOffStr, type_str);
         break;
       default:
         break;
     }
   }
-  return result;
 }
 
 #if DECODE_FUJITSU_AC
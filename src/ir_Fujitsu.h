@@ -112,6 +112,8 @@ union FujitsuProtocol {
 };
 
 // Constants
+const uint16_t kFujitsuAcHdrMark = 3324;
+const uint16_t kFujitsuAcHdrSpace = 1574;
 const uint8_t kFujitsuAcModeAuto =  0x0;  // 0b000
 const uint8_t kFujitsuAcModeCool =  0x1;  // 0b001
 const uint8_t kFujitsuAcModeDry =   0x2;  // 0b010
@@ -244,6 +246,7 @@ class IRFujitsuAC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL);
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
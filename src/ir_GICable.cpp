@@ -14,10 +14,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_GICable.h"
 
 // Constants
-const uint16_t kGicableHdrMark = 9000;
-const uint16_t kGicableHdrSpace = 4400;
 const uint16_t kGicableBitMark = 550;
 const uint16_t kGicableOneSpace = 4400;
 const uint16_t kGicableZeroSpace = 2200;
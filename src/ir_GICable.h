@@ -0,0 +1,16 @@
+// Copyright 2018 David Conran
+
+/// @file
+/// @brief G.I. Cable
+
+#ifndef IR_GICABLE_H_
+#define IR_GICABLE_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kGicableHdrMark = 9000;
+const uint16_t kGicableHdrSpace = 4400;
+
+#endif  // IR_GICABLE_H_
@@ -340,77 +340,84 @@ stdAc::state_t IRGoodweatherAc::toCommon(void) const {
 String IRGoodweatherAc::toString(void) const {
   String result = "";
   result.reserve(150);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kGoodweatherAuto, kGoodweatherCool,
-                            kGoodweatherHeat, kGoodweatherDry, kGoodweatherFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kGoodweatherFanHigh, kGoodweatherFanLow,
-                           kGoodweatherFanAuto, kGoodweatherFanAuto,
-                           kGoodweatherFanMed);
-
-  result += addToggleToString(_.Turbo, kTurboStr);
-  result += addToggleToString(_.Light, kLightStr);
-  result += addToggleToString(_.Sleep, kSleepStr);
-  result += addIntToString(_.Swing, kSwingStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRGoodweatherAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kGoodweatherAuto, kGoodweatherCool,
+                  kGoodweatherHeat, kGoodweatherDry, kGoodweatherFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kGoodweatherFanHigh, kGoodweatherFanLow,
+                 kGoodweatherFanAuto, kGoodweatherFanAuto,
+                 kGoodweatherFanMed);
+
+  addToggleToString(out, _.Turbo, kTurboStr);
+  addToggleToString(out, _.Light, kLightStr);
+  addToggleToString(out, _.Sleep, kSleepStr);
+  addIntToString(out, _.Swing, kSwingStr);
+  *out += kSpaceLBraceStr;
   switch (_.Swing) {
     case kGoodweatherSwingFast:
-      result += kFastStr;
+      *out += kFastStr;
       break;
     case kGoodweatherSwingSlow:
-      result += kSlowStr;
+      *out += kSlowStr;
       break;
     case kGoodweatherSwingOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addIntToString(_.Command, kCommandStr);
-  result += kSpaceLBraceStr;
+  *out += ')';
+  addIntToString(out, _.Command, kCommandStr);
+  *out += kSpaceLBraceStr;
   switch (_.Command) {
     case kGoodweatherCmdPower:
-      result += kPowerStr;
+      *out += kPowerStr;
       break;
     case kGoodweatherCmdMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kGoodweatherCmdUpTemp:
-      result += kTempUpStr;
+      *out += kTempUpStr;
       break;
     case kGoodweatherCmdDownTemp:
-      result += kTempDownStr;
+      *out += kTempDownStr;
       break;
     case kGoodweatherCmdSwing:
-      result += kSwingStr;
+      *out += kSwingStr;
       break;
     case kGoodweatherCmdFan:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kGoodweatherCmdTimer:
-      result += kTimerStr;
+      *out += kTimerStr;
       break;
     case kGoodweatherCmdAirFlow:
-      result += kAirFlowStr;
+      *out += kAirFlowStr;
       break;
     case kGoodweatherCmdHold:
-      result += kHoldStr;
+      *out += kHoldStr;
       break;
     case kGoodweatherCmdSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kGoodweatherCmdTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     case kGoodweatherCmdLight:
-      result += kLightStr;
+      *out += kLightStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 #if DECODE_GOODWEATHER
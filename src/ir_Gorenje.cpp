@@ -10,11 +10,11 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Gorenje.h"
 
 const uint32_t kGorenjeMinGap = 100000U;  // 0.1s
 const uint16_t kGorenjeHdrMark = 0;
 const uint32_t kGorenjeHdrSpace = 0;
-const uint16_t kGorenjeBitMark = 1300;
 const uint32_t kGorenjeOneSpace = 5700;
 const uint32_t kGorenjeZeroSpace = 1700;
 const uint16_t kGorenjeFreq = 38000;  // Hz
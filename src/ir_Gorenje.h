@@ -0,0 +1,15 @@
+// Copyright 2022 Mateusz Bronk (mbronk)
+
+/// @file
+/// @brief Support for the Gorenje cooker hood IR protocols.
+
+#ifndef IR_GORENJE_H_
+#define IR_GORENJE_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kGorenjeBitMark = 1300;
+
+#endif  // IR_GORENJE_H_
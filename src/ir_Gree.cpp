@@ -20,8 +20,6 @@
 #include "ir_Kelvinator.h"
 
 // Constants
-const uint16_t kGreeHdrMark = 9000;
-const uint16_t kGreeHdrSpace = 4500;  ///< See #684 & real example in unit tests
 const uint16_t kGreeBitMark = 620;
 const uint16_t kGreeOneSpace = 1600;
 const uint16_t kGreeZeroSpace = 540;
@@ -619,69 +617,76 @@ stdAc::state_t IRGreeAC::toCommon(void) {
 String IRGreeAC::toString(void) {
   String result = "";
   result.reserve(220);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::GREE, _model, false);
-  result += addBoolToString(_.Power, kPowerStr);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRGreeAC::toString(IRtextWriter *out) {
+  addModelToString(out, decode_type_t::GREE, _model, false);
+  addBoolToString(out, _.Power, kPowerStr);
   if (_model == gree_ac_remote_model_t::YX1FSF && _.Mode == kGreeEcono) {
-    result += addIntToString(_.Mode, kModeStr);
-    result += kSpaceLBraceStr;
-    result += kEconoStr;
-    result += ')';
+    addIntToString(out, _.Mode, kModeStr);
+    *out += kSpaceLBraceStr;
+    *out += kEconoStr;
+    *out += ')';
   } else {
-    result += addModeToString(_.Mode, kGreeAuto, kGreeCool, kGreeHeat,
-                              kGreeDry, kGreeFan);
+    addModeToString(out, _.Mode, kGreeAuto, kGreeCool, kGreeHeat,
+                    kGreeDry, kGreeFan);
   }
-  result += addTempToString(getTemp(), !_.UseFahrenheit);
-  result += addFanToString(_.Fan, kGreeFanMax, kGreeFanMin, kGreeFanAuto,
-                           kGreeFanAuto, kGreeFanMed);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addBoolToString(_.IFeel, kIFeelStr);
-  result += addBoolToString(_.WiFi, kWifiStr);
-  result += addBoolToString(_.Xfan, kXFanStr);
-  result += addBoolToString(_.Light, kLightStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addLabeledString(_.SwingAuto ? kAutoStr : kManualStr,
-                             kSwingVModeStr);
-  result += addIntToString(_.SwingV, kSwingVStr);
-  result += kSpaceLBraceStr;
+  addTempToString(out, getTemp(), !_.UseFahrenheit);
+  addFanToString(out, _.Fan, kGreeFanMax, kGreeFanMin, kGreeFanAuto,
+                 kGreeFanAuto, kGreeFanMed);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addBoolToString(out, _.IFeel, kIFeelStr);
+  addBoolToString(out, _.WiFi, kWifiStr);
+  addBoolToString(out, _.Xfan, kXFanStr);
+  addBoolToString(out, _.Light, kLightStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addLabeledString(out, _.SwingAuto ? kAutoStr : kManualStr,
+                   kSwingVModeStr);
+  addIntToString(out, _.SwingV, kSwingVStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingV) {
     case kGreeSwingLastPos:
-      result += kLastStr;
+      *out += kLastStr;
       break;
     case kGreeSwingAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
-    default: result += kUnknownStr;
+    default: *out += kUnknownStr;
   }
-  result += ')';
-  result += addSwingHToString(_.SwingH, kGreeSwingHAuto, kGreeSwingHMaxLeft,
-                              kGreeSwingHLeft, kGreeSwingHMiddle,
-                              kGreeSwingHRight, kGreeSwingHMaxRight,
-                              kGreeSwingHOff,
-                              // rest are unused.
-                              0xFF, 0xFF, 0xFF, 0xFF);
-  result += addLabeledString(
+  *out += ')';
+  addSwingHToString(out, _.SwingH, kGreeSwingHAuto, kGreeSwingHMaxLeft,
+                    kGreeSwingHLeft, kGreeSwingHMiddle,
+                    kGreeSwingHRight, kGreeSwingHMaxRight,
+                    kGreeSwingHOff,
+                    // rest are unused.
+                    0xFF, 0xFF, 0xFF, 0xFF);
+  addLabeledString(out,
       _.TimerEnabled ? minsToString(getTimer()) : kOffStr, kTimerStr);
   uint8_t src = _.DisplayTemp;
-  result += addIntToString(src, kDisplayTempStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, src, kDisplayTempStr);
+  *out += kSpaceLBraceStr;
   switch (src) {
     case kGreeDisplayTempOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kGreeDisplayTempSet:
-      result += kSetStr;
+      *out += kSetStr;
       break;
     case kGreeDisplayTempInside:
-      result += kInsideStr;
+      *out += kInsideStr;
       break;
     case kGreeDisplayTempOutside:
-      result += kOutsideStr;
+      *out += kOutsideStr;
       break;
-    default: result += kUnknownStr;
+    default: *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 #if DECODE_GREE
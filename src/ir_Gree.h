@@ -88,6 +88,8 @@ union GreeProtocol{
 };
 
 // Constants
+const uint16_t kGreeHdrMark = 9000;
+const uint16_t kGreeHdrSpace = 4500;  ///< See #684 & real example in unit tests
 
 const uint8_t kGreeAuto  = 0;
 const uint8_t kGreeCool  = 1;
@@ -220,6 +222,7 @@ class IRGreeAC {
   static bool validChecksum(const uint8_t state[],
                             const uint16_t length = kGreeStateLength);
   String toString(void);
+  void toString(IRtextWriter *out);
 #ifndef UNIT_TEST
 
  private:
@@ -21,7 +21,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kHaierAcHdr = 3000;
 const uint16_t kHaierAcHdrGap = 4300;
 const uint16_t kHaierAcBitMark = 520;
 const uint16_t kHaierAcOneSpace = 1650;
@@ -468,84 +467,91 @@ stdAc::state_t IRHaierAC::toCommon(void) const {
 String IRHaierAC::toString(void) const {
   String result = "";
   result.reserve(170);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHaierAC::toString(IRtextWriter *out) const {
   uint8_t cmd = _.Command;
-  result += addIntToString(cmd, kCommandStr, false);
-  result += kSpaceLBraceStr;
+  addIntToString(out, cmd, kCommandStr, false);
+  *out += kSpaceLBraceStr;
   switch (cmd) {
     case kHaierAcCmdOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kHaierAcCmdOn:
-      result += kOnStr;
+      *out += kOnStr;
       break;
     case kHaierAcCmdMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kHaierAcCmdFan:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kHaierAcCmdTempUp:
-      result += kTempUpStr;
+      *out += kTempUpStr;
       break;
     case kHaierAcCmdTempDown:
-      result += kTempDownStr;
+      *out += kTempDownStr;
       break;
     case kHaierAcCmdSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kHaierAcCmdTimerSet:
-      result += kTimerStr;
-      result += ' ';
-      result += kSetStr;
+      *out += kTimerStr;
+      *out += ' ';
+      *out += kSetStr;
       break;
     case kHaierAcCmdTimerCancel:
-      result += kTimerStr;
-      result += ' ';
-      result += kCancelStr;
+      *out += kTimerStr;
+      *out += ' ';
+      *out += kCancelStr;
       break;
     case kHaierAcCmdHealth:
-      result += kHealthStr;
+      *out += kHealthStr;
       break;
     case kHaierAcCmdSwing:
-      result += kSwingVStr;
+      *out += kSwingVStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addModeToString(_.Mode, kHaierAcAuto, kHaierAcCool, kHaierAcHeat,
-                            kHaierAcDry, kHaierAcFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kHaierAcFanHigh, kHaierAcFanLow,
-                           kHaierAcFanAuto, kHaierAcFanAuto, kHaierAcFanMed);
-  result += addIntToString(_.SwingV, kSwingVStr);
-  result += kSpaceLBraceStr;
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addModeToString(out, _.Mode, kHaierAcAuto, kHaierAcCool, kHaierAcHeat,
+                  kHaierAcDry, kHaierAcFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kHaierAcFanHigh, kHaierAcFanLow,
+                 kHaierAcFanAuto, kHaierAcFanAuto, kHaierAcFanMed);
+  addIntToString(out, _.SwingV, kSwingVStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingV) {
     case kHaierAcSwingVOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kHaierAcSwingVUp:
-      result += kUpStr;
+      *out += kUpStr;
       break;
     case kHaierAcSwingVDown:
-      result += kDownStr;
+      *out += kDownStr;
       break;
     case kHaierAcSwingVChg:
-      result += kChangeStr;
+      *out += kChangeStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Health, kHealthStr);
-  result += addLabeledString(minsToString(getCurrTime()), kClockStr);
-  result += addLabeledString(
+  *out += ')';
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Health, kHealthStr);
+  addLabeledString(out, minsToString(getCurrTime()), kClockStr);
+  addLabeledString(out,
       getOnTimer() >= 0 ? minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       getOffTimer() >= 0 ? minsToString(getOffTimer()) : kOffStr,
       kOffTimerStr);
-  return result;
 }
 // End of IRHaierAC class.
 
@@ -1173,138 +1179,145 @@ stdAc::state_t IRHaierAC176::toCommon(void) const {
 String IRHaierAC176::toString(void) const {
   String result = "";
   result.reserve(280);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::HAIER_AC176, getModel(), false);
-  result += addBoolToString(_.Power, kPowerStr);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHaierAC176::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::HAIER_AC176, getModel(), false);
+  addBoolToString(out, _.Power, kPowerStr);
   uint8_t cmd = _.Button;
-  result += addIntToString(cmd, kButtonStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, cmd, kButtonStr);
+  *out += kSpaceLBraceStr;
   switch (cmd) {
     case kHaierAcYrw02ButtonPower:
-      result += kPowerStr;
+      *out += kPowerStr;
       break;
     case kHaierAcYrw02ButtonMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kHaierAcYrw02ButtonFan:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kHaierAcYrw02ButtonTempUp:
-      result += kTempUpStr;
+      *out += kTempUpStr;
       break;
     case kHaierAcYrw02ButtonTempDown:
-      result += kTempDownStr;
+      *out += kTempDownStr;
       break;
     case kHaierAcYrw02ButtonSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kHaierAcYrw02ButtonHealth:
-      result += kHealthStr;
+      *out += kHealthStr;
       break;
     case kHaierAcYrw02ButtonSwingV:
-      result += kSwingVStr;
+      *out += kSwingVStr;
       break;
     case kHaierAcYrw02ButtonSwingH:
-      result += kSwingHStr;
+      *out += kSwingHStr;
       break;
     case kHaierAcYrw02ButtonTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     case kHaierAcYrw02ButtonTimer:
-      result += kTimerStr;
+      *out += kTimerStr;
       break;
     case kHaierAcYrw02ButtonLock:
-      result += kLockStr;
+      *out += kLockStr;
       break;
     case kHaierAcYrw02ButtonCFAB:
-      result += kCelsiusFahrenheitStr;
+      *out += kCelsiusFahrenheitStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addModeToString(_.Mode, kHaierAcYrw02Auto, kHaierAcYrw02Cool,
-                            kHaierAcYrw02Heat, kHaierAcYrw02Dry,
-                            kHaierAcYrw02Fan);
-  result += addTempToString(getTemp(), !_.UseFahrenheit);
-  result += addFanToString(_.Fan, kHaierAcYrw02FanHigh, kHaierAcYrw02FanLow,
-                           kHaierAcYrw02FanAuto, kHaierAcYrw02FanAuto,
-                           kHaierAcYrw02FanMed);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addIntToString(_.SwingV, kSwingVStr);
-  result += kSpaceLBraceStr;
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addModeToString(out, _.Mode, kHaierAcYrw02Auto, kHaierAcYrw02Cool,
+                  kHaierAcYrw02Heat, kHaierAcYrw02Dry,
+                  kHaierAcYrw02Fan);
+  addTempToString(out, getTemp(), !_.UseFahrenheit);
+  addFanToString(out, _.Fan, kHaierAcYrw02FanHigh, kHaierAcYrw02FanLow,
+                 kHaierAcYrw02FanAuto, kHaierAcYrw02FanAuto,
+                 kHaierAcYrw02FanMed);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addIntToString(out, _.SwingV, kSwingVStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingV) {
     case kHaierAcYrw02SwingVOff:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kHaierAcYrw02SwingVAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kHaierAcYrw02SwingVBottom:
-      result += kLowestStr;
+      *out += kLowestStr;
       break;
     case kHaierAcYrw02SwingVDown:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kHaierAcYrw02SwingVTop:
-      result += kHighestStr;
+      *out += kHighestStr;
       break;
     case kHaierAcYrw02SwingVMiddle:
-      result += kMiddleStr;
+      *out += kMiddleStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addSwingHToString(_.SwingH, kHaierAcYrw02SwingHAuto,
-                              kHaierAcYrw02SwingHLeftMax,
-                              kHaierAcYrw02SwingHLeft,
-                              kHaierAcYrw02SwingHMiddle,
-                              kHaierAcYrw02SwingHRight,
-                              kHaierAcYrw02SwingHRightMax,
-                              // Below are unused.
-                              kHaierAcYrw02SwingHMiddle,
-                              kHaierAcYrw02SwingHMiddle,
-                              kHaierAcYrw02SwingHMiddle,
-                              kHaierAcYrw02SwingHMiddle,
-                              kHaierAcYrw02SwingHMiddle);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Health, kHealthStr);
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addSwingHToString(out, _.SwingH, kHaierAcYrw02SwingHAuto,
+                    kHaierAcYrw02SwingHLeftMax,
+                    kHaierAcYrw02SwingHLeft,
+                    kHaierAcYrw02SwingHMiddle,
+                    kHaierAcYrw02SwingHRight,
+                    kHaierAcYrw02SwingHRightMax,
+                    // Below are unused.
+                    kHaierAcYrw02SwingHMiddle,
+                    kHaierAcYrw02SwingHMiddle,
+                    kHaierAcYrw02SwingHMiddle,
+                    kHaierAcYrw02SwingHMiddle,
+                    kHaierAcYrw02SwingHMiddle);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Health, kHealthStr);
   const uint8_t tmode = getTimerMode();
-  result += addIntToString(tmode, kTimerModeStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, tmode, kTimerModeStr);
+  *out += kSpaceLBraceStr;
   switch (tmode) {
     case kHaierAcYrw02NoTimers:
-      result += kNAStr;
+      *out += kNAStr;
       break;
     case kHaierAcYrw02OnTimer:
-      result += kOnStr;
+      *out += kOnStr;
       break;
     case kHaierAcYrw02OffTimer:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kHaierAcYrw02OnThenOffTimer:
-      result += kOnStr;
-      result += '-';
-      result += kOffStr;
+      *out += kOnStr;
+      *out += '-';
+      *out += kOffStr;
       break;
     case kHaierAcYrw02OffThenOnTimer:
-      result += kOffStr;
-      result += '-';
-      result += kOnStr;
+      *out += kOffStr;
+      *out += '-';
+      *out += kOnStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addLabeledString((tmode != kHaierAcYrw02NoTimers &&
-                              tmode != kHaierAcYrw02OffTimer) ?
-      minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString((tmode != kHaierAcYrw02NoTimers &&
-                              tmode != kHaierAcYrw02OnTimer) ?
-      minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
-  result += addBoolToString(_.Lock, kLockStr);
-  return result;
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addLabeledString(out, (tmode != kHaierAcYrw02NoTimers &&
+                    tmode != kHaierAcYrw02OffTimer) ?
+    minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
+  addLabeledString(out, (tmode != kHaierAcYrw02NoTimers &&
+                    tmode != kHaierAcYrw02OnTimer) ?
+    minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
+  addBoolToString(out, _.Lock, kLockStr);
 }
 // End of IRHaierAC176 class.
 
@@ -2056,124 +2069,131 @@ stdAc::state_t IRHaierAC160::toCommon(const stdAc::state_t *prev) const {
 String IRHaierAC160::toString(void) const {
   String result = "";
   result.reserve(280);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHaierAC160::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
   uint8_t cmd = _.Button;
-  result += addIntToString(cmd, kButtonStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, cmd, kButtonStr);
+  *out += kSpaceLBraceStr;
   switch (cmd) {
     case kHaierAcYrw02ButtonPower:
-      result += kPowerStr;
+      *out += kPowerStr;
       break;
     case kHaierAcYrw02ButtonMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kHaierAcYrw02ButtonFan:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kHaierAcYrw02ButtonTempUp:
-      result += kTempUpStr;
+      *out += kTempUpStr;
       break;
     case kHaierAcYrw02ButtonTempDown:
-      result += kTempDownStr;
+      *out += kTempDownStr;
       break;
     case kHaierAcYrw02ButtonSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kHaierAcYrw02ButtonHealth:
-      result += kHealthStr;
+      *out += kHealthStr;
       break;
     case kHaierAcYrw02ButtonSwingV:
-      result += kSwingVStr;
+      *out += kSwingVStr;
       break;
     case kHaierAcYrw02ButtonSwingH:
-      result += kSwingHStr;
+      *out += kSwingHStr;
       break;
     case kHaierAcYrw02ButtonTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     case kHaierAcYrw02ButtonTimer:
-      result += kTimerStr;
+      *out += kTimerStr;
       break;
     case kHaierAcYrw02ButtonLock:
-      result += kLockStr;
+      *out += kLockStr;
       break;
     case kHaierAc160ButtonClean:
-      result += kCleanStr;
+      *out += kCleanStr;
       break;
     case kHaierAc160ButtonLight:
-      result += kLightStr;
+      *out += kLightStr;
       break;
     case kHaierAc160ButtonAuxHeating:
-      result += kHeatingStr;
+      *out += kHeatingStr;
       break;
     case kHaierAcYrw02ButtonCFAB:
-      result += kCelsiusFahrenheitStr;
+      *out += kCelsiusFahrenheitStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addModeToString(_.Mode, kHaierAcYrw02Auto, kHaierAcYrw02Cool,
-                            kHaierAcYrw02Heat, kHaierAcYrw02Dry,
-                            kHaierAcYrw02Fan);
-  result += addTempToString(getTemp(), !_.UseFahrenheit);
-  result += addFanToString(_.Fan, kHaierAcYrw02FanHigh, kHaierAcYrw02FanLow,
-                           kHaierAcYrw02FanAuto, kHaierAcYrw02FanAuto,
-                           kHaierAcYrw02FanMed);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(_.Health, kHealthStr);
-  result += addIntToString(_.SwingV, kSwingVStr);
-  result += kSpaceLBraceStr;
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addModeToString(out, _.Mode, kHaierAcYrw02Auto, kHaierAcYrw02Cool,
+                  kHaierAcYrw02Heat, kHaierAcYrw02Dry,
+                  kHaierAcYrw02Fan);
+  addTempToString(out, getTemp(), !_.UseFahrenheit);
+  addFanToString(out, _.Fan, kHaierAcYrw02FanHigh, kHaierAcYrw02FanLow,
+                 kHaierAcYrw02FanAuto, kHaierAcYrw02FanAuto,
+                 kHaierAcYrw02FanMed);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, _.Health, kHealthStr);
+  addIntToString(out, _.SwingV, kSwingVStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingV) {
-    case kHaierAc160SwingVOff:     result += kOffStr;     break;
-    case kHaierAc160SwingVAuto:    result += kAutoStr;    break;
-    case kHaierAc160SwingVTop:     result += kTopStr;     break;
-    case kHaierAc160SwingVHighest: result += kHighestStr; break;
-    case kHaierAc160SwingVHigh:    result += kHighStr;    break;
-    case kHaierAc160SwingVMiddle:  result += kMiddleStr;  break;
-    case kHaierAc160SwingVLow:     result += kLowStr;     break;
-    case kHaierAc160SwingVLowest:  result += kLowestStr;  break;
-    default:                       result += kUnknownStr;
-  }
-  result += ')';
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(getClean(), kCleanStr);
+    case kHaierAc160SwingVOff:     *out += kOffStr;     break;
+    case kHaierAc160SwingVAuto:    *out += kAutoStr;    break;
+    case kHaierAc160SwingVTop:     *out += kTopStr;     break;
+    case kHaierAc160SwingVHighest: *out += kHighestStr; break;
+    case kHaierAc160SwingVHigh:    *out += kHighStr;    break;
+    case kHaierAc160SwingVMiddle:  *out += kMiddleStr;  break;
+    case kHaierAc160SwingVLow:     *out += kLowStr;     break;
+    case kHaierAc160SwingVLowest:  *out += kLowestStr;  break;
+    default:                       *out += kUnknownStr;
+  }
+  *out += ')';
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, getClean(), kCleanStr);
   const uint8_t tmode = getTimerMode();
-  result += addIntToString(tmode, kTimerModeStr);
-  result += kSpaceLBraceStr;
+  addIntToString(out, tmode, kTimerModeStr);
+  *out += kSpaceLBraceStr;
   switch (tmode) {
     case kHaierAcYrw02NoTimers:
-      result += kNAStr;
+      *out += kNAStr;
       break;
     case kHaierAcYrw02OnTimer:
-      result += kOnStr;
+      *out += kOnStr;
       break;
     case kHaierAcYrw02OffTimer:
-      result += kOffStr;
+      *out += kOffStr;
       break;
     case kHaierAcYrw02OnThenOffTimer:
-      result += kOnStr;
-      result += '-';
-      result += kOffStr;
+      *out += kOnStr;
+      *out += '-';
+      *out += kOffStr;
       break;
     case kHaierAcYrw02OffThenOnTimer:
-      result += kOffStr;
-      result += '-';
-      result += kOnStr;
+      *out += kOffStr;
+      *out += '-';
+      *out += kOnStr;
       break;
     default:
-      result += kUnknownStr;
-  }
-  result += ')';
-  result += addLabeledString((tmode != kHaierAcYrw02NoTimers &&
-                              tmode != kHaierAcYrw02OffTimer) ?
-      minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString((tmode != kHaierAcYrw02NoTimers &&
-                              tmode != kHaierAcYrw02OnTimer) ?
-      minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
-  result += addBoolToString(_.Lock, kLockStr);
-  result += addBoolToString(_.AuxHeating, kHeatingStr);
-  return result;
+      *out += kUnknownStr;
+  }
+  *out += ')';
+  addLabeledString(out, (tmode != kHaierAcYrw02NoTimers &&
+                    tmode != kHaierAcYrw02OffTimer) ?
+    minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
+  addLabeledString(out, (tmode != kHaierAcYrw02NoTimers &&
+                    tmode != kHaierAcYrw02OnTimer) ?
+    minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
+  addBoolToString(out, _.Lock, kLockStr);
+  addBoolToString(out, _.AuxHeating, kHeatingStr);
 }
 // End of IRHaierAC160 class.
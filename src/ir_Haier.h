@@ -70,6 +70,7 @@ union HaierProtocol{
 };
 
 // Constants
+const uint16_t kHaierAcHdr = 3000;
 
 const uint8_t kHaierAcPrefix = 0b10100101;
 
@@ -429,6 +430,7 @@ class IRHaierAC {
   static stdAc::swingv_t toCommonSwingV(const uint8_t pos);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -527,6 +529,7 @@ class IRHaierAC176 {
   static bool toCommonQuiet(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -638,6 +641,7 @@ class IRHaierAC160 {
   static bool toCommonQuiet(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
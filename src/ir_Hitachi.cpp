@@ -22,17 +22,11 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kHitachiAcHdrMark = 3300;
-const uint16_t kHitachiAcHdrSpace = 1700;
-const uint16_t kHitachiAc1HdrMark = 3400;
-const uint16_t kHitachiAc1HdrSpace = 3400;
 const uint16_t kHitachiAcBitMark = 400;
 const uint16_t kHitachiAcOneSpace = 1250;
 const uint16_t kHitachiAcZeroSpace = 500;
 const uint32_t kHitachiAcMinGap = kDefaultMessageGap;  // Just a guess.
 // Support for HitachiAc424 protocol
-const uint16_t kHitachiAc424LdrMark = 29784;   // Leader
-const uint16_t kHitachiAc424LdrSpace = 49290;  // Leader
 const uint16_t kHitachiAc424HdrMark = 3416;    // Header
 const uint16_t kHitachiAc424HdrSpace = 1604;   // Header
 const uint16_t kHitachiAc424BitMark = 463;
@@ -40,8 +34,6 @@ const uint16_t kHitachiAc424OneSpace = 1208;
 const uint16_t kHitachiAc424ZeroSpace = 372;
 
 // Support for HitachiAc3 protocol
-const uint16_t kHitachiAc3HdrMark = 3400;    // Header
-const uint16_t kHitachiAc3HdrSpace = 1660;   // Header
 const uint16_t kHitachiAc3BitMark = 460;
 const uint16_t kHitachiAc3OneSpace = 1250;
 const uint16_t kHitachiAc3ZeroSpace = 410;
@@ -411,18 +403,25 @@ stdAc::state_t IRHitachiAc::toCommon(void) const {
 String IRHitachiAc::toString(void) const {
   String result = "";
   result.reserve(110);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(getMode(), kHitachiAcAuto, kHitachiAcCool,
-                            kHitachiAcHeat, kHitachiAcDry, kHitachiAcFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kHitachiAcFanHigh, kHitachiAcFanLow,
-                           kHitachiAcFanAuto, kHitachiAcFanAuto,
-                           kHitachiAcFanMed);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.SwingH, kSwingHStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, getMode(), kHitachiAcAuto, kHitachiAcCool,
+                  kHitachiAcHeat, kHitachiAcDry, kHitachiAcFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kHitachiAcFanHigh, kHitachiAcFanLow,
+                 kHitachiAcFanAuto, kHitachiAcFanAuto,
+                 kHitachiAcFanMed);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+}
+
 /// Class constructor
 /// @param[in] pin GPIO to be used when sending.
 /// @param[in] inverted Is the output signal to be inverted?
@@ -813,29 +812,36 @@ stdAc::state_t IRHitachiAc1::toCommon(void) const {
 String IRHitachiAc1::toString(void) const {
   String result = "";
   result.reserve(170);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::HITACHI_AC1, getModel(), false);
-  result += addBoolToString(_.Power, kPowerStr);
-  result += addBoolToString(_.PowerToggle, kPowerToggleStr);
-  result += addModeToString(_.Mode, kHitachiAc1Auto, kHitachiAc1Cool,
-                            kHitachiAc1Heat, kHitachiAc1Dry, kHitachiAc1Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kHitachiAc1FanHigh, kHitachiAc1FanLow,
-                           kHitachiAc1FanAuto, kHitachiAc1FanAuto,
-                           kHitachiAc1FanMed);
-  result += addBoolToString(_.SwingToggle, kSwingVToggleStr);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.SwingH, kSwingHStr);
-  result += addLabeledString(_.Sleep ? uint64ToString(_.Sleep) : kOffStr,
-                             kSleepStr);
-  result += addLabeledString(getOnTimer() ? minsToString(getOnTimer())
-                                          : kOffStr,
-                            kOnTimerStr);
-  result += addLabeledString(getOffTimer() ? minsToString(getOffTimer())
-                                           : kOffStr,
-                            kOffTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc1::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::HITACHI_AC1, getModel(), false);
+  addBoolToString(out, _.Power, kPowerStr);
+  addBoolToString(out, _.PowerToggle, kPowerToggleStr);
+  addModeToString(out, _.Mode, kHitachiAc1Auto, kHitachiAc1Cool,
+                  kHitachiAc1Heat, kHitachiAc1Dry, kHitachiAc1Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kHitachiAc1FanHigh, kHitachiAc1FanLow,
+                 kHitachiAc1FanAuto, kHitachiAc1FanAuto,
+                 kHitachiAc1FanMed);
+  addBoolToString(out, _.SwingToggle, kSwingVToggleStr);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+  addLabeledString(out, _.Sleep ? uint64ToString(_.Sleep) : kOffStr,
+                   kSleepStr);
+  addLabeledString(out, getOnTimer() ? minsToString(getOnTimer())
+                                : kOffStr,
+                  kOnTimerStr);
+  addLabeledString(out, getOffTimer() ? minsToString(getOffTimer())
+                                 : kOffStr,
+                  kOffTimerStr);
+}
+
 #if (DECODE_HITACHI_AC || DECODE_HITACHI_AC1 || DECODE_HITACHI_AC2 || \
      DECODE_HITACHI_AC344 || DECODE_HITACHI_AC264)
 /// Decode the supplied Hitachi A/C message.
@@ -1286,52 +1292,59 @@ stdAc::state_t IRHitachiAc424::toCommon(void) const {
   return result;
 }
 
-/// Convert the internal state into a human readable string for the settings
+/// Write the current internal state as human readable text, for the settings
 /// that are common to protocols of this nature.
-/// @return A string containing the common settings in human-readable form.
-String IRHitachiAc424::_toString(void) const {
-  String result = "";
-  result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, 0, kHitachiAc424Cool,
-                            kHitachiAc424Heat, kHitachiAc424Dry,
-                            kHitachiAc424Fan);
-  result += addTempToString(_.Temp);
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+/// @param[out] out Where to write the text.
+void IRHitachiAc424::_toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, 0, kHitachiAc424Cool,
+                  kHitachiAc424Heat, kHitachiAc424Dry, kHitachiAc424Fan);
+  addTempToString(out, _.Temp);
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
-    case kHitachiAc424FanAuto:   result += kAutoStr; break;
-    case kHitachiAc424FanMax:    result += kMaxStr; break;
-    case kHitachiAc424FanHigh:   result += kHighStr; break;
-    case kHitachiAc424FanMedium: result += kMedStr; break;
-    case kHitachiAc424FanLow:    result += kLowStr; break;
-    case kHitachiAc424FanMin:    result += kMinStr; break;
-    default:                     result += kUnknownStr;
+    case kHitachiAc424FanAuto:   *out += kAutoStr; break;
+    case kHitachiAc424FanMax:    *out += kMaxStr; break;
+    case kHitachiAc424FanHigh:   *out += kHighStr; break;
+    case kHitachiAc424FanMedium: *out += kMedStr; break;
+    case kHitachiAc424FanLow:    *out += kLowStr; break;
+    case kHitachiAc424FanMin:    *out += kMinStr; break;
+    default:                     *out += kUnknownStr;
   }
-  result += ')';
-  result += addIntToString(_.Button, kButtonStr);
-  result += kSpaceLBraceStr;
+  *out += ')';
+  addIntToString(out, _.Button, kButtonStr);
+  *out += kSpaceLBraceStr;
   switch (_.Button) {
     case kHitachiAc424ButtonPowerMode:
-      result += kPowerStr;
-      result += '/';
-      result += kModeStr;
+      *out += kPowerStr;
+      *out += '/';
+      *out += kModeStr;
       break;
-    case kHitachiAc424ButtonFan:      result += kFanStr; break;
-    case kHitachiAc424ButtonSwingV:   result += kSwingVStr; break;
-    case kHitachiAc344ButtonSwingH:   result += kSwingHStr; break;
-    case kHitachiAc424ButtonTempDown: result += kTempDownStr; break;
-    case kHitachiAc424ButtonTempUp:   result += kTempUpStr; break;
-    default: result += kUnknownStr;
+    case kHitachiAc424ButtonFan:      *out += kFanStr; break;
+    case kHitachiAc424ButtonSwingV:   *out += kSwingVStr; break;
+    case kHitachiAc344ButtonSwingH:   *out += kSwingHStr; break;
+    case kHitachiAc424ButtonTempDown: *out += kTempDownStr; break;
+    case kHitachiAc424ButtonTempUp:   *out += kTempUpStr; break;
+    default: *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 /// Convert the internal state into a human readable string.
 /// @return A string containing the settings in human-readable form.
 String IRHitachiAc424::toString(void) const {
-  return _toString() + addBoolToString(getSwingVToggle(), kSwingVToggleStr);
+  String result = "";
+  result.reserve(100);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc424::toString(IRtextWriter *out) const {
+  _toString(out);
+  addBoolToString(out, getSwingVToggle(), kSwingVToggleStr);
 }
 
 
@@ -1578,23 +1591,30 @@ stdAc::state_t IRHitachiAc344::toCommon(void) const {
 /// Convert the internal state into a human readable string.
 /// @return A string containing the settings in human-readable form.
 String IRHitachiAc344::toString(void) const {
-  String result;
+  String result = "";
   result.reserve(120);  // Reserve some heap for the string to reduce fragging.
-  result += _toString();
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addIntToString(_.SwingH, kSwingHStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc344::toString(IRtextWriter *out) const {
+  _toString(out);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addIntToString(out, _.SwingH, kSwingHStr);
+  *out += kSpaceLBraceStr;
   switch (_.SwingH) {
-    case kHitachiAc344SwingHLeftMax:  result += kLeftMaxStr; break;
-    case kHitachiAc344SwingHLeft:     result += kLeftStr; break;
-    case kHitachiAc344SwingHMiddle:   result += kMiddleStr; break;
-    case kHitachiAc344SwingHRight:    result += kRightStr; break;
-    case kHitachiAc344SwingHRightMax: result += kRightMaxStr; break;
-    case kHitachiAc344SwingHAuto:     result += kAutoStr; break;
-    default:                          result += kUnknownStr;
+    case kHitachiAc344SwingHLeftMax:  *out += kLeftMaxStr; break;
+    case kHitachiAc344SwingHLeft:     *out += kLeftStr; break;
+    case kHitachiAc344SwingHMiddle:   *out += kMiddleStr; break;
+    case kHitachiAc344SwingHRight:    *out += kRightStr; break;
+    case kHitachiAc344SwingHRightMax: *out += kRightMaxStr; break;
+    case kHitachiAc344SwingHAuto:     *out += kAutoStr; break;
+    default:                          *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 
@@ -1697,12 +1717,19 @@ stdAc::state_t IRHitachiAc264::toCommon(void) const {
 /// Convert the internal state into a human readable string.
 /// @return A string containing the settings in human-readable form.
 String IRHitachiAc264::toString(void) const {
-  String result;
+  String result = "";
   result.reserve(120);  // Reserve some heap for the string to reduce fragging.
-  result += _toString();
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc264::toString(IRtextWriter *out) const {
+  _toString(out);
+}
+
 #if DECODE_HITACHI_AC264
 // For Decoding HITACHI_AC264, see `decodeHitachiAC`
 #endif  // DECODE_HITACHI_AC264
@@ -1952,17 +1979,24 @@ stdAc::state_t IRHitachiAc296::toCommon(void) const {
 String IRHitachiAc296::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kHitachiAc296Auto, kHitachiAc296Cool,
-                            kHitachiAc296Heat, kHitachiAc1Dry,
-                            kHitachiAc296Auto);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kHitachiAc296FanHigh, kHitachiAc296FanLow,
-                           kHitachiAc296FanAuto, kHitachiAc296FanSilent,
-                           kHitachiAc296FanMedium);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRHitachiAc296::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kHitachiAc296Auto, kHitachiAc296Cool,
+                  kHitachiAc296Heat, kHitachiAc1Dry,
+                  kHitachiAc296Auto);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kHitachiAc296FanHigh, kHitachiAc296FanLow,
+                 kHitachiAc296FanAuto, kHitachiAc296FanSilent,
+                 kHitachiAc296FanMedium);
+}
+
 #if DECODE_HITACHI_AC296
 /// Decode the supplied Hitachi 37-byte A/C message.
 /// Status: STABLE / Working on a real device.
@@ -73,6 +73,14 @@ union HitachiProtocol{
 };
 
 // Constants
+const uint16_t kHitachiAcHdrMark = 3300;
+const uint16_t kHitachiAcHdrSpace = 1700;
+const uint16_t kHitachiAc1HdrMark = 3400;
+const uint16_t kHitachiAc1HdrSpace = 3400;
+const uint16_t kHitachiAc424LdrMark = 29784;   // Leader
+const uint16_t kHitachiAc424LdrSpace = 49290;  // Leader
+const uint16_t kHitachiAc3HdrMark = 3400;    // Header
+const uint16_t kHitachiAc3HdrSpace = 1660;   // Header
 const uint16_t kHitachiAcFreq = 38000;  // Hz.
 const uint8_t kHitachiAcAuto = 2;
 const uint8_t kHitachiAcHeat = 3;
@@ -410,6 +418,7 @@ class IRHitachiAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -480,6 +489,7 @@ class IRHitachiAc1 {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -533,6 +543,7 @@ class IRHitachiAc424 {
   virtual stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed) const;
   virtual stdAc::state_t toCommon(void) const;
   virtual String toString(void) const;
+  virtual void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -544,7 +555,7 @@ class IRHitachiAc424 {
 #endif  // UNIT_TEST
   Hitachi424Protocol _;
   void setInvertedStates(void);
-  String _toString(void) const;
+  void _toString(IRtextWriter *out) const;
   uint8_t _previoustemp;
 };
 
@@ -601,6 +612,7 @@ class IRHitachiAc344: public IRHitachiAc424 {
   static uint8_t convertSwingH(const stdAc::swingh_t position);
   static stdAc::swingh_t toCommonSwingH(const uint8_t pos);
   String toString(void) const override;
+  void toString(IRtextWriter *out) const override;
 };
 
 /// Class for handling detailed Hitachi 264-bit A/C messages.
@@ -619,6 +631,7 @@ class IRHitachiAc264: public IRHitachiAc424 {
   void send(const uint16_t repeat = kHitachiAcDefaultRepeat) override;
 #endif  // SEND_HITACHI_AC264
   String toString(void) const override;
+  void toString(IRtextWriter *out) const override;
 };
 
 class IRHitachiAc296 {
@@ -651,6 +664,7 @@ class IRHitachiAc296 {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -11,11 +11,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Inax.h"
 
 // Constants
 const uint16_t kInaxTick = 500;
-const uint16_t kInaxHdrMark = 9000;
-const uint16_t kInaxHdrSpace = 4500;
 const uint16_t kInaxBitMark = 560;
 const uint16_t kInaxOneSpace = 1675;
 const uint16_t kInaxZeroSpace = kInaxBitMark;
@@ -0,0 +1,16 @@
+// Copyright 2019 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for the Inax Robot Toilet IR protocols.
+
+#ifndef IR_INAX_H_
+#define IR_INAX_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kInaxHdrMark = 9000;
+const uint16_t kInaxHdrSpace = 4500;
+
+#endif  // IR_INAX_H_
@@ -15,15 +15,13 @@
 #include "IRsend.h"
 #include "IRtimer.h"
 #include "IRutils.h"
+#include "ir_JVC.h"
 
 // Constants
-const uint16_t kJvcTick = 75;
 const uint16_t kJvcHdrMarkTicks = 112;
 const uint16_t kJvcHdrMark = kJvcHdrMarkTicks * kJvcTick;
 const uint16_t kJvcHdrSpaceTicks = 56;
 const uint16_t kJvcHdrSpace = kJvcHdrSpaceTicks * kJvcTick;
-const uint16_t kJvcBitMarkTicks = 7;
-const uint16_t kJvcBitMark = kJvcBitMarkTicks * kJvcTick;
 const uint16_t kJvcOneSpaceTicks = 23;
 const uint16_t kJvcOneSpace = kJvcOneSpaceTicks * kJvcTick;
 const uint16_t kJvcZeroSpaceTicks = 7;
@@ -47,7 +45,7 @@ void IRsend::sendJVC(uint64_t data, uint16_t nbits, uint16_t repeat) {
   // Set 38kHz IR carrier frequency & a 1/3 (33%) duty cycle.
   enableIROut(38, 33);
 
-  IRtimer usecs = IRtimer();
+  IRsendTimer usecs = IRsendTimer(this);
   // Header
   // Only sent for the first message.
   mark(kJvcHdrMark);
@@ -0,0 +1,18 @@
+// Copyright 2015 Kristian Lauszus
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief Support for JVC protocols.
+
+#ifndef IR_JVC_H_
+#define IR_JVC_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kJvcTick = 75;
+const uint16_t kJvcBitMarkTicks = 7;
+const uint16_t kJvcBitMark = kJvcBitMarkTicks * kJvcTick;
+
+#endif  // IR_JVC_H_
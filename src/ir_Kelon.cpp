@@ -33,8 +33,6 @@ using irutils::addLabeledString;
 using irutils::minsToString;
 
 // Constants
-const uint16_t kKelonHdrMark = 9000;
-const uint16_t kKelonHdrSpace = 4600;
 const uint16_t kKelonBitMark = 560;
 const uint16_t kKelonOneSpace = 1680;
 const uint16_t kKelonZeroSpace = 600;
@@ -428,25 +426,32 @@ stdAc::state_t IRKelonAc::toCommon(const stdAc::state_t *prev) const {
 /// @return A String.
 String IRKelonAc::toString() const {
   String result = "";
-  // Reserve some heap for the string to reduce fragging.
   result.reserve(160);
-  result += addTempToString(getTemp(), true, false);
-  result += addModeToString(_.Mode, kKelonModeSmart, kKelonModeCool,
-                            kKelonModeHeat, kKelonModeDry, kKelonModeFan);
-  result += addFanToString(_.Fan, kKelonFanMax, kKelonFanMin, kKelonFanAuto,
-                           -1, kKelonFanMedium, kKelonFanMax);
-  result += addBoolToString(_.SleepEnabled, kSleepStr);
-  result += addSignedIntToString(getDryGrade(), kDryStr);
-  result += addLabeledString(
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRKelonAc::toString(IRtextWriter *out) const {
+  // Reserve some heap for the string to reduce fragging.
+  addTempToString(out, getTemp(), true, false);
+  addModeToString(out, _.Mode, kKelonModeSmart, kKelonModeCool,
+                  kKelonModeHeat, kKelonModeDry, kKelonModeFan);
+  addFanToString(out, _.Fan, kKelonFanMax, kKelonFanMin, kKelonFanAuto,
+                 -1, kKelonFanMedium, kKelonFanMax);
+  addBoolToString(out, _.SleepEnabled, kSleepStr);
+  addSignedIntToString(out, getDryGrade(), kDryStr);
+  addLabeledString(out,
       getTimerEnabled() ? (getTimer() > 0 ? minsToString(getTimer()) : kOnStr)
                         : kOffStr,
       kTimerStr);
-  result += addBoolToString(getSupercool(), kTurboStr);
+  addBoolToString(out, getSupercool(), kTurboStr);
   if (getTogglePower())
-    result += addBoolToString(true, kPowerToggleStr);
+    addBoolToString(out, true, kPowerToggleStr);
   if (getToggleSwingVertical())
-    result += addBoolToString(true, kSwingVToggleStr);
-  return result;
+    addBoolToString(out, true, kSwingVToggleStr);
 }
 
 // KELON168
@@ -1046,63 +1051,70 @@ stdAc::state_t IRKelon168Ac::toCommon(const stdAc::state_t *prev) const {
 String IRKelon168Ac::toString(void) const {
   String result = "";
   result.reserve(200);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::KELON168, getModel(), false);
-  result += addBoolToString(_.Power, kPowerToggleStr);
-  result += addModeToString(_.Mode, kKelon168Auto, kKelon168Cool,
-                            kKelon168Heat, kKelon168Dry, kKelon168Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kKelon168FanHigh, kKelon168FanLow,
-                           kKelon168FanAuto, kKelon168FanAuto,
-                           kKelon168FanMedium);
-  result += addBoolToString(getSwing(), kSwingStr);
-  result += addBoolToString(getLight(), kLightStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
-  result += addLabeledString(
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRKelon168Ac::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::KELON168, getModel(), false);
+  addBoolToString(out, _.Power, kPowerToggleStr);
+  addModeToString(out, _.Mode, kKelon168Auto, kKelon168Cool,
+                  kKelon168Heat, kKelon168Dry, kKelon168Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kKelon168FanHigh, kKelon168FanLow,
+                 kKelon168FanAuto, kKelon168FanAuto,
+                 kKelon168FanMedium);
+  addBoolToString(out, getSwing(), kSwingStr);
+  addBoolToString(out, getLight(), kLightStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+  addLabeledString(out,
       _.OnTimerEnabled ? minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.OffTimerEnabled ? minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(getSuper(), kSuperStr);
-  result += addIntToString(_.Cmd, kCommandStr);
-  result += kSpaceLBraceStr;
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, getSuper(), kSuperStr);
+  addIntToString(out, _.Cmd, kCommandStr);
+  *out += kSpaceLBraceStr;
   switch (_.Cmd) {
     case kKelon168CommandLight:
-      result += kLightStr;
+      *out += kLightStr;
       break;
     case kKelon168CommandPower:
-      result += kPowerStr;
+      *out += kPowerStr;
       break;
     case kKelon168CommandTemp:
-      result += kTempStr;
+      *out += kTempStr;
       break;
     case kKelon168CommandSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kKelon168CommandSuper:
-      result += kSuperStr;
+      *out += kSuperStr;
       break;
     case kKelon168CommandOnTimer:
-      result += kOnTimerStr;
+      *out += kOnTimerStr;
       break;
     case kKelon168CommandMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kKelon168CommandSwing:
-      result += kSwingStr;
+      *out += kSwingStr;
       break;
     case kKelon168CommandIFeel:
-      result += kIFeelStr;
+      *out += kIFeelStr;
       break;
     case kKelon168CommandFanSpeed:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kKelon168CommandOffTimer:
-      result += kOffTimerStr;
+      *out += kOffTimerStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
       break;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
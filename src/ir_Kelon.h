@@ -66,6 +66,8 @@ union KelonProtocol {
 };
 
 // Constants
+const uint16_t kKelonHdrMark = 9000;
+const uint16_t kKelonHdrSpace = 4600;
 const uint8_t kKelonModeHeat = 0;
 const uint8_t kKelonModeSmart = 1;  // (temp = 26C, but not shown)
 const uint8_t kKelonModeCool = 2;
@@ -134,6 +136,7 @@ class IRKelonAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = nullptr) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 
  private:
 #ifndef UNIT_TEST
@@ -321,6 +324,7 @@ class IRKelon168Ac {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -27,11 +27,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kKelvinatorTick = 85;
-const uint16_t kKelvinatorHdrMarkTicks = 106;
-const uint16_t kKelvinatorHdrMark = kKelvinatorHdrMarkTicks * kKelvinatorTick;
-const uint16_t kKelvinatorHdrSpaceTicks = 53;
-const uint16_t kKelvinatorHdrSpace = kKelvinatorHdrSpaceTicks * kKelvinatorTick;
 const uint16_t kKelvinatorBitMarkTicks = 8;
 const uint16_t kKelvinatorBitMark = kKelvinatorBitMarkTicks * kKelvinatorTick;
 const uint16_t kKelvinatorOneSpaceTicks = 18;
@@ -54,6 +49,8 @@ using irutils::addModeToString;
 using irutils::addFanToString;
 using irutils::addTempToString;
 using irutils::addSwingVToString;
+using irutils::sumHighNibbles;
+using irutils::sumLowNibbles;
 
 #if SEND_KELVINATOR
 /// Send a Kelvinator A/C message.
@@ -163,11 +160,14 @@ void IRKelvinatorAC::setRaw(const uint8_t new_code[]) {
 uint8_t IRKelvinatorAC::calcBlockChecksum(const uint8_t *block,
                                           const uint16_t length) {
   uint8_t sum = kKelvinatorChecksumStart;
-  // Sum the lower half of the first 4 bytes of this block.
-  for (uint8_t i = 0; i < 4 && i < length - 1; i++, block++)
-    sum += (*block & 0b1111);
-  // then sum the upper half of the next 3 bytes.
-  for (uint8_t i = 4; i < length - 1; i++, block++) sum += (*block >> 4);
+  if (length > 1) {
+    // Sum the lower half of the first 4 bytes of this block.
+    const uint16_t lows = std::min(static_cast<uint16_t>(length - 1),
+                                   static_cast<uint16_t>(4));
+    sum = sumLowNibbles(block, lows, sum);
+    // then sum the upper half of the next 3 bytes.
+    sum = sumHighNibbles(block + lows, length - 1 - lows, sum);
+  }
   // Trim it down to fit into the 4 bits allowed. i.e. Mod 16.
   return sum & 0b1111;
 }
@@ -475,33 +475,40 @@ stdAc::state_t IRKelvinatorAC::toCommon(void) const {
 String IRKelvinatorAC::toString(void) const {
   String result = "";
   result.reserve(160);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kKelvinatorAuto, kKelvinatorCool,
-                            kKelvinatorHeat, kKelvinatorDry, kKelvinatorFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kKelvinatorFanMax, kKelvinatorFanMin,
-                           kKelvinatorFanAuto, kKelvinatorFanAuto,
-                           kKelvinatorBasicFanMax);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Quiet, kQuietStr);
-  result += addBoolToString(_.XFan, kXFanStr);
-  result += addBoolToString(_.IonFilter, kIonStr);
-  result += addBoolToString(_.Light, kLightStr);
-  result += addBoolToString(_.SwingH, kSwingHStr);
-  result += addSwingVToString(_.SwingV, kKelvinatorSwingVAuto,
-                              kKelvinatorSwingVHighest,
-                              kKelvinatorSwingVHighAuto,
-                              kKelvinatorSwingVUpperMiddle,
-                              kKelvinatorSwingVMiddle,
-                              kKelvinatorSwingVLowerMiddle,
-                              kKelvinatorSwingVLowAuto,
-                              kKelvinatorSwingVLowest,
-                              kKelvinatorSwingVOff,
-                              kKelvinatorSwingVAuto, kKelvinatorSwingVAuto,
-                              kKelvinatorSwingVAuto);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRKelvinatorAC::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kKelvinatorAuto, kKelvinatorCool,
+                  kKelvinatorHeat, kKelvinatorDry, kKelvinatorFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kKelvinatorFanMax, kKelvinatorFanMin,
+                 kKelvinatorFanAuto, kKelvinatorFanAuto,
+                 kKelvinatorBasicFanMax);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Quiet, kQuietStr);
+  addBoolToString(out, _.XFan, kXFanStr);
+  addBoolToString(out, _.IonFilter, kIonStr);
+  addBoolToString(out, _.Light, kLightStr);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+  addSwingVToString(out, _.SwingV, kKelvinatorSwingVAuto,
+                    kKelvinatorSwingVHighest,
+                    kKelvinatorSwingVHighAuto,
+                    kKelvinatorSwingVUpperMiddle,
+                    kKelvinatorSwingVMiddle,
+                    kKelvinatorSwingVLowerMiddle,
+                    kKelvinatorSwingVLowAuto,
+                    kKelvinatorSwingVLowest,
+                    kKelvinatorSwingVOff,
+                    kKelvinatorSwingVAuto, kKelvinatorSwingVAuto,
+                    kKelvinatorSwingVAuto);
+}
+
 #if DECODE_KELVINATOR
 /// Decode the supplied Kelvinator message.
 /// Status: STABLE / Known working.
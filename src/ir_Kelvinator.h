@@ -90,6 +90,11 @@ union KelvinatorProtocol{
 };
 
 // Constants
+const uint16_t kKelvinatorTick = 85;
+const uint16_t kKelvinatorHdrMarkTicks = 106;
+const uint16_t kKelvinatorHdrMark = kKelvinatorHdrMarkTicks * kKelvinatorTick;
+const uint16_t kKelvinatorHdrSpaceTicks = 53;
+const uint16_t kKelvinatorHdrSpace = kKelvinatorHdrSpaceTicks * kKelvinatorTick;
 const uint8_t kKelvinatorAuto = 0;  // (temp = 25C)
 const uint8_t kKelvinatorCool = 1;
 const uint8_t kKelvinatorDry = 2;  // (temp = 25C, but not shown)
@@ -181,6 +186,7 @@ class IRKelvinatorAC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
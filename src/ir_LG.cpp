@@ -29,7 +29,6 @@ using irutils::addIntToString;
 
 // Constants
 // Common timings
-const uint16_t kLgBitMark = 550;              ///< uSeconds.
 const uint16_t kLgOneSpace = 1600;            ///< uSeconds.
 const uint16_t kLgZeroSpace = 550;            ///< uSeconds.
 const uint16_t kLgRptSpace = 2250;            ///< uSeconds.
@@ -801,58 +800,65 @@ stdAc::state_t IRLgAc::toCommon(const stdAc::state_t *prev) const {
 String IRLgAc::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(_protocol, getModel(), false);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRLgAc::toString(IRtextWriter *out) const {
+  addModelToString(out, _protocol, getModel(), false);
   if (_isNormal()) {  // A "Normal" generic settings message.
-    result += addBoolToString(getPower(), kPowerStr);
+    addBoolToString(out, getPower(), kPowerStr);
     if (getPower()) {  // Only display the rest if is in power on state.
-      result += addModeToString(_.Mode, kLgAcAuto, kLgAcCool,
-                                kLgAcHeat, kLgAcDry, kLgAcFan);
-      result += addTempToString(getTemp());
-      result += addFanToString(_.Fan, kLgAcFanHigh,
-                               _isAKB74955603() ? kLgAcFanLowAlt : kLgAcFanLow,
-                               kLgAcFanAuto, kLgAcFanLowest, kLgAcFanMedium,
-                               kLgAcFanMax);
+      addModeToString(out, _.Mode, kLgAcAuto, kLgAcCool,
+                      kLgAcHeat, kLgAcDry, kLgAcFan);
+      addTempToString(out, getTemp());
+      addFanToString(out, _.Fan, kLgAcFanHigh,
+                     _isAKB74955603() ? kLgAcFanLowAlt : kLgAcFanLow,
+                     kLgAcFanAuto, kLgAcFanLowest, kLgAcFanMedium,
+                     kLgAcFanMax);
     }
   } else {  // It must be a special single purpose code.
     if (isOffCommand()) {
-      result += addBoolToString(false, kPowerStr);
+      addBoolToString(out, false, kPowerStr);
     } else if (isLightToggle()) {
-      result += addBoolToString(true, kLightToggleStr);
+      addBoolToString(out, true, kLightToggleStr);
     } else if (isSwingH()) {
-      result += addBoolToString(_swingh, kSwingHStr);
+      addBoolToString(out, _swingh, kSwingHStr);
     } else if (isSwingV()) {
       if (isSwingVToggle())
-        result += addToggleToString(isSwingVToggle(), kSwingVStr);
+        addToggleToString(out, isSwingVToggle(), kSwingVStr);
       else
-        result += addSwingVToString((uint8_t)(_swingv >> kLgAcChecksumSize),
-                                    0,  // No Auto, See "swing". Unused
-                                    kLgAcSwingVHighest_Short,
-                                    kLgAcSwingVHigh_Short,
-                                    kLgAcSwingVUpperMiddle_Short,
-                                    kLgAcSwingVMiddle_Short,
-                                    0,  // Unused
-                                    kLgAcSwingVLow_Short,
-                                    kLgAcSwingVLowest_Short,
-                                    kLgAcSwingVOff_Short,
-                                    kLgAcSwingVSwing_Short,
-                                    0, 0);
+        addSwingVToString(out, (uint8_t)(_swingv >> kLgAcChecksumSize),
+                          0,  // No Auto, See "swing". Unused
+                          kLgAcSwingVHighest_Short,
+                          kLgAcSwingVHigh_Short,
+                          kLgAcSwingVUpperMiddle_Short,
+                          kLgAcSwingVMiddle_Short,
+                          0,  // Unused
+                          kLgAcSwingVLow_Short,
+                          kLgAcSwingVLowest_Short,
+                          kLgAcSwingVOff_Short,
+                          kLgAcSwingVSwing_Short,
+                          0, 0);
     } else if (isVaneSwingV()) {
       const uint8_t vane = getVaneCode(_.raw) / kLgAcVaneSwingVSize;
-      result += addIntToString(vane, kVaneStr);
-      result += addSwingVToString(_vaneswingv[vane],
-                                  0,  // No Auto, See "swing". Unused
-                                  kLgAcVaneSwingVHighest,
-                                  kLgAcVaneSwingVHigh,
-                                  kLgAcVaneSwingVUpperMiddle,
-                                  kLgAcVaneSwingVMiddle,
-                                  0,  // Unused
-                                  kLgAcVaneSwingVLow,
-                                  kLgAcVaneSwingVLowest,
-                                  // Rest unused
-                                  0, 0, 0, 0);
+      addIntToString(out, vane, kVaneStr);
+      addSwingVToString(out, _vaneswingv[vane],
+                        0,  // No Auto, See "swing". Unused
+                        kLgAcVaneSwingVHighest,
+                        kLgAcVaneSwingVHigh,
+                        kLgAcVaneSwingVUpperMiddle,
+                        kLgAcVaneSwingVMiddle,
+                        0,  // Unused
+                        kLgAcVaneSwingVLow,
+                        kLgAcVaneSwingVLowest,
+                        // Rest unused
+                        0, 0, 0, 0);
     }
   }
-  return result;
 }
 
 /// Check if the internal state looks like a valid LG A/C message.
@@ -50,6 +50,8 @@ union LGProtocol{
   };
 };
 
+// Constants
+const uint16_t kLgBitMark = 550;  ///< uSeconds.
 const uint8_t kLgAcFanLowest = 0;  // 0b0000
 const uint8_t kLgAcFanLow = 1;     // 0b0001
 const uint8_t kLgAcFanMedium = 2;  // 0b0010
@@ -169,6 +171,7 @@ class IRLgAc {
   static uint8_t convertVaneSwingV(const stdAc::swingv_t swingv);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
   void setModel(const lg_ac_remote_model_t model);
   lg_ac_remote_model_t getModel(void) const;
 #ifndef UNIT_TEST
@@ -13,11 +13,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Lego.h"
 
 
 // Constants
-const uint16_t kLegoPfBitMark = 158;
-const uint16_t kLegoPfHdrSpace = 1026;
 const uint16_t kLegoPfZeroSpace = 263;
 const uint16_t kLegoPfOneSpace = 553;
 const uint32_t kLegoPfMinCommandLength = 16000;  // 16ms
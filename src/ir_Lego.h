@@ -0,0 +1,16 @@
+// Copyright 2019 David Conran
+
+/// @file
+/// @brief Support for LEGO protocols.
+
+#ifndef IR_LEGO_H_
+#define IR_LEGO_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kLegoPfBitMark = 158;
+const uint16_t kLegoPfHdrSpace = 1026;
+
+#endif  // IR_LEGO_H_
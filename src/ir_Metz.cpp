@@ -12,10 +12,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Metz.h"
 
 // Constants.
-const uint16_t kMetzHdrMark = 880;    ///< uSeconds.
-const uint16_t kMetzHdrSpace = 2336;  ///< uSeconds.
 const uint16_t kMetzBitMark = 473;    ///< uSeconds.
 const uint16_t kMetzOneSpace = 1640;  ///< uSeconds.
 const uint16_t kMetzZeroSpace = 940;  ///< uSeconds.
@@ -0,0 +1,16 @@
+// Copyright 2020 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for Metz protocol
+
+#ifndef IR_METZ_H_
+#define IR_METZ_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kMetzHdrMark = 880;    ///< uSeconds.
+const uint16_t kMetzHdrSpace = 2336;  ///< uSeconds.
+
+#endif  // IR_METZ_H_
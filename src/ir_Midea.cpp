@@ -19,17 +19,12 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kMideaTick = 80;
 const uint16_t kMideaBitMarkTicks = 7;
 const uint16_t kMideaBitMark = kMideaBitMarkTicks * kMideaTick;
 const uint16_t kMideaOneSpaceTicks = 21;
 const uint16_t kMideaOneSpace = kMideaOneSpaceTicks * kMideaTick;
 const uint16_t kMideaZeroSpaceTicks = 7;
 const uint16_t kMideaZeroSpace = kMideaZeroSpaceTicks * kMideaTick;
-const uint16_t kMideaHdrMarkTicks = 56;
-const uint16_t kMideaHdrMark = kMideaHdrMarkTicks * kMideaTick;
-const uint16_t kMideaHdrSpaceTicks = 56;
-const uint16_t kMideaHdrSpace = kMideaHdrSpaceTicks * kMideaTick;
 const uint16_t kMideaMinGapTicks =
     kMideaHdrMarkTicks + kMideaZeroSpaceTicks + kMideaBitMarkTicks;
 const uint16_t kMideaMinGap = kMideaMinGapTicks * kMideaTick;
@@ -43,7 +38,11 @@ using irutils::addLabeledString;
 using irutils::addModeToString;
 using irutils::addTempToString;
 using irutils::addToggleToString;
+using irutils::checkInvertedBytePairs;
+using irutils::invertBytePairs;
 using irutils::minsToString;
+using irutils::reverseBitsInBytes;
+using irutils::sumBytes;
 
 #if SEND_MIDEA
 /// Send a Midea message
@@ -500,13 +499,8 @@ bool IRMideaAC::getQuiet(void) const {
 /// @param[in] state The value to calc the checksum of.
 /// @return The calculated checksum value.
 uint8_t IRMideaAC::calcChecksum(const uint64_t state) {
-  uint8_t sum = 0;
-  uint64_t temp_state = state;
-
-  for (uint8_t i = 0; i < 5; i++) {
-    temp_state >>= 8;
-    sum += reverseBits((temp_state & 0xFF), 8);
-  }
+  // Sum the 5 bytes above the checksum, each with their bits reversed.
+  uint8_t sum = sumBytes(reverseBitsInBytes(state >> 8), 5);
   sum = 256 - sum;
   return reverseBits(sum, 8);
 }
@@ -691,56 +685,63 @@ stdAc::state_t IRMideaAC::toCommon(const stdAc::state_t *prev) {
 /// @return A human readable string.
 String IRMideaAC::toString(void) {
   String result = "";
-  const uint8_t message_type = getType();
   result.reserve(230);  // Reserve some heap for the string to reduce fragging.
-  result += addIntToString(message_type, kTypeStr, false);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMideaAC::toString(IRtextWriter *out) {
+  const uint8_t message_type = getType();
+  addIntToString(out, message_type, kTypeStr, false);
+  *out += kSpaceLBraceStr;
   switch (message_type) {
-    case kMideaACTypeCommand: result += kCommandStr; break;
-    case kMideaACTypeSpecial: result += kSpecialStr; break;
-    case kMideaACTypeFollow:  result += kFollowStr; break;
-    default:                  result += kUnknownStr;
+    case kMideaACTypeCommand: *out += kCommandStr; break;
+    case kMideaACTypeSpecial: *out += kSpecialStr; break;
+    case kMideaACTypeFollow:  *out += kFollowStr; break;
+    default:                  *out += kUnknownStr;
   }
-  result += ')';
+  *out += ')';
   if (message_type != kMideaACTypeSpecial) {
-    result += addBoolToString(_.Power, kPowerStr);
-    result += addModeToString(_.Mode, kMideaACAuto, kMideaACCool,
-                              kMideaACHeat, kMideaACDry, kMideaACFan);
-    result += addBoolToString(!_.useFahrenheit, kCelsiusStr);
-    result += addTempToString(getTemp(true));
-    result += '/';
-    result += uint64ToString(getTemp(false));
-    result += 'F';
+    addBoolToString(out, _.Power, kPowerStr);
+    addModeToString(out, _.Mode, kMideaACAuto, kMideaACCool,
+                    kMideaACHeat, kMideaACDry, kMideaACFan);
+    addBoolToString(out, !_.useFahrenheit, kCelsiusStr);
+    addTempToString(out, getTemp(true));
+    *out += '/';
+    *out += uint64ToString(getTemp(false));
+    *out += 'F';
     if (getEnableSensorTemp()) {
-      result += kCommaSpaceStr;
-      result += kSensorStr;
-      result += addTempToString(getSensorTemp(true), true, false);
-      result += '/';
-      result += uint64ToString(getSensorTemp(false));
-      result += 'F';
+      *out += kCommaSpaceStr;
+      *out += kSensorStr;
+      addTempToString(out, getSensorTemp(true), true, false);
+      *out += '/';
+      *out += uint64ToString(getSensorTemp(false));
+      *out += 'F';
     } else {
-      result += addLabeledString(
+      addLabeledString(out,
           isOnTimerEnabled() ? minsToString(getOnTimer()) : kOffStr,
           kOnTimerStr);
     }
-    result += addLabeledString(
+    addLabeledString(out,
         isOffTimerEnabled() ? minsToString(getOffTimer()) : kOffStr,
         kOffTimerStr);
-    result += addFanToString(_.Fan, kMideaACFanHigh, kMideaACFanLow,
-                             kMideaACFanAuto, kMideaACFanAuto, kMideaACFanMed);
-    result += addBoolToString(_.Sleep, kSleepStr);
+    addFanToString(out, _.Fan, kMideaACFanHigh, kMideaACFanLow,
+                   kMideaACFanAuto, kMideaACFanAuto, kMideaACFanMed);
+    addBoolToString(out, _.Sleep, kSleepStr);
   }
-  result += addToggleToString(getSwingVToggle(), kSwingVStr);
+  addToggleToString(out, getSwingVToggle(), kSwingVStr);
 #if KAYSUN_AC
-  result += addBoolToString(getSwingVStep(), kStepStr);
+  addBoolToString(out, getSwingVStep(), kStepStr);
 #endif  // KAYSUN_AC
-  result += addToggleToString(getEconoToggle(), kEconoStr);
-  result += addToggleToString(getTurboToggle(), kTurboStr);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addToggleToString(getLightToggle(), kLightStr);
-  result += addToggleToString(getCleanToggle(), kCleanStr);
-  result += addToggleToString(get8CHeatToggle(), k8CHeatStr);
-  return result;
+  addToggleToString(out, getEconoToggle(), kEconoStr);
+  addToggleToString(out, getTurboToggle(), kTurboStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addToggleToString(out, getLightToggle(), kLightStr);
+  addToggleToString(out, getCleanToggle(), kCleanStr);
+  addToggleToString(out, get8CHeatToggle(), k8CHeatStr);
 }
 
 #if DECODE_MIDEA
@@ -822,14 +823,11 @@ bool IRrecv::decodeMidea(decode_results *results, uint16_t offset,
 void IRsend::sendMidea24(const uint64_t data, const uint16_t nbits,
                           const uint16_t repeat) {
   uint64_t newdata = 0;
-  // Construct the data into bye & inverted byte pairs.
-  for (int16_t i = nbits - 8; i >= 0; i -= 8) {
-    // Shuffle the data to be sent so far.
-    newdata <<= 16;
-    uint8_t next = GETBITS64(data, i, 8);
-    newdata |= ((next << 8) | (next ^ 0xFF));
-  }
-  sendNEC(newdata, nbits * 2, repeat);
+  // Spread the data bytes out to be the first byte of each pair.
+  for (int16_t i = nbits - 8; i >= 0; i -= 8)
+    newdata = (newdata << 16) | (GETBITS64(data, i, 8) << 8);
+  // Construct the data into byte & inverted byte pairs.
+  sendNEC(invertBytePairs(newdata, nbits * 2), nbits * 2, repeat);
 }
 #endif  // SEND_MIDEA24
 
@@ -860,20 +858,15 @@ bool IRrecv::decodeMidea24(decode_results *results, uint16_t offset,
                     kNecBitMark, kNecZeroSpace,
                     kNecBitMark, kMidea24MinGap, true)) return false;
 
-  // Build the result by checking every second byte is a complement(inversion)
-  // of the previous one.
+  // Check every second byte is a complement(inversion) of the previous one.
+  // Any bits after the last whole pair are ignored.
+  const uint8_t unpaired = (nbits * 2) % 16;
+  if (!checkInvertedBytePairs(longdata >> unpaired, nbits * 2 - unpaired))
+    return false;  // They are not, so abort.
+  // Build the result from the first byte of each pair.
   uint32_t data = 0;
-  for (uint8_t i = nbits * 2; i >= 16;) {
-    // Shuffle the data collected so far.
-    data <<= 8;
-    i -= 8;
-    uint8_t current = GETBITS64(longdata, i, 8);
-    i -= 8;
-    uint8_t next = GETBITS64(longdata, i, 8);
-    // Check they are an inverted pair.
-    if (current != (next ^ 0xFF)) return false;  // They are not, so abort.
-    data |= current;
-  }
+  for (int16_t i = nbits * 2 - 8; i >= 8; i -= 16)
+    data = (data << 8) | GETBITS64(longdata, i, 8);
 
   // Success
   results->decode_type = decode_type_t::MIDEA24;
@@ -107,6 +107,11 @@ union MideaProtocol{
 };
 
 // Constants
+const uint16_t kMideaTick = 80;
+const uint16_t kMideaHdrMarkTicks = 56;
+const uint16_t kMideaHdrMark = kMideaHdrMarkTicks * kMideaTick;
+const uint16_t kMideaHdrSpaceTicks = 56;
+const uint16_t kMideaHdrSpace = kMideaHdrSpaceTicks * kMideaTick;
 const uint8_t kMideaACMinTempF = 62;        ///< Fahrenheit
 const uint8_t kMideaACMaxTempF = 86;        ///< Fahrenheit
 const uint8_t kMideaACMinTempC = 17;        ///< Celsius
@@ -247,6 +252,7 @@ class IRMideaAC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL);
   String toString(void);
+  void toString(IRtextWriter *out);
 #ifndef UNIT_TEST
 
  private:
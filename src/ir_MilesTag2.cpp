@@ -17,6 +17,7 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_MilesTag2.h"
 
 // Constants
 // Shot packets have this bit as `0`
@@ -24,8 +25,6 @@ const uint16_t kMilesTag2ShotMask = 1 << (kMilesTag2ShotBits - 1);
 // Msg packets have this bit as `1`
 const uint32_t kMilesTag2MsgMask = 1 << (kMilesTag2MsgBits - 1);
 const uint8_t  kMilesTag2MsgTerminator = 0xE8;
-const uint16_t kMilesTag2HdrMark = 2400;     /// uSeconds.
-const uint16_t kMilesTag2Space = 600;        /// uSeconds.
 const uint16_t kMilesTag2OneMark = 1200;     /// uSeconds.
 const uint16_t kMilesTag2ZeroMark = 600;     /// uSeconds.
 const uint16_t kMilesTag2RptLength = 32000;  /// uSeconds.
@@ -0,0 +1,17 @@
+// Copyright 2021 Victor Mukayev (vitos1k)
+// Copyright 2021 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for the MilesTag2 IR protocol for LaserTag gaming
+
+#ifndef IR_MILESTAG2_H_
+#define IR_MILESTAG2_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kMilesTag2HdrMark = 2400;     /// uSeconds.
+const uint16_t kMilesTag2Space = 600;        /// uSeconds.
+
+#endif  // IR_MILESTAG2_H_
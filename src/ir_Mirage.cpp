@@ -32,9 +32,7 @@ using irutils::uint8ToBcd;
 using irutils::sumNibbles;
 
 // Constants
-const uint16_t kMirageHdrMark = 8360;            ///< uSeconds
 const uint16_t kMirageBitMark = 554;             ///< uSeconds
-const uint16_t kMirageHdrSpace = 4248;           ///< uSeconds
 const uint16_t kMirageOneSpace = 1592;           ///< uSeconds
 const uint16_t kMirageZeroSpace = 545;           ///< uSeconds
 const uint32_t kMirageGap = kDefaultMessageGap;  ///< uSeconds (just a guess)
@@ -793,12 +791,20 @@ void IRMirageAc::fromCommon(const stdAc::state_t state) {
 String IRMirageAc::toString(void) const {
   String result = "";
   result.reserve(240);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::MIRAGE, _model, false);
-  result += addBoolToString(getPower(), kPowerStr);
-  result += addModeToString(_.Mode, 0xFF, kMirageAcCool,
-                            kMirageAcHeat, kMirageAcDry,
-                            kMirageAcFan);
-  result += addTempToString(getTemp());
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMirageAc::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::MIRAGE, _model, false);
+  addBoolToString(out, getPower(), kPowerStr);
+  addModeToString(out, _.Mode, 0xFF, kMirageAcCool,
+                  kMirageAcHeat, kMirageAcDry,
+                  kMirageAcFan);
+  addTempToString(out, getTemp());
   uint8_t fanlow;
   uint8_t fanmed;
   switch (_model) {
@@ -810,45 +816,44 @@ String IRMirageAc::toString(void) const {
       fanlow = kMirageAcFanLow;
       fanmed = kMirageAcFanMed;
   }
-  result += addFanToString(_.Fan, kMirageAcFanHigh, fanlow, kMirageAcFanAuto,
-                           kMirageAcFanAuto, fanmed);
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(getSleep(), kSleepStr);
+  addFanToString(out, _.Fan, kMirageAcFanHigh, fanlow, kMirageAcFanAuto,
+                 kMirageAcFanAuto, fanmed);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, getSleep(), kSleepStr);
   switch (_model) {
     case mirage_ac_remote_model_t::KKG29AC1:
-      result += addBoolToString(_.Quiet, kQuietStr);
-      result += addToggleToString(getLight(), kLightStr);
-      result += addBoolToString(_.SwingV, kSwingVStr);
-      result += addBoolToString(_.SwingH, kSwingHStr);
-      result += addBoolToString(_.Filter, kFilterStr);
-      result += addToggleToString(_.CleanToggle, kCleanStr);
-      result += addLabeledString(getOnTimer() ? minsToString(getOnTimer())
-                                              : kOffStr,
-                                 kOnTimerStr);
-      result += addLabeledString(getOffTimer() ? minsToString(getOffTimer())
-                                               : kOffStr,
-                                 kOffTimerStr);
-      result += addBoolToString(_.IFeel, kIFeelStr);
+      addBoolToString(out, _.Quiet, kQuietStr);
+      addToggleToString(out, getLight(), kLightStr);
+      addBoolToString(out, _.SwingV, kSwingVStr);
+      addBoolToString(out, _.SwingH, kSwingHStr);
+      addBoolToString(out, _.Filter, kFilterStr);
+      addToggleToString(out, _.CleanToggle, kCleanStr);
+      addLabeledString(out, getOnTimer() ? minsToString(getOnTimer())
+                                    : kOffStr,
+                       kOnTimerStr);
+      addLabeledString(out, getOffTimer() ? minsToString(getOffTimer())
+                                     : kOffStr,
+                       kOffTimerStr);
+      addBoolToString(out, _.IFeel, kIFeelStr);
       if (_.IFeel) {
-        result += addIntToString(getSensorTemp(), kSensorTempStr);
-        result += 'C';
+        addIntToString(out, getSensorTemp(), kSensorTempStr);
+        *out += 'C';
       }
       break;
     default:  // e.g. Model KKG9AC1
-      result += addBoolToString(getLight(), kLightStr);
-      result += addSwingVToString(getSwingV(),
-                                  kMirageAcSwingVAuto,
-                                  kMirageAcSwingVHighest,
-                                  kMirageAcSwingVHigh,
-                                  0xFF,  // Unused.
-                                  kMirageAcSwingVMiddle,
-                                  0xFF,  // Unused.
-                                  kMirageAcSwingVLow,
-                                  kMirageAcSwingVLowest,
-                                  kMirageAcSwingVOff,
-                                  0xFF, 0xFF, 0xFF);  // Unused.
-      result += addLabeledString(minsToString(getClock() / 60), kClockStr);
+      addBoolToString(out, getLight(), kLightStr);
+      addSwingVToString(out, getSwingV(),
+                        kMirageAcSwingVAuto,
+                        kMirageAcSwingVHighest,
+                        kMirageAcSwingVHigh,
+                        0xFF,  // Unused.
+                        kMirageAcSwingVMiddle,
+                        0xFF,  // Unused.
+                        kMirageAcSwingVLow,
+                        kMirageAcSwingVLowest,
+                        kMirageAcSwingVOff,
+                        0xFF, 0xFF, 0xFF);  // Unused.
+      addLabeledString(out, minsToString(getClock() / 60), kClockStr);
   }
-  return result;
 }
 #endif  // DECODE_MIRAGE
@@ -159,6 +159,8 @@ union Mirage120Protocol{
 };
 
 // Constants
+const uint16_t kMirageHdrMark = 8360;            ///< uSeconds
+const uint16_t kMirageHdrSpace = 4248;           ///< uSeconds
 const uint8_t kMirageAcHeat =    0b001;  // 1
 const uint8_t kMirageAcCool =    0b010;  // 2
 const uint8_t kMirageAcDry =     0b011;  // 3
@@ -261,6 +263,7 @@ class IRMirageAc {
   stdAc::state_t toCommon(void) const;
   void fromCommon(const stdAc::state_t state);
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -33,9 +33,6 @@
 // Constants
 // Mitsubishi TV
 // period time is 1/33000Hz = 30.303 uSeconds (T)
-const uint16_t kMitsubishiTick = 30;
-const uint16_t kMitsubishiBitMarkTicks = 10;
-const uint16_t kMitsubishiBitMark = kMitsubishiBitMarkTicks * kMitsubishiTick;
 const uint16_t kMitsubishiOneSpaceTicks = 70;
 const uint16_t kMitsubishiOneSpace = kMitsubishiOneSpaceTicks * kMitsubishiTick;
 const uint16_t kMitsubishiZeroSpaceTicks = 30;
@@ -48,16 +45,12 @@ const uint16_t kMitsubishiMinGapTicks = 936;
 const uint16_t kMitsubishiMinGap = kMitsubishiMinGapTicks * kMitsubishiTick;
 
 // Mitsubishi Projector (HC3000)
-const uint16_t kMitsubishi2HdrMark = 8400;
-const uint16_t kMitsubishi2HdrSpace = kMitsubishi2HdrMark / 2;
 const uint16_t kMitsubishi2BitMark = 560;
 const uint16_t kMitsubishi2ZeroSpace = 520;
 const uint16_t kMitsubishi2OneSpace = kMitsubishi2ZeroSpace * 3;
 const uint16_t kMitsubishi2MinGap = 28500;
 
 // Mitsubishi A/C
-const uint16_t kMitsubishiAcHdrMark = 3400;
-const uint16_t kMitsubishiAcHdrSpace = 1750;
 const uint16_t kMitsubishiAcBitMark = 450;
 const uint16_t kMitsubishiAcOneSpace = 1300;
 const uint16_t kMitsubishiAcZeroSpace = 420;
@@ -66,8 +59,6 @@ const uint16_t kMitsubishiAcRptSpace = 15500;
 const uint8_t  kMitsubishiAcExtraTolerance = 5;
 
 // Mitsubishi 136 bit A/C
-const uint16_t kMitsubishi136HdrMark = 3324;
-const uint16_t kMitsubishi136HdrSpace = 1474;
 const uint16_t kMitsubishi136BitMark = 467;
 const uint16_t kMitsubishi136OneSpace = 1137;
 const uint16_t kMitsubishi136ZeroSpace = 351;
@@ -95,6 +86,14 @@ using irutils::addTempToString;
 using irutils::addTempFloatToString;
 using irutils::minsToString;
 
+/// The format of a Mitsubishi 16-bit message.
+constexpr ir_protocol_t kMitsubishiProtocol = {
+    0, 0,  // No Header
+    kMitsubishiBitMark, kMitsubishiOneSpace,
+    kMitsubishiBitMark, kMitsubishiZeroSpace,
+    kMitsubishiBitMark, kMitsubishiMinGap, kMitsubishiMinCommandLength,
+    33, 50, true, 30, kMarkExcess};
+
 #if SEND_MITSUBISHI
 /// Send the supplied Mitsubishi 16-bit message.
 /// Status: STABLE / Working.
@@ -105,14 +104,14 @@ using irutils::minsToString;
 /// @see https://github.com/marcosamarinho/IRremoteESP8266/blob/master/ir_Mitsubishi.cpp
 /// @see GlobalCache's Control Tower's Mitsubishi TV data.
 void IRsend::sendMitsubishi(uint64_t data, uint16_t nbits, uint16_t repeat) {
-  sendGeneric(0, 0,  // No Header
-              kMitsubishiBitMark, kMitsubishiOneSpace, kMitsubishiBitMark,
-              kMitsubishiZeroSpace, kMitsubishiBitMark, kMitsubishiMinGap,
-              kMitsubishiMinCommandLength, data, nbits, 33, true, repeat, 50);
+  sendProtocol(kMitsubishiProtocol, data, nbits, repeat);
 }
 #endif  // SEND_MITSUBISHI
 
 #if DECODE_MITSUBISHI
+constexpr protocol_windows_t kMitsubishiWindows =
+    IRrecv::protocolWindows(kMitsubishiProtocol);
+
 /// Decode the supplied Mitsubishi 16-bit message.
 /// Status: STABLE / Working.
 /// @param[in,out] results Ptr to the data to decode & where to store the result
@@ -131,13 +130,9 @@ bool IRrecv::decodeMitsubishi(decode_results *results, uint16_t offset,
   uint64_t data = 0;
 
   // Match Data + Footer
-  if (!matchGeneric(results->rawbuf + offset, &data,
-                    results->rawlen - offset, nbits,
-                    0, 0,  // No header
-                    kMitsubishiBitMark, kMitsubishiOneSpace,
-                    kMitsubishiBitMark, kMitsubishiZeroSpace,
-                    kMitsubishiBitMark, kMitsubishiMinGap,
-                    true, 30)) return false;
+  if (!matchProtocol(results->rawbuf + offset, &data,
+                     results->rawlen - offset, nbits,
+                     kMitsubishiProtocol, kMitsubishiWindows)) return false;
   // Success
   results->decode_type = MITSUBISHI;
   results->bits = nbits;
@@ -819,69 +814,76 @@ bool IRMitsubishiAC::getWeeklyTimerEnabled(void) const { return _.WeeklyTimer; }
 String IRMitsubishiAC::toString(void) const {
   String result = "";
   result.reserve(110);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kMitsubishiAcAuto, kMitsubishiAcCool,
-                            kMitsubishiAcHeat, kMitsubishiAcDry,
-                            kMitsubishiAcFan);
-  result += addTempFloatToString(getTemp());
-  result += addFanToString(getFan(), kMitsubishiAcFanRealMax,
-                           kMitsubishiAcFanRealMax - 3,
-                           kMitsubishiAcFanAuto, kMitsubishiAcFanQuiet,
-                           kMitsubishiAcFanRealMax - 2);
-  result += addSwingVToString(_.Vane, kMitsubishiAcVaneAuto,
-                              kMitsubishiAcVaneHighest, kMitsubishiAcVaneHigh,
-                              kMitsubishiAcVaneAuto,  // Upper Middle unused.
-                              kMitsubishiAcVaneMiddle,
-                              kMitsubishiAcVaneAuto,  // Lower Middle unused.
-                              kMitsubishiAcVaneLow, kMitsubishiAcVaneLowest,
-                              kMitsubishiAcVaneAuto, kMitsubishiAcVaneSwing,
-                              // Below are unused.
-                              kMitsubishiAcVaneAuto, kMitsubishiAcVaneAuto);
-  result += addSwingHToString(_.WideVane, kMitsubishiAcWideVaneAuto,
-                              kMitsubishiAcWideVaneLeftMax,
-                              kMitsubishiAcWideVaneLeft,
-                              kMitsubishiAcWideVaneMiddle,
-                              kMitsubishiAcWideVaneRight,
-                              kMitsubishiAcWideVaneRightMax,
-                              kMitsubishiAcWideVaneAuto,  // Unused
-                              kMitsubishiAcWideVaneAuto,  // Unused
-                              kMitsubishiAcWideVaneAuto,  // Unused
-                              kMitsubishiAcWideVaneAuto,  // Unused
-                              kMitsubishiAcWideVaneWide);
-  result += addLabeledString(minsToString(_.Clock * 10), kClockStr);
-  result += addLabeledString(minsToString(_.StartClock * 10), kOnTimerStr);
-  result += addLabeledString(minsToString(_.StopClock * 10), kOffTimerStr);
-  result += kCommaSpaceStr;
-  result += kTimerStr;
-  result += kColonSpaceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMitsubishiAC::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kMitsubishiAcAuto, kMitsubishiAcCool,
+                  kMitsubishiAcHeat, kMitsubishiAcDry,
+                  kMitsubishiAcFan);
+  addTempFloatToString(out, getTemp());
+  addFanToString(out, getFan(), kMitsubishiAcFanRealMax,
+                 kMitsubishiAcFanRealMax - 3,
+                 kMitsubishiAcFanAuto, kMitsubishiAcFanQuiet,
+                 kMitsubishiAcFanRealMax - 2);
+  addSwingVToString(out, _.Vane, kMitsubishiAcVaneAuto,
+                    kMitsubishiAcVaneHighest, kMitsubishiAcVaneHigh,
+                    kMitsubishiAcVaneAuto,  // Upper Middle unused.
+                    kMitsubishiAcVaneMiddle,
+                    kMitsubishiAcVaneAuto,  // Lower Middle unused.
+                    kMitsubishiAcVaneLow, kMitsubishiAcVaneLowest,
+                    kMitsubishiAcVaneAuto, kMitsubishiAcVaneSwing,
+                    // Below are unused.
+                    kMitsubishiAcVaneAuto, kMitsubishiAcVaneAuto);
+  addSwingHToString(out, _.WideVane, kMitsubishiAcWideVaneAuto,
+                    kMitsubishiAcWideVaneLeftMax,
+                    kMitsubishiAcWideVaneLeft,
+                    kMitsubishiAcWideVaneMiddle,
+                    kMitsubishiAcWideVaneRight,
+                    kMitsubishiAcWideVaneRightMax,
+                    kMitsubishiAcWideVaneAuto,  // Unused
+                    kMitsubishiAcWideVaneAuto,  // Unused
+                    kMitsubishiAcWideVaneAuto,  // Unused
+                    kMitsubishiAcWideVaneAuto,  // Unused
+                    kMitsubishiAcWideVaneWide);
+  addLabeledString(out, minsToString(_.Clock * 10), kClockStr);
+  addLabeledString(out, minsToString(_.StartClock * 10), kOnTimerStr);
+  addLabeledString(out, minsToString(_.StopClock * 10), kOffTimerStr);
+  *out += kCommaSpaceStr;
+  *out += kTimerStr;
+  *out += kColonSpaceStr;
   switch (_.Timer) {
     case kMitsubishiAcNoTimer:
-      result += '-';
+      *out += '-';
       break;
     case kMitsubishiAcStartTimer:
-      result += kStartStr;
+      *out += kStartStr;
       break;
     case kMitsubishiAcStopTimer:
-      result += kStopStr;
+      *out += kStopStr;
       break;
     case kMitsubishiAcStartStopTimer:
-      result += kStartStr;
-      result += '+';
-      result += kStopStr;
+      *out += kStartStr;
+      *out += '+';
+      *out += kStopStr;
       break;
     default:
-      result += F("? (");
-      result += _.Timer;
-      result += ')';
+      *out += F("? (");
+      *out += _.Timer;
+      *out += ')';
   }
-  result += addBoolToString(_.WeeklyTimer, kWeeklyTimerStr);
-  result += addBoolToString(_.iSave10C, k10CHeatStr);
-  result += addBoolToString(_.ISee, kISeeStr);
-  result += addBoolToString(_.Ecocool, kEconoStr);
-  result += addBoolToString(_.AbsenseDetect, kAbsenseDetectStr);
-  result += addIntToString(_.DirectIndirect, kDirectIndirectModeStr);
-  result += addBoolToString(_.NaturalFlow, kFreshStr);
-  return result;
+  addBoolToString(out, _.WeeklyTimer, kWeeklyTimerStr);
+  addBoolToString(out, _.iSave10C, k10CHeatStr);
+  addBoolToString(out, _.ISee, kISeeStr);
+  addBoolToString(out, _.Ecocool, kEconoStr);
+  addBoolToString(out, _.AbsenseDetect, kAbsenseDetectStr);
+  addIntToString(out, _.DirectIndirect, kDirectIndirectModeStr);
+  addBoolToString(out, _.NaturalFlow, kFreshStr);
 }
 
 #if SEND_MITSUBISHI136
@@ -1223,31 +1225,38 @@ stdAc::state_t IRMitsubishi136::toCommon(void) const {
 String IRMitsubishi136::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kMitsubishi136Auto, kMitsubishi136Cool,
-                            kMitsubishi136Heat, kMitsubishi136Dry,
-                            kMitsubishi136Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kMitsubishi136FanMax,
-                           kMitsubishi136FanLow,  kMitsubishi136FanMax,
-                           kMitsubishi136FanQuiet, kMitsubishi136FanMed);
-  result += addSwingVToString(_.SwingV, kMitsubishi136SwingVAuto,
-                              kMitsubishi136SwingVHighest,
-                              kMitsubishi136SwingVHigh,
-                              kMitsubishi136SwingVAuto,  // Unused
-                              kMitsubishi136SwingVAuto,  // Unused
-                              kMitsubishi136SwingVAuto,  // Unused
-                              kMitsubishi136SwingVLow,
-                              kMitsubishi136SwingVLow,
-                              // Below are unused.
-                              kMitsubishi136SwingVAuto,
-                              kMitsubishi136SwingVAuto,
-                              kMitsubishi136SwingVAuto,
-                              kMitsubishi136SwingVAuto);
-  result += addBoolToString(getQuiet(), kQuietStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMitsubishi136::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kMitsubishi136Auto, kMitsubishi136Cool,
+                  kMitsubishi136Heat, kMitsubishi136Dry,
+                  kMitsubishi136Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kMitsubishi136FanMax,
+                 kMitsubishi136FanLow,  kMitsubishi136FanMax,
+                 kMitsubishi136FanQuiet, kMitsubishi136FanMed);
+  addSwingVToString(out, _.SwingV, kMitsubishi136SwingVAuto,
+                    kMitsubishi136SwingVHighest,
+                    kMitsubishi136SwingVHigh,
+                    kMitsubishi136SwingVAuto,  // Unused
+                    kMitsubishi136SwingVAuto,  // Unused
+                    kMitsubishi136SwingVAuto,  // Unused
+                    kMitsubishi136SwingVLow,
+                    kMitsubishi136SwingVLow,
+                    // Below are unused.
+                    kMitsubishi136SwingVAuto,
+                    kMitsubishi136SwingVAuto,
+                    kMitsubishi136SwingVAuto,
+                    kMitsubishi136SwingVAuto);
+  addBoolToString(out, getQuiet(), kQuietStr);
+}
+
 
 #if SEND_MITSUBISHI112
 /// Send a Mitsubishi 112-bit A/C formatted message. (MITSUBISHI112)
@@ -1690,38 +1699,45 @@ stdAc::state_t IRMitsubishi112::toCommon(void) const {
 String IRMitsubishi112::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kMitsubishi112Auto, kMitsubishi112Cool,
-                            kMitsubishi112Heat, kMitsubishi112Dry,
-                            kMitsubishi112Auto);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kMitsubishi112FanMax,
-                           kMitsubishi112FanLow,  kMitsubishi112FanMax,
-                           kMitsubishi112FanQuiet, kMitsubishi112FanMed);
-  result += addSwingVToString(_.SwingV, kMitsubishi112SwingVAuto,
-                             kMitsubishi112SwingVHighest,
-                             kMitsubishi112SwingVHigh,
-                             kMitsubishi112SwingVAuto,  // Upper Middle unused.
-                             kMitsubishi112SwingVMiddle,
-                             kMitsubishi112SwingVAuto,  // Lower Middle unused.
-                             kMitsubishi112SwingVLow,
-                             kMitsubishi112SwingVLowest,
-                             // Below are unused.
-                             kMitsubishi112SwingVAuto,
-                             kMitsubishi112SwingVAuto,
-                             kMitsubishi112SwingVAuto,
-                             kMitsubishi112SwingVAuto);
-  result += addSwingHToString(_.SwingH, kMitsubishi112SwingHAuto,
-                              kMitsubishi112SwingHLeftMax,
-                              kMitsubishi112SwingHLeft,
-                              kMitsubishi112SwingHMiddle,
-                              kMitsubishi112SwingHRight,
-                              kMitsubishi112SwingHRightMax,
-                              kMitsubishi112SwingHAuto,  // Unused
-                              kMitsubishi112SwingHAuto,  // Unused
-                              kMitsubishi112SwingHAuto,  // Unused
-                              kMitsubishi112SwingHAuto,  // Unused
-                              kMitsubishi112SwingHWide);
-  result += addBoolToString(getQuiet(), kQuietStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMitsubishi112::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kMitsubishi112Auto, kMitsubishi112Cool,
+                  kMitsubishi112Heat, kMitsubishi112Dry,
+                  kMitsubishi112Auto);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kMitsubishi112FanMax,
+                 kMitsubishi112FanLow,  kMitsubishi112FanMax,
+                 kMitsubishi112FanQuiet, kMitsubishi112FanMed);
+  addSwingVToString(out, _.SwingV, kMitsubishi112SwingVAuto,
+                   kMitsubishi112SwingVHighest,
+                   kMitsubishi112SwingVHigh,
+                   kMitsubishi112SwingVAuto,  // Upper Middle unused.
+                   kMitsubishi112SwingVMiddle,
+                   kMitsubishi112SwingVAuto,  // Lower Middle unused.
+                   kMitsubishi112SwingVLow,
+                   kMitsubishi112SwingVLowest,
+                   // Below are unused.
+                   kMitsubishi112SwingVAuto,
+                   kMitsubishi112SwingVAuto,
+                   kMitsubishi112SwingVAuto,
+                   kMitsubishi112SwingVAuto);
+  addSwingHToString(out, _.SwingH, kMitsubishi112SwingHAuto,
+                    kMitsubishi112SwingHLeftMax,
+                    kMitsubishi112SwingHLeft,
+                    kMitsubishi112SwingHMiddle,
+                    kMitsubishi112SwingHRight,
+                    kMitsubishi112SwingHRightMax,
+                    kMitsubishi112SwingHAuto,  // Unused
+                    kMitsubishi112SwingHAuto,  // Unused
+                    kMitsubishi112SwingHAuto,  // Unused
+                    kMitsubishi112SwingHAuto,  // Unused
+                    kMitsubishi112SwingHWide);
+  addBoolToString(out, getQuiet(), kQuietStr);
+}
@@ -21,8 +21,6 @@
 #endif
 
 // Constants
-const uint16_t kMitsubishiHeavyHdrMark = 3140;
-const uint16_t kMitsubishiHeavyHdrSpace = 1630;
 const uint16_t kMitsubishiHeavyBitMark = 370;
 const uint16_t kMitsubishiHeavyOneSpace = 420;
 const uint16_t kMitsubishiHeavyZeroSpace = 1220;
@@ -482,72 +480,79 @@ stdAc::state_t IRMitsubishiHeavy152Ac::toCommon(void) const {
 String IRMitsubishiHeavy152Ac::toString(void) const {
   String result = "";
   result.reserve(180);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kMitsubishiHeavyAuto,
-                            kMitsubishiHeavyCool, kMitsubishiHeavyHeat,
-                            kMitsubishiHeavyDry, kMitsubishiHeavyFan);
-  result += addTempToString(getTemp());
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMitsubishiHeavy152Ac::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kMitsubishiHeavyAuto,
+                  kMitsubishiHeavyCool, kMitsubishiHeavyHeat,
+                  kMitsubishiHeavyDry, kMitsubishiHeavyFan);
+  addTempToString(out, getTemp());
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
     case kMitsubishiHeavy152FanAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kMitsubishiHeavy152FanHigh:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kMitsubishiHeavy152FanLow:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kMitsubishiHeavy152FanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kMitsubishiHeavy152FanMax:
-      result += kMaxStr;
+      *out += kMaxStr;
       break;
     case kMitsubishiHeavy152FanEcono:
-      result += kEconoStr;
+      *out += kEconoStr;
       break;
     case kMitsubishiHeavy152FanTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addSwingVToString(_.SwingV, kMitsubishiHeavy152SwingVAuto,
-                              kMitsubishiHeavy152SwingVHighest,
-                              kMitsubishiHeavy152SwingVHigh,
-                              kMitsubishiHeavy152SwingVAuto,  // UpperMid unused
-                              kMitsubishiHeavy152SwingVMiddle,
-                              kMitsubishiHeavy152SwingVAuto,  // LowerMid unused
-                              kMitsubishiHeavy152SwingVLow,
-                              kMitsubishiHeavy152SwingVLowest,
-                              kMitsubishiHeavy152SwingVOff,
-                              // Below are unused.
-                              kMitsubishiHeavy152SwingVAuto,
-                              kMitsubishiHeavy152SwingVAuto,
-                              kMitsubishiHeavy152SwingVAuto);
-  result += addSwingHToString(_.SwingH, kMitsubishiHeavy152SwingHAuto,
-                              kMitsubishiHeavy152SwingHLeftMax,
-                              kMitsubishiHeavy152SwingHLeft,
-                              kMitsubishiHeavy152SwingHMiddle,
-                              kMitsubishiHeavy152SwingHRight,
-                              kMitsubishiHeavy152SwingHRightMax,
-                              kMitsubishiHeavy152SwingHOff,
-                              kMitsubishiHeavy152SwingHLeftRight,
-                              kMitsubishiHeavy152SwingHRightLeft,
-                              // Below are unused.
-                              kMitsubishiHeavy152SwingHAuto,
-                              kMitsubishiHeavy152SwingHAuto);
-  result += addBoolToString(_.Silent, kSilentStr);
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(getEcono(), kEconoStr);
-  result += addBoolToString(_.Night, kNightStr);
-  result += addBoolToString(_.Filter, kFilterStr);
-  result += addBoolToString(get3D(), k3DStr);
-  result += addBoolToString(getClean(), kCleanStr);
-  return result;
+  *out += ')';
+  addSwingVToString(out, _.SwingV, kMitsubishiHeavy152SwingVAuto,
+                    kMitsubishiHeavy152SwingVHighest,
+                    kMitsubishiHeavy152SwingVHigh,
+                    kMitsubishiHeavy152SwingVAuto,  // UpperMid unused
+                    kMitsubishiHeavy152SwingVMiddle,
+                    kMitsubishiHeavy152SwingVAuto,  // LowerMid unused
+                    kMitsubishiHeavy152SwingVLow,
+                    kMitsubishiHeavy152SwingVLowest,
+                    kMitsubishiHeavy152SwingVOff,
+                    // Below are unused.
+                    kMitsubishiHeavy152SwingVAuto,
+                    kMitsubishiHeavy152SwingVAuto,
+                    kMitsubishiHeavy152SwingVAuto);
+  addSwingHToString(out, _.SwingH, kMitsubishiHeavy152SwingHAuto,
+                    kMitsubishiHeavy152SwingHLeftMax,
+                    kMitsubishiHeavy152SwingHLeft,
+                    kMitsubishiHeavy152SwingHMiddle,
+                    kMitsubishiHeavy152SwingHRight,
+                    kMitsubishiHeavy152SwingHRightMax,
+                    kMitsubishiHeavy152SwingHOff,
+                    kMitsubishiHeavy152SwingHLeftRight,
+                    kMitsubishiHeavy152SwingHRightLeft,
+                    // Below are unused.
+                    kMitsubishiHeavy152SwingHAuto,
+                    kMitsubishiHeavy152SwingHAuto);
+  addBoolToString(out, _.Silent, kSilentStr);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, getEcono(), kEconoStr);
+  addBoolToString(out, _.Night, kNightStr);
+  addBoolToString(out, _.Filter, kFilterStr);
+  addBoolToString(out, get3D(), k3DStr);
+  addBoolToString(out, getClean(), kCleanStr);
 }
 
 
@@ -927,67 +932,74 @@ stdAc::state_t IRMitsubishiHeavy88Ac::toCommon(void) const {
 String IRMitsubishiHeavy88Ac::toString(void) const {
   String result = "";
   result.reserve(140);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kMitsubishiHeavyAuto,
-                            kMitsubishiHeavyCool, kMitsubishiHeavyHeat,
-                            kMitsubishiHeavyDry, kMitsubishiHeavyFan);
-  result += addTempToString(getTemp());
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRMitsubishiHeavy88Ac::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kMitsubishiHeavyAuto,
+                  kMitsubishiHeavyCool, kMitsubishiHeavyHeat,
+                  kMitsubishiHeavyDry, kMitsubishiHeavyFan);
+  addTempToString(out, getTemp());
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
     case kMitsubishiHeavy88FanAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kMitsubishiHeavy88FanHigh:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kMitsubishiHeavy88FanLow:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kMitsubishiHeavy88FanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kMitsubishiHeavy88FanEcono:
-      result += kEconoStr;
+      *out += kEconoStr;
       break;
     case kMitsubishiHeavy88FanTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addSwingVToString(getSwingVertical(), kMitsubishiHeavy88SwingVAuto,
-                              kMitsubishiHeavy88SwingVHighest,
-                              kMitsubishiHeavy88SwingVHigh,
-                              kMitsubishiHeavy88SwingVAuto,  // UpperMid unused
-                              kMitsubishiHeavy88SwingVMiddle,
-                              kMitsubishiHeavy88SwingVAuto,  // LowerMid unused
-                              kMitsubishiHeavy88SwingVLow,
-                              kMitsubishiHeavy88SwingVLowest,
-                              kMitsubishiHeavy88SwingVOff,
-                              // Below are unused.
-                              kMitsubishiHeavy88SwingVAuto,
-                              kMitsubishiHeavy88SwingVAuto,
-                              kMitsubishiHeavy88SwingVAuto);
-  result += addSwingHToString(getSwingHorizontal(),
-                              kMitsubishiHeavy88SwingHAuto,
-                              kMitsubishiHeavy88SwingHLeftMax,
-                              kMitsubishiHeavy88SwingHLeft,
-                              kMitsubishiHeavy88SwingHMiddle,
-                              kMitsubishiHeavy88SwingHRight,
-                              kMitsubishiHeavy88SwingHRightMax,
-                              kMitsubishiHeavy88SwingHOff,
-                              kMitsubishiHeavy88SwingHLeftRight,
-                              kMitsubishiHeavy88SwingHRightLeft,
-                              kMitsubishiHeavy88SwingH3D,
-                              // Below are unused.
-                              kMitsubishiHeavy88SwingHAuto);
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(getEcono(), kEconoStr);
-  result += addBoolToString(get3D(), k3DStr);
-  result += addBoolToString(_.Clean, kCleanStr);
-  return result;
+  *out += ')';
+  addSwingVToString(out, getSwingVertical(), kMitsubishiHeavy88SwingVAuto,
+                    kMitsubishiHeavy88SwingVHighest,
+                    kMitsubishiHeavy88SwingVHigh,
+                    kMitsubishiHeavy88SwingVAuto,  // UpperMid unused
+                    kMitsubishiHeavy88SwingVMiddle,
+                    kMitsubishiHeavy88SwingVAuto,  // LowerMid unused
+                    kMitsubishiHeavy88SwingVLow,
+                    kMitsubishiHeavy88SwingVLowest,
+                    kMitsubishiHeavy88SwingVOff,
+                    // Below are unused.
+                    kMitsubishiHeavy88SwingVAuto,
+                    kMitsubishiHeavy88SwingVAuto,
+                    kMitsubishiHeavy88SwingVAuto);
+  addSwingHToString(out, getSwingHorizontal(),
+                    kMitsubishiHeavy88SwingHAuto,
+                    kMitsubishiHeavy88SwingHLeftMax,
+                    kMitsubishiHeavy88SwingHLeft,
+                    kMitsubishiHeavy88SwingHMiddle,
+                    kMitsubishiHeavy88SwingHRight,
+                    kMitsubishiHeavy88SwingHRightMax,
+                    kMitsubishiHeavy88SwingHOff,
+                    kMitsubishiHeavy88SwingHLeftRight,
+                    kMitsubishiHeavy88SwingHRightLeft,
+                    kMitsubishiHeavy88SwingH3D,
+                    // Below are unused.
+                    kMitsubishiHeavy88SwingHAuto);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, getEcono(), kEconoStr);
+  addBoolToString(out, get3D(), k3DStr);
+  addBoolToString(out, _.Clean, kCleanStr);
 }
 
 #if DECODE_MITSUBISHIHEAVY
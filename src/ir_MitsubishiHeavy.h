@@ -75,6 +75,8 @@ union Mitsubishi152Protocol{
 };
 
 // Constants.
+const uint16_t kMitsubishiHeavyHdrMark = 3140;
+const uint16_t kMitsubishiHeavyHdrSpace = 1630;
 const uint8_t kMitsubishiHeavySigLength = 5;
 
 // ZMS (152 bit)
@@ -254,6 +256,7 @@ class IRMitsubishiHeavy152Ac {
   static stdAc::swingh_t toCommonSwingH(const uint8_t pos);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -331,6 +334,7 @@ class IRMitsubishiHeavy88Ac {
   static stdAc::swingh_t toCommonSwingH(const uint8_t pos);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -14,6 +14,12 @@
 #include "IRsend.h"
 #include "IRutils.h"
 
+/// The format of an NEC message. (Excluding the repeat code)
+constexpr ir_protocol_t kNecProtocol = {
+    kNecHdrMark, kNecHdrSpace, kNecBitMark, kNecOneSpace, kNecBitMark,
+    kNecZeroSpace, kNecBitMark, kNecMinGap, kNecMinCommandLength,
+    38, 33, true, kUseDefTol, kMarkExcess};
+
 // This protocol is used by a lot of other protocols, hence the long list.
 #if (SEND_NEC || SEND_SHERWOOD || SEND_AIWA_RC_T501 || SEND_SANYO || \
      SEND_MIDEA24)
@@ -26,10 +32,7 @@
 /// @note This protocol appears to have no header.
 /// @see http://www.sbprojects.net/knowledge/ir/nec.php
 void IRsend::sendNEC(uint64_t data, uint16_t nbits, uint16_t repeat) {
-  sendGeneric(kNecHdrMark, kNecHdrSpace, kNecBitMark, kNecOneSpace, kNecBitMark,
-              kNecZeroSpace, kNecBitMark, kNecMinGap, kNecMinCommandLength,
-              data, nbits, 38, true, 0,  // Repeats are handled later.
-              33);
+  sendProtocol(kNecProtocol, data, nbits, 0);  // Repeats are handled later.
   // Optional command repeat sequence.
   if (repeat)
     sendGeneric(kNecHdrMark, kNecRptSpace, 0, 0, 0, 0,  // No actual data sent.
@@ -63,6 +66,9 @@ uint32_t IRsend::encodeNEC(uint16_t address, uint16_t command) {
 
 // This protocol is used by a lot of other protocols, hence the long list.
 #if (DECODE_NEC || DECODE_SHERWOOD || DECODE_AIWA_RC_T501 || DECODE_SANYO)
+constexpr protocol_windows_t kNecWindows =
+    IRrecv::protocolWindows(kNecProtocol);
+
 /// Decode the supplied NEC (Renesas) message.
 /// Status: STABLE / Known good.
 /// @param[in,out] results Ptr to the data to decode & where to store the result
@@ -88,12 +94,12 @@ bool IRrecv::decodeNEC(decode_results *results, uint16_t offset,
   uint64_t data = 0;
 
   // Header - All NEC messages have this Header Mark.
-  if (!matchMark(results->rawbuf[offset++], kNecHdrMark)) return false;
+  if (!matchMark(results->rawbuf[offset], kNecHdrMark)) return false;
   // Check if it is a repeat code.
-  if (matchSpace(results->rawbuf[offset], kNecRptSpace) &&
-      matchMark(results->rawbuf[offset + 1], kNecBitMark) &&
-      (offset + 2 <= results->rawlen ||
-       matchAtLeast(results->rawbuf[offset + 2], kNecMinGap))) {
+  if (matchSpace(results->rawbuf[offset + 1], kNecRptSpace) &&
+      matchMark(results->rawbuf[offset + 2], kNecBitMark) &&
+      (offset + 3 <= results->rawlen ||
+       matchAtLeast(results->rawbuf[offset + 3], kNecMinGap))) {
     results->value = kRepeat;
     results->decode_type = NEC;
     results->bits = 0;
@@ -103,13 +109,9 @@ bool IRrecv::decodeNEC(decode_results *results, uint16_t offset,
     return true;
   }
 
-  // Match Header (cont.) + Data + Footer
-  if (!matchGeneric(results->rawbuf + offset, &data,
-                    results->rawlen - offset, nbits,
-                    0, kNecHdrSpace,
-                    kNecBitMark, kNecOneSpace,
-                    kNecBitMark, kNecZeroSpace,
-                    kNecBitMark, kNecMinGap, true)) return false;
+  // Match Header + Data + Footer
+  if (!matchProtocol(results->rawbuf + offset, &data, results->rawlen - offset,
+                     nbits, kNecProtocol, kNecWindows)) return false;
   // Compliance
   // Calculate command and optionally enforce integrity checking.
   uint8_t command = (data & 0xFF00) >> 8;
@@ -17,8 +17,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kNeoclimaHdrMark = 6112;
-const uint16_t kNeoclimaHdrSpace = 7391;
 const uint16_t kNeoclimaBitMark = 537;
 const uint16_t kNeoclimaOneSpace = 1651;
 const uint16_t kNeoclimaZeroSpace = 571;
@@ -514,49 +512,56 @@ stdAc::state_t IRNeoclimaAc::toCommon(void) const {
 String IRNeoclimaAc::toString(void) const {
   String result = "";
   result.reserve(110);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kNeoclimaAuto, kNeoclimaCool,
-                            kNeoclimaHeat, kNeoclimaDry, kNeoclimaFan);
-  result += addTempToString(getTemp(), getTempUnits());
-  result += addFanToString(_.Fan, kNeoclimaFanHigh, kNeoclimaFanLow,
-                           kNeoclimaFanAuto, kNeoclimaFanAuto, kNeoclimaFanMed);
-  result += addBoolToString(getSwingV(), kSwingVStr);
-  result += addBoolToString(getSwingH(), kSwingHStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addBoolToString(_.Hold, kHoldStr);
-  result += addBoolToString(_.Ion, kIonStr);
-  result += addBoolToString(_.Eye, kEyeStr);
-  result += addBoolToString(_.Light, kLightStr);
-  result += addBoolToString(getFollow(), kFollowStr);
-  result += addBoolToString(_.CHeat, k8CHeatStr);
-  result += addBoolToString(_.Fresh, kFreshStr);
-  result += addIntToString(_.Button, kButtonStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRNeoclimaAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kNeoclimaAuto, kNeoclimaCool,
+                  kNeoclimaHeat, kNeoclimaDry, kNeoclimaFan);
+  addTempToString(out, getTemp(), getTempUnits());
+  addFanToString(out, _.Fan, kNeoclimaFanHigh, kNeoclimaFanLow,
+                 kNeoclimaFanAuto, kNeoclimaFanAuto, kNeoclimaFanMed);
+  addBoolToString(out, getSwingV(), kSwingVStr);
+  addBoolToString(out, getSwingH(), kSwingHStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addBoolToString(out, _.Hold, kHoldStr);
+  addBoolToString(out, _.Ion, kIonStr);
+  addBoolToString(out, _.Eye, kEyeStr);
+  addBoolToString(out, _.Light, kLightStr);
+  addBoolToString(out, getFollow(), kFollowStr);
+  addBoolToString(out, _.CHeat, k8CHeatStr);
+  addBoolToString(out, _.Fresh, kFreshStr);
+  addIntToString(out, _.Button, kButtonStr);
+  *out += kSpaceLBraceStr;
   switch (_.Button) {
-    case kNeoclimaButtonPower:    result += kPowerStr; break;
-    case kNeoclimaButtonMode:     result += kModeStr; break;
-    case kNeoclimaButtonTempUp:   result += kTempUpStr; break;
-    case kNeoclimaButtonTempDown: result += kTempDownStr; break;
-    case kNeoclimaButtonSwing:    result += kSwingStr; break;
-    case kNeoclimaButtonFanSpeed: result += kFanStr; break;
-    case kNeoclimaButtonAirFlow:  result += kAirFlowStr; break;
-    case kNeoclimaButtonHold:     result += kHoldStr; break;
-    case kNeoclimaButtonSleep:    result += kSleepStr; break;
-    case kNeoclimaButtonLight:    result += kLightStr; break;
-    case kNeoclimaButtonEye:      result += kEyeStr; break;
-    case kNeoclimaButtonFollow:   result += kFollowStr; break;
-    case kNeoclimaButtonIon:      result += kIonStr; break;
-    case kNeoclimaButtonFresh:    result += kFreshStr; break;
-    case kNeoclimaButton8CHeat:   result += k8CHeatStr; break;
-    case kNeoclimaButtonTurbo:    result += kTurboStr; break;
-    case kNeoclimaButtonEcono:    result += kEconoStr; break;
-    case kNeoclimaButtonTempUnit: result += kCelsiusFahrenheitStr; break;
-    default:                      result += kUnknownStr;
+    case kNeoclimaButtonPower:    *out += kPowerStr; break;
+    case kNeoclimaButtonMode:     *out += kModeStr; break;
+    case kNeoclimaButtonTempUp:   *out += kTempUpStr; break;
+    case kNeoclimaButtonTempDown: *out += kTempDownStr; break;
+    case kNeoclimaButtonSwing:    *out += kSwingStr; break;
+    case kNeoclimaButtonFanSpeed: *out += kFanStr; break;
+    case kNeoclimaButtonAirFlow:  *out += kAirFlowStr; break;
+    case kNeoclimaButtonHold:     *out += kHoldStr; break;
+    case kNeoclimaButtonSleep:    *out += kSleepStr; break;
+    case kNeoclimaButtonLight:    *out += kLightStr; break;
+    case kNeoclimaButtonEye:      *out += kEyeStr; break;
+    case kNeoclimaButtonFollow:   *out += kFollowStr; break;
+    case kNeoclimaButtonIon:      *out += kIonStr; break;
+    case kNeoclimaButtonFresh:    *out += kFreshStr; break;
+    case kNeoclimaButton8CHeat:   *out += k8CHeatStr; break;
+    case kNeoclimaButtonTurbo:    *out += kTurboStr; break;
+    case kNeoclimaButtonEcono:    *out += kEconoStr; break;
+    case kNeoclimaButtonTempUnit: *out += kCelsiusFahrenheitStr; break;
+    default:                      *out += kUnknownStr;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 #if DECODE_NEOCLIMA
@@ -76,6 +76,8 @@ union NeoclimaProtocol {
 };
 
 // Constants
+const uint16_t kNeoclimaHdrMark = 6112;
+const uint16_t kNeoclimaHdrSpace = 7391;
 
 const uint8_t kNeoclimaButtonPower =    0x00;
 const uint8_t kNeoclimaButtonMode =     0x01;
@@ -177,6 +179,7 @@ class IRNeoclimaAc {
   static uint8_t calcChecksum(const uint8_t state[],
                               const uint16_t length = kNeoclimaStateLength);
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
   static uint8_t convertMode(const stdAc::opmode_t mode);
   static uint8_t convertFan(const stdAc::fanspeed_t speed);
   static stdAc::opmode_t toCommonMode(const uint8_t mode);
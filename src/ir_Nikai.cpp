@@ -12,13 +12,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Nikai.h"
 
 // Constants
-const uint16_t kNikaiTick = 500;
-const uint16_t kNikaiHdrMarkTicks = 8;
-const uint16_t kNikaiHdrMark = kNikaiHdrMarkTicks * kNikaiTick;
-const uint16_t kNikaiHdrSpaceTicks = 8;
-const uint16_t kNikaiHdrSpace = kNikaiHdrSpaceTicks * kNikaiTick;
 const uint16_t kNikaiBitMarkTicks = 1;
 const uint16_t kNikaiBitMark = kNikaiBitMarkTicks * kNikaiTick;
 const uint16_t kNikaiOneSpaceTicks = 2;
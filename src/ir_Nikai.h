@@ -0,0 +1,20 @@
+// Copyright 2009 Ken Shirriff
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief Nikai
+
+#ifndef IR_NIKAI_H_
+#define IR_NIKAI_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kNikaiTick = 500;
+const uint16_t kNikaiHdrMarkTicks = 8;
+const uint16_t kNikaiHdrMark = kNikaiHdrMarkTicks * kNikaiTick;
+const uint16_t kNikaiHdrSpaceTicks = 8;
+const uint16_t kNikaiHdrSpace = kNikaiHdrSpaceTicks * kNikaiTick;
+
+#endif  // IR_NIKAI_H_
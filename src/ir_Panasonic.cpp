@@ -25,8 +25,6 @@
 
 // Constants
 /// @see http://www.remotecentral.com/cgi-bin/mboard/rc-pronto/thread.cgi?26152
-const uint16_t kPanasonicHdrMark = 3456;             ///< uSeconds.
-const uint16_t kPanasonicHdrSpace = 1728;            ///< uSeconds.
 const uint16_t kPanasonicBitMark = 432;              ///< uSeconds.
 const uint16_t kPanasonicOneSpace = 1296;            ///< uSeconds.
 const uint16_t kPanasonicZeroSpace = 432;            ///< uSeconds.
@@ -38,9 +36,7 @@ const uint16_t kPanasonicAcSectionGap = 10000;       ///< uSeconds.
 const uint16_t kPanasonicAcSection1Length = 8;
 const uint32_t kPanasonicAcMessageGap = kDefaultMessageGap;  // Just a guess.
 
-const uint16_t kPanasonicAc32HdrMark = 3543;         ///< uSeconds.
 const uint16_t kPanasonicAc32BitMark = 920;          ///< uSeconds.
-const uint16_t kPanasonicAc32HdrSpace = 3450;        ///< uSeconds.
 const uint16_t kPanasonicAc32OneSpace = 2575;        ///< uSeconds.
 const uint16_t kPanasonicAc32ZeroSpace = 828;        ///< uSeconds.
 const uint16_t kPanasonicAc32SectionGap = 13946;     ///< uSeconds.
@@ -800,57 +796,64 @@ stdAc::state_t IRPanasonicAc::toCommon(void) {
 String IRPanasonicAc::toString(void) {
   String result = "";
   result.reserve(180);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::PANASONIC_AC, getModel(), false);
-  result += addBoolToString(getPower(), kPowerStr);
-  result += addModeToString(getMode(), kPanasonicAcAuto, kPanasonicAcCool,
-                            kPanasonicAcHeat, kPanasonicAcDry, kPanasonicAcFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kPanasonicAcFanHigh, kPanasonicAcFanLow,
-                           kPanasonicAcFanAuto, kPanasonicAcFanMin,
-                           kPanasonicAcFanMed, kPanasonicAcFanMax);
-  result += addSwingVToString(getSwingVertical(), kPanasonicAcSwingVAuto,
-                              kPanasonicAcSwingVHighest,
-                              kPanasonicAcSwingVHigh,
-                              kPanasonicAcSwingVAuto,  // Upper Middle is unused
-                              kPanasonicAcSwingVMiddle,
-                              kPanasonicAcSwingVAuto,  // Lower Middle is unused
-                              kPanasonicAcSwingVLow,
-                              kPanasonicAcSwingVLowest,
-                              // Below are unused.
-                              kPanasonicAcSwingVAuto,
-                              kPanasonicAcSwingVAuto,
-                              kPanasonicAcSwingVAuto,
-                              kPanasonicAcSwingVAuto);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRPanasonicAc::toString(IRtextWriter *out) {
+  addModelToString(out, decode_type_t::PANASONIC_AC, getModel(), false);
+  addBoolToString(out, getPower(), kPowerStr);
+  addModeToString(out, getMode(), kPanasonicAcAuto, kPanasonicAcCool,
+                  kPanasonicAcHeat, kPanasonicAcDry, kPanasonicAcFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kPanasonicAcFanHigh, kPanasonicAcFanLow,
+                 kPanasonicAcFanAuto, kPanasonicAcFanMin,
+                 kPanasonicAcFanMed, kPanasonicAcFanMax);
+  addSwingVToString(out, getSwingVertical(), kPanasonicAcSwingVAuto,
+                    kPanasonicAcSwingVHighest,
+                    kPanasonicAcSwingVHigh,
+                    kPanasonicAcSwingVAuto,  // Upper Middle is unused
+                    kPanasonicAcSwingVMiddle,
+                    kPanasonicAcSwingVAuto,  // Lower Middle is unused
+                    kPanasonicAcSwingVLow,
+                    kPanasonicAcSwingVLowest,
+                    // Below are unused.
+                    kPanasonicAcSwingVAuto,
+                    kPanasonicAcSwingVAuto,
+                    kPanasonicAcSwingVAuto,
+                    kPanasonicAcSwingVAuto);
   switch (getModel()) {
     case kPanasonicJke:
     case kPanasonicCkp:
       break;  // No Horizontal Swing support.
     default:
-      result += addSwingHToString(getSwingHorizontal(), kPanasonicAcSwingHAuto,
-                                  kPanasonicAcSwingHFullLeft,
-                                  kPanasonicAcSwingHLeft,
-                                  kPanasonicAcSwingHMiddle,
-                                  kPanasonicAcSwingHRight,
-                                  kPanasonicAcSwingHFullRight,
-                                  // Below are unused.
-                                  kPanasonicAcSwingHAuto,
-                                  kPanasonicAcSwingHAuto,
-                                  kPanasonicAcSwingHAuto,
-                                  kPanasonicAcSwingHAuto,
-                                  kPanasonicAcSwingHAuto);
+      addSwingHToString(out, getSwingHorizontal(), kPanasonicAcSwingHAuto,
+                        kPanasonicAcSwingHFullLeft,
+                        kPanasonicAcSwingHLeft,
+                        kPanasonicAcSwingHMiddle,
+                        kPanasonicAcSwingHRight,
+                        kPanasonicAcSwingHFullRight,
+                        // Below are unused.
+                        kPanasonicAcSwingHAuto,
+                        kPanasonicAcSwingHAuto,
+                        kPanasonicAcSwingHAuto,
+                        kPanasonicAcSwingHAuto,
+                        kPanasonicAcSwingHAuto);
   }
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addBoolToString(getPowerful(), kPowerfulStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addBoolToString(out, getPowerful(), kPowerfulStr);
   if (getModel() == kPanasonicDke)
-    result += addBoolToString(getIon(), kIonStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
-  result += addLabeledString(
+    addBoolToString(out, getIon(), kIonStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+  addLabeledString(out,
       isOnTimerEnabled() ? minsToString(getOnTimer()) : kOffStr,
       kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       isOffTimerEnabled() ? minsToString(getOffTimer()) : kOffStr,
       kOffTimerStr);
-  return result;
 }
 
 #if DECODE_PANASONIC_AC
@@ -1289,32 +1292,39 @@ uint8_t IRPanasonicAc32::convertSwingV(const stdAc::swingv_t position) {
 String IRPanasonicAc32::toString(void) const {
   String result = "";
   result.reserve(110);
-  result += addBoolToString(getPowerToggle(), kPowerToggleStr, false);
-  result += addModeToString(_.Mode, kPanasonicAc32Auto, kPanasonicAc32Cool,
-                            kPanasonicAc32Heat, kPanasonicAc32Dry,
-                            kPanasonicAc32Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kPanasonicAc32FanHigh, kPanasonicAc32FanLow,
-                           kPanasonicAc32FanAuto, kPanasonicAc32FanMin,
-                           kPanasonicAc32FanMed, kPanasonicAc32FanMax);
-  result += addBoolToString(_.SwingH, kSwingHStr);
-  result += addSwingVToString(getSwingVertical(),
-                              kPanasonicAc32SwingVAuto,
-                              kPanasonicAcSwingVHighest,
-                              kPanasonicAcSwingVHigh,
-                              kPanasonicAc32SwingVAuto,  // Upper Middle unused
-                              kPanasonicAcSwingVMiddle,
-                              kPanasonicAc32SwingVAuto,  // Lower Middle unused
-                              kPanasonicAcSwingVLow,
-                              kPanasonicAcSwingVLowest,
-                              // Below are unused.
-                              kPanasonicAc32SwingVAuto,
-                              kPanasonicAc32SwingVAuto,
-                              kPanasonicAc32SwingVAuto,
-                              kPanasonicAc32SwingVAuto);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRPanasonicAc32::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPowerToggle(), kPowerToggleStr, false);
+  addModeToString(out, _.Mode, kPanasonicAc32Auto, kPanasonicAc32Cool,
+                  kPanasonicAc32Heat, kPanasonicAc32Dry,
+                  kPanasonicAc32Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kPanasonicAc32FanHigh, kPanasonicAc32FanLow,
+                 kPanasonicAc32FanAuto, kPanasonicAc32FanMin,
+                 kPanasonicAc32FanMed, kPanasonicAc32FanMax);
+  addBoolToString(out, _.SwingH, kSwingHStr);
+  addSwingVToString(out, getSwingVertical(),
+                    kPanasonicAc32SwingVAuto,
+                    kPanasonicAcSwingVHighest,
+                    kPanasonicAcSwingVHigh,
+                    kPanasonicAc32SwingVAuto,  // Upper Middle unused
+                    kPanasonicAcSwingVMiddle,
+                    kPanasonicAc32SwingVAuto,  // Lower Middle unused
+                    kPanasonicAcSwingVLow,
+                    kPanasonicAcSwingVLowest,
+                    // Below are unused.
+                    kPanasonicAc32SwingVAuto,
+                    kPanasonicAc32SwingVAuto,
+                    kPanasonicAc32SwingVAuto,
+                    kPanasonicAc32SwingVAuto);
+}
+
 /// Convert the current internal state into its stdAc::state_t equivalent.
 /// @param[in] prev Ptr to the previous state if required.
 /// @return The stdAc equivalent of the native settings.
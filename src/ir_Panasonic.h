@@ -45,6 +45,10 @@
 #endif
 
 // Constants
+const uint16_t kPanasonicHdrMark = 3456;             ///< uSeconds.
+const uint16_t kPanasonicHdrSpace = 1728;            ///< uSeconds.
+const uint16_t kPanasonicAc32HdrMark = 3543;         ///< uSeconds.
+const uint16_t kPanasonicAc32HdrSpace = 3450;        ///< uSeconds.
 const uint16_t kPanasonicFreq = 36700;
 const uint16_t kPanasonicAcExcess = 0;
 // Much higher than usual. See issue #540.
@@ -167,6 +171,7 @@ class IRPanasonicAc {
   static stdAc::swingh_t toCommonSwingH(const uint8_t pos);
   stdAc::state_t toCommon(void);
   String toString(void);
+  void toString(IRtextWriter *out);
 #ifndef UNIT_TEST
 
  private:
@@ -258,6 +263,7 @@ class IRPanasonicAc32 {
   static stdAc::swingv_t toCommonSwingV(const uint8_t pos);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -0,0 +1,19 @@
+// Copyright 2009 Ken Shirriff
+// Copyright 2017, 2018 David Conran
+// Copyright 2018 Kamil Palczewski
+// Copyright 2019 s-hadinger
+
+/// @file
+/// @brief Pioneer remote emulation
+
+#ifndef IR_PIONEER_H_
+#define IR_PIONEER_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kPioneerHdrMark = 8506;  ///< uSeconds.
+const uint16_t kPioneerHdrSpace = 4191;  ///< uSeconds.
+
+#endif  // IR_PIONEER_H_
@@ -23,6 +23,7 @@
 #include "IRsend.h"
 #include "IRtimer.h"
 #include "IRutils.h"
+#include "ir_RC5_RC6.h"
 
 // Constants
 // RC-5/RC-5X
@@ -33,9 +34,6 @@ const uint16_t kRc5ToggleMask = 0x800;  // The 12th bit.
 const uint16_t kRc5SamplesMin = 11;
 
 // RC-6
-const uint16_t kRc6Tick = 444;
-const uint16_t kRc6HdrMarkTicks = 6;
-const uint16_t kRc6HdrMark = kRc6HdrMarkTicks * kRc6Tick;
 const uint16_t kRc6HdrSpaceTicks = 2;
 const uint16_t kRc6HdrSpace = kRc6HdrSpaceTicks * kRc6Tick;
 const uint16_t kRc6RptLengthTicks = 187;
@@ -72,7 +70,7 @@ void IRsend::sendRC5(const uint64_t data, uint16_t nbits,
     nbits--;
   }
 
-  IRtimer usecTimer = IRtimer();
+  IRsendTimer usecTimer = IRsendTimer(this);
   for (uint16_t i = 0; i <= repeat; i++) {
     usecTimer.reset();
 
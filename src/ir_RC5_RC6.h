@@ -0,0 +1,18 @@
+// Copyright 2009 Ken Shirriff
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief RC-5 & RC-6 support
+
+#ifndef IR_RC5_RC6_H_
+#define IR_RC5_RC6_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kRc6Tick = 444;
+const uint16_t kRc6HdrMarkTicks = 6;
+const uint16_t kRc6HdrMark = kRc6HdrMarkTicks * kRc6Tick;
+
+#endif  // IR_RC5_RC6_H_
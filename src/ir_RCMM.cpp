@@ -12,11 +12,11 @@
 #include "IRsend.h"
 #include "IRtimer.h"
 #include "IRutils.h"
+#include "ir_RCMM.h"
 
 // Constants
 const uint16_t kRcmmTick = 28;  // Technically it would be 27.777*
 const uint16_t kRcmmHdrMarkTicks = 15;
-const uint16_t kRcmmHdrMark = 416;
 const uint16_t kRcmmHdrSpaceTicks = 10;
 const uint16_t kRcmmHdrSpace = 277;
 const uint16_t kRcmmBitMarkTicks = 6;
@@ -45,7 +45,7 @@ const uint8_t kRcmmTolerance = 10;
 void IRsend::sendRCMM(uint64_t data, uint16_t nbits, uint16_t repeat) {
   // Set 36kHz IR carrier frequency & a 1/3 (33%) duty cycle.
   enableIROut(36, 33);
-  IRtimer usecs = IRtimer();
+  IRsendTimer usecs = IRsendTimer(this);
 
   for (uint16_t r = 0; r <= repeat; r++) {
     usecs.reset();
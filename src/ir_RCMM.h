@@ -0,0 +1,15 @@
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief Support for the Phillips RC-MM protocol.
+
+#ifndef IR_RCMM_H_
+#define IR_RCMM_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kRcmmHdrMark = 416;
+
+#endif  // IR_RCMM_H_
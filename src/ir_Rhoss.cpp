@@ -11,8 +11,6 @@
 #include "IRtext.h"
 #include "IRutils.h"
 
-const uint16_t kRhossHdrMark = 3042;
-const uint16_t kRhossHdrSpace = 4248;
 const uint16_t kRhossBitMark = 648;
 const uint16_t kRhossOneSpace = 1545;
 const uint16_t kRhossZeroSpace = 457;
@@ -352,13 +350,20 @@ stdAc::state_t IRRhossAc::toCommon(void) const {
 String IRRhossAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(getMode(), kRhossModeAuto, kRhossModeCool,
-                             kRhossModeHeat, kRhossModeDry, kRhossModeFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kRhossFanMax, kRhossFanMin,
-                           kRhossFanAuto, kRhossFanAuto,
-                           kRhossFanMed);
-  result += addBoolToString(getSwing(), kSwingVStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRRhossAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, getMode(), kRhossModeAuto, kRhossModeCool,
+                   kRhossModeHeat, kRhossModeDry, kRhossModeFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kRhossFanMax, kRhossFanMin,
+                 kRhossFanAuto, kRhossFanAuto,
+                 kRhossFanMed);
+  addBoolToString(out, getSwing(), kSwingVStr);
+}
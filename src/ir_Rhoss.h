@@ -57,6 +57,8 @@ union RhossProtocol{
 };
 
 // Constants
+const uint16_t kRhossHdrMark = 3042;
+const uint16_t kRhossHdrSpace = 4248;
 
 // Fan Control
 const uint8_t kRhossFanAuto =  0b00;
@@ -130,6 +132,7 @@ class IRRhossAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -21,11 +21,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kSamsungTick = 560;
-const uint16_t kSamsungHdrMarkTicks = 8;
-const uint16_t kSamsungHdrMark = kSamsungHdrMarkTicks * kSamsungTick;
-const uint16_t kSamsungHdrSpaceTicks = 8;
-const uint16_t kSamsungHdrSpace = kSamsungHdrSpaceTicks * kSamsungTick;
 const uint16_t kSamsungBitMarkTicks = 1;
 const uint16_t kSamsungBitMark = kSamsungBitMarkTicks * kSamsungTick;
 const uint16_t kSamsungOneSpaceTicks = 3;
@@ -45,19 +40,15 @@ const uint16_t kSamsungMinGapTicks =
 const uint32_t kSamsungMinGap = kSamsungMinGapTicks * kSamsungTick;
 
 const uint16_t kSamsungAcHdrMark = 690;
-const uint16_t kSamsungAcHdrSpace = 17844;
 const uint8_t kSamsungAcSections = 2;
 const uint16_t kSamsungAcSectionMark = 3086;
 const uint16_t kSamsungAcSectionSpace = 8864;
 const uint16_t kSamsungAcSectionGap = 2886;
-const uint16_t kSamsungAcBitMark = 586;
 const uint16_t kSamsungAcOneSpace = 1432;
 const uint16_t kSamsungAcZeroSpace = 436;
 
 // Data from https://github.com/crankyoldgit/IRremoteESP8266/issues/1220
 // Values calculated based on the average of ten messages.
-const uint16_t kSamsung36HdrMark = 4515;  /// < uSeconds
-const uint16_t kSamsung36HdrSpace = 4438;  /// < uSeconds
 const uint16_t kSamsung36BitMark = 512;  /// < uSeconds
 const uint16_t kSamsung36OneSpace = 1468;  /// < uSeconds
 const uint16_t kSamsung36ZeroSpace = 490;  /// < uSeconds
@@ -895,51 +886,58 @@ stdAc::state_t IRSamsungAc::toCommon(void) const {
 String IRSamsungAc::toString(void) const {
   String result = "";
   result.reserve(230);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kSamsungAcAuto, kSamsungAcCool,
-                            kSamsungAcHeat, kSamsungAcDry,
-                            kSamsungAcFan);
-  result += addTempToString(getTemp());
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRSamsungAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kSamsungAcAuto, kSamsungAcCool,
+                  kSamsungAcHeat, kSamsungAcDry,
+                  kSamsungAcFan);
+  addTempToString(out, getTemp());
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
     case kSamsungAcFanAuto:
     case kSamsungAcFanAuto2:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kSamsungAcFanLow:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kSamsungAcFanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kSamsungAcFanHigh:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kSamsungAcFanTurbo:
-      result += kTurboStr;
+      *out += kTurboStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
       break;
   }
-  result += ')';
-  result += addBoolToString(getSwing(), kSwingVStr);
-  result += addBoolToString(getSwingH(), kSwingHStr);
-  result += addToggleToString(_.BeepToggle, kBeepStr);
-  result += addToggleToString(getClean(), kCleanStr);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  result += addBoolToString(getPowerful(), kPowerfulStr);
-  result += addBoolToString(getEcono(), kEconoStr);
-  result += addBoolToString(getBreeze(), kBreezeStr);
-  result += addBoolToString(_.Display, kLightStr);
-  result += addBoolToString(_.Ion, kIonStr);
+  *out += ')';
+  addBoolToString(out, getSwing(), kSwingVStr);
+  addBoolToString(out, getSwingH(), kSwingHStr);
+  addToggleToString(out, _.BeepToggle, kBeepStr);
+  addToggleToString(out, getClean(), kCleanStr);
+  addBoolToString(out, getQuiet(), kQuietStr);
+  addBoolToString(out, getPowerful(), kPowerfulStr);
+  addBoolToString(out, getEcono(), kEconoStr);
+  addBoolToString(out, getBreeze(), kBreezeStr);
+  addBoolToString(out, _.Display, kLightStr);
+  addBoolToString(out, _.Ion, kIonStr);
   if (_OnTimerEnable)
-    result += addLabeledString(minsToString(_OnTimer), kOnTimerStr);
+    addLabeledString(out, minsToString(_OnTimer), kOnTimerStr);
   if (_OffTimerEnable)
-    result += addLabeledString(minsToString(_OffTimer),
-                               _Sleep ? kSleepTimerStr : kOffTimerStr);
-  return result;
+    addLabeledString(out, minsToString(_OffTimer),
+                     _Sleep ? kSleepTimerStr : kOffTimerStr);
 }
 
 #if DECODE_SAMSUNG_AC
@@ -164,6 +164,15 @@ union SamsungProtocol{
 };
 
 // Constants
+const uint16_t kSamsungTick = 560;
+const uint16_t kSamsungHdrMarkTicks = 8;
+const uint16_t kSamsungHdrMark = kSamsungHdrMarkTicks * kSamsungTick;
+const uint16_t kSamsungHdrSpaceTicks = 8;
+const uint16_t kSamsungHdrSpace = kSamsungHdrSpaceTicks * kSamsungTick;
+const uint16_t kSamsungAcHdrSpace = 17844;
+const uint16_t kSamsungAcBitMark = 586;
+const uint16_t kSamsung36HdrMark = 4515;  /// < uSeconds
+const uint16_t kSamsung36HdrSpace = 4438;  /// < uSeconds
 const uint8_t kSamsungAcMinTemp  = 16;  // C   Mask 0b11110000
 const uint8_t kSamsungAcMaxTemp  = 30;  // C   Mask 0b11110000
 const uint8_t kSamsungAcAutoTemp = 25;  // C   Mask 0b11110000
@@ -249,6 +258,7 @@ class IRSamsungAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -46,7 +46,6 @@ const uint16_t kSanyoSa8650bRptLength = 45000;
 // Sanyo LC7461
 const uint16_t kSanyoLc7461AddressMask = (1 << kSanyoLC7461AddressBits) - 1;
 const uint16_t kSanyoLc7461CommandMask = (1 << kSanyoLC7461CommandBits) - 1;
-const uint16_t kSanyoLc7461HdrMark = 9000;
 const uint16_t kSanyoLc7461HdrSpace = 4500;
 const uint16_t kSanyoLc7461BitMark = 560;    // 1T
 const uint16_t kSanyoLc7461OneSpace = 1690;  // 3T
@@ -60,16 +59,12 @@ const uint16_t kSanyoLc7461MinGap =
                          (kSanyoLc7461OneSpace + kSanyoLc7461ZeroSpace) / 2) +
      kSanyoLc7461BitMark);
 
-const uint16_t kSanyoAcHdrMark = 8500;   ///< uSeconds
-const uint16_t kSanyoAcHdrSpace = 4200;  ///< uSeconds
 const uint16_t kSanyoAcBitMark = 500;    ///< uSeconds
 const uint16_t kSanyoAcOneSpace = 1600;  ///< uSeconds
 const uint16_t kSanyoAcZeroSpace = 550;  ///< uSeconds
 const uint32_t kSanyoAcGap = kDefaultMessageGap;  ///< uSeconds (Guess only)
 const uint16_t kSanyoAcFreq = 38000;  ///< Hz. (Guess only)
 
-const uint16_t kSanyoAc88HdrMark = 5400;   ///< uSeconds
-const uint16_t kSanyoAc88HdrSpace = 2000;  ///< uSeconds
 const uint16_t kSanyoAc88BitMark = 500;    ///< uSeconds
 const uint16_t kSanyoAc88OneSpace = 1500;  ///< uSeconds
 const uint16_t kSanyoAc88ZeroSpace = 750;  ///< uSeconds
@@ -77,9 +72,7 @@ const uint32_t kSanyoAc88Gap = 3675;       ///< uSeconds
 const uint16_t kSanyoAc88Freq = 38000;     ///< Hz. (Guess only)
 const uint8_t  kSanyoAc88ExtraTolerance = 5;  /// (%) Extra tolerance to use.
 
-const uint16_t kSanyoAc152HdrMark = 3300;   ///< uSeconds
 const uint16_t kSanyoAc152BitMark = 440;    ///< uSeconds
-const uint16_t kSanyoAc152HdrSpace = 1725;  ///< uSeconds
 const uint16_t kSanyoAc152OneSpace = 1290;  ///< uSeconds
 const uint16_t kSanyoAc152ZeroSpace = 405;  ///< uSeconds
 const uint16_t kSanyoAc152Freq = 38000;     ///< Hz. (Guess only)
@@ -645,37 +638,44 @@ stdAc::state_t IRSanyoAc::toCommon(void) const {
 String IRSanyoAc::toString(void) const {
   String result = "";
   result.reserve(140);
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kSanyoAcAuto, kSanyoAcCool,
-                            kSanyoAcHeat, kSanyoAcDry, kSanyoAcAuto);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kSanyoAcFanHigh, kSanyoAcFanLow,
-                           kSanyoAcFanAuto, kSanyoAcFanAuto,
-                           kSanyoAcFanMedium);
-  result += addSwingVToString(_.SwingV, kSanyoAcSwingVAuto,
-                              kSanyoAcSwingVHighest, kSanyoAcSwingVHigh,
-                              kSanyoAcSwingVUpperMiddle,
-                              kSanyoAcSwingVAuto,  // Middle is unused
-                              kSanyoAcSwingVLowerMiddle,
-                              kSanyoAcSwingVLow, kSanyoAcSwingVLowest,
-                              // Below are unused.
-                              kSanyoAcSwingVAuto,
-                              kSanyoAcSwingVAuto,
-                              kSanyoAcSwingVAuto,
-                              kSanyoAcSwingVAuto);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Beep, kBeepStr);
-  result += addLabeledString(_.Sensor ? kRoomStr : kWallStr, kSensorStr);
-  result += kCommaSpaceStr;
-  result += kSensorStr;
-  result += ' ';
-  result += addTempToString(getSensorTemp(), true, false);
-  const uint16_t offtime =  getOffTimer();
-  result += addLabeledString(offtime ? minsToString(offtime) : kOffStr,
-                             kOffTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRSanyoAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kSanyoAcAuto, kSanyoAcCool,
+                  kSanyoAcHeat, kSanyoAcDry, kSanyoAcAuto);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kSanyoAcFanHigh, kSanyoAcFanLow,
+                 kSanyoAcFanAuto, kSanyoAcFanAuto,
+                 kSanyoAcFanMedium);
+  addSwingVToString(out, _.SwingV, kSanyoAcSwingVAuto,
+                    kSanyoAcSwingVHighest, kSanyoAcSwingVHigh,
+                    kSanyoAcSwingVUpperMiddle,
+                    kSanyoAcSwingVAuto,  // Middle is unused
+                    kSanyoAcSwingVLowerMiddle,
+                    kSanyoAcSwingVLow, kSanyoAcSwingVLowest,
+                    // Below are unused.
+                    kSanyoAcSwingVAuto,
+                    kSanyoAcSwingVAuto,
+                    kSanyoAcSwingVAuto,
+                    kSanyoAcSwingVAuto);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Beep, kBeepStr);
+  addLabeledString(out, _.Sensor ? kRoomStr : kWallStr, kSensorStr);
+  *out += kCommaSpaceStr;
+  *out += kSensorStr;
+  *out += ' ';
+  addTempToString(out, getSensorTemp(), true, false);
+  const uint16_t offtime =  getOffTimer();
+  addLabeledString(out, offtime ? minsToString(offtime) : kOffStr,
+                   kOffTimerStr);
+}
+
 #if SEND_SANYO_AC88
 /// Send a SanyoAc88 formatted message.
 /// Status: ALPHA / Completely untested.
@@ -974,20 +974,27 @@ stdAc::state_t IRSanyoAc88::toCommon(void) const {
 String IRSanyoAc88::toString(void) const {
   String result = "";
   result.reserve(115);
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(_.Mode, kSanyoAc88Auto, kSanyoAc88Cool,
-                            kSanyoAc88Heat, kSanyoAc88Auto, kSanyoAc88Fan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kSanyoAc88FanHigh, kSanyoAc88FanLow,
-                           kSanyoAc88FanAuto, kSanyoAc88FanAuto,
-                           kSanyoAc88FanMedium);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRSanyoAc88::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, _.Mode, kSanyoAc88Auto, kSanyoAc88Cool,
+                  kSanyoAc88Heat, kSanyoAc88Auto, kSanyoAc88Fan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kSanyoAc88FanHigh, kSanyoAc88FanLow,
+                 kSanyoAc88FanAuto, kSanyoAc88FanAuto,
+                 kSanyoAc88FanMedium);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+}
+
 #if SEND_SANYO_AC152
 /// Send a SanyoAc152 formatted message.
 /// Status: BETA / Probably works.
@@ -79,6 +79,13 @@ union SanyoProtocol{
 };
 
 // Constants
+const uint16_t kSanyoLc7461HdrMark = 9000;
+const uint16_t kSanyoAcHdrMark = 8500;   ///< uSeconds
+const uint16_t kSanyoAcHdrSpace = 4200;  ///< uSeconds
+const uint16_t kSanyoAc88HdrMark = 5400;   ///< uSeconds
+const uint16_t kSanyoAc88HdrSpace = 2000;  ///< uSeconds
+const uint16_t kSanyoAc152HdrMark = 3300;   ///< uSeconds
+const uint16_t kSanyoAc152HdrSpace = 1725;  ///< uSeconds
 
 const uint8_t kSanyoAcTempMin = 16;    ///< Celsius
 const uint8_t kSanyoAcTempMax = 30;    ///< Celsius
@@ -156,6 +163,7 @@ class IRSanyoAc {
   static stdAc::swingv_t toCommonSwingV(const uint8_t setting);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -268,6 +276,7 @@ class IRSanyoAc88 {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
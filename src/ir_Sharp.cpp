@@ -24,9 +24,6 @@
 
 // Constants
 // period time = 1/38000Hz = 26.316 microseconds.
-const uint16_t kSharpTick = 26;
-const uint16_t kSharpBitMarkTicks = 10;
-const uint16_t kSharpBitMark = kSharpBitMarkTicks * kSharpTick;
 const uint16_t kSharpOneSpaceTicks = 70;
 const uint16_t kSharpOneSpace = kSharpOneSpaceTicks * kSharpTick;
 const uint16_t kSharpZeroSpaceTicks = 30;
@@ -869,40 +866,48 @@ stdAc::state_t IRSharpAc::toCommon(const stdAc::state_t *prev) const {
 /// @return A human readable string.
 String IRSharpAc::toString(void) const {
   String result = "";
-  const sharp_ac_remote_model_t model = getModel();
   result.reserve(170);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::SHARP_AC, getModel(), false);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
 
-  result += addLabeledString(isPowerSpecial() ? String("-")
-                                              : String(getPower() ? kOnStr
-                                                                  : kOffStr),
-                             kPowerStr);
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRSharpAc::toString(IRtextWriter *out) const {
+  const sharp_ac_remote_model_t model = getModel();
+  addModelToString(out, decode_type_t::SHARP_AC, getModel(), false);
+
+  addLabeledString(out, isPowerSpecial() ? String("-")
+                                    : String(getPower() ? kOnStr
+                                                        : kOffStr),
+                   kPowerStr);
   const uint8_t mode = _.Mode;
-  result += addModeToString(
+  addModeToString(out,
       mode,
       // Make the value invalid if the model doesn't support an Auto mode.
       (model == sharp_ac_remote_model_t::A907) ? kSharpAcAuto : 255,
       kSharpAcCool, kSharpAcHeat, kSharpAcDry, kSharpAcFan);
-  result += addTempToString(getTemp());
+  addTempToString(out, getTemp());
   switch (model) {
     case sharp_ac_remote_model_t::A705:
     case sharp_ac_remote_model_t::A903:
-      result += addFanToString(_.Fan, kSharpAcFanMax, kSharpAcFanA705Low,
-                               kSharpAcFanAuto, kSharpAcFanAuto,
-                               kSharpAcFanA705Med);
+      addFanToString(out, _.Fan, kSharpAcFanMax, kSharpAcFanA705Low,
+                     kSharpAcFanAuto, kSharpAcFanAuto,
+                     kSharpAcFanA705Med);
       break;
     default:
-      result += addFanToString(_.Fan, kSharpAcFanMax, kSharpAcFanMin,
-                               kSharpAcFanAuto, kSharpAcFanAuto,
-                               kSharpAcFanMed);
+      addFanToString(out, _.Fan, kSharpAcFanMax, kSharpAcFanMin,
+                     kSharpAcFanAuto, kSharpAcFanAuto,
+                     kSharpAcFanMed);
   }
   if (getSwingV() == kSharpAcSwingVIgnore) {
-    result += addIntToString(kSharpAcSwingVIgnore, kSwingVStr);
-    result += kSpaceLBraceStr;
-    result += kNAStr;
-    result += ')';
+    addIntToString(out, kSharpAcSwingVIgnore, kSwingVStr);
+    *out += kSpaceLBraceStr;
+    *out += kNAStr;
+    *out += ')';
   } else {
-    result += addSwingVToString(
+    addSwingVToString(out,
         getSwingV(), 0xFF,
         // Coanda means Highest when in Cool mode.
         (mode == kSharpAcCool) ? kSharpAcSwingVCoanda : kSharpAcSwingVToggle,
@@ -918,21 +923,20 @@ String IRSharpAc::toString(void) const {
         0xFF,
         0xFF);
   }
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(_.Ion, kIonStr);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, _.Ion, kIonStr);
   switch (model) {
     case sharp_ac_remote_model_t::A705:
     case sharp_ac_remote_model_t::A903:
-      result += addToggleToString(getLightToggle(), kLightStr);
+      addToggleToString(out, getLightToggle(), kLightStr);
       break;
     default:
-      result += addToggleToString(getEconoToggle(), kEconoStr);
+      addToggleToString(out, getEconoToggle(), kEconoStr);
   }
-  result += addBoolToString(_.Clean, kCleanStr);
+  addBoolToString(out, _.Clean, kCleanStr);
   if (_.TimerEnabled)
-    result += addLabeledString(minsToString(getTimerTime()),
-                               _.TimerType ? kOnTimerStr : kOffTimerStr);
-  return result;
+    addLabeledString(out, minsToString(getTimerTime()),
+                     _.TimerType ? kOnTimerStr : kOffTimerStr);
 }
 
 #if DECODE_SHARP_AC
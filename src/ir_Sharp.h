@@ -84,6 +84,9 @@ union SharpProtocol{
 };
 
 // Constants
+const uint16_t kSharpTick = 26;
+const uint16_t kSharpBitMarkTicks = 10;
+const uint16_t kSharpBitMark = kSharpBitMarkTicks * kSharpTick;
 const uint16_t kSharpAcHdrMark = 3800;
 const uint16_t kSharpAcHdrSpace = 1900;
 const uint16_t kSharpAcBitMark = 470;
@@ -213,6 +216,7 @@ class IRSharpAc {
       const stdAc::opmode_t mode = stdAc::opmode_t::kHeat) const;
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -17,12 +17,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Sony.h"
 
 
 // Constants
-const uint16_t kSonyTick = 200;
-const uint16_t kSonyHdrMarkTicks = 12;
-const uint16_t kSonyHdrMark = kSonyHdrMarkTicks * kSonyTick;
 const uint16_t kSonySpaceTicks = 3;
 const uint16_t kSonySpace = kSonySpaceTicks * kSonyTick;
 const uint16_t kSonyOneMarkTicks = 6;
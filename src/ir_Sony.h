@@ -0,0 +1,19 @@
+// Copyright 2009 Ken Shirriff
+// Copyright 2016 marcosamarinho
+// Copyright 2017,2020 David Conran
+
+/// @file
+/// @brief Support for Sony SIRC(Serial Infra-Red Control) protocols.
+
+#ifndef IR_SONY_H_
+#define IR_SONY_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kSonyTick = 200;
+const uint16_t kSonyHdrMarkTicks = 12;
+const uint16_t kSonyHdrMark = kSonyHdrMarkTicks * kSonyTick;
+
+#endif  // IR_SONY_H_
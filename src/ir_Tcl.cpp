@@ -17,8 +17,6 @@
 const uint8_t kTcl112AcTimerResolution = 20;  // Minutes
 const uint16_t kTcl112AcTimerMax = 720;  // Minutes (12 hrs)
 
-const uint16_t kTcl96AcHdrMark = 1056;  // uSeconds.
-const uint16_t kTcl96AcHdrSpace = 550;  // uSeconds.
 const uint16_t kTcl96AcBitMark = 600;   // uSeconds.
 const uint32_t kTcl96AcGap = kDefaultMessageGap;  // Just a guess.
 const uint8_t  kTcl96AcSpaceCount = 4;
@@ -486,48 +484,55 @@ stdAc::state_t IRTcl112Ac::toCommon(const stdAc::state_t *prev) const {
 String IRTcl112Ac::toString(void) const {
   String result = "";
   result.reserve(220);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTcl112Ac::toString(IRtextWriter *out) const {
   tcl_ac_remote_model_t model = getModel();
-  result += addModelToString(decode_type_t::TCL112AC, model, false);
-  result += addIntToString(_.MsgType, D_STR_TYPE);
+  addModelToString(out, decode_type_t::TCL112AC, model, false);
+  addIntToString(out, _.MsgType, D_STR_TYPE);
   switch (_.MsgType) {
     case kTcl112AcNormal:
-      result += addBoolToString(_.Power, kPowerStr);
-      result += addModeToString(_.Mode, kTcl112AcAuto, kTcl112AcCool,
-                                kTcl112AcHeat, kTcl112AcDry, kTcl112AcFan);
-      result += addTempFloatToString(getTemp());
-      result += addFanToString(_.Fan, kTcl112AcFanHigh, kTcl112AcFanLow,
-                               kTcl112AcFanAuto, kTcl112AcFanMin,
-                               kTcl112AcFanMed);
-      result += addSwingVToString(_.SwingV, kTcl112AcSwingVOff,
-                                            kTcl112AcSwingVHighest,
-                                            kTcl112AcSwingVHigh,
-                                            0xFF,  // unused
-                                            kTcl112AcSwingVMiddle,
-                                            0xFF,  // unused
-                                            kTcl112AcSwingVLow,
-                                            kTcl112AcSwingVLowest,
-                                            kTcl112AcSwingVOff,
-                                            kTcl112AcSwingVOn,  // Swing
-                                            0xFF, 0xFF);  // Both Unused
+      addBoolToString(out, _.Power, kPowerStr);
+      addModeToString(out, _.Mode, kTcl112AcAuto, kTcl112AcCool,
+                      kTcl112AcHeat, kTcl112AcDry, kTcl112AcFan);
+      addTempFloatToString(out, getTemp());
+      addFanToString(out, _.Fan, kTcl112AcFanHigh, kTcl112AcFanLow,
+                     kTcl112AcFanAuto, kTcl112AcFanMin,
+                     kTcl112AcFanMed);
+      addSwingVToString(out, _.SwingV, kTcl112AcSwingVOff,
+                                  kTcl112AcSwingVHighest,
+                                  kTcl112AcSwingVHigh,
+                                  0xFF,  // unused
+                                  kTcl112AcSwingVMiddle,
+                                  0xFF,  // unused
+                                  kTcl112AcSwingVLow,
+                                  kTcl112AcSwingVLowest,
+                                  kTcl112AcSwingVOff,
+                                  kTcl112AcSwingVOn,  // Swing
+                                  0xFF, 0xFF);  // Both Unused
       if (model != tcl_ac_remote_model_t::GZ055BE1) {
-        result += addBoolToString(_.SwingH, kSwingHStr);
-        result += addBoolToString(_.Econo, kEconoStr);
-        result += addBoolToString(_.Health, kHealthStr);
-        result += addBoolToString(_.Turbo, kTurboStr);
-        result += addBoolToString(getLight(), kLightStr);
+        addBoolToString(out, _.SwingH, kSwingHStr);
+        addBoolToString(out, _.Econo, kEconoStr);
+        addBoolToString(out, _.Health, kHealthStr);
+        addBoolToString(out, _.Turbo, kTurboStr);
+        addBoolToString(out, getLight(), kLightStr);
       }
-      result += addLabeledString(
+      addLabeledString(out,
           _.OnTimerEnabled ? minsToString(getOnTimer()) : kOffStr,
           kOnTimerStr);
-      result += addLabeledString(
+      addLabeledString(out,
           _.OffTimerEnabled ? minsToString(getOffTimer()) : kOffStr,
           kOffTimerStr);
       break;
     case kTcl112AcSpecial:
-      result += addBoolToString(_.Quiet, kQuietStr);
+      addBoolToString(out, _.Quiet, kQuietStr);
       break;
   }
-  return result;
 }
 
 #if DECODE_TCL112AC
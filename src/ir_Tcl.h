@@ -83,6 +83,8 @@ union Tcl112Protocol{
 };
 
 // Constants
+const uint16_t kTcl96AcHdrMark = 1056;  // uSeconds.
+const uint16_t kTcl96AcHdrSpace = 550;  // uSeconds.
 const uint16_t kTcl112AcHdrMark = 3000;
 const uint16_t kTcl112AcHdrSpace = 1650;
 const uint16_t kTcl112AcBitMark = 500;
@@ -183,6 +185,7 @@ class IRTcl112Ac {
   static stdAc::swingv_t toCommonSwingV(const uint8_t setting);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -16,9 +16,8 @@ using irutils::addFanToString;
 using irutils::addLabeledString;
 using irutils::addTempToString;
 using irutils::minsToString;
+using irutils::sumBytes;
 
-const uint16_t kTechnibelAcHdrMark = 8836;
-const uint16_t kTechnibelAcHdrSpace = 4380;
 const uint16_t kTechnibelAcBitMark = 523;
 const uint16_t kTechnibelAcOneSpace = 1696;
 const uint16_t kTechnibelAcZeroSpace = 564;
@@ -105,11 +104,9 @@ void IRTechnibelAc::send(const uint16_t repeat) {
 /// @param[in] state A valid code for this protocol.
 /// @return The calculated checksum of the supplied state.
 uint8_t IRTechnibelAc::calcChecksum(const uint64_t state) {
-  uint8_t sum = 0;
   // Add up all the 8 bit data chunks.
-  for (uint8_t offset = kTechnibelAcTimerHoursOffset;
-        offset < kTechnibelAcHeaderOffset; offset += 8)
-    sum += GETBITS64(state, offset, 8);
+  const uint8_t sum = sumBytes(state >> kTechnibelAcTimerHoursOffset,
+      (kTechnibelAcHeaderOffset - kTechnibelAcTimerHoursOffset) / 8);
   return ~sum + 1;
 }
 
@@ -391,18 +388,25 @@ stdAc::state_t IRTechnibelAc::toCommon(void) const {
 String IRTechnibelAc::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, 255,  // No Auto, so use impossible value
-                            kTechnibelAcCool, kTechnibelAcHeat, kTechnibelAcDry,
-                            kTechnibelAcFan);
-  result += addFanToString(_.Fan, kTechnibelAcFanHigh, kTechnibelAcFanLow,
-                           kTechnibelAcFanLow, kTechnibelAcFanLow,
-                           kTechnibelAcFanMedium);
-  result += addTempToString(_.Temp, !_.UseFah);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Swing, kSwingVStr);
-  result += addLabeledString(_.TimerEnable ? minsToString(getTimer())
-                                           : kOffStr,
-                             kTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTechnibelAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, 255,  // No Auto, so use impossible value
+                  kTechnibelAcCool, kTechnibelAcHeat, kTechnibelAcDry,
+                  kTechnibelAcFan);
+  addFanToString(out, _.Fan, kTechnibelAcFanHigh, kTechnibelAcFanLow,
+                 kTechnibelAcFanLow, kTechnibelAcFanLow,
+                 kTechnibelAcFanMedium);
+  addTempToString(out, _.Temp, !_.UseFah);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Swing, kSwingVStr);
+  addLabeledString(out, _.TimerEnable ? minsToString(getTimer())
+                                 : kOffStr,
+                   kTimerStr);
+}
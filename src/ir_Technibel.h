@@ -46,6 +46,8 @@ union TechnibelProtocol{
 };
 
 // Constants
+const uint16_t kTechnibelAcHdrMark = 8836;
+const uint16_t kTechnibelAcHdrSpace = 4380;
 
 const uint8_t kTechnibelAcTimerHoursOffset = 16;
 const uint8_t kTechnibelAcTimerMax = 24;
@@ -120,6 +122,7 @@ class IRTechnibelAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -14,8 +14,6 @@
 
 // Constants
 // using SPACE modulation.
-const uint16_t kTecoHdrMark = 9000;
-const uint16_t kTecoHdrSpace = 4440;
 const uint16_t kTecoBitMark = 620;
 const uint16_t kTecoOneSpace = 1650;
 const uint16_t kTecoZeroSpace = 580;
@@ -323,23 +321,30 @@ stdAc::state_t IRTecoAc::toCommon(void) const {
 String IRTecoAc::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kTecoAuto, kTecoCool, kTecoHeat,
-                            kTecoDry, kTecoFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kTecoFanHigh, kTecoFanLow,
-                           kTecoFanAuto, kTecoFanAuto, kTecoFanMed);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(_.Swing, kSwingStr);
-  result += addBoolToString(_.Light, kLightStr);
-  result += addBoolToString(_.Humid, kHumidStr);
-  result += addBoolToString(_.Save, kSaveStr);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTecoAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kTecoAuto, kTecoCool, kTecoHeat,
+                  kTecoDry, kTecoFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kTecoFanHigh, kTecoFanLow,
+                 kTecoFanAuto, kTecoFanAuto, kTecoFanMed);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, _.Swing, kSwingStr);
+  addBoolToString(out, _.Light, kLightStr);
+  addBoolToString(out, _.Humid, kHumidStr);
+  addBoolToString(out, _.Save, kSaveStr);
   if (getTimerEnabled())
-    result += addLabeledString(irutils::minsToString(getTimer()),
-                               kTimerStr);
+    addLabeledString(out, irutils::minsToString(getTimer()),
+                     kTimerStr);
   else
-    result += addBoolToString(false, kTimerStr);
-  return result;
+    addBoolToString(out, false, kTimerStr);
 }
 
 #if DECODE_TECO
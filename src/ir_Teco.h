@@ -43,6 +43,8 @@ union TecoProtocol{
 };
 
 // Constants.
+const uint16_t kTecoHdrMark = 9000;
+const uint16_t kTecoHdrSpace = 4440;
 const uint8_t kTecoAuto = 0;  // temp = 25C
 const uint8_t kTecoCool = 1;
 const uint8_t kTecoDry = 2;  // temp = 25C, but not shown
@@ -115,6 +117,7 @@ class IRTecoAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
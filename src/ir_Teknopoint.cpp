@@ -11,11 +11,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Teknopoint.h"
 
 // Protocol timings
-const uint16_t kTeknopointHdrMark = 3600;
 const uint16_t kTeknopointBitMark = 477;
-const uint16_t kTeknopointHdrSpace = 1600;
 const uint16_t kTeknopointOneSpace = 1200;
 const uint16_t kTeknopointZeroSpace = 530;
 const uint16_t kTeknopointFreq = 38000;  // Hz. (Guess Only)
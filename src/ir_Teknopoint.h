@@ -0,0 +1,16 @@
+// Copyright 2021 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for the Teknopoint protocol
+
+#ifndef IR_TEKNOPOINT_H_
+#define IR_TEKNOPOINT_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kTeknopointHdrMark = 3600;
+const uint16_t kTeknopointHdrSpace = 1600;
+
+#endif  // IR_TEKNOPOINT_H_
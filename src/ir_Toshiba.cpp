@@ -22,8 +22,6 @@
 // Constants
 
 // Toshiba A/C
-const uint16_t kToshibaAcHdrMark = 4400;
-const uint16_t kToshibaAcHdrSpace = 4300;
 const uint16_t kToshibaAcBitMark = 580;
 const uint16_t kToshibaAcOneSpace = 1600;
 const uint16_t kToshibaAcZeroSpace = 490;
@@ -464,36 +462,43 @@ stdAc::state_t IRToshibaAC::toCommon(const stdAc::state_t *prev) const {
 String IRToshibaAC::toString(void) const {
   String result = "";
   result.reserve(95);
-  result += addModelToString(decode_type_t::TOSHIBA_AC, getModel(), false);
-  result += addTempToString(getTemp(), true);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRToshibaAC::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::TOSHIBA_AC, getModel(), false);
+  addTempToString(out, getTemp(), true);
   switch (getStateLength()) {
     case kToshibaACStateLengthShort:
-      result += addIntToString(getSwing(true), kSwingVStr);
-      result += kSpaceLBraceStr;
+      addIntToString(out, getSwing(true), kSwingVStr);
+      *out += kSpaceLBraceStr;
       switch (getSwing(true)) {
-        case kToshibaAcSwingOff:    result += kOffStr; break;
-        case kToshibaAcSwingOn:     result += kOnStr; break;
-        case kToshibaAcSwingStep:   result += kStepStr; break;
-        case kToshibaAcSwingToggle: result += kToggleStr; break;
-        default:                    result += kUnknownStr;
+        case kToshibaAcSwingOff:    *out += kOffStr; break;
+        case kToshibaAcSwingOn:     *out += kOnStr; break;
+        case kToshibaAcSwingStep:   *out += kStepStr; break;
+        case kToshibaAcSwingToggle: *out += kToggleStr; break;
+        default:                    *out += kUnknownStr;
       }
-      result += ')';
+      *out += ')';
       break;
     case kToshibaACStateLengthLong:
     case kToshibaACStateLength:
     default:
-      result += addBoolToString(getPower(), kPowerStr);
+      addBoolToString(out, getPower(), kPowerStr);
       if (getPower())
-        result += addModeToString(getMode(), kToshibaAcAuto, kToshibaAcCool,
-                                  kToshibaAcHeat, kToshibaAcDry, kToshibaAcFan);
-      result += addFanToString(getFan(), kToshibaAcFanMax, kToshibaAcFanMin,
-                               kToshibaAcFanAuto, kToshibaAcFanAuto,
-                               kToshibaAcFanMed);
-      result += addBoolToString(getTurbo(), kTurboStr);
-      result += addBoolToString(getEcono(), kEconoStr);
-      result += addBoolToString(getFilter(), kFilterStr);
+        addModeToString(out, getMode(), kToshibaAcAuto, kToshibaAcCool,
+                        kToshibaAcHeat, kToshibaAcDry, kToshibaAcFan);
+      addFanToString(out, getFan(), kToshibaAcFanMax, kToshibaAcFanMin,
+                     kToshibaAcFanAuto, kToshibaAcFanAuto,
+                     kToshibaAcFanMed);
+      addBoolToString(out, getTurbo(), kTurboStr);
+      addBoolToString(out, getEcono(), kEconoStr);
+      addBoolToString(out, getFilter(), kFilterStr);
   }
-  return result;
 }
 
 /// Get the model information currently known.
@@ -88,6 +88,8 @@ union ToshibaProtocol{
 };
 
 // Constants
+const uint16_t kToshibaAcHdrMark = 4400;
+const uint16_t kToshibaAcHdrSpace = 4300;
 
 const uint8_t kToshibaAcLengthByte = 2;  ///< Byte pos of the "length" attribute
 const uint8_t kToshibaAcMinLength = 6;  ///< Min Nr. of bytes in a message.
@@ -181,6 +183,7 @@ class IRToshibaAC {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -11,10 +11,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Toto.h"
 
 // Constants
-const uint16_t kTotoHdrMark = 6197;
-const uint16_t kTotoHdrSpace = 2754;
 const uint16_t kTotoBitMark = 600;
 const uint16_t kTotoOneSpace = 1634;
 const uint16_t kTotoZeroSpace = 516;
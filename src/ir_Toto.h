@@ -0,0 +1,16 @@
+// Copyright 2022 David Conran (crankyoldgit)
+
+/// @file
+/// @brief Support for the Toto Toilet IR protocols.
+
+#ifndef IR_TOTO_H_
+#define IR_TOTO_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kTotoHdrMark = 6197;
+const uint16_t kTotoHdrSpace = 2754;
+
+#endif  // IR_TOTO_H_
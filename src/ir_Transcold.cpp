@@ -18,9 +18,7 @@
 
 // Constants
 
-const uint16_t kTranscoldHdrMark =   5944;  ///< uSeconds.
 const uint16_t kTranscoldBitMark =    555;  ///< uSeconds.
-const uint16_t kTranscoldHdrSpace =  7563;  ///< uSeconds.
 const uint16_t kTranscoldOneSpace =  3556;  ///< uSeconds.
 const uint16_t kTranscoldZeroSpace = 1526;  ///< uSeconds.
 
@@ -388,44 +386,54 @@ stdAc::state_t IRTranscoldAc::toCommon(const stdAc::state_t *prev) const {
 String IRTranscoldAc::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  if (!getPower()) return result;  // If it's off, there is no other info.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTranscoldAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  if (!getPower()) return;  // If it's off, there is no other info.
   // Special modes.
-  if (getSwing()) return result + addToggleToString(true, kSwingStr);
-  result += addModeToString(getMode(), kTranscoldAuto, kTranscoldCool,
-                            kTranscoldHeat, kTranscoldDry, kTranscoldFan);
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+  if (getSwing()) {
+    addToggleToString(out, true, kSwingStr);
+    return;
+  }
+  addModeToString(out, getMode(), kTranscoldAuto, kTranscoldCool,
+                  kTranscoldHeat, kTranscoldDry, kTranscoldFan);
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
     case kTranscoldFanAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kTranscoldFanAuto0:
-      result += kAutoStr;
-      result += '0';
+      *out += kAutoStr;
+      *out += '0';
       break;
     case kTranscoldFanMax:
-      result += kMaxStr;
+      *out += kMaxStr;
       break;
     case kTranscoldFanMin:
-      result += kMinStr;
+      *out += kMinStr;
       break;
     case kTranscoldFanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kTranscoldFanZoneFollow:
-      result += kZoneFollowStr;
+      *out += kZoneFollowStr;
       break;
     case kTranscoldFanFixed:
-      result += kFixedStr;
+      *out += kFixedStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
+  *out += ')';
   // Fan mode doesn't have a temperature.
-  if (getMode() != kTranscoldFan) result += addTempToString(getTemp());
-  return result;
+  if (getMode() != kTranscoldFan) addTempToString(out, getTemp());
 }
 
 #if DECODE_TRANSCOLD
@@ -83,6 +83,8 @@ union TranscoldProtocol{
 };
 
 // Constants
+const uint16_t kTranscoldHdrMark =   5944;  ///< uSeconds.
+const uint16_t kTranscoldHdrSpace =  7563;  ///< uSeconds.
 // Modes
 const uint8_t kTranscoldCool = 0b0110;
 const uint8_t kTranscoldDry = 0b1100;
@@ -151,6 +153,7 @@ class IRTranscoldAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
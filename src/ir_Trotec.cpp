@@ -17,16 +17,12 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kTrotecHdrMark = 5952;
-const uint16_t kTrotecHdrSpace = 7364;
 const uint16_t kTrotecBitMark = 592;
 const uint16_t kTrotecOneSpace = 1560;
 const uint16_t kTrotecZeroSpace = 592;
 const uint16_t kTrotecGap = 6184;
 const uint16_t kTrotecGapEnd = 1500;  // made up value
 
-const uint16_t kTrotec3550HdrMark = 12000;
-const uint16_t kTrotec3550HdrSpace = 5130;
 const uint16_t kTrotec3550BitMark = 550;
 const uint16_t kTrotec3550OneSpace = 1950;
 const uint16_t kTrotec3550ZeroSpace = 500;
@@ -294,16 +290,23 @@ stdAc::state_t IRTrotecESP::toCommon(void) const {
 String IRTrotecESP::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kTrotecAuto, kTrotecCool, kTrotecAuto,
-                            kTrotecDry, kTrotecFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kTrotecFanHigh, kTrotecFanLow,
-                           kTrotecFanHigh, kTrotecFanHigh, kTrotecFanMed);
-  result += addBoolToString(_.Sleep, kSleepStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
 
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTrotecESP::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kTrotecAuto, kTrotecCool, kTrotecAuto,
+                  kTrotecDry, kTrotecFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kTrotecFanHigh, kTrotecFanLow,
+                 kTrotecFanHigh, kTrotecFanHigh, kTrotecFanMed);
+  addBoolToString(out, _.Sleep, kSleepStr);
+}
+
 #if DECODE_TROTEC
 /// Decode the supplied Trotec message.
 /// Status: STABLE / Works. Untested on real devices.
@@ -629,14 +632,21 @@ stdAc::state_t IRTrotec3550::toCommon(void) const {
 String IRTrotec3550::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kTrotecAuto, kTrotecCool, kTrotecAuto,
-                            kTrotecDry, kTrotecFan);
-  result += addTempToString(getTemp(), _.Celsius);
-  result += addFanToString(_.Fan, kTrotecFanHigh, kTrotecFanLow,
-                           kTrotecFanHigh, kTrotecFanHigh, kTrotecFanMed);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addLabeledString(_.TimerSet ? minsToString(getTimer()) : kOffStr,
-                             kTimerStr);
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTrotec3550::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kTrotecAuto, kTrotecCool, kTrotecAuto,
+                  kTrotecDry, kTrotecFan);
+  addTempToString(out, getTemp(), _.Celsius);
+  addFanToString(out, _.Fan, kTrotecFanHigh, kTrotecFanLow,
+                 kTrotecFanHigh, kTrotecFanHigh, kTrotecFanMed);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addLabeledString(out, _.TimerSet ? minsToString(getTimer()) : kOffStr,
+                   kTimerStr);
+}
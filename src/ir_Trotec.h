@@ -58,6 +58,10 @@ union TrotecProtocol{
 };
 
 // Constants
+const uint16_t kTrotecHdrMark = 5952;
+const uint16_t kTrotecHdrSpace = 7364;
+const uint16_t kTrotec3550HdrMark = 12000;
+const uint16_t kTrotec3550HdrSpace = 5130;
 const uint8_t kTrotecIntro1 = 0x12;
 const uint8_t kTrotecIntro2 = 0x34;
 
@@ -180,6 +184,7 @@ class IRTrotecESP {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -237,6 +242,7 @@ class IRTrotec3550 {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
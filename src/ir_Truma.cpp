@@ -18,11 +18,10 @@ using irutils::addBoolToString;
 using irutils::addFanToString;
 using irutils::addModeToString;
 using irutils::addTempToString;
+using irutils::sumBytes;
 
 // Constants
 
-const uint16_t kTrumaLdrMark = 20200;
-const uint16_t kTrumaLdrSpace = 1000;
 const uint16_t kTrumaHdrMark = 1800;
 const uint16_t kTrumaSpace = 630;
 const uint16_t kTrumaOneMark = 600;
@@ -121,13 +120,7 @@ void IRTrumaAc::send(const uint16_t repeat) {
 /// @param[in] state The value to calc the checksum of.
 /// @return The calculated checksum value.
 uint8_t IRTrumaAc::calcChecksum(const uint64_t state) {
-  uint8_t sum = kTrumaChecksumInit;
-  uint64_t to_checksum = state;
-  for (uint16_t i = 8; i < kTrumaBits; i += 8) {
-    sum += (to_checksum & 0xFF);
-    to_checksum >>= 8;
-  }
-  return sum;
+  return sumBytes(state, (kTrumaBits - 8) / 8, kTrumaChecksumInit);
 }
 
 /// Verify the checksum is valid for a given state.
@@ -327,14 +320,21 @@ stdAc::state_t IRTrumaAc::toCommon(void) const {
 String IRTrumaAc::toString(void) const {
   String result = "";
   result.reserve(80);
-  result += addBoolToString(getPower(), kPowerStr, false);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRTrumaAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
   if (getPower())  // Only show the Operating Mode if the unit is on.
-    result += addModeToString(_.Mode, kTrumaAuto, kTrumaCool,
-                              kTrumaAuto, kTrumaAuto, kTrumaFan);
+    addModeToString(out, _.Mode, kTrumaAuto, kTrumaCool,
+                    kTrumaAuto, kTrumaAuto, kTrumaFan);
 
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kTrumaFanHigh, kTrumaFanLow, kTrumaFanHigh,
-                           kTrumaFanQuiet, kTrumaFanMed);
-  result += addBoolToString(getQuiet(), kQuietStr);
-  return result;
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kTrumaFanHigh, kTrumaFanLow, kTrumaFanHigh,
+                 kTrumaFanQuiet, kTrumaFanMed);
+  addBoolToString(out, getQuiet(), kQuietStr);
 }
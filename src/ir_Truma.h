@@ -47,6 +47,8 @@ union TrumaProtocol{
 };
 
 // Constants
+const uint16_t kTrumaLdrMark = 20200;
+const uint16_t kTrumaLdrSpace = 1000;
 const uint64_t kTrumaDefaultState = 0x50FFFFFFE6E781;  ///< Off, Auto, 16C, High
 const uint8_t kTrumaChecksumInit = 5;
 
@@ -107,6 +109,7 @@ class IRTrumaAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
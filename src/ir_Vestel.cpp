@@ -471,58 +471,65 @@ stdAc::state_t IRVestelAc::toCommon(void) const {
 String IRVestelAc::toString(void) const {
   String result = "";
   result.reserve(100);  // Reserve some heap for the string to reduce fragging.
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRVestelAc::toString(IRtextWriter *out) const {
   if (isTimeCommand()) {
-    result += addLabeledString(minsToString(getTime()), kClockStr, false);
-    result += addLabeledString(
+    addLabeledString(out, minsToString(getTime()), kClockStr, false);
+    addLabeledString(out,
         (_.Timer ? minsToString(getTimer()) : kOffStr),
         kTimerStr);
-    result += addLabeledString(
+    addLabeledString(out,
         (_.OnTimer && !_.Timer) ? minsToString(getOnTimer()) : kOffStr,
         kOnTimerStr);
-    result += addLabeledString(
+    addLabeledString(out,
         (_.OffTimer ? minsToString(getOffTimer()) : kOffStr),
         kOffTimerStr);
-    return result;
+    return;
   }
   // Not a time command, it's a normal command.
-  result += addBoolToString(_.Power, kPowerStr, false);
-  result += addModeToString(_.Mode, kVestelAcAuto, kVestelAcCool,
-                            kVestelAcHeat, kVestelAcDry, kVestelAcFan);
-  result += addTempToString(getTemp());
-  result += addIntToString(_.Fan, kFanStr);
-  result += kSpaceLBraceStr;
+  addBoolToString(out, _.Power, kPowerStr, false);
+  addModeToString(out, _.Mode, kVestelAcAuto, kVestelAcCool,
+                  kVestelAcHeat, kVestelAcDry, kVestelAcFan);
+  addTempToString(out, getTemp());
+  addIntToString(out, _.Fan, kFanStr);
+  *out += kSpaceLBraceStr;
   switch (_.Fan) {
     case kVestelAcFanAuto:
-      result += kAutoStr;
+      *out += kAutoStr;
       break;
     case kVestelAcFanLow:
-      result += kLowStr;
+      *out += kLowStr;
       break;
     case kVestelAcFanMed:
-      result += kMedStr;
+      *out += kMedStr;
       break;
     case kVestelAcFanHigh:
-      result += kHighStr;
+      *out += kHighStr;
       break;
     case kVestelAcFanAutoCool:
-      result += kAutoStr;
-      result += ' ';
-      result += kCoolStr;
+      *out += kAutoStr;
+      *out += ' ';
+      *out += kCoolStr;
       break;
     case kVestelAcFanAutoHot:
-      result += kAutoStr;
-      result += ' ';
-      result += kHeatStr;
+      *out += kAutoStr;
+      *out += ' ';
+      *out += kHeatStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
   }
-  result += ')';
-  result += addBoolToString(getSleep(), kSleepStr);
-  result += addBoolToString(getTurbo(), kTurboStr);
-  result += addBoolToString(_.Ion, kIonStr);
-  result += addBoolToString(getSwing(), kSwingStr);
-  return result;
+  *out += ')';
+  addBoolToString(out, getSleep(), kSleepStr);
+  addBoolToString(out, getTurbo(), kTurboStr);
+  addBoolToString(out, _.Ion, kIonStr);
+  addBoolToString(out, getSwing(), kSwingStr);
 }
 
 #if DECODE_VESTEL_AC
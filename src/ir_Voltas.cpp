@@ -21,7 +21,6 @@ using irutils::addTempToString;
 using irutils::minsToString;
 
 // Constants
-const uint16_t kVoltasBitMark = 1026;   ///< uSeconds.
 const uint16_t kVoltasOneSpace = 2553;  ///< uSeconds.
 const uint16_t kVoltasZeroSpace = 554;  ///< uSeconds.
 const uint16_t kVoltasFreq = 38000;     ///< Hz.
@@ -491,26 +490,33 @@ stdAc::state_t IRVoltas::toCommon(const stdAc::state_t *prev) {
 String IRVoltas::toString() {
   String result = "";
   result.reserve(200);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::VOLTAS, getModel(), false);
-  result += addBoolToString(_.Power, kPowerStr);
-  result += addModeToString(_.Mode, 255, kVoltasCool, kVoltasHeat,
-                            kVoltasDry, kVoltasFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.FanSpeed, kVoltasFanHigh, kVoltasFanLow,
-                           kVoltasFanAuto, kVoltasFanAuto, kVoltasFanMed);
-  result += addBoolToString(getSwingV(), kSwingVStr);
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRVoltas::toString(IRtextWriter *out) {
+  addModelToString(out, decode_type_t::VOLTAS, getModel(), false);
+  addBoolToString(out, _.Power, kPowerStr);
+  addModeToString(out, _.Mode, 255, kVoltasCool, kVoltasHeat,
+                  kVoltasDry, kVoltasFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.FanSpeed, kVoltasFanHigh, kVoltasFanLow,
+                 kVoltasFanAuto, kVoltasFanAuto, kVoltasFanMed);
+  addBoolToString(out, getSwingV(), kSwingVStr);
   if (getSwingHChange())
-    result += addBoolToString(_.SwingH, kSwingHStr);
+    addBoolToString(out, _.SwingH, kSwingHStr);
   else
-    result += addLabeledString(kNAStr, kSwingHStr);
-  result += addBoolToString(_.Turbo, kTurboStr);
-  result += addBoolToString(_.Econo, kEconoStr);
-  result += addBoolToString(_.Wifi, kWifiStr);
-  result += addBoolToString(_.Light, kLightStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addLabeledString(_.OnTimerEnable ? minsToString(getOnTime())
-                                             : kOffStr, kOnTimerStr);
-  result += addLabeledString(_.OffTimerEnable ? minsToString(getOffTime())
-                                              : kOffStr, kOffTimerStr);
-  return result;
+    addLabeledString(out, kNAStr, kSwingHStr);
+  addBoolToString(out, _.Turbo, kTurboStr);
+  addBoolToString(out, _.Econo, kEconoStr);
+  addBoolToString(out, _.Wifi, kWifiStr);
+  addBoolToString(out, _.Light, kLightStr);
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addLabeledString(out, _.OnTimerEnable ? minsToString(getOnTime())
+                                   : kOffStr, kOnTimerStr);
+  addLabeledString(out, _.OffTimerEnable ? minsToString(getOffTime())
+                                    : kOffStr, kOffTimerStr);
 }
@@ -72,6 +72,7 @@ union VoltasProtocol {
 };
 
 // Constants
+const uint16_t kVoltasBitMark = 1026;   ///< uSeconds.
 const uint8_t kVoltasFan   = 0b0001;  ///< 1
 const uint8_t kVoltasHeat  = 0b0010;  ///< 2
 const uint8_t kVoltasDry   = 0b0100;  ///< 4
@@ -144,6 +145,7 @@ class IRVoltas {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL);
   String toString(void);
+  void toString(IRtextWriter *out);
 #ifndef UNIT_TEST
 
  private:
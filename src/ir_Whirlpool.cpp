@@ -21,8 +21,6 @@
 #include "IRutils.h"
 
 // Constants
-const uint16_t kWhirlpoolAcHdrMark = 8950;
-const uint16_t kWhirlpoolAcHdrSpace = 4484;
 const uint16_t kWhirlpoolAcBitMark = 597;
 const uint16_t kWhirlpoolAcOneSpace = 1649;
 const uint16_t kWhirlpoolAcZeroSpace = 533;
@@ -530,68 +528,75 @@ stdAc::state_t IRWhirlpoolAc::toCommon(const stdAc::state_t *prev) const {
 String IRWhirlpoolAc::toString(void) const {
   String result = "";
   result.reserve(200);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(decode_type_t::WHIRLPOOL_AC, getModel(), false);
-  result += addBoolToString(_.Power, kPowerToggleStr);
-  result += addModeToString(_.Mode, kWhirlpoolAcAuto, kWhirlpoolAcCool,
-                            kWhirlpoolAcHeat, kWhirlpoolAcDry, kWhirlpoolAcFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(_.Fan, kWhirlpoolAcFanHigh, kWhirlpoolAcFanLow,
-                           kWhirlpoolAcFanAuto, kWhirlpoolAcFanAuto,
-                           kWhirlpoolAcFanMedium);
-  result += addBoolToString(getSwing(), kSwingStr);
-  result += addBoolToString(getLight(), kLightStr);
-  result += addLabeledString(minsToString(getClock()), kClockStr);
-  result += addLabeledString(
+  IRtextWriter out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRWhirlpoolAc::toString(IRtextWriter *out) const {
+  addModelToString(out, decode_type_t::WHIRLPOOL_AC, getModel(), false);
+  addBoolToString(out, _.Power, kPowerToggleStr);
+  addModeToString(out, _.Mode, kWhirlpoolAcAuto, kWhirlpoolAcCool,
+                  kWhirlpoolAcHeat, kWhirlpoolAcDry, kWhirlpoolAcFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, _.Fan, kWhirlpoolAcFanHigh, kWhirlpoolAcFanLow,
+                 kWhirlpoolAcFanAuto, kWhirlpoolAcFanAuto,
+                 kWhirlpoolAcFanMedium);
+  addBoolToString(out, getSwing(), kSwingStr);
+  addBoolToString(out, getLight(), kLightStr);
+  addLabeledString(out, minsToString(getClock()), kClockStr);
+  addLabeledString(out,
       _.OnTimerEnabled ? minsToString(getOnTimer()) : kOffStr, kOnTimerStr);
-  result += addLabeledString(
+  addLabeledString(out,
       _.OffTimerEnabled ? minsToString(getOffTimer()) : kOffStr, kOffTimerStr);
-  result += addBoolToString(_.Sleep, kSleepStr);
-  result += addBoolToString(getSuper(), kSuperStr);
-  result += addIntToString(_.Cmd, kCommandStr);
-  result += kSpaceLBraceStr;
+  addBoolToString(out, _.Sleep, kSleepStr);
+  addBoolToString(out, getSuper(), kSuperStr);
+  addIntToString(out, _.Cmd, kCommandStr);
+  *out += kSpaceLBraceStr;
   switch (_.Cmd) {
     case kWhirlpoolAcCommandLight:
-      result += kLightStr;
+      *out += kLightStr;
       break;
     case kWhirlpoolAcCommandPower:
-      result += kPowerStr;
+      *out += kPowerStr;
       break;
     case kWhirlpoolAcCommandTemp:
-      result += kTempStr;
+      *out += kTempStr;
       break;
     case kWhirlpoolAcCommandSleep:
-      result += kSleepStr;
+      *out += kSleepStr;
       break;
     case kWhirlpoolAcCommandSuper:
-      result += kSuperStr;
+      *out += kSuperStr;
       break;
     case kWhirlpoolAcCommandOnTimer:
-      result += kOnTimerStr;
+      *out += kOnTimerStr;
       break;
     case kWhirlpoolAcCommandMode:
-      result += kModeStr;
+      *out += kModeStr;
       break;
     case kWhirlpoolAcCommandSwing:
-      result += kSwingStr;
+      *out += kSwingStr;
       break;
     case kWhirlpoolAcCommandIFeel:
-      result += kIFeelStr;
+      *out += kIFeelStr;
       break;
     case kWhirlpoolAcCommandFanSpeed:
-      result += kFanStr;
+      *out += kFanStr;
       break;
     case kWhirlpoolAcCommand6thSense:
-      result += k6thSenseStr;
+      *out += k6thSenseStr;
       break;
     case kWhirlpoolAcCommandOffTimer:
-      result += kOffTimerStr;
+      *out += kOffTimerStr;
       break;
     default:
-      result += kUnknownStr;
+      *out += kUnknownStr;
       break;
   }
-  result += ')';
-  return result;
+  *out += ')';
 }
 
 #if DECODE_WHIRLPOOL_AC
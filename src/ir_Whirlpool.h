@@ -100,6 +100,8 @@ union WhirlpoolProtocol{
 };
 
 // Constants
+const uint16_t kWhirlpoolAcHdrMark = 8950;
+const uint16_t kWhirlpoolAcHdrSpace = 4484;
 const uint8_t kWhirlpoolAcChecksumByte1 = 13;
 const uint8_t kWhirlpoolAcChecksumByte2 = kWhirlpoolAcStateLength - 1;
 const uint8_t kWhirlpoolAcHeat = 0;
@@ -185,6 +187,7 @@ class IRWhirlpoolAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
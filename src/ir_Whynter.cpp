@@ -13,19 +13,15 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Whynter.h"
 
 // Constants
-const uint16_t kWhynterTick = 50;
 const uint16_t kWhynterHdrMarkTicks = 57;
 const uint16_t kWhynterHdrMark = kWhynterHdrMarkTicks * kWhynterTick;
 const uint16_t kWhynterHdrSpaceTicks = 57;
 const uint16_t kWhynterHdrSpace = kWhynterHdrSpaceTicks * kWhynterTick;
-const uint16_t kWhynterBitMarkTicks = 15;
-const uint16_t kWhynterBitMark = kWhynterBitMarkTicks * kWhynterTick;
 const uint16_t kWhynterOneSpaceTicks = 43;
 const uint16_t kWhynterOneSpace = kWhynterOneSpaceTicks * kWhynterTick;
-const uint16_t kWhynterZeroSpaceTicks = 15;
-const uint16_t kWhynterZeroSpace = kWhynterZeroSpaceTicks * kWhynterTick;
 const uint16_t kWhynterMinCommandLengthTicks = 2160;  // Totally made up value.
 const uint32_t kWhynterMinCommandLength =
     kWhynterMinCommandLengthTicks * kWhynterTick;
@@ -0,0 +1,20 @@
+// Copyright 2009 Ken Shirriff
+// Copyright 2017 David Conran
+
+/// @file
+/// @brief Support for Whynter protocols.
+
+#ifndef IR_WHYNTER_H_
+#define IR_WHYNTER_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kWhynterTick = 50;
+const uint16_t kWhynterBitMarkTicks = 15;
+const uint16_t kWhynterBitMark = kWhynterBitMarkTicks * kWhynterTick;
+const uint16_t kWhynterZeroSpaceTicks = 15;
+const uint16_t kWhynterZeroSpace = kWhynterZeroSpaceTicks * kWhynterTick;
+
+#endif  // IR_WHYNTER_H_
@@ -33,10 +33,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Wowwee.h"
 
 // Constants
-const uint16_t kWowweeHdrMark   = 6684;
-const uint16_t kWowweeHdrSpace  = 723;
 const uint16_t kWowweeBitMark   = 912;
 const uint16_t kWowweeOneSpace  = 3259;
 const uint16_t kWowweeZeroSpace = kWowweeHdrSpace;
@@ -0,0 +1,16 @@
+// Copyright 2022 David Conran
+
+/// @file
+/// @brief Support for WowWee RoboRapter protocol
+
+#ifndef IR_WOWWEE_H_
+#define IR_WOWWEE_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kWowweeHdrMark   = 6684;
+const uint16_t kWowweeHdrSpace  = 723;
+
+#endif  // IR_WOWWEE_H_
@@ -14,9 +14,9 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Xmp.h"
 
 // Constants
-const uint16_t kXmpMark =          210;  ///< uSeconds.
 const uint16_t kXmpBaseSpace =     760;  ///< uSeconds
 const uint16_t kXmpSpaceStep =     135;  ///< uSeconds
 const uint16_t kXmpFooterSpace = 13000;  ///< uSeconds.
@@ -0,0 +1,15 @@
+// Copyright 2021 David Conran
+
+/// @file
+/// @brief Support for XMP protocols.
+
+#ifndef IR_XMP_H_
+#define IR_XMP_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kXmpMark =          210;  ///< uSeconds.
+
+#endif  // IR_XMP_H_
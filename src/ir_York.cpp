@@ -27,13 +27,12 @@ using irutils::addModeToString;
 using irutils::addFanToString;
 using irutils::addTempToString;
 using irutils::addLabeledString;
+using irutils::crc16;
 using irutils::minsToString;
 
 
 // Constants
-const uint16_t kYorkHdrMark = 4887;
 const uint16_t kYorkBitMark = 612;
-const uint16_t kYorkHdrSpace = 2267;
 const uint16_t kYorkOneSpace = 1778;
 const uint16_t kYorkZeroSpace = 579;
 const uint16_t kYorkFreq = 38000;  // Hz. (Guessing the most common frequency.)
@@ -284,19 +283,7 @@ uint16_t IRYorkAc::getOffTimer(void) const {
 
 /// CRC16-16 (a.k.a. CRC-16-IBM)
 void IRYorkAc::calcChecksum() {
-  uint8_t length = 14;
-  uint16_t reg_crc = 0x0000;
-  uint8_t* data = _.raw;
-  while (length--) {
-    reg_crc ^= *data++;
-    for (uint16_t index = 0; index < 8; index++) {
-      if (reg_crc & 0x01) {
-        reg_crc = (reg_crc>>1) ^ 0xA001;
-      } else {
-        reg_crc = reg_crc >>1;
-      }
-    }
-  }
+  const uint16_t reg_crc = crc16(_.raw, 14);  // CRC-16/ARC
   _.Chk1 = (reg_crc & 0xff);
   _.Chk2 = ((reg_crc >> 8) & 0x00ff);
 }
@@ -341,17 +328,24 @@ stdAc::state_t IRYorkAc::toCommon(const stdAc::state_t *prev) const {
 String IRYorkAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(_.Power, kPowerStr, false);
-
-  result += addModeToString(_.Mode, kYorkAuto, kYorkCool,
-                            kYorkHeat, kYorkDry, kYorkFan);
-  result += addFanToString(_.Fan, kYorkFanHigh, kYorkFanLow,
-                           kYorkFanAuto, kYorkFanAuto,
-                           kYorkFanMedium);
-  result += addTempToString(getTemp(), true);
-  result += addBoolToString(_.SwingV, kSwingVStr);
-  result += addLabeledString(minsToString(getOnTimer()), kOnTimerStr);
-  result += addLabeledString(minsToString(getOffTimer()), kOffTimerStr);
-
+  IRtextWriter out(&result);
+  toString(&out);
   return result;
 }
+
+/// Write the current internal state as human readable text.
+/// @param[out] out Where to write the text.
+void IRYorkAc::toString(IRtextWriter *out) const {
+  addBoolToString(out, _.Power, kPowerStr, false);
+
+  addModeToString(out, _.Mode, kYorkAuto, kYorkCool,
+                  kYorkHeat, kYorkDry, kYorkFan);
+  addFanToString(out, _.Fan, kYorkFanHigh, kYorkFanLow,
+                 kYorkFanAuto, kYorkFanAuto,
+                 kYorkFanMedium);
+  addTempToString(out, getTemp(), true);
+  addBoolToString(out, _.SwingV, kSwingVStr);
+  addLabeledString(out, minsToString(getOnTimer()), kOnTimerStr);
+  addLabeledString(out, minsToString(getOffTimer()), kOffTimerStr);
+
+}
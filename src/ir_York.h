@@ -64,6 +64,8 @@ union YorkProtocol{
 };
 
 // Constants
+const uint16_t kYorkHdrMark = 4887;
+const uint16_t kYorkHdrSpace = 2267;
 const uint8_t kYorkKnownGoodState[kYorkStateLength] = {
     0x08, 0x10, 0x07, 0x02, 0x40, 0x08,
     0x03, 0x18, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00,
@@ -123,6 +125,7 @@ class IRYorkAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString() const;
+  void toString(IRtextWriter *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -13,11 +13,10 @@
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_Zepeal.h"
 
 // Constants
 
-const uint16_t kZepealHdrMark = 2330;
-const uint16_t kZepealHdrSpace = 3380;
 const uint16_t kZepealOneMark = 1300;
 const uint16_t kZepealZeroMark = 420;
 const uint16_t kZepealOneSpace = kZepealZeroMark;
@@ -0,0 +1,16 @@
+// Copyright 2020 Christian Nilsson (nikize)
+
+/// @file
+/// @brief Support for Zepeal protocol.
+
+#ifndef IR_ZEPEAL_H_
+#define IR_ZEPEAL_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+
+// Constants
+const uint16_t kZepealHdrMark = 2330;
+const uint16_t kZepealHdrSpace = 3380;
+
+#endif  // IR_ZEPEAL_H_
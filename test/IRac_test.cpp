@@ -1,6 +1,7 @@
 // Copyright 2019-2021 David Conran
 
 #include <string>
+#include <type_traits>
 #include "ir_Airton.h"
 #include "ir_Airwell.h"
 #include "ir_Amcor.h"
@@ -2791,6 +2792,52 @@ TEST(TestIRac, strToModel) {
   EXPECT_EQ(0, IRac::strToModel("FOOBAR", 0));
 }
 
+TEST(TestIRac, strToKeywords) {
+  // Every alias is accepted, in any case.
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("fan-only"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("fan_only"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("Fan Only"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("fanonly"));
+  EXPECT_EQ(stdAc::opmode_t::kDry, IRac::strToOpmode("dehumidify"));
+  EXPECT_EQ(stdAc::opmode_t::kOff, IRac::strToOpmode("Stop"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMin, IRac::strToFanspeed("lowest"));
+  EXPECT_EQ(stdAc::fanspeed_t::kLow, IRac::strToFanspeed("lo"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMedium, IRac::strToFanspeed("Mid"));
+  EXPECT_EQ(stdAc::fanspeed_t::kHigh, IRac::strToFanspeed("hi"));
+  EXPECT_EQ(stdAc::swingv_t::kAuto, IRac::strToSwingV("swing"));
+  EXPECT_EQ(stdAc::swingv_t::kLowest, IRac::strToSwingV("Down"));
+  EXPECT_EQ(stdAc::swingv_t::kHighest, IRac::strToSwingV("top"));
+  EXPECT_EQ(stdAc::swingh_t::kLeftMax, IRac::strToSwingH("leftmax"));
+  EXPECT_EQ(stdAc::swingh_t::kLeftMax, IRac::strToSwingH("Left Max"));
+  EXPECT_EQ(stdAc::swingh_t::kRightMax, IRac::strToSwingH("maxright"));
+  EXPECT_EQ(stdAc::swingh_t::kWide, IRac::strToSwingH("WIDE"));
+  EXPECT_EQ(panasonic_ac_remote_model_t::kPanasonicDke,
+            IRac::strToModel("panasonicpkr"));
+  EXPECT_EQ(whirlpool_ac_remote_model_t::DG11J13A,
+            IRac::strToModel("dg11j104"));
+  EXPECT_EQ(gree_ac_remote_model_t::YX1FSF, IRac::strToModel("Yx1fsf"));
+  EXPECT_TRUE(IRac::strToBool("yes"));
+  EXPECT_FALSE(IRac::strToBool("false", true));
+  // A keyword is only accepted in its own category.
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("Low", stdAc::opmode_t::kHeat));
+  EXPECT_EQ(stdAc::fanspeed_t::kMax,
+            IRac::strToFanspeed("Cool", stdAc::fanspeed_t::kMax));
+  EXPECT_EQ(stdAc::swingh_t::kRight,
+            IRac::strToSwingH("Top", stdAc::swingh_t::kRight));
+  EXPECT_EQ(stdAc::swingv_t::kHigh,
+            IRac::strToSwingV("Left", stdAc::swingv_t::kHigh));
+  EXPECT_EQ(-1, IRac::strToModel("Auto"));
+  EXPECT_TRUE(IRac::strToBool("Cool", true));
+  // Not quite a keyword.
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("Coo", stdAc::opmode_t::kHeat));
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("Cool ", stdAc::opmode_t::kHeat));
+  EXPECT_EQ(stdAc::opmode_t::kHeat,
+            IRac::strToOpmode("", stdAc::opmode_t::kHeat));
+}
+
 TEST(TestIRac, strToCommandType) {
   EXPECT_EQ(stdAc::ac_command_t::kControlCommand,
             IRac::strToCommandType("Control"));
@@ -3334,3 +3381,355 @@ TEST(TestIRac, cleanState) {
   clean = irac.cleanState(s);
   EXPECT_FALSE(clean.power);
 }
+
+uint16_t irac_queue_sent_id = 0;
+
+void recordIracQueueSent(const uint16_t id) { irac_queue_sent_id = id; }
+
+TEST(TestIRac, SendQueue) {
+  IRac irac(kGpioUnused);
+  IRsendTest irsend(kGpioUnused);
+  IRrecv capture(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  // Don't yield at all, so we can decode the whole thing in one go.
+  IRsendQueue queue(&irsend, 1, UINT32_MAX);
+  irac.setSendQueue(&queue, recordIracQueueSent);
+  irac.next.protocol = decode_type_t::COOLIX;
+  irac.next.power = true;
+  irac.next.mode = stdAc::opmode_t::kHeat;
+  irac.next.degrees = 21;
+  irac.next.fanspeed = stdAc::fanspeed_t::kHigh;
+  irac.next.sensorTemperature = kNoTempValue;
+  irac_queue_sent_id = 0;
+
+  ASSERT_TRUE(irac.sendAc());
+  EXPECT_EQ(1, queue.getDepth());
+  EXPECT_EQ(0, irac_queue_sent_id);
+  EXPECT_EQ("", irsend.outputStr());  // Nothing has been sent yet.
+  irac.next.degrees = 22;
+  EXPECT_FALSE(irac.sendAc());  // The queue is full.
+  EXPECT_EQ(1, queue.getStats().dropped);
+
+  EXPECT_FALSE(queue.loop());
+  EXPECT_NE(0, irac_queue_sent_id);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(capture.decode(&irsend.capture));
+  ASSERT_EQ(COOLIX, irsend.capture.decode_type);
+  EXPECT_EQ(
+      "Power: On, Mode: 3 (Heat), Fan: 1 (Max), Temp: 21C, Zone Follow: Off, "
+      "Sensor Temp: Off",
+      IRAcUtils::resultAcToString(&irsend.capture));
+
+  // Without the queue, it is sent directly again.
+  irac.setSendQueue(NULL);
+  irac_queue_sent_id = 0;
+  EXPECT_TRUE(irac.sendAc());
+  EXPECT_EQ(0, queue.getDepth());
+  EXPECT_EQ(0, irac_queue_sent_id);
+}
+
+TEST(TestIRac, FrameCache) {
+  IRac irac(kGpioUnused);
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  IRsendQueue queue(&irsend, 1, UINT32_MAX);  // So we can see what is sent.
+  IRacFrameCache cache(2);
+  irac.setSendQueue(&queue);
+  irac.setFrameCache(&cache);
+  stdAc::state_t cool, heat, off;
+  cool.protocol = heat.protocol = off.protocol = decode_type_t::COOLIX;
+  cool.power = heat.power = true;
+  cool.mode = stdAc::opmode_t::kCool;
+  cool.degrees = 24;
+  heat.mode = stdAc::opmode_t::kHeat;
+  heat.degrees = 21;
+  off.mode = stdAc::opmode_t::kOff;
+
+  ASSERT_TRUE(irac.sendAc(cool, &off));
+  queue.loop();
+  const std::string expected = irsend.outputStr();
+  EXPECT_EQ(1, cache.getStats().misses);
+  EXPECT_EQ(0, cache.getStats().hits);
+  EXPECT_EQ(1, cache.getCount());
+  // The same again comes from the cache, & is exactly the same.
+  ASSERT_TRUE(irac.sendAc(cool, &off));
+  queue.loop();
+  EXPECT_EQ(expected, irsend.outputStr());
+  EXPECT_EQ(1, cache.getStats().hits);
+  // Without the cache, it renders the same thing.
+  irac.setFrameCache(NULL);
+  ASSERT_TRUE(irac.sendAc(cool, &off));
+  queue.loop();
+  EXPECT_EQ(expected, irsend.outputStr());
+  irac.setFrameCache(&cache);
+
+  // A different previous state is a different message for some protocols.
+  ASSERT_TRUE(irac.sendAc(cool, &cool));
+  queue.loop();
+  EXPECT_EQ(2, cache.getStats().misses);
+  EXPECT_EQ(2, cache.getCount());
+  // Least Recently Used entries are evicted first.
+  ASSERT_TRUE(irac.sendAc(cool, &off));  // Hit.
+  queue.loop();
+  ASSERT_TRUE(irac.sendAc(heat, &off));  // Evicts (cool, &cool).
+  queue.loop();
+  EXPECT_EQ(1, cache.getStats().evictions);
+  irsend.reset();
+  ASSERT_TRUE(irac.sendAc(cool, &off));  // Still a hit.
+  queue.loop();
+  EXPECT_EQ(expected, irsend.outputStr());
+  EXPECT_EQ(3, cache.getStats().hits);
+  EXPECT_EQ(3, cache.getStats().misses);
+
+  // Time dependent states aren't cached.
+  cool.clock = 600;
+  ASSERT_TRUE(irac.sendAc(cool, &off));
+  queue.loop();
+  EXPECT_EQ(1, cache.getStats().bypassed);
+  EXPECT_EQ(3, cache.getStats().misses);
+  // Nor are unsupported ones.
+  cool.clock = -1;
+  cool.protocol = decode_type_t::NEC;
+  EXPECT_FALSE(irac.sendAc(cool, &off));
+  EXPECT_EQ(2, cache.getCount());
+  EXPECT_EQ(3, cache.getStats().misses);
+  EXPECT_EQ(0, queue.getDepth());
+
+  cache.clear();
+  EXPECT_EQ(0, cache.getCount());
+  cache.resetStats();
+  EXPECT_EQ(0, cache.getStats().hits);
+}
+
+TEST(TestIRac, PackState) {
+  stdAc::state_t state;
+  uint64_t packed;
+  // The default state.
+  ASSERT_TRUE(IRac::packState(state, &packed));
+  EXPECT_FALSE(IRac::cmpStates(state, IRac::unpackState(packed)));
+
+  // Every field at an extreme.
+  state.protocol = decode_type_t::kLastDecodeType;
+  state.model = 6;
+  state.power = true;
+  state.mode = stdAc::opmode_t::kLastOpmodeEnum;
+  state.degrees = 63.5;
+  state.fanspeed = stdAc::fanspeed_t::kLastFanspeedEnum;
+  state.swingv = stdAc::swingv_t::kLastSwingvEnum;
+  state.swingh = stdAc::swingh_t::kLastSwinghEnum;
+  state.quiet = state.turbo = state.econo = state.light = true;
+  state.filter = state.clean = state.beep = state.iFeel = true;
+  state.sleep = 16382;
+  state.command = stdAc::ac_command_t::kLastAcCommandEnum;
+  state.sensorTemperature = 0;
+  uint64_t other;
+  ASSERT_TRUE(IRac::packState(state, &other));
+  EXPECT_NE(packed, other);
+  stdAc::state_t unpacked = IRac::unpackState(other);
+  EXPECT_FALSE(IRac::cmpStates(state, unpacked));
+  EXPECT_EQ(-1, unpacked.clock);
+  // The clock is ignored, just like cmpStates().
+  state.clock = 1234;
+  ASSERT_TRUE(IRac::packState(state, &packed));
+  EXPECT_EQ(other, packed);
+  EXPECT_EQ(IRac::hashState(other), IRac::hashState(packed));
+
+  // Each field changes the packed state, & so the hash.
+  state.celsius = false;
+  state.degrees = 127;
+  state.sensorTemperature = 126;
+  ASSERT_TRUE(IRac::packState(state, &packed));
+  EXPECT_NE(other, packed);
+  EXPECT_NE(IRac::hashState(other), IRac::hashState(packed));
+  EXPECT_FALSE(IRac::cmpStates(state, IRac::unpackState(packed)));
+  for (int16_t sleep = -1; sleep < 100; sleep++) {
+    state.sleep = sleep;
+    ASSERT_TRUE(IRac::packState(state, &other));
+    EXPECT_EQ(sleep, IRac::unpackState(other).sleep);
+    EXPECT_NE(packed, other);
+    packed = other;
+  }
+
+  // Things that can't be packed exactly.
+  stdAc::state_t bad;
+  bad.degrees = 21.3;
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+  bad.degrees = 64;
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+  bad.celsius = false;
+  bad.degrees = 72.5;  // Fahrenheit is in whole degrees.
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+  bad = stdAc::state_t();
+  bad.sensorTemperature = -1;
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+  bad = stdAc::state_t();
+  bad.sleep = 16383;
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+  bad = stdAc::state_t();
+  bad.model = 15;
+  EXPECT_FALSE(IRac::packState(bad, &packed));
+}
+
+// Render what an IRac sends for a state, as a string of "m"arks & "s"paces.
+static std::string renderAc(IRac *ac, const stdAc::state_t state) {
+  IRpulseBuffer pulses(2048);
+  IRsend::renderAllTo(&pulses);
+  ac->sendAc(state, NULL);
+  IRsend::renderAllTo(NULL);
+  std::string result;
+  for (uint16_t i = 0; i < pulses.getLength(); i++)
+    result += std::to_string(pulses.getEntry(i)) + ",";
+  return result;
+}
+
+// An IRac owns its persistent encoders, so it mustn't be copied.
+static_assert(!std::is_copy_constructible<IRac>::value,
+              "IRac must not be copy constructible");
+static_assert(!std::is_copy_assignable<IRac>::value,
+              "IRac must not be copy assignable");
+
+TEST(TestIRac, PersistentEncoders) {
+  const decode_type_t protocols[] = {DAIKIN, GREE, MITSUBISHI_AC, PANASONIC_AC};
+  IRac persistent(kGpioUnused);
+  IRac fresh(kGpioUnused);
+  EXPECT_FALSE(persistent.getPersistentEncoders());
+  persistent.setPersistentEncoders(true);
+  EXPECT_TRUE(persistent.getPersistentEncoders());
+  srand(18);
+  for (uint8_t p = 0; p < 4; p++) {
+    stdAc::state_t state;
+    state.protocol = protocols[p];
+    state.power = true;
+    state.mode = stdAc::opmode_t::kCool;
+    for (uint16_t n = 0; n < 200; n++) {
+      // Mostly the sort of changes made often, with the odd bigger one.
+      switch (rand() % 16) {
+        case 0: state.power = !state.power; break;
+        case 1: state.mode = (stdAc::opmode_t)(rand() % 5); break;
+        case 2: state.fanspeed = (stdAc::fanspeed_t)(rand() % 7); break;
+        case 3: state.swingv = (stdAc::swingv_t)(rand() % 8 - 1); break;
+        case 4: state.swingh = (stdAc::swingh_t)(rand() % 8 - 1); break;
+        case 5: state.quiet = !state.quiet; break;
+        case 6: state.turbo = !state.turbo; break;
+        case 7: state.econo = !state.econo; break;
+        case 8: state.light = !state.light; break;
+        case 9: state.filter = !state.filter; break;
+        case 10: state.clean = !state.clean; break;
+        case 11: state.sleep = (rand() % 2) ? -1 : 60; break;
+        case 12: state.clock = (rand() % 3) ? rand() % 1440 : -1; break;
+        default: state.degrees = 16 + rand() % 15;
+      }
+      // Only the settings that changed are set, but the result must be the
+      // same as setting them all from scratch.
+      const std::string expected = renderAc(&fresh, state);
+      ASSERT_EQ(expected, renderAc(&persistent, state))
+          << typeToString(state.protocol) << " step " << n;
+    }
+  }
+  EXPECT_NE(nullptr, persistent._daikin);
+  EXPECT_NE(nullptr, persistent._panasonic);
+  persistent.setPersistentEncoders(false);
+  EXPECT_EQ(nullptr, persistent._daikin);
+  EXPECT_EQ(nullptr, persistent._panasonic);
+}
+
+TEST(TestIRacMulti, SendsToEachTarget) {
+  ac_target_t targets[4];
+  for (uint8_t i = 0; i < 4; i++) {
+    IRac::initState(&targets[i].state);
+    targets[i].pin = 4 + i;
+    targets[i].prev = NULL;
+    targets[i].state.power = true;
+    targets[i].state.mode = stdAc::opmode_t::kCool;
+    targets[i].state.degrees = 20 + i;
+  }
+  targets[0].state.protocol = DAIKIN;
+  targets[1].state.protocol = MITSUBISHI_AC;
+  targets[2].state.protocol = decode_type_t::UNKNOWN;  // Unsupported.
+  targets[3].state.protocol = PANASONIC_AC;  // 36.7kHz, unlike the others.
+
+  IRmultiSendTest multi;
+  IRacMulti ac(&multi);
+  EXPECT_EQ(3, ac.sendAc(targets, 4));
+  EXPECT_EQ(2, ac.getPasses());
+  EXPECT_EQ(0, multi.getCount());
+  // How long it spent sending them.
+  const uint32_t elapsed = multi.elapsed;
+
+  EXPECT_EQ(0, multi.cycles[3]);  // Only three were sent.
+
+  IRsendTest irsend(kGpioUnused);
+  uint32_t durations[4] = {0};
+  for (uint8_t i = 0; i < 4; i++) {
+    if (i == 2) continue;
+    // The unsupported one wasn't added, so the Panasonic one was sent third.
+    ASSERT_TRUE(multi.decode(std::min(i, (uint8_t)2), &irsend));
+    stdAc::state_t result;
+    ASSERT_TRUE(IRAcUtils::decodeToState(&irsend.capture, &result));
+    EXPECT_EQ(targets[i].state.protocol, result.protocol);
+    EXPECT_EQ(targets[i].state.degrees, result.degrees);
+    EXPECT_TRUE(result.power);
+    // How long it takes to send on its own.
+    IRac single(kGpioUnused);
+    IRpulseBuffer pulses(kSendQueueBufferSize);
+    IRsend::renderAllTo(&pulses);
+    single.sendAc(targets[i].state, NULL);
+    IRsend::renderAllTo(NULL);
+    durations[i] = pulses.getDuration();
+  }
+  // The Daikin & Mitsubishi messages were sent together.
+  EXPECT_NEAR(std::max(durations[0], durations[1]) + durations[3], elapsed,
+              100);
+  EXPECT_LT(elapsed, durations[0] + durations[1] + durations[3]);
+
+  // Messages too big for the buffer they're rendered into aren't sent.
+  IRacMulti small(&multi, 100);
+  EXPECT_EQ(0, small.sendAc(targets, 2));
+  EXPECT_EQ(0, small.getPasses());
+}
+
+TEST(TestIRac, ResultAcToStringWriter) {
+  IRAirtonAc ac(kGpioUnused);
+  IRrecv capture(kGpioUnused);
+  const char expected[] =
+      "Power: On, Mode: 1 (Cool), Fan: 5 (Maximum), Temp: 18C, "
+      "Swing(V): On, Econo: On, Turbo: On, Light: On, Health: On, Sleep: On";
+  ac.begin();
+  ac.setPower(true);
+  ac.setMode(kAirtonCool);
+  ac.setTemp(18);
+  ac.setFan(kAirtonFanMax);
+  ac.setSwingV(true);
+  ac.setEcono(true);
+  ac.setTurbo(true);
+  ac.setLight(true);
+  ac.setHealth(true);
+  ac.setSleep(true);
+  ac.send();
+  ac._irsend.makeDecodeResult();
+  ASSERT_TRUE(capture.decode(&ac._irsend.capture));
+  ASSERT_EQ(AIRTON, ac._irsend.capture.decode_type);
+
+  char buffer[200];
+  IRtextWriter out(buffer, sizeof(buffer));
+  EXPECT_TRUE(IRAcUtils::resultAcToString(&out, &ac._irsend.capture));
+  EXPECT_STREQ(expected, buffer);
+  EXPECT_EQ(IRAcUtils::resultAcToString(&ac._irsend.capture), buffer);
+
+  // Too small a buffer gets a truncated, but still terminated, string.
+  char small[11];
+  IRtextWriter truncated(small, sizeof(small));
+  EXPECT_TRUE(IRAcUtils::resultAcToString(&truncated, &ac._irsend.capture));
+  EXPECT_STREQ("Power: On,", small);
+  EXPECT_TRUE(truncated.hasOverflowed());
+  EXPECT_EQ(strlen(expected), truncated.getLength());
+
+  // Not an A/C message, so nothing is written.
+  ac._irsend.capture.decode_type = decode_type_t::NEC;
+  IRtextWriter nothing(buffer, sizeof(buffer));
+  EXPECT_FALSE(IRAcUtils::resultAcToString(&nothing, &ac._irsend.capture));
+  EXPECT_STREQ("", buffer);
+  EXPECT_EQ(0, nothing.getLength());
+}
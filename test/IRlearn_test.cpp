@@ -0,0 +1,228 @@
+// Copyright 2026 David Conran
+
+#include <type_traits>
+#include "IRlearn.h"
+#include "IRrecv.h"
+#include "IRrecv_test.h"
+#include "IRremoteESP8266.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "gtest/gtest.h"
+
+// Tests for the IRlearnedCodes class.
+
+// It owns its tables, so it mustn't be copied.
+static_assert(!std::is_copy_constructible<IRlearnedCodes>::value,
+              "IRlearnedCodes must not be copy constructible");
+static_assert(!std::is_copy_assignable<IRlearnedCodes>::value,
+              "IRlearnedCodes must not be copy assignable");
+
+// Stretch/shrink every duration of a capture by a different amount, between
+// -`percent`% & +`percent`%, like a real (noisy) receiver would.
+void jitter(decode_results *results, const uint8_t percent) {
+  for (uint16_t i = 1; i < results->rawlen; i++) {
+    const int32_t change = (i * 27) % (2 * percent + 1) - percent;
+    results->rawbuf[i] = results->rawbuf[i] * (100 + change) / 100;
+  }
+}
+
+// Capture a NEC message.
+void captureNEC(IRsendTest *irsend, const uint16_t address,
+                const uint16_t command) {
+  irsend->reset();
+  irsend->sendNEC(irsend->encodeNEC(address, command));
+  irsend->makeDecodeResult();
+}
+
+TEST(TestIRlearnedCodes, Symbol) {
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(100, 100));
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(100, 80));  // decodeHash edge
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(100, 70));
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(100, 125));  // decodeHash edge
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(100, 142));
+  EXPECT_EQ(kLearnShorter, IRlearnedCodes::symbol(100, 69));
+  EXPECT_EQ(kLearnShorter, IRlearnedCodes::symbol(1000, 1));
+  EXPECT_EQ(kLearnLonger, IRlearnedCodes::symbol(100, 143));
+  EXPECT_EQ(kLearnLonger, IRlearnedCodes::symbol(1, 1000));
+  // +/-15% errors in both durations don't change it.
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(115, 85));
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(85, 115));
+  EXPECT_EQ(kLearnShorter, IRlearnedCodes::symbol(170, 115));
+  EXPECT_EQ(kLearnLonger, IRlearnedCodes::symbol(115, 170));
+  // Extremes.
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(0, 0));
+  EXPECT_EQ(kLearnShorter, IRlearnedCodes::symbol(UINT16_MAX, 0));
+  EXPECT_EQ(kLearnLonger, IRlearnedCodes::symbol(0, UINT16_MAX));
+  EXPECT_EQ(kLearnSame, IRlearnedCodes::symbol(UINT16_MAX, UINT16_MAX));
+}
+
+TEST(TestIRlearnedCodes, Distance) {
+  // 4 symbols per byte, first symbol in the lowest bits.
+  const uint8_t same[5] = {0x55, 0x55, 0x55, 0x55, 0x01};  // 17 x kLearnSame
+  uint8_t other[5] = {0x55, 0x55, 0x55, 0x55, 0x01};
+  EXPECT_EQ(0, IRlearnedCodes::distance(same, other, 17));
+  other[0] = 0x54;  // 1st symbol is now kLearnShorter.
+  EXPECT_EQ(1, IRlearnedCodes::distance(same, other, 17));
+  other[4] = 0x02;  // 17th symbol is now kLearnLonger.
+  EXPECT_EQ(2, IRlearnedCodes::distance(same, other, 17));
+  EXPECT_EQ(2, IRlearnedCodes::distance(other, same, 17));
+  EXPECT_EQ(1, IRlearnedCodes::distance(same, other, 16));
+  other[2] = 0xA8;  // 3 x kLearnLonger, & 1 x kLearnShorter.
+  EXPECT_EQ(6, IRlearnedCodes::distance(same, other, 17));
+  // kLearnLonger vs kLearnShorter is still one difference.
+  const uint8_t longer = kLearnLonger;
+  const uint8_t shorter = kLearnShorter;
+  EXPECT_EQ(1, IRlearnedCodes::distance(&longer, &shorter, 1));
+  // Stop counting, once it gets to the limit.
+  EXPECT_EQ(1, IRlearnedCodes::distance(same, other, 8, 1));
+  EXPECT_EQ(0, IRlearnedCodes::distance(same, other, 0));
+}
+
+TEST(TestIRlearnedCodes, IntegerCompareMatchesFloatingPoint) {
+  IRrecv irrecv(1);
+  for (uint32_t oldval = 0; oldval <= 1200; oldval++)
+    for (uint32_t newval = 0; newval <= 1200; newval++) {
+      const uint16_t expected = (newval < oldval * 0.8) ? 0
+                              : (oldval < newval * 0.8) ? 2 : 1;
+      ASSERT_EQ(expected, irrecv.compare(oldval, newval))
+          << oldval << " vs " << newval;
+    }
+  EXPECT_EQ(1, irrecv.compare(UINT16_MAX, UINT16_MAX));
+  EXPECT_EQ(0, irrecv.compare(UINT16_MAX, 52427));
+  EXPECT_EQ(1, irrecv.compare(UINT16_MAX, 52428));
+  EXPECT_EQ(2, irrecv.compare(52427, UINT16_MAX));
+}
+
+TEST(TestIRlearnedCodes, LearnAndLookup) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRlearnedCodes codes;
+  EXPECT_EQ(0, codes.size());
+  EXPECT_EQ(kLearnDefaultCapacity, codes.capacity());
+  for (uint16_t cmd = 0; cmd < 32; cmd++) {
+    captureNEC(&irsend, 0x04, cmd);
+    ASSERT_TRUE(codes.learn(&irsend.capture, 1000 + cmd));
+  }
+  EXPECT_EQ(32, codes.size());
+
+  uint32_t id = 0;
+  uint16_t distance = UINT16_MAX;
+  // An exact replay.
+  captureNEC(&irsend, 0x04, 7);
+  ASSERT_TRUE(codes.lookup(&irsend.capture, &id, &distance));
+  EXPECT_EQ(1007, id);
+  EXPECT_EQ(0, distance);
+  // Noisy replays, which change the decodeHash() value.
+  IRrecv irrecv(1);
+  uint16_t hash_changes = 0;
+  uint16_t candidates = 0;
+  for (uint16_t cmd = 0; cmd < 32; cmd++) {
+    captureNEC(&irsend, 0x04, cmd);
+    irrecv.decodeHash(&irsend.capture);
+    const uint64_t hash = irsend.capture.value;
+    jitter(&irsend.capture, 15);
+    irrecv.decodeHash(&irsend.capture);
+    if (hash != irsend.capture.value) hash_changes++;
+    id = 0;
+    ASSERT_TRUE(codes.lookup(&irsend.capture, &id, &distance)) << cmd;
+    EXPECT_EQ(1000U + cmd, id);
+    EXPECT_EQ(0, distance);
+    candidates += codes.candidates();
+  }
+  EXPECT_EQ(32, hash_changes);
+  // The index should avoid comparing them to most of the codes.
+  EXPECT_GT(32 * codes.size() / 4, candidates);
+  // A code we haven't learned, but of the same length.
+  captureNEC(&irsend, 0x04, 0xAA);
+  EXPECT_FALSE(codes.lookup(&irsend.capture, &id));
+  // A completely different length of code.
+  irsend.reset();
+  irsend.sendSony(irsend.encodeSony(kSony12Bits, 0x12, 0x1), kSony12Bits, 0);
+  irsend.makeDecodeResult();
+  EXPECT_FALSE(codes.lookup(&irsend.capture, &id));
+  EXPECT_EQ(0, codes.candidates());
+
+  codes.clear();
+  EXPECT_EQ(0, codes.size());
+  captureNEC(&irsend, 0x04, 7);
+  EXPECT_FALSE(codes.lookup(&irsend.capture, &id));
+}
+
+TEST(TestIRlearnedCodes, MaxDistance) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRlearnedCodes codes;
+  captureNEC(&irsend, 0x04, 0x10);
+  ASSERT_TRUE(codes.learn(&irsend.capture, 1));
+  // Make the 2nd (short) bit space into a long one. i.e. A single bad pulse.
+  captureNEC(&irsend, 0x04, 0x10);
+  irsend.capture.rawbuf[6] *= 3;
+  uint32_t id = 0;
+  uint16_t distance = 0;
+  ASSERT_TRUE(codes.lookup(&irsend.capture, &id, &distance));
+  EXPECT_EQ(1, id);
+  EXPECT_EQ(2, distance);  // It is compared to the one before & after it.
+  EXPECT_FALSE(codes.lookup(&irsend.capture, &id, &distance, 1));
+}
+
+TEST(TestIRlearnedCodes, Limits) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  // Limited by capacity.
+  IRlearnedCodes two(2);
+  EXPECT_EQ(2, two.capacity());
+  captureNEC(&irsend, 0x04, 1);
+  EXPECT_TRUE(two.learn(&irsend.capture, 1));
+  EXPECT_TRUE(two.learn(&irsend.capture, 2));
+  EXPECT_FALSE(two.learn(&irsend.capture, 3));
+  EXPECT_EQ(2, two.size());
+  // Duplicates find the most recently learned one.
+  uint32_t id = 0;
+  EXPECT_TRUE(two.lookup(&irsend.capture, &id));
+  EXPECT_EQ(2, id);
+
+  // Limited by the pool size. A NEC message needs 17 bytes.
+  captureNEC(&irsend, 0x04, 1);
+  EXPECT_EQ(66, IRlearnedCodes::symbolCount(&irsend.capture));
+  IRlearnedCodes small(10, 20);
+  EXPECT_TRUE(small.learn(&irsend.capture, 1));
+  EXPECT_FALSE(small.learn(&irsend.capture, 2));
+  EXPECT_EQ(1, small.size());
+  small.clear();
+  EXPECT_TRUE(small.learn(&irsend.capture, 3));
+
+  // Limited by the max. nr. of symbols in a capture.
+  IRlearnedCodes longest(10, 100, 66);
+  EXPECT_TRUE(longest.learn(&irsend.capture, 1));
+  EXPECT_TRUE(longest.lookup(&irsend.capture, &id));
+  IRlearnedCodes shorter(10, 100, 65);
+  EXPECT_FALSE(shorter.learn(&irsend.capture, 1));
+  irsend.capture.rawlen--;  // One symbol shorter.
+  EXPECT_TRUE(shorter.learn(&irsend.capture, 2));
+  irsend.capture.rawlen++;
+  EXPECT_FALSE(shorter.lookup(&irsend.capture, &id));
+  EXPECT_EQ(0, shorter.candidates());
+
+  // Too short to learn.
+  irsend.capture.rawlen = 3;
+  EXPECT_EQ(0, IRlearnedCodes::symbolCount(&irsend.capture));
+  EXPECT_FALSE(small.learn(&irsend.capture, 4));
+  EXPECT_FALSE(small.lookup(&irsend.capture, &id));
+}
+
+TEST(TestIRlearnedCodes, LotsOfLookups) {
+  // More lookups than the lookup counter can count, to check it wraps safely.
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRlearnedCodes codes;
+  captureNEC(&irsend, 0x04, 1);
+  ASSERT_TRUE(codes.learn(&irsend.capture, 1));
+  captureNEC(&irsend, 0x04, 2);
+  ASSERT_TRUE(codes.learn(&irsend.capture, 2));
+  uint32_t id = 0;
+  for (uint32_t i = 0; i <= UINT16_MAX + 2UL; i++) {
+    id = 0;
+    ASSERT_TRUE(codes.lookup(&irsend.capture, &id));
+    ASSERT_EQ(2, id);
+  }
+}
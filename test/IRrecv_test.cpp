@@ -1,6 +1,7 @@
 // Copyright 2017 David Conran
 
 #include "IRrecv_test.h"
+#include <vector>
 #include "IRrecv.h"
 #include "IRremoteESP8266.h"
 #include "IRsend.h"
@@ -42,6 +43,24 @@ TEST(TestIRrecv, IRrecvDestructor) {
   delete irrecv_ptr;
 }
 
+TEST(TestIRrecv, InstancesAreIndependent) {
+  IRrecv first(1, 100);
+  IRrecv second(2, 200);
+  EXPECT_EQ(100, first.getBufSize());
+  EXPECT_EQ(200, second.getBufSize());
+  EXPECT_NE(first._getParamsPtr(), second._getParamsPtr());
+  EXPECT_NE(first._getParamsPtr()->rawbuf, second._getParamsPtr()->rawbuf);
+  // Capturing for one doesn't affect the other.
+  first.enableIRIn();
+  second.enableIRIn();
+  first._getParamsPtr()->rawlen = 10;
+  first._timeout();
+  EXPECT_EQ(kStopState, first._getParamsPtr()->rcvstate);
+  EXPECT_EQ(10, first._getParamsPtr()->rawlen);
+  EXPECT_EQ(kIdleState, second._getParamsPtr()->rcvstate);
+  EXPECT_EQ(0, second._getParamsPtr()->rawlen);
+}
+
 TEST(TestIRrecv, DecodeHeapOverflow) {
   // Check that we handle the rawbuf correctly when we fill it. e.g. overflow.
   // Ref: https://github.com/crankyoldgit/IRremoteESP8266/issues/1516
@@ -540,6 +559,70 @@ TEST(TestDecode, DecodeAiwa) {
   EXPECT_EQ(0x7F, irsend.capture.value);
 }
 
+// Test the integer calculation of the tolerance bounds.
+TEST(TestMatch, TicksLowAndHigh) {
+  IRrecv irrecv(1);
+  EXPECT_EQ(750, irrecv.ticksLow(1000, 25));
+  EXPECT_EQ(1251, irrecv.ticksHigh(1000, 25));
+  EXPECT_EQ(650, irrecv.ticksLow(1000, 35));
+  EXPECT_EQ(1351, irrecv.ticksHigh(1000, 35));
+  EXPECT_EQ(64, irrecv.ticksLow(99, 35));  // Rounded down.
+  EXPECT_EQ(134, irrecv.ticksHigh(99, 35));  // Rounded down, then + 1.
+  EXPECT_EQ(550, irrecv.ticksLow(1000, 25, 200));
+  EXPECT_EQ(1451, irrecv.ticksHigh(1000, 25, 200));
+  EXPECT_EQ(0, irrecv.ticksLow(100, 50, 100));  // Can't go below zero.
+  EXPECT_EQ(0, irrecv.ticksLow(1000, 100));
+  EXPECT_EQ(2001, irrecv.ticksHigh(1000, 100));
+  // Out of range tolerances use the default.
+  EXPECT_EQ(irrecv.ticksLow(1000), irrecv.ticksLow(1000, 101));
+  EXPECT_EQ(irrecv.ticksHigh(1000), irrecv.ticksHigh(1000, 101));
+}
+
+// Test that a precalculated window matches the same values as match().
+TEST(TestMatch, Windows) {
+  IRrecv irrecv(1);
+  match_window_t window = irrecv.matchWindow(1000, 25);
+  EXPECT_EQ(375, window.low);  // 750us
+  EXPECT_EQ(625, window.high);  // 1251us
+  window = irrecv.matchWindow(99, 35);
+  EXPECT_EQ(32, window.low);  // 64us is 32 ticks.
+  EXPECT_EQ(67, window.high);  // 134us is 67 ticks.
+  window = irrecv.matchWindow(99, 35, 1);
+  EXPECT_EQ(32, window.low);  // 63us is 31.5 ticks, so round inwards.
+  EXPECT_EQ(67, window.high);  // 135us is 67.5 ticks, so round inwards.
+
+  const uint32_t desired[] = {0, 1, 99, 100, 555, 1000, 4500, 9000, 100000};
+  const uint8_t tolerances[] = {0, 10, 25, 35, 100};
+  for (uint8_t d = 0; d < sizeof(desired) / sizeof(desired[0]); d++)
+    for (uint8_t t = 0; t < sizeof(tolerances); t++) {
+      window = irrecv.matchWindow(desired[d], tolerances[t], 25);
+      for (uint32_t ticks = 0; ticks <= desired[d]; ticks++) {
+        const uint32_t usecs = ticks * kRawTick;
+        const bool expected =
+            usecs >= irrecv.ticksLow(desired[d], tolerances[t], 25) &&
+            usecs <= irrecv.ticksHigh(desired[d], tolerances[t], 25);
+        ASSERT_EQ(expected, irrecv.match(ticks, window)) << desired[d] << ", "
+            << (uint16_t)tolerances[t] << ", " << ticks;
+        ASSERT_EQ(expected, irrecv.match(ticks, desired[d], tolerances[t], 25));
+      }
+    }
+
+  // Marks & Spaces.
+  EXPECT_TRUE(irrecv.matchMark(500, irrecv.markWindow(1000)));
+  EXPECT_TRUE(irrecv.matchMark(640, irrecv.markWindow(1000)));  // 1280us
+  EXPECT_FALSE(irrecv.matchMark(640, irrecv.markWindow(1000, kUseDefTol, 0)));
+  EXPECT_TRUE(irrecv.matchSpace(500, irrecv.spaceWindow(1000)));
+  EXPECT_TRUE(irrecv.matchSpace(360, irrecv.spaceWindow(1000)));  // 720us
+  EXPECT_FALSE(irrecv.matchSpace(360,
+                                 irrecv.spaceWindow(1000, kUseDefTol, 0)));
+  // Small values don't wrap around when the excess is removed.
+  window = irrecv.spaceWindow(0);
+  EXPECT_EQ(0, window.low);
+  EXPECT_EQ(0, window.high);
+  EXPECT_TRUE(irrecv.matchSpace(0, window));
+  EXPECT_FALSE(irrecv.matchSpace(1, window));
+}
+
 // Test matchData() on space encoded data.
 TEST(TestMatchData, SpaceEncoded) {
   IRsendTest irsend(0);
@@ -653,6 +736,57 @@ TEST(TestMatchData, ArbitraryEncoded) {
   ASSERT_FALSE(result.success);
 }
 
+// Test matchBytes() agrees with matchData() over multiple blocks of symbols.
+TEST(TestMatchBytes, AgreesWithMatchData) {
+  IRrecv irrecv(1);
+  const uint16_t kBytes = 11;  // More than a single block of 64 bits.
+  const uint8_t expected[kBytes] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD,
+                                    0xEF, 0xFF, 0x00, 0xA5};
+  uint16_t raw[kBytes * 8 * 2];
+  for (uint16_t bit = 0; bit < kBytes * 8; bit++) {
+    const bool one = (expected[bit / 8] >> (7 - bit % 8)) & 1;
+    raw[2 * bit] = (500 + (bit % 3) * 20) / kRawTick;  // Some jitter.
+    raw[2 * bit + 1] = (one ? 1500 : 500) / kRawTick;
+  }
+  uint8_t result[kBytes];
+  // MSBF order.
+  EXPECT_EQ(kBytes * 16,
+            irrecv.matchBytes(raw, result, kBytes * 16, kBytes,
+                              500, 1500, 500, 500));
+  for (uint16_t i = 0; i < kBytes; i++) {
+    EXPECT_EQ(expected[i], result[i]);
+    match_result_t data = irrecv.matchData(raw + i * 16, 8,
+                                           500, 1500, 500, 500);
+    ASSERT_TRUE(data.success);
+    EXPECT_EQ(data.data, result[i]);
+  }
+  // LSBF order.
+  EXPECT_EQ(kBytes * 16,
+            irrecv.matchBytes(raw, result, kBytes * 16, kBytes,
+                              500, 1500, 500, 500, kTolerance, kMarkExcess,
+                              false));
+  for (uint16_t i = 0; i < kBytes; i++)
+    EXPECT_EQ(reverseBits(expected[i], 8), result[i]);
+  // No trailing space, so the last space is never looked at.
+  // Note: The length check still requires a following entry (e.g. a footer).
+  raw[kBytes * 16 - 1] = 0;
+  EXPECT_EQ(0, irrecv.matchBytes(raw, result, kBytes * 16, kBytes,
+                                 500, 1500, 500, 500));
+  EXPECT_EQ(kBytes * 16 - 1,
+            irrecv.matchBytes(raw, result, kBytes * 16 + 1, kBytes,
+                              500, 1500, 500, 500, kTolerance, kMarkExcess,
+                              true, false));
+  EXPECT_EQ(expected[kBytes - 1], result[kBytes - 1]);
+  // A bad pulse in the second block.
+  raw[2 * 70] = 1000 / kRawTick;
+  EXPECT_EQ(0, irrecv.matchBytes(raw, result, kBytes * 16 + 1, kBytes,
+                                 500, 1500, 500, 500, kTolerance, kMarkExcess,
+                                 true, false));
+  // Not enough data.
+  EXPECT_EQ(0, irrecv.matchBytes(raw, result, kBytes * 16 - 2, kBytes,
+                                 500, 1500, 500, 500));
+}
+
 TEST(TestMatchGeneric, NormalWithNoAtleast) {
   IRsendTest irsend(0);
   IRrecv irrecv(1);
@@ -2068,3 +2202,793 @@ TEST(TestMatchManchesterData, SimulateLongFooter) {
   EXPECT_EQ("f38000d50m1000s2000m1000s1000m2000s5000",
             irsend.outputStr());
 }
+
+// Tests for the table of decoders used by decode().
+
+// Find the first position of a protocol in the decoder table.
+// Returns -1 if it isn't in the table.
+int16_t decoderIndex(const decode_type_t type) {
+  for (uint16_t i = 0; i < IRrecv::_nrDecoders; i++)
+    if (IRrecv::_decoders[i].type == type) return i;
+  return -1;
+}
+
+// Check that each decoder comes before the ones it can be confused with.
+TEST(TestDecodeTable, PriorityOrder) {
+  const decode_type_t edges[][2] = {
+      {AIWA_RC_T501, SANYO_LC7461}, {SANYO_LC7461, NEC},
+      {CARRIER_AC, NEC}, {PIONEER, NEC}, {EPSON, NEC},
+      {MILESTAG2, SONY},
+      {FUJITSU_AC, DENON}, {FUJITSU_AC, PANASONIC}, {DENON, PANASONIC},
+      {LG, SAMSUNG},
+      {GICABLE, JVC},
+      {BOSCH144, COOLIX},
+      {KELVINATOR, GREE},
+      {NEC, NEC_LIKE},
+      {HITACHI_AC424, HITACHI_AC3}, {MITSUBISHI136, HITACHI_AC3},
+      {HITACHI_AC3, HITACHI_AC2}, {HITACHI_AC3, HITACHI_AC},
+      {HITACHI_AC344, HITACHI_AC}, {HITACHI_AC264, HITACHI_AC},
+      {HITACHI_AC296, HITACHI_AC}, {HITACHI_AC2, HITACHI_AC},
+      {TRUMA, MULTIBRACKETS}};
+  for (uint16_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+    const int16_t first = decoderIndex(edges[i][0]);
+    const int16_t second = decoderIndex(edges[i][1]);
+    ASSERT_LE(0, first) << typeToString(edges[i][0]);
+    ASSERT_LE(0, second) << typeToString(edges[i][1]);
+    EXPECT_LT(first, second) << typeToString(edges[i][0]) << " must be before "
+                             << typeToString(edges[i][1]);
+  }
+}
+
+TEST(TestDecodeTable, PlausibleHeader) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  // 0 means don't screen.
+  EXPECT_TRUE(irrecv._plausibleHeader(&irsend.capture, kStartOffset, 0, 0));
+  EXPECT_TRUE(irrecv._plausibleHeader(&irsend.capture, kStartOffset,
+                                      8960, 4480));
+  EXPECT_TRUE(irrecv._plausibleHeader(&irsend.capture, kStartOffset, 8960, 0));
+  // Mark is too short.
+  EXPECT_FALSE(irrecv._plausibleHeader(&irsend.capture, kStartOffset,
+                                       3300, 0));
+  // Mark is okay, but the space is way off.
+  EXPECT_FALSE(irrecv._plausibleHeader(&irsend.capture, kStartOffset,
+                                       8960, 1000));
+  // Past the end of the data.
+  EXPECT_FALSE(irrecv._plausibleHeader(&irsend.capture,
+                                       irsend.capture.rawlen, 8960, 0));
+  // Loosening the tolerance loosens the screen.
+  EXPECT_FALSE(irrecv._plausibleHeader(&irsend.capture, kStartOffset,
+                                       8960, 2600));
+  irrecv.setTolerance(60);
+  EXPECT_TRUE(irrecv._plausibleHeader(&irsend.capture, kStartOffset,
+                                      8960, 2600));
+}
+
+TEST(TestDecodeTable, ScreeningReducesAttempts) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_EQ(0x807F40BF, irsend.capture.value);
+  // Only the NEC-like decoders ahead of it should have been tried.
+  EXPECT_GE(decoderIndex(NEC) + 1, irrecv._decodeAttempts);
+  // Few others share its header mark, so few table entries were looked at.
+  EXPECT_GT(IRrecv::_nrDecoders / 2, irrecv._decodeCandidates);
+
+  // The last protocol in the table shouldn't have to try them all.
+  const uint8_t expected[kEuromStateLength] = {
+      0x18, 0x27, 0x71, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x10, 0x21};
+  irsend.reset();
+  irsend.sendEurom(expected);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(EUROM, irsend.capture.decode_type);
+  EXPECT_GT(IRrecv::_nrDecoders / 2, irrecv._decodeAttempts);
+  // Nor even look at them all.
+  EXPECT_GT(IRrecv::_nrDecoders, irrecv._decodeCandidates);
+
+  // Without the screening, every decoder before it gets tried.
+  irrecv._screenDecoders = false;
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(EUROM, irsend.capture.decode_type);
+  EXPECT_EQ(decoderIndex(EUROM) + 1, irrecv._decodeAttempts);
+  EXPECT_EQ(irrecv._decodeAttempts, irrecv._decodeCandidates);
+}
+
+// The header mark index must cover every decoder, sorted by header mark.
+TEST(TestDecodeTable, HeaderIndex) {
+  IRrecv irrecv(1);  // Builds the index.
+  ASSERT_TRUE(IRrecv::_indexed);
+  std::vector<uint16_t> seen(IRrecv::_nrDecoders, 0);
+  for (uint16_t i = 0; i < IRrecv::_nrHdrIndex; i++) {
+    const uint8_t pos = IRrecv::_hdrIndex[i];
+    ASSERT_GT(IRrecv::_nrDecoders, pos);
+    seen[pos]++;
+    EXPECT_NE(0, IRrecv::_decoders[pos].hdrmark);
+    if (i) {
+      const uint8_t prev = IRrecv::_hdrIndex[i - 1];
+      EXPECT_LE(IRrecv::_decoders[prev].hdrmark,
+                IRrecv::_decoders[pos].hdrmark);
+      // Equal marks keep their table (i.e. priority) order.
+      if (IRrecv::_decoders[prev].hdrmark == IRrecv::_decoders[pos].hdrmark) {
+        EXPECT_LT(prev, pos);
+      }
+    }
+  }
+  for (uint16_t i = 0; i < IRrecv::_nrDecoders; i++) {
+    const bool headerless = IRrecv::_headerless[i / 8] & (1 << (i % 8));
+    EXPECT_EQ(IRrecv::_decoders[i].hdrmark == 0, headerless)
+        << typeToString(IRrecv::_decoders[i].type);
+    EXPECT_EQ(headerless ? 0 : 1, seen[i])
+        << typeToString(IRrecv::_decoders[i].type);
+  }
+}
+
+// The header mark buckets must pick exactly the decoders whose header mark
+// `_plausibleHeader()` would accept.
+TEST(TestDecodeTable, BucketsMatchTheScreen) {
+  IRrecv irrecv(1);
+  uint16_t rawbuf[3] = {0, 0, 0};
+  decode_results results;
+  results.rawbuf = rawbuf;
+  results.rawlen = 3;
+  std::vector<uint8_t> candidates((IRrecv::_nrDecoders + 7) / 8);
+  for (uint8_t tolerance = 25; tolerance <= 75; tolerance += 50) {
+    irrecv.setTolerance(tolerance);
+    for (uint32_t usecs = 0; usecs <= 20000; usecs += 10) {
+      rawbuf[kStartOffset] = usecs / kRawTick;
+      irrecv._findCandidates(&results, kStartOffset, candidates.data());
+      for (uint16_t i = 0; i < IRrecv::_nrDecoders; i++) {
+        const uint16_t hdrmark = IRrecv::_decoders[i].hdrmark;
+        const bool candidate = candidates[i / 8] & (1 << (i % 8));
+        ASSERT_EQ(irrecv._plausibleHeader(&results, kStartOffset, hdrmark, 0),
+                  candidate)
+            << typeToString(IRrecv::_decoders[i].type) << " @ " << usecs
+            << "us, tolerance " << static_cast<int>(tolerance) << "%";
+      }
+    }
+  }
+  // Past the end of the data, only the headerless ones are candidates.
+  irrecv._findCandidates(&results, results.rawlen, candidates.data());
+  for (uint16_t i = 0; i < candidates.size(); i++)
+    EXPECT_EQ(IRrecv::_headerless[i], candidates[i]);
+}
+
+// Bucketing mustn't change which of two look-alike protocols wins.
+TEST(TestDecodeTable, BucketingKeepsPriority) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  const uint8_t bosch[kBosch144StateLength] = {
+      0xB2, 0x4D, 0x3F, 0xC0, 0x00, 0xFF,
+      0xB2, 0x4D, 0x3F, 0xC0, 0x00, 0xFF,
+      0xD5, 0x64, 0x00, 0x10, 0x00, 0x49};
+  irsend.reset();
+  irsend.sendBosch144(bosch);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(BOSCH144, irsend.capture.decode_type);
+
+  const uint8_t kelvinator[kKelvinatorStateLength] = {
+      0x19, 0x0B, 0x80, 0x50, 0x00, 0x00, 0x00, 0xE0,
+      0x19, 0x0B, 0x80, 0x70, 0x00, 0x00, 0x10, 0xF0};
+  irsend.reset();
+  irsend.sendKelvinator(kelvinator);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(KELVINATOR, irsend.capture.decode_type);
+}
+
+// `_minRawLen[]` is indexed by protocol, so each row must be in its place.
+TEST(TestDecodeTable, MinRawLenRows) {
+  for (int i = 0; i <= kLastDecodeType; i++)
+    EXPECT_EQ(i, IRrecv::_minRawLen[i].type)
+        << "Expected the row for " << typeToString((decode_type_t)i);
+}
+
+TEST(TestDecodeTable, LengthScreening) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  const uint16_t samsung_min = IRrecv::_minRawLen[SAMSUNG].rawlen;
+  ASSERT_LT(0, samsung_min);
+  ASSERT_LE(samsung_min, irsend.capture.rawlen);
+  irsend.capture.rawlen = samsung_min;
+  EXPECT_TRUE(irrecv._longEnough(&irsend.capture, kStartOffset, SAMSUNG));
+  EXPECT_FALSE(irrecv._longEnough(&irsend.capture, kStartOffset + 2, SAMSUNG));
+  irsend.capture.rawlen--;
+  EXPECT_FALSE(irrecv._longEnough(&irsend.capture, kStartOffset, SAMSUNG));
+  // It really is too short.
+  EXPECT_FALSE(irrecv.decodeSAMSUNG(&irsend.capture, kStartOffset,
+                                    kSamsungBits, false));
+  // Protocols we don't screen.
+  EXPECT_EQ(0, IRrecv::_minRawLen[RC5].rawlen);
+  EXPECT_TRUE(irrecv._longEnough(&irsend.capture, kStartOffset, RC5));
+  EXPECT_TRUE(irrecv._longEnough(&irsend.capture, kStartOffset, UNKNOWN));
+
+  // A NEC repeat code is tiny, but it's still a valid NEC message.
+  irsend.reset();
+  irsend.sendNEC(irsend.encodeNEC(0, 0), kNECBits, 1);
+  // Just the repeat code.
+  irsend.makeDecodeResult(kHeader + 2 * kNECBits + kFooter);
+  EXPECT_TRUE(irrecv._longEnough(&irsend.capture, kStartOffset, NEC));
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_TRUE(irsend.capture.repeat);
+}
+
+TEST(TestDecodeTable, PulseIndex) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  irrecv._indexPulses(&irsend.capture);
+  EXPECT_TRUE(irrecv._pulses.valid);
+  EXPECT_FALSE(irrecv._pulses.overflow);
+  // Marks: Header & bits/footer.
+  ASSERT_EQ(2, irrecv._pulses.nmarks);
+  EXPECT_EQ(8960 / kRawTick, irrecv._pulses.marks[0].low);
+  EXPECT_EQ(1, irrecv._pulses.marks[0].count);
+  EXPECT_EQ(560 / kRawTick, irrecv._pulses.marks[1].low);
+  EXPECT_EQ(33, irrecv._pulses.marks[1].count);
+  // Spaces: Header, '1' bits, '0' bits, & the trailing gap.
+  EXPECT_EQ(4, irrecv._pulses.nspaces);
+  EXPECT_TRUE(irrecv._hasMark(&irsend.capture, 560));
+  EXPECT_TRUE(irrecv._hasMark(&irsend.capture, 525));  // kJvcBitMark
+  EXPECT_FALSE(irrecv._hasMark(&irsend.capture, 260));  // kSharpBitMark
+  EXPECT_FALSE(irrecv._hasMark(&irsend.capture, 4500));
+
+  // A new decode invalidates the previous index.
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_FALSE(irrecv._pulses.valid);  // NEC didn't need it.
+
+  // Too many distinct durations to be useful, so it can't rule anything out.
+  const uint16_t kVaried = 2 * kMaxPulseClusters + 3;
+  uint16_t varied[kVaried];
+  for (uint16_t i = 0; i < kVaried; i++) varied[i] = 100 << (i / 2);
+  irsend.reset();
+  irsend.sendRaw(varied, kVaried, 38);
+  irsend.makeDecodeResult();
+  irrecv._indexPulses(&irsend.capture);
+  EXPECT_TRUE(irrecv._pulses.overflow);
+  EXPECT_TRUE(irrecv._hasMark(&irsend.capture, 260));
+}
+
+TEST(TestDecodeTable, PulseIndexIsLazy) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  // The bit mark is found straight after the header, so that is all it needs.
+  EXPECT_TRUE(irrecv._hasMark(&irsend.capture, 560));
+  EXPECT_TRUE(irrecv._pulses.valid);
+  EXPECT_EQ(kStartOffset + 3, irrecv._pulses.next);
+  EXPECT_EQ(2, irrecv._pulses.nmarks);
+  // A mark that isn't there needs all of it. The same as indexing it at once.
+  EXPECT_FALSE(irrecv._hasMark(&irsend.capture, 260));
+  EXPECT_EQ(irsend.capture.rawlen, irrecv._pulses.next);
+  ASSERT_EQ(2, irrecv._pulses.nmarks);
+  EXPECT_EQ(33, irrecv._pulses.marks[1].count);
+  EXPECT_EQ(4, irrecv._pulses.nspaces);
+  // Then it is answered from the index.
+  EXPECT_TRUE(irrecv._hasMark(&irsend.capture, 8960));
+  EXPECT_FALSE(irrecv._hasMark(&irsend.capture, 4500));
+}
+
+// Feed a capture to the receiver one entry at a time, like the ISR does, and
+// try to decode it early after each one.
+// Returns the nr. of entries it took to decode, or 0 if it never did.
+uint16_t earlyDecodeLength(IRrecv *irrecv, const decode_results *capture,
+                           decode_results *results) {
+  atomic_irparams_t *params = irrecv->_getParamsPtr();
+  irrecv->resume();
+  params->rcvstate = kMarkState;
+  for (uint16_t i = 0; i < capture->rawlen; i++) {
+    params->rawbuf[i] = capture->rawbuf[i];
+    params->rawlen = i + 1;
+    if (irrecv->_decodeEarly(results, NULL)) return params->rawlen;
+  }
+  return 0;
+}
+
+TEST(TestEarlyDecode, Default) {
+  IRrecv irrecv(1);
+  EXPECT_FALSE(irrecv.getEarlyDecode());
+  irrecv.setEarlyDecode();
+  EXPECT_TRUE(irrecv.getEarlyDecode());
+  irrecv.setEarlyDecode(false);
+  EXPECT_FALSE(irrecv.getEarlyDecode());
+}
+
+TEST(TestEarlyDecode, DecodesBeforeTheGap) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  decode_results results;
+  irsend.begin();
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(irsend.capture.rawlen - 1,
+            earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  EXPECT_EQ(NEC, results.decode_type);
+  EXPECT_EQ(kNECBits, results.bits);
+  EXPECT_EQ(0x807F40BF, results.value);
+  EXPECT_EQ(kStopState, irrecv._getParamsPtr()->rcvstate);
+
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(irsend.capture.rawlen - 1,
+            earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  EXPECT_EQ(SAMSUNG, results.decode_type);
+  EXPECT_EQ(0xE0E09966, results.value);
+}
+
+TEST(TestEarlyDecode, VariableLengthProtocolsWait) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  decode_results results;
+  irsend.begin();
+
+  // We can't tell how many bits these have until the gap at the end, so they
+  // are left for the timeout & the normal decode.
+  irsend.reset();
+  irsend.sendSony(0x240, kSony12Bits, 0);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(0, earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  irsend.reset();
+  irsend.sendRC5(0x175, kRC5Bits);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(0, earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  irsend.reset();
+  irsend.sendRC6(0x175, kRC6Mode0Bits);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(0, earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  EXPECT_EQ(kMarkState, irrecv._getParamsPtr()->rcvstate);
+}
+
+// The start of a RC6-36 (MCE) message looks like a whole RC6 Mode 0 one.
+TEST(TestEarlyDecode, RC6_36IsntCutShort) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  decode_results results;
+  irsend.begin();
+  irrecv.setEarlyDecode();
+
+  irsend.reset();
+  irsend.sendRC6(0xC800F740C, kRC6_36Bits);
+  irsend.makeDecodeResult();
+  EXPECT_EQ(0, earlyDecodeLength(&irrecv, &irsend.capture, &results));
+  EXPECT_EQ(kMarkState, irrecv._getParamsPtr()->rcvstate);
+  // Once it is over, it decodes as the whole message.
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(RC6, irsend.capture.decode_type);
+  EXPECT_EQ(kRC6_36Bits, irsend.capture.bits);
+  EXPECT_EQ(0xC800F740C, irsend.capture.value);
+}
+
+TEST(TestEarlyDecode, OnlyTriesNewData) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  decode_results results;
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  atomic_irparams_t *params = irrecv._getParamsPtr();
+  irrecv.resume();
+  params->rcvstate = kMarkState;
+  for (uint16_t i = 0; i < irsend.capture.rawlen - 2; i++)
+    params->rawbuf[i] = irsend.capture.rawbuf[i];
+  params->rawlen = irsend.capture.rawlen - 2;  // Missing the footer mark.
+  EXPECT_FALSE(irrecv._decodeEarly(&results, NULL));
+  params->rawbuf[params->rawlen] = irsend.capture.rawbuf[params->rawlen];
+  params->rawlen = params->rawlen + 1;
+  EXPECT_TRUE(irrecv._decodeEarly(&results, NULL));
+  EXPECT_EQ(NEC, results.decode_type);
+  // Nothing new, so don't report it again.
+  irrecv._getParamsPtr()->rcvstate = kMarkState;
+  EXPECT_FALSE(irrecv._decodeEarly(&results, NULL));
+  // resume() starts afresh.
+  irrecv.resume();
+  EXPECT_EQ(0, irrecv._early_rawlen);
+}
+
+// Capture a message into the current capture slot, like the ISR does.
+void captureIntoSlot(IRrecv *irrecv, const decode_results *capture) {
+  atomic_irparams_t *params = irrecv->_getParamsPtr();
+  params->rcvstate = kMarkState;
+  for (uint16_t i = 0; i < capture->rawlen && i < params->bufsize; i++) {
+    params->rawbuf[i] = capture->rawbuf[i];
+    params->rawlen = i + 1;
+  }
+  if (capture->rawlen > params->bufsize) params->overflow = true;
+  irrecv->_timeout();
+}
+
+TEST(TestCaptureSlots, Default) {
+  IRrecv irrecv(1);
+  EXPECT_EQ(0, irrecv.getCaptureSlots());
+  irrecv.setCaptureSlots(1);
+  EXPECT_EQ(0, irrecv.getCaptureSlots());
+  irrecv.setCaptureSlots(3);
+  EXPECT_EQ(3, irrecv.getCaptureSlots());
+  EXPECT_EQ(0, irrecv.getDropCount());
+  EXPECT_EQ(0, irrecv.getOverflowCount());
+  irrecv.setCaptureSlots(0);
+  EXPECT_EQ(0, irrecv.getCaptureSlots());
+}
+
+TEST(TestCaptureSlots, BackToBackMessages) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1, kRawBuf);
+  decode_results results;
+  irsend.begin();
+  irrecv.setCaptureSlots(3);
+
+  // Nothing captured yet.
+  EXPECT_FALSE(irrecv.decode(&results));
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF, kNECBits, 0);
+  irsend.makeDecodeResult();
+  captureIntoSlot(&irrecv, &irsend.capture);
+  irsend.reset();
+  irsend.sendSony(0x240, kSony12Bits, 0);
+  irsend.makeDecodeResult();
+  captureIntoSlot(&irrecv, &irsend.capture);
+  // The ring is full, so this one is dropped.
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966, kSamsungBits, 0);
+  irsend.makeDecodeResult();
+  captureIntoSlot(&irrecv, &irsend.capture);
+  EXPECT_EQ(1, irrecv.getDropCount());
+
+  // Messages come out oldest first, & are decoded in place.
+  ASSERT_TRUE(irrecv.decode(&results));
+  EXPECT_EQ(NEC, results.decode_type);
+  EXPECT_EQ(0x807F40BF, results.value);
+  EXPECT_EQ(irrecv._getParamsPtr()->slots[0].rawbuf, results.rawbuf);
+  // Once we are done with a slot, there is room for another message.
+  irrecv.resume();
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966, kSamsungBits, 0);
+  irsend.makeDecodeResult();
+  captureIntoSlot(&irrecv, &irsend.capture);
+  EXPECT_EQ(1, irrecv.getDropCount());
+  ASSERT_TRUE(irrecv.decode(&results));
+  EXPECT_EQ(SONY, results.decode_type);
+  EXPECT_EQ(0x240, results.value);
+  ASSERT_TRUE(irrecv.decode(&results));
+  EXPECT_EQ(SAMSUNG, results.decode_type);
+  EXPECT_EQ(0xE0E09966, results.value);
+  irrecv.resume();
+  EXPECT_FALSE(irrecv.decode(&results));
+  EXPECT_EQ(1, irrecv.getDropCount());
+}
+
+TEST(TestCaptureSlots, OverflowAndSaveBuffer) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1, 20);
+  decode_results results;
+  irparams_t save;
+  uint16_t savebuf[20];
+  save.rawbuf = savebuf;
+  irsend.begin();
+  irrecv.setCaptureSlots(2);
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF, kNECBits, 0);
+  irsend.makeDecodeResult();
+  captureIntoSlot(&irrecv, &irsend.capture);
+  EXPECT_EQ(1, irrecv.getOverflowCount());
+  EXPECT_EQ(0, irrecv.getDropCount());
+  irrecv.decode(&results, &save);
+  EXPECT_TRUE(results.overflow);
+  EXPECT_EQ(20, results.rawlen);
+  EXPECT_EQ(savebuf, results.rawbuf);
+  // The copy frees the slot straight away.
+  EXPECT_EQ(irrecv._getParamsPtr()->head, irrecv._getParamsPtr()->tail);
+}
+
+#if ENABLE_DECODE_PROFILING
+TEST(TestDecodeProfile, CountsAttemptsAndSuccesses) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+
+  decode_profile_t nec = irrecv.getDecodeProfile(NEC);
+  EXPECT_EQ(2, nec.attempts);
+  EXPECT_EQ(2, nec.successes);
+  EXPECT_EQ(0, nec.rejects);
+  // Decoders before NEC were tried, but failed.
+  decode_profile_t sanyo = irrecv.getDecodeProfile(SANYO_LC7461);
+  EXPECT_EQ(2, sanyo.attempts);
+  EXPECT_EQ(0, sanyo.successes);
+  EXPECT_EQ(2, sanyo.rejects);
+  EXPECT_LT(0, sanyo.reject_offsets);
+  // Decoders after it weren't tried at all.
+  EXPECT_EQ(0, irrecv.getDecodeProfile(SONY).attempts);
+  // Out of range.
+  EXPECT_EQ(0, irrecv.getDecodeProfile(UNKNOWN).attempts);
+
+  irrecv.resetDecodeProfile();
+  EXPECT_EQ(0, irrecv.getDecodeProfile(NEC).attempts);
+  EXPECT_EQ(0, irrecv.getDecodeProfile(NEC).nsecs);
+}
+
+TEST(TestDecodeProfile, RejectOffset) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  // A Samsung message, with a corrupted 3rd bit.
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  irsend.capture.rawbuf[8] = 5000 / kRawTick;
+  irrecv.decode(&irsend.capture);
+  decode_profile_t samsung = irrecv.getDecodeProfile(SAMSUNG);
+  EXPECT_EQ(1, samsung.attempts);
+  EXPECT_EQ(0, samsung.successes);
+  EXPECT_EQ(1, samsung.rejects);
+  EXPECT_EQ(7, samsung.reject_offsets);  // The mark of the 3rd bit.
+}
+
+TEST(TestDecodeProfile, Output) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  EXPECT_EQ(
+      "Protocol              Attempts Successes     uSecs Reject at\n",
+      irrecv.decodeProfileToString());
+  EXPECT_EQ("[]", irrecv.decodeProfileToJson());
+
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  // Make the timing deterministic.
+  for (uint16_t i = 0; i <= kLastDecodeType; i++) irrecv._profile[i].nsecs = 0;
+  irrecv._profile[NEC].nsecs = 12345;
+  const String table = irrecv.decodeProfileToString();
+  EXPECT_NE(std::string::npos, table.find(
+      "\nNEC                          1         1        12         -\n"));
+  const String json = irrecv.decodeProfileToJson();
+  EXPECT_NE(std::string::npos, json.find(
+      "{\"protocol\":\"NEC\",\"attempts\":1,\"successes\":1,\"usecs\":12,"
+      "\"rejects\":0,\"reject_offsets\":0}"));
+  EXPECT_EQ('[', json[0]);
+  EXPECT_EQ(']', json[json.length() - 1]);
+}
+#endif  // ENABLE_DECODE_PROFILING
+
+#if ENABLE_MATCH_TRACE
+TEST(TestMatchTrace, RecordsMatches) {
+  IRrecv irrecv(1);
+  EXPECT_EQ(0, irrecv.getMatchTraceCount());
+  EXPECT_EQ(
+      "Protocol              Offset    Step   uSecs     Min     Max Matched\n",
+      irrecv.matchTraceToString());
+
+  EXPECT_TRUE(irrecv.matchMark(500 / kRawTick, 500));
+  EXPECT_FALSE(irrecv.matchSpace(1000 / kRawTick, 500));
+  EXPECT_TRUE(irrecv.matchAtLeast(20000 / kRawTick, 10000));
+  ASSERT_EQ(3, irrecv.getMatchTraceCount());
+  match_trace_t trace = irrecv.getMatchTrace(0);
+  EXPECT_EQ(UNKNOWN, trace.protocol);  // Not called by a decoder.
+  EXPECT_EQ(500, trace.measured);
+  EXPECT_GE(500, trace.low);
+  EXPECT_LE(500, trace.high);
+  EXPECT_TRUE(trace.matched);
+  trace = irrecv.getMatchTrace(1);
+  EXPECT_EQ(1, trace.step);
+  EXPECT_EQ(1000, trace.measured);
+  EXPECT_FALSE(trace.matched);
+  trace = irrecv.getMatchTrace(2);
+  EXPECT_EQ(20000, trace.measured);
+  EXPECT_EQ(UINT32_MAX, trace.high);  // No upper limit.
+  EXPECT_TRUE(trace.matched);
+  // Out of range.
+  EXPECT_EQ(0, irrecv.getMatchTrace(3).measured);
+  EXPECT_NE(std::string::npos, irrecv.matchTraceToString().find(
+      "\nUNKNOWN                    0       2   20000    7500       -"
+      "     Yes\n"));
+
+  // Only the most recent matches are kept.
+  for (uint16_t i = 0; i < kMatchTraceLength; i++)
+    irrecv.matchMark(i, 500);
+  EXPECT_EQ(kMatchTraceLength, irrecv.getMatchTraceCount());
+  EXPECT_EQ(0, irrecv.getMatchTrace(0).measured);
+  EXPECT_EQ((kMatchTraceLength - 1) * kRawTick,
+            irrecv.getMatchTrace(kMatchTraceLength - 1).measured);
+
+  irrecv.clearMatchTrace();
+  EXPECT_EQ(0, irrecv.getMatchTraceCount());
+}
+
+// The failed Samsung matches seen by `samsungFailureHook()`.
+static std::vector<match_trace_t> samsungFailures;
+
+void samsungFailureHook(const match_trace_t *trace) {
+  if (trace->protocol == SAMSUNG && !trace->matched)
+    samsungFailures.push_back(*trace);
+}
+
+TEST(TestMatchTrace, Hook) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  // A Samsung message, with a corrupted space in the 3rd bit.
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  irsend.capture.rawbuf[8] = 5000 / kRawTick;
+  samsungFailures.clear();
+  irrecv.setMatchTraceHook(samsungFailureHook);
+  irrecv.decode(&irsend.capture);
+  // The space didn't match that of a '1' or a '0'.
+  ASSERT_EQ(2, samsungFailures.size());
+  for (uint8_t i = 0; i < samsungFailures.size(); i++) {
+    EXPECT_EQ(kStartOffset, samsungFailures[i].offset);
+    EXPECT_EQ(5000, samsungFailures[i].measured);
+    EXPECT_GT(5000, samsungFailures[i].high);
+  }
+  EXPECT_EQ(7, samsungFailures[0].step);  // The header etc. matched first.
+
+  // Matches made outside of a decoder are not attributed to one.
+  irrecv.setMatchTraceHook(NULL);
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(2, samsungFailures.size());
+  irrecv.matchMark(1, 500);
+  EXPECT_EQ(UNKNOWN,
+            irrecv.getMatchTrace(irrecv.getMatchTraceCount() - 1).protocol);
+}
+#endif  // ENABLE_MATCH_TRACE
+
+// Tracing must never change the result of a match. This runs with it compiled
+// out (`make run`) & in (`make run_features`), so both paths are covered.
+TEST(TestMatchTrace, SameResultsWithOrWithoutTracing) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  EXPECT_TRUE(irrecv.matchMark(500 / kRawTick, 500));
+  EXPECT_FALSE(irrecv.matchMark(1000 / kRawTick, 500));
+  EXPECT_TRUE(irrecv.matchSpace(500 / kRawTick, 500));
+  EXPECT_FALSE(irrecv.matchSpace(1000 / kRawTick, 500));
+  EXPECT_TRUE(irrecv.matchAtLeast(20000 / kRawTick, 10000));
+  EXPECT_FALSE(irrecv.matchAtLeast(5000 / kRawTick, 10000));
+
+  // The fast data matcher traces why a bit failed, in a few different ways.
+  // A space that is neither a '1' or a '0'.
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  irsend.capture.rawbuf[8] = 5000 / kRawTick;
+  irrecv.decode(&irsend.capture);
+  EXPECT_NE(SAMSUNG, irsend.capture.decode_type);
+  // A mark that is neither.
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  irsend.capture.rawbuf[7] = 5000 / kRawTick;
+  irrecv.decode(&irsend.capture);
+  EXPECT_NE(SAMSUNG, irsend.capture.decode_type);
+  // Nothing wrong with it.
+  irsend.reset();
+  irsend.sendSAMSUNG(0xE0E09966);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(SAMSUNG, irsend.capture.decode_type);
+  EXPECT_EQ(0xE0E09966, irsend.capture.value);
+}
+
+// A made up protocol, to check the descriptors with.
+constexpr ir_protocol_t kTestProtocol = {
+    9000, 4500, 560, 1690, 560, 560, 560, 40000, 0,
+    38, kDutyDefault, true, kUseDefTol, kMarkExcess};
+constexpr protocol_windows_t kTestWindows =
+    IRrecv::protocolWindows(kTestProtocol);
+
+TEST(TestProtocolDescriptors, WindowsMatchTheRuntimeOnes) {
+  IRrecv irrecv(1);
+  const uint32_t marks[] = {9000, 560};
+  const uint32_t spaces[] = {4500, 1690, 560, 40000};
+  const match_window_t cmarks[] = {kTestWindows.hdrmark,
+                                   kTestWindows.data.onemark};
+  const match_window_t cspaces[] = {kTestWindows.hdrspace,
+                                    kTestWindows.data.onespace,
+                                    kTestWindows.data.zerospace,
+                                    kTestWindows.gap};
+  for (uint8_t i = 0; i < 2; i++) {
+    match_window_t window = irrecv.markWindow(marks[i]);
+    EXPECT_EQ(window.low, cmarks[i].low);
+    EXPECT_EQ(window.high, cmarks[i].high);
+  }
+  for (uint8_t i = 0; i < 4; i++) {
+    match_window_t window = irrecv.spaceWindow(spaces[i]);
+    EXPECT_EQ(window.low, cspaces[i].low);
+    EXPECT_EQ(window.high, cspaces[i].high);
+  }
+  // An explicit tolerance in the descriptor is used over the default.
+  ir_protocol_t strict = kTestProtocol;
+  strict.tolerance = 10;
+  const protocol_windows_t windows = IRrecv::protocolWindows(strict);
+  match_window_t window = irrecv.markWindow(9000, 10);
+  EXPECT_EQ(window.low, windows.hdrmark.low);
+  EXPECT_EQ(window.high, windows.hdrmark.high);
+}
+
+TEST(TestProtocolDescriptors, SendAndMatch) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendProtocol(kTestProtocol, 0xA5, 8);
+  EXPECT_EQ(
+      "f38000d50"
+      "m9000s4500"
+      "m560s1690m560s560m560s1690m560s560m560s560m560s1690m560s560m560s1690"
+      "m560s40000",
+      irsend.outputStr());
+  irsend.reset();
+  irsend.sendProtocol(kTestProtocol, 0xA5, 8);
+  irsend.makeDecodeResult();
+  uint64_t data = 0;
+  EXPECT_EQ(2 + 8 * 2 + 2,
+            irrecv.matchProtocol(irsend.capture.rawbuf + kStartOffset, &data,
+                                 irsend.capture.rawlen - kStartOffset, 8,
+                                 kTestProtocol, kTestWindows));
+  EXPECT_EQ(0xA5, data);
+  // Too short a header.
+  irsend.capture.rawbuf[kStartOffset] = 4000 / kRawTick;
+  EXPECT_EQ(0, irrecv.matchProtocol(irsend.capture.rawbuf + kStartOffset,
+                                    &data,
+                                    irsend.capture.rawlen - kStartOffset, 8,
+                                    kTestProtocol, kTestWindows));
+}
+
+TEST(TestProtocolDescriptors, HonoursAChangedTolerance) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  // Stretch a '1' bit's space by 35%. Outside the default tolerance.
+  irsend.capture.rawbuf[4] = irsend.capture.rawbuf[4] * 135 / 100;
+  EXPECT_FALSE(irrecv.decodeNEC(&irsend.capture));
+  irrecv.setTolerance(40);
+  ASSERT_TRUE(irrecv.decodeNEC(&irsend.capture));
+  EXPECT_EQ(0x807F40BF, irsend.capture.value);
+}
@@ -1,9 +1,11 @@
 // Copyright 2017,2019 David Conran
 
+#include <type_traits>
 #include "IRsend_test.h"
 #include "IRrecv_test.h"
 #include "IRsend.h"
 #include "IRutils.h"
+#include "ir_NEC.h"
 #include "gtest/gtest.h"
 
 // Tests sendData().
@@ -379,6 +381,41 @@ TEST(TestLowLevelSend, SpaceNoModulation) {
   EXPECT_EQ("[Off]1000usecs", irsend.low_level_sequence);
 }
 
+TEST(TestLowLevelSend, MarkFractionalCarrier) {
+  IRsendLowLevelTest irsend(0);
+
+  irsend.begin();
+  EXPECT_FALSE(irsend.getFractionalCarrier());
+  irsend.setFractionalCarrier(true);
+  EXPECT_TRUE(irsend.getFractionalCarrier());
+
+  // 38kHz is a period of 26.316us. Cycles start at 0, 26.3, 52.6, & 78.9us.
+  irsend.reset();
+  irsend.enableIROut(38000, 50);
+  EXPECT_EQ(4, irsend.mark(100));
+  EXPECT_EQ(
+      "[On]13usecs[Off]13usecs[On]13usecs[Off]13usecs[On]13usecs[Off]13usecs"
+      "[On]14usecs[Off]8usecs",
+      irsend.low_level_sequence);
+
+  // The fractions don't accumulate over a long mark. i.e. 10ms @ 38kHz
+  irsend.reset();
+  EXPECT_EQ(380, irsend.mark(10000));
+  irsend.enableIROut(57600, 50);
+  EXPECT_EQ(576, irsend.mark(10000));
+  // vs. the whole uSec periods of the normal carrier generator.
+  irsend.setFractionalCarrier(false);
+  irsend.enableIROut(38000, 50);
+  EXPECT_NE(380, irsend.mark(10000));
+
+  // No modulation is unaffected.
+  irsend.setFractionalCarrier(true);
+  irsend.reset();
+  irsend.enableIROut(38000, 100);
+  EXPECT_EQ(1, irsend.mark(1000));
+  EXPECT_EQ("[On]1000usecs[Off]", irsend.low_level_sequence);
+}
+
 // Test expected to work/produce a message for simple irsend:send()
 TEST(TestSend, GenericSimpleSendMethod) {
   IRsendTest irsend(0);
@@ -863,3 +900,355 @@ TEST(TestSendManchester, SendOverLargeData) {
       "m300",
       irsend.outputStr());
 }
+
+// Tests for rendering messages, & transmitting them later.
+
+// It owns its entries, so it mustn't be copied. (copyFrom() copies them.)
+static_assert(!std::is_copy_constructible<IRpulseBuffer>::value,
+              "IRpulseBuffer must not be copy constructible");
+static_assert(!std::is_copy_assignable<IRpulseBuffer>::value,
+              "IRpulseBuffer must not be copy assignable");
+
+TEST(TestPulseBuffer, MergesAndOverflows) {
+  IRpulseBuffer pulses(4);
+  EXPECT_EQ(0, pulses.getLength());
+  EXPECT_TRUE(pulses.addCarrier(36000, 50));
+  EXPECT_TRUE(pulses.addCarrier(38000, 33));  // Replaces the unused one.
+  EXPECT_TRUE(pulses.addMark(100));
+  EXPECT_TRUE(pulses.addMark(200));
+  EXPECT_TRUE(pulses.addSpace(0));  // Ignored.
+  EXPECT_TRUE(pulses.addCarrier(38000, 33));  // No change, so ignored.
+  EXPECT_TRUE(pulses.addSpace(50));
+  EXPECT_TRUE(pulses.addSpace(60));
+  ASSERT_EQ(3, pulses.getLength());
+  EXPECT_EQ(kPulseCarrier | 38000 | (33 << kPulseDutyOffset),
+            pulses.getEntry(0));
+  EXPECT_EQ(kPulseMark | 300, pulses.getEntry(1));
+  EXPECT_EQ(kPulseSpace | 110, pulses.getEntry(2));
+  EXPECT_EQ(410, pulses.getDuration());
+  EXPECT_FALSE(pulses.hasOverflowed());
+
+  EXPECT_TRUE(pulses.addMark(10));
+  EXPECT_FALSE(pulses.addSpace(10));  // Full.
+  EXPECT_TRUE(pulses.hasOverflowed());
+  EXPECT_EQ(4, pulses.getLength());
+  IRsendTest irsend(0);
+  irsend.begin();
+  EXPECT_FALSE(irsend.play(&pulses));  // It's incomplete, so don't send it.
+
+  pulses.clear();
+  EXPECT_EQ(0, pulses.getLength());
+  EXPECT_EQ(0, pulses.getDuration());
+  EXPECT_FALSE(pulses.hasOverflowed());
+}
+
+TEST(TestPulseBuffer, RenderThenPlay) {
+  IRsend irsend(0);
+  IRpulseBuffer pulses;
+  irsend.begin();
+  irsend.renderTo(&pulses);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  EXPECT_EQ(kPulseCarrier | 38000 | (33 << kPulseDutyOffset),
+            pulses.getEntry(0));
+  EXPECT_EQ(kPulseMark | kNecHdrMark, pulses.getEntry(1));
+  EXPECT_EQ(kPulseSpace | kNecHdrSpace, pulses.getEntry(2));
+  // The carrier, the header, the data, & the footer.
+  EXPECT_EQ(1 + 2 + 2 * kNECBits + 2, pulses.getLength());
+  EXPECT_EQ(kNecMinCommandLength, pulses.getDuration());
+
+  IRsendTest player(0);
+  player.begin();
+  player.reset();
+  EXPECT_TRUE(player.play(&pulses));
+  IRsendTest direct(0);
+  direct.begin();
+  direct.reset();
+  direct.sendNEC(0x20DF10EF);
+  const std::string expected = direct.outputStr();
+  EXPECT_EQ(expected, player.outputStr());
+  // It can be played again, & via a transmitter.
+  IRgpioTransmitter transmitter(&player);
+  EXPECT_TRUE(transmitter.transmit(&pulses));
+  EXPECT_EQ(expected, player.outputStr());
+  EXPECT_FALSE(transmitter.transmit(NULL));
+}
+
+// Rendering then playing a message should send exactly what sending it would.
+TEST(TestPulseBuffer, RenderingMatchesSendingForEveryProtocol) {
+  uint8_t state[kStateSizeMax];
+  for (uint16_t i = 0; i < kStateSizeMax; i++) state[i] = i * 0x1D;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    const decode_type_t type = (decode_type_t)i;
+    const uint16_t nbits = IRsend::defaultBits(type);
+    if (!nbits) continue;
+    const uint16_t repeat = IRsend::minRepeats(type) + 1;
+    IRsendTest direct(0);
+    direct.begin();
+    direct.reset();
+    IRsend renderer(0);
+    IRpulseBuffer pulses(2000);
+    renderer.begin();
+    renderer.renderTo(&pulses);
+    bool sent;
+    if (hasACState(type)) {
+      sent = direct.send(type, state, nbits / 8);
+      renderer.send(type, state, nbits / 8);
+    } else {
+      const uint64_t value = (nbits >= 64) ? 0xA5A5A5A5A5A5A5A5ULL :
+          0xA5A5A5A5A5A5A5A5ULL & ((1ULL << nbits) - 1);
+      sent = direct.send(type, value, nbits, repeat);
+      renderer.send(type, value, nbits, repeat);
+    }
+    if (!sent) continue;
+    IRsendTest player(0);
+    player.begin();
+    player.reset();
+    EXPECT_TRUE(player.play(&pulses));
+    EXPECT_EQ(direct.outputStr(), player.outputStr()) << typeToString(type);
+  }
+}
+
+// Rendering takes no real time, so it mustn't move the clock that everything
+// else is timed with. e.g. An IRsendQueue waiting out a gap.
+TEST(TestPulseBuffer, RenderingLeavesTheClockAlone) {
+  IRsend irsend(0);
+  IRpulseBuffer pulses;
+  irsend.begin();
+  IRtimer timer;
+  irsend.renderTo(&pulses);
+  // JVC times its messages, to pad the repeats out to a fixed length.
+  irsend.sendJVC(0xC2B8, kJvcBits, 1);
+  irsend.renderTo(NULL);
+  EXPECT_EQ(2 * 60000, pulses.getDuration());  // 2 x kJvcRptLength
+  EXPECT_EQ(0, timer.elapsed());
+}
+
+uint16_t queue_sent_ids[4];
+uint8_t queue_sent_count;
+
+void recordQueueSent(const uint16_t id) {
+  queue_sent_ids[queue_sent_count++ % 4] = id;
+}
+
+// It owns its buffers, so it mustn't be copied.
+static_assert(!std::is_copy_constructible<IRsendQueue>::value,
+              "IRsendQueue must not be copy constructible");
+static_assert(!std::is_copy_assignable<IRsendQueue>::value,
+              "IRsendQueue must not be copy assignable");
+
+TEST(TestSendQueue, SendsInTheBackground) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  irsend.reset();
+  IRsendQueue queue(&irsend);
+  IRpulseBuffer pulses;
+  irsend.renderTo(&pulses);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  const uint32_t gap =
+      pulses.getEntry(pulses.getLength() - 1) & kPulseValueMask;
+  EXPECT_LE(kNecMinGap, gap);
+  irsend.sendNEC(0x20DF10EF);
+  std::string expected = irsend.outputStr();
+  // A blocking send ends with the gap, but the queue waits it out instead.
+  expected.resize(expected.rfind('s'));
+  queue_sent_count = 0;
+
+  EXPECT_FALSE(queue.loop());  // Nothing to do.
+  EXPECT_EQ(0, queue.getDepth());
+  const uint16_t first = queue.enqueue(&pulses, recordQueueSent);
+  const uint16_t second = queue.enqueue(&pulses, recordQueueSent);
+  EXPECT_NE(0, first);
+  EXPECT_NE(0, second);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(2, queue.getDepth());
+  EXPECT_EQ(0, queue.enqueue(&pulses));  // It's full.
+  EXPECT_EQ(1, queue.getStats().dropped);
+  EXPECT_EQ(0, queue_sent_count);
+  EXPECT_EQ("", irsend.outputStr());  // Queuing doesn't send anything.
+
+  // Everything up to the trailing gap of the first message is sent, then it
+  // returns rather than waiting out the gap.
+  EXPECT_TRUE(queue.loop());
+  EXPECT_EQ(expected, irsend.outputStr());
+  EXPECT_EQ(0, queue_sent_count);
+  EXPECT_TRUE(queue.loop());  // Still waiting.
+  EXPECT_EQ("", irsend.outputStr());
+  EXPECT_EQ(2, queue.getDepth());
+
+  // Once the gap has passed, the first message is done & the second starts.
+  IRtimer::add(gap);
+  EXPECT_TRUE(queue.loop());
+  ASSERT_EQ(1, queue_sent_count);
+  EXPECT_EQ(first, queue_sent_ids[0]);
+  EXPECT_EQ(1, queue.getDepth());
+  EXPECT_NE("", irsend.outputStr());
+  IRtimer::add(gap);
+  EXPECT_FALSE(queue.loop());
+  ASSERT_EQ(2, queue_sent_count);
+  EXPECT_EQ(second, queue_sent_ids[1]);
+  EXPECT_EQ(0, queue.getDepth());
+
+  send_queue_stats_t stats = queue.getStats();
+  EXPECT_EQ(2, stats.queued);
+  EXPECT_EQ(2, stats.sent);
+  EXPECT_EQ(1, stats.dropped);
+  EXPECT_EQ(2, stats.max_depth);
+  EXPECT_LE(kNecMinCommandLength, stats.max_latency);
+  EXPECT_LE(stats.max_latency, stats.total_latency);
+  queue.resetStats();
+  EXPECT_EQ(0, queue.getStats().sent);
+}
+
+// Rendering the next message while the queue waits out a gap mustn't cut the
+// gap short, or count towards how long the message took to send.
+TEST(TestSendQueue, RenderingDuringAWait) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  irsend.reset();
+  IRsendQueue queue(&irsend);
+  IRpulseBuffer pulses;
+  irsend.renderTo(&pulses);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  const uint32_t gap =
+      pulses.getEntry(pulses.getLength() - 1) & kPulseValueMask;
+  EXPECT_NE(0, queue.enqueue(&pulses));
+  EXPECT_TRUE(queue.loop());  // Sent up to the gap, & now waiting it out.
+
+  // Render something much longer than the gap, while waiting.
+  IRpulseBuffer next;
+  irsend.renderTo(&next);
+  irsend.sendJVC(0xC2B8, kJvcBits, 3);
+  irsend.renderTo(NULL);
+  EXPECT_LT(gap, next.getDuration());
+  EXPECT_TRUE(queue.loop());  // Still waiting.
+  EXPECT_EQ(1, queue.getDepth());
+
+  IRtimer::add(gap - 1);
+  EXPECT_TRUE(queue.loop());  // Still waiting.
+  IRtimer::add(1);
+  EXPECT_FALSE(queue.loop());  // The whole gap has now passed.
+  EXPECT_EQ(0, queue.getDepth());
+  EXPECT_EQ(pulses.getDuration(), queue.getStats().max_latency);
+}
+
+TEST(TestSendQueue, RejectsWhatWontFit) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRsendQueue queue(&irsend, 1, kSendQueueYieldGap, 10);
+  EXPECT_EQ(10, queue.getBufferSize());
+  IRpulseBuffer pulses;
+  irsend.renderTo(&pulses);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  EXPECT_EQ(0, queue.enqueue(&pulses));  // Too big.
+  EXPECT_EQ(0, queue.enqueue(NULL));
+  EXPECT_EQ(2, queue.getStats().dropped);
+  EXPECT_EQ(0, queue.getDepth());
+
+  IRpulseBuffer small(2);
+  irsend.renderTo(&small);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  EXPECT_TRUE(small.hasOverflowed());
+  EXPECT_EQ(0, queue.enqueue(&small));  // Incomplete.
+
+  small.clear();
+  small.addMark(100);
+  EXPECT_NE(0, queue.enqueue(&small));
+  queue.clear();
+  EXPECT_EQ(0, queue.getDepth());
+  EXPECT_FALSE(queue.loop());
+}
+
+TEST(TestMultiSend, SharedCarrierIsSentSimultaneously) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRpulseBuffer nec;
+  IRpulseBuffer samsung;
+  irsend.renderTo(&nec);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(&samsung);
+  irsend.sendSAMSUNG(0xE0E09966, kSamsungBits, 1);
+  irsend.renderTo(NULL);
+  const uint32_t longest = std::max(nec.getDuration(), samsung.getDuration());
+
+  IRmultiSendTest multi;
+  EXPECT_TRUE(multi.add(4, &nec));
+  EXPECT_TRUE(multi.add(5, &samsung));
+  EXPECT_EQ(2, multi.getCount());
+  const uint32_t start = _IRtimer_unittest_now;
+  EXPECT_EQ(1, multi.send());
+  // About as long as the longest, rather than as long as both.
+  EXPECT_NEAR(longest, _IRtimer_unittest_now - start, 30);
+  // Roughly the nr. of 38kHz cycles the marks of each need.
+  EXPECT_NEAR(1045, multi.cycles[0], 10);  // ~27.5ms of marks.
+  EXPECT_NEAR(1745, multi.cycles[1], 20);  // ~45.9ms of marks.
+
+  ASSERT_TRUE(multi.decode(0, &irsend));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_EQ(0x20DF10EF, irsend.capture.value);
+  ASSERT_TRUE(multi.decode(1, &irsend));
+  EXPECT_EQ(SAMSUNG, irsend.capture.decode_type);
+  EXPECT_EQ(0xE0E09966, irsend.capture.value);
+}
+
+TEST(TestMultiSend, DifferentCarriersAreSentInTurn) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRpulseBuffer nec;
+  IRpulseBuffer sony;
+  irsend.renderTo(&nec);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(&sony);
+  irsend.sendSony(0x240, kSony12Bits);  // 40kHz
+  irsend.renderTo(NULL);
+
+  IRmultiSendTest multi;
+  multi.add(4, &nec);
+  multi.add(5, &sony);
+  multi.add(6, &nec);
+  const uint32_t start = _IRtimer_unittest_now;
+  EXPECT_EQ(2, multi.send());
+  EXPECT_NEAR(nec.getDuration() + sony.getDuration(),
+              _IRtimer_unittest_now - start, 60);
+  EXPECT_EQ(multi.cycles[0], multi.cycles[2]);
+  for (uint8_t i = 0; i < 3; i++) {
+    ASSERT_TRUE(multi.decode(i, &irsend));
+    EXPECT_EQ((i == 1) ? SONY : NEC, irsend.capture.decode_type);
+  }
+}
+
+TEST(TestMultiSend, UnmodulatedAndLimits) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  IRpulseBuffer nec;
+  irsend.renderTo(&nec);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+
+  IRmultiSendTest multi(false, false);
+  EXPECT_FALSE(multi.add(4, NULL));
+  IRpulseBuffer small(2);
+  irsend.renderTo(&small);
+  irsend.sendNEC(0x20DF10EF);
+  irsend.renderTo(NULL);
+  EXPECT_FALSE(multi.add(4, &small));  // Incomplete.
+  for (uint8_t i = 0; i < kMultiSendMax; i++) EXPECT_TRUE(multi.add(i, &nec));
+  EXPECT_FALSE(multi.add(kMultiSendMax, &nec));  // Full.
+  EXPECT_EQ(1, multi.send());
+  uint32_t marks = 0;
+  for (uint16_t i = 0; i < nec.getLength(); i++)
+    if ((nec.getEntry(i) & kPulseKindMask) == kPulseMark) marks++;
+  for (uint8_t i = 0; i < kMultiSendMax; i++) {
+    // Each mark is a single pulse, without a carrier.
+    EXPECT_EQ(marks, multi.cycles[i]);
+    ASSERT_TRUE(multi.decode(i, &irsend));
+    EXPECT_EQ(NEC, irsend.capture.decode_type);
+  }
+  multi.clear();
+  EXPECT_EQ(0, multi.getCount());
+  EXPECT_EQ(0, multi.send());
+}
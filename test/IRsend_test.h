@@ -8,6 +8,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRtimer.h"
@@ -102,6 +103,7 @@ class IRsendTest : public IRsend {
   void addGap(uint32_t usecs) { space(usecs); }
 
   uint16_t mark(uint16_t usec) {
+    if (_renderTarget() != NULL) return IRsend::mark(usec);
     IRtimer::add(usec);
     if (last >= OUTPUT_BUF) return 0;
     if (last & 1)  // Is odd? (i.e. last call was a space())
@@ -114,6 +116,7 @@ class IRsendTest : public IRsend {
   }
 
   void space(uint32_t time) {
+    if (_renderTarget() != NULL) return IRsend::space(time);
     IRtimer::add(time);
     if (last >= OUTPUT_BUF) return;
     if (last & 1) {  // Is odd? (i.e. last call was a space())
@@ -150,6 +153,82 @@ class IRsendLowLevelTest : public IRsend {
 
   void ledOn() { low_level_sequence += "[On]"; }
 };
+
+// Records the marks & spaces each GPIO of an IRmultiSend sent.
+class IRmultiSendTest : public IRmultiSend {
+ public:
+  uint32_t cycles[kMultiSendMax];  // Nr. of times each LED was turned on.
+  uint32_t elapsed;  // How long it has spent sending. (uSecs)
+
+  explicit IRmultiSendTest(bool i = false, bool j = true)
+      : IRmultiSend(i, j) {
+    reset();
+  }
+
+  void reset() {
+    elapsed = 0;
+    for (uint8_t i = 0; i < kMultiSendMax; i++) {
+      cycles[i] = 0;
+      _raw[i].clear();
+      _lit[i] = false;
+      _started[i] = false;
+    }
+  }
+
+  // The marks & spaces a GPIO sent. i.e. With the carrier removed.
+  std::vector<uint16_t> getRaw(const uint8_t i) {
+    std::vector<uint16_t> raw = _raw[i];
+    if (_started[i]) raw.push_back(_off[i] - _mark[i]);  // The last mark.
+    return raw;
+  }
+
+  // Decode what a GPIO sent, via `irsend`'s capture buffer.
+  bool decode(const uint8_t i, IRsendTest *irsend) {
+    std::vector<uint16_t> raw = getRaw(i);
+    irsend->reset();
+    irsend->sendRaw(raw.data(), raw.size(), 38);
+    irsend->makeDecodeResult();
+    IRrecv irrecv(0);
+    return irrecv.decode(&irsend->capture);
+  }
+
+ protected:
+  void _delayMicroseconds(uint32_t usec) {
+    _IRtimer_unittest_now += usec;
+    elapsed += usec;
+  }
+
+  void _setPins(const uint16_t on) {
+    const uint32_t now = _IRtimer_unittest_now;
+    for (uint8_t i = 0; i < kMultiSendMax; i++) {
+      const bool lit = (on >> i) & 1;
+      if (lit == _lit[i]) continue;
+      _lit[i] = lit;
+      if (!lit) {
+        _off[i] = now;
+        continue;
+      }
+      cycles[i]++;
+      if (!_started[i]) {
+        _started[i] = true;
+        _mark[i] = now;
+      } else if (now - _off[i] > kCarrierGap) {  // A new mark.
+        _raw[i].push_back(_off[i] - _mark[i]);
+        _raw[i].push_back(now - _off[i]);
+        _mark[i] = now;
+      }
+    }
+  }
+
+ private:
+  // Longer than this with the LED off is a space, not part of the carrier.
+  static const uint32_t kCarrierGap = 100;
+  std::vector<uint16_t> _raw[kMultiSendMax];
+  bool _lit[kMultiSendMax];
+  bool _started[kMultiSendMax];
+  uint32_t _mark[kMultiSendMax];  // When the current mark started.
+  uint32_t _off[kMultiSendMax];  // When the LED was last turned off.
+};
 #endif  // UNIT_TEST
 
 #endif  // TEST_IRSEND_TEST_H_
@@ -2,10 +2,12 @@
 
 #include "IRutils.h"
 #include <stdint.h>
+#include <algorithm>
 #include "IRrecv.h"
 #include "IRrecv_test.h"
 #include "IRsend.h"
 #include "IRsend_test.h"
+#include "IRtext.h"
 #include "gtest/gtest.h"
 
 // Tests reverseBits().
@@ -39,6 +41,45 @@ TEST(ReverseBitsTest, LessBitsReversedThanInputHasSet) {
   EXPECT_EQ(0x12345678FFFF0000, reverseBits(0x123456780000FFFF, 32));
 }
 
+// Tests reverseBits against a bit at a time version, for every bit size.
+TEST(ReverseBitsTest, MatchesBitAtATime) {
+  const uint64_t values[] = {0, 1, 0xFFFFFFFFFFFFFFFFULL, 0x0123456789ABCDEFULL,
+                             0xFFFFAAAA0000AAAAULL, 0x8000000000000001ULL,
+                             0xF0E1D2C3B4A59687ULL};
+  for (uint8_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+    for (uint16_t nbits = 0; nbits <= 70; nbits++) {
+      uint64_t input = values[v];
+      uint64_t expected = 0;
+      const uint16_t bits = std::min(nbits, static_cast<uint16_t>(64));
+      for (uint16_t i = 0; i < bits; i++, input >>= 1)
+        expected = (expected << 1) | (input & 1);
+      if (bits < 64) expected |= input << bits;
+      if (nbits <= 1) expected = values[v];
+      ASSERT_EQ(expected, reverseBits(values[v], nbits)) << "nbits: " << nbits;
+    }
+  }
+}
+
+// Tests reversing the bits within each byte, but not the order of the bytes.
+TEST(ReverseBitsTest, ReverseBitsInBytes) {
+  EXPECT_EQ(0x0F80C4A2E6000000ULL,
+            irutils::reverseBitsInBytes(0xF0012345670000ULL << 8));
+  EXPECT_EQ(0x8040201008040201ULL,
+            irutils::reverseBitsInBytes(0x0102040810204080ULL));
+  uint8_t data[40];
+  uint8_t expected[sizeof(data)];
+  for (uint8_t align = 0; align < 8; align++) {
+    for (uint16_t len = 0; len + align <= sizeof(data); len++) {
+      for (uint16_t i = 0; i < sizeof(data); i++) data[i] = i * 37 + len;
+      memcpy(expected, data, sizeof(data));
+      for (uint16_t i = align; i < align + len; i++)
+        expected[i] = reverseBits(expected[i], 8);
+      EXPECT_EQ(data + align, irutils::reverseBitsInBytes(data + align, len));
+      ASSERT_EQ(0, memcmp(expected, data, sizeof(data)));
+    }
+  }
+}
+
 // Tests for uint64ToString()
 
 TEST(TestUint64ToString, TrivialCases) {
@@ -403,6 +444,51 @@ TEST(TestStrToDecodeType, strToDecodeType) {
   EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("foo"));
 }
 
+TEST(TestStrToDecodeType, CaseAndNumbers) {
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("nec"));
+  EXPECT_EQ(decode_type_t::MITSUBISHI_HEAVY_152,
+            strToDecodeType("Mitsubishi_Heavy_152"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType(""));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("NEC "));
+  // Protocol numbers.
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("3"));
+  EXPECT_EQ(decode_type_t::UNUSED, strToDecodeType("UNUSED"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("0"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("-1"));
+  EXPECT_EQ(decode_type_t::UNKNOWN,
+            strToDecodeType(uint64ToString(kLastDecodeType + 1).c_str()));
+  EXPECT_EQ(kLastDecodeType,
+            strToDecodeType(uint64ToString(kLastDecodeType).c_str()));
+}
+
+TEST(TestStrToDecodeType, HashTable) {
+  // Every protocol is in the hash table exactly once, in the right bucket,
+  // & the chains of protocols in each bucket are short.
+  uint16_t seen[kLastDecodeType + 1] = {0};
+  uint16_t longest = 0;
+  for (uint16_t bucket = 0; bucket < kProtocolNameHashSize; bucket++) {
+    uint16_t length = 0;
+    for (uint8_t i = kProtocolNameHeads[bucket]; i != kNoProtocolName;
+         i = kProtocolNameNext[i]) {
+      ASSERT_LE(i, kLastDecodeType);
+      EXPECT_EQ(bucket, kProtocolNameHashes[i] % kProtocolNameHashSize);
+      EXPECT_EQ(irutils::caseInsensitiveHash(
+          typeToString((decode_type_t)i).c_str()), kProtocolNameHashes[i]);
+      seen[i]++;
+      length++;
+    }
+    longest = std::max(longest, length);
+  }
+  for (uint16_t i = 0; i <= kLastDecodeType; i++)
+    EXPECT_EQ(1, seen[i]) << typeToString((decode_type_t)i);
+  EXPECT_GE(4, longest);
+  // Case insensitive.
+  EXPECT_EQ(irutils::caseInsensitiveHash("Daikin2"),
+            irutils::caseInsensitiveHash("DAIKIN2"));
+  EXPECT_NE(irutils::caseInsensitiveHash("DAIKIN2"),
+            irutils::caseInsensitiveHash("DAIKIN"));
+}
+
 TEST(TestUtils, htmlEscape) {
   EXPECT_EQ("", irutils::htmlEscape(""));
   EXPECT_EQ("No Changes", irutils::htmlEscape("No Changes"));
@@ -552,6 +638,116 @@ TEST(TestUtils, sumNibbles) {
   EXPECT_EQ(0x22, irutils::sumNibbles(0x88C0051, 255, 0, false));
 }
 
+// Byte/bit at a time reference versions of the word at a time checksum
+// helpers, to cross check them against.
+uint8_t refSumBytes(const uint8_t *ptr, const uint16_t length,
+                    const uint8_t init) {
+  uint8_t sum = init;
+  for (uint16_t i = 0; i < length; i++) sum += ptr[i];
+  return sum;
+}
+
+uint8_t refXorBytes(const uint8_t *ptr, const uint16_t length,
+                    const uint8_t init) {
+  uint8_t sum = init;
+  for (uint16_t i = 0; i < length; i++) sum ^= ptr[i];
+  return sum;
+}
+
+uint8_t refSumNibbles(const uint8_t *ptr, const uint16_t length,
+                      const uint8_t init, const bool low, const bool high) {
+  uint8_t sum = init;
+  for (uint16_t i = 0; i < length; i++) {
+    if (low) sum += ptr[i] & 0xF;
+    if (high) sum += ptr[i] >> 4;
+  }
+  return sum;
+}
+
+uint16_t refCountBits(const uint8_t *ptr, const uint16_t length,
+                      const bool ones, const uint16_t init) {
+  uint16_t count = init;
+  for (uint16_t i = 0; i < length; i++)
+    for (uint8_t bit = 0; bit < 8; bit++) count += (ptr[i] >> bit) & 1;
+  return (ones || length == 0) ? count : length * 8 - count;
+}
+
+TEST(TestUtils, ChecksumsMatchReferences) {
+  // Enough data to need more than one batch of words in the sums.
+  uint8_t data[600];
+  uint32_t seed = 12345;
+  for (uint16_t i = 0; i < sizeof(data); i++) {
+    seed = seed * 1103515245 + 12345;
+    data[i] = seed >> 16;
+  }
+  uint8_t ones[sizeof(data)];
+  memset(ones, 0xFF, sizeof(ones));
+  const uint8_t inits[] = {0, 1, 0x7F, 0xFF};
+  // Every length, at every alignment.
+  for (uint8_t align = 0; align < 8; align++) {
+    for (uint16_t len = 0; len + align <= sizeof(data); len++) {
+      const uint8_t *ptr = data + align;
+      for (uint8_t i = 0; i < sizeof(inits); i++) {
+        const uint8_t init = inits[i];
+        ASSERT_EQ(refSumBytes(ptr, len, init), sumBytes(ptr, len, init));
+        ASSERT_EQ(refXorBytes(ptr, len, init), xorBytes(ptr, len, init));
+        ASSERT_EQ(refSumNibbles(ptr, len, init, true, true),
+                  irutils::sumNibbles(ptr, len, init));
+        ASSERT_EQ(refSumNibbles(ptr, len, init, true, false),
+                  irutils::sumLowNibbles(ptr, len, init));
+        ASSERT_EQ(refSumNibbles(ptr, len, init, false, true),
+                  irutils::sumHighNibbles(ptr, len, init));
+        ASSERT_EQ(refCountBits(ptr, len, true, init),
+                  countBits(ptr, len, true, init));
+        ASSERT_EQ(refCountBits(ptr, len, false, init),
+                  countBits(ptr, len, false, init));
+      }
+      // The worst case for carries between the lanes of a word.
+      ASSERT_EQ(refSumBytes(ones, len, 0), sumBytes(ones, len));
+      ASSERT_EQ(refSumNibbles(ones, len, 0, true, true),
+                irutils::sumNibbles(ones, len));
+      ASSERT_EQ(refCountBits(ones, len, true, 0), countBits(ones, len));
+    }
+  }
+
+  // Integer variants. Every count, & more, of various values.
+  const uint64_t values[] = {0, 1, 0xFFFFFFFFFFFFFFFFULL,
+                             0x0123456789ABCDEFULL, 0x88C0051,
+                             0x8000000000000001ULL, 0xF0F0F0F00F0F0F0FULL};
+  for (uint8_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+    const uint64_t value = values[v];
+    for (uint16_t count = 0; count <= 255; count++) {
+      uint16_t bits = 3;
+      for (uint8_t i = 0; i < 64 && i < count; i++) bits += (value >> i) & 1;
+      ASSERT_EQ(bits, countBits(value, count, true, 3));
+      ASSERT_EQ(static_cast<uint16_t>(count ? count - bits : bits),
+                countBits(value, count, false, 3));
+    }
+    for (uint16_t count = 0; count <= 20; count++) {
+      uint8_t nibbles = 5;
+      uint16_t bytes = 5;
+      for (uint8_t i = 0; i < 16 && i < count; i++)
+        nibbles += (value >> (i * 4)) & 0xF;
+      for (uint8_t i = 0; i < 8 && i < count; i++)
+        bytes += (value >> (i * 8)) & 0xFF;
+      ASSERT_EQ(nibbles, irutils::sumNibbles(value, count, 5, false));
+      ASSERT_EQ(nibbles & 0xF, irutils::sumNibbles(value, count, 5));
+      ASSERT_EQ(bytes, irutils::sumBytes(value, count, 5, false));
+      ASSERT_EQ(bytes & 0xFF, irutils::sumBytes(value, count, 5));
+    }
+  }
+}
+
+TEST(TestUtils, crc16) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  EXPECT_EQ(0x0000, irutils::crc16(check, 0));
+  EXPECT_EQ(0xBB3D, irutils::crc16(check, sizeof(check)));  // CRC-16/ARC
+  EXPECT_EQ(0x4B37,  // CRC-16/MODBUS
+            irutils::crc16(check, sizeof(check), 0xFFFF));
+  EXPECT_EQ(0x2189,  // CRC-16/KERMIT
+            irutils::crc16(check, sizeof(check), 0, 0x8408));
+}
+
 TEST(TestUtils, BCD) {
   EXPECT_EQ(0, irutils::uint8ToBcd(0));
   EXPECT_EQ(0, irutils::bcdToUint8(0));
@@ -778,6 +974,47 @@ TEST(TestUtils, InvertedBytePairs) {
   EXPECT_STATE_EQ(correct, wrong, 6 * 8);
 }
 
+TEST(TestUtils, InvertedBytePairsAtEveryAlignment) {
+  uint8_t data[40];
+  uint8_t expected[sizeof(data)];
+  for (uint8_t align = 0; align < 8; align++) {
+    for (uint16_t len = 0; len + align <= sizeof(data); len++) {
+      for (uint16_t i = 0; i < sizeof(data); i++) data[i] = i * 37 + len;
+      memcpy(expected, data, sizeof(data));
+      for (uint16_t i = align + 1; i < align + len; i += 2)
+        expected[i] = ~expected[i - 1];
+      EXPECT_EQ(data + align, irutils::invertBytePairs(data + align, len));
+      ASSERT_EQ(0, memcmp(expected, data, sizeof(data)));
+      ASSERT_TRUE(irutils::checkInvertedBytePairs(data + align, len));
+      // Break each pair in turn.
+      for (uint16_t i = 1; i < len; i++) {
+        data[align + i] ^= 0x10;
+        ASSERT_EQ(i % 2 == 0 && i == len - 1,
+                  irutils::checkInvertedBytePairs(data + align, len));
+        data[align + i] ^= 0x10;
+      }
+    }
+  }
+}
+
+TEST(TestUtils, InvertedBytePairsInIntegers) {
+  EXPECT_EQ(0xB24DF00FULL, irutils::invertBytePairs(0xB200F000ULL, 32));
+  EXPECT_EQ(0xB200F00FULL, irutils::invertBytePairs(0xB200F000ULL, 16));
+  EXPECT_EQ(0xB200F00FULL, irutils::invertBytePairs(0xB200F000ULL, 31));
+  EXPECT_EQ(0xB200F000ULL, irutils::invertBytePairs(0xB200F000ULL, 15));
+  EXPECT_EQ(0x12ED34CB56A97887ULL,
+            irutils::invertBytePairs(0x1200340056007800ULL, 64));
+  EXPECT_EQ(0x12ED34CB56A97887ULL,
+            irutils::invertBytePairs(0x1200340056007800ULL, 100));
+  EXPECT_TRUE(irutils::checkInvertedBytePairs(0xB24DF00FULL, 32));
+  EXPECT_TRUE(irutils::checkInvertedBytePairs(0x12ED34CB56A97887ULL, 64));
+  EXPECT_TRUE(irutils::checkInvertedBytePairs(0x12ED34CB56A978FFULL, 15));
+  EXPECT_FALSE(irutils::checkInvertedBytePairs(0x12ED34CB56A978FFULL, 16));
+  EXPECT_FALSE(irutils::checkInvertedBytePairs(0x13ED34CB56A97887ULL, 64));
+  EXPECT_TRUE(irutils::checkInvertedBytePairs(0x13ED34CB56A97887ULL, 48));
+  EXPECT_TRUE(irutils::checkInvertedBytePairs(0x1234ULL, 0));
+}
+
 TEST(TestUtils, lowLevelSanityCheck) {
   ASSERT_EQ(0, irutils::lowLevelSanityCheck());
 }
@@ -795,3 +1032,123 @@ TEST(TestUtils, VersionDefines) {
                          _IRREMOTEESP8266_VERSION_PATCH;
   ASSERT_EQ(_IRREMOTEESP8266_VERSION, version_int);
 }
+
+TEST(TestIRtextWriter, FixedBuffer) {
+  char buffer[16];
+  IRtextWriter out(buffer, sizeof(buffer));
+  EXPECT_STREQ("", buffer);
+  out += "Temp";
+  out += ':';
+  out += ' ';
+  out.writeUint64(25);
+  out += String("C");
+  EXPECT_STREQ("Temp: 25C", buffer);
+  EXPECT_EQ(9, out.getLength());
+  EXPECT_FALSE(out.hasOverflowed());
+  // Fill it right up.
+  out += "123456";
+  EXPECT_STREQ("Temp: 25C123456", buffer);
+  EXPECT_FALSE(out.hasOverflowed());
+  // Too much. It should be truncated, but still be NUL terminated.
+  out += "789";
+  EXPECT_STREQ("Temp: 25C123456", buffer);
+  EXPECT_TRUE(out.hasOverflowed());
+  // The length keeps counting, so the caller knows how big it needed to be.
+  EXPECT_EQ(18, out.getLength());
+}
+
+TEST(TestIRtextWriter, Numbers) {
+  char buffer[80];
+  IRtextWriter out(buffer, sizeof(buffer));
+  out.writeUint64(0);
+  out += ',';
+  out.writeUint64(0xDEADBEEF, 16);
+  out += ',';
+  out.writeUint64(0xA, 16, 4, '0');
+  out += ',';
+  out.writeUint64(5, 2, 8, '0');
+  out += ',';
+  out.writeUint64(UINT64_MAX);
+  out += ',';
+  out.writeInt64(-123);
+  out += ',';
+  out.writeUint64(12, 1);  // Invalid base.
+  EXPECT_STREQ(
+      "0,DEADBEEF,000A,00000101,18446744073709551615,-123,12", buffer);
+  // Same as the String versions?
+  EXPECT_EQ(uint64ToString(UINT64_MAX, 16), String("FFFFFFFFFFFFFFFF"));
+  EXPECT_EQ(int64ToString(-42, 16), String("-2A"));
+}
+
+TEST(TestIRtextWriter, Sinks) {
+  // String sink.
+  String text = "Hello";
+  IRtextWriter to_string(&text);
+  to_string += ", World";
+  EXPECT_EQ("Hello, World", text);
+  EXPECT_EQ(7, to_string.getLength());
+  // Stream sink.
+  FILE *stream = tmpfile();
+  ASSERT_NE(nullptr, stream);
+  IRtextWriter to_stream(stream);
+  irutils::addBoolToString(&to_stream, true, kPowerStr, false);
+  irutils::addTempToString(&to_stream, 21);
+  char buffer[40] = {0};
+  rewind(stream);
+  ASSERT_NE(nullptr, fgets(buffer, sizeof(buffer), stream));
+  fclose(stream);
+  EXPECT_STREQ("Power: On, Temp: 21C", buffer);
+  // A writer with nowhere to write, still counts.
+  IRtextWriter nowhere(NULL, 0);
+  nowhere += "abc";
+  EXPECT_EQ(3, nowhere.getLength());
+  EXPECT_FALSE(nowhere.hasOverflowed());
+}
+
+TEST(TestIRtextWriter, MatchesStringVersions) {
+  char buffer[2048];
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    irutils::minsToString(&out, 23 * 60 + 59);
+    EXPECT_EQ(irutils::minsToString(23 * 60 + 59), String(buffer));
+  }
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    irutils::addSignedIntToString(&out, -17, kTempStr);
+    EXPECT_EQ(irutils::addSignedIntToString(-17, kTempStr), String(buffer));
+  }
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    typeToString(&out, decode_type_t::NEC, true);
+    EXPECT_EQ(typeToString(decode_type_t::NEC, true), String(buffer));
+  }
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x807F40BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    resultToHumanReadableBasic(&out, &irsend.capture);
+    EXPECT_EQ(resultToHumanReadableBasic(&irsend.capture), String(buffer));
+  }
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    resultToHexidecimal(&out, &irsend.capture);
+    EXPECT_EQ(resultToHexidecimal(&irsend.capture), String(buffer));
+  }
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    resultToTimingInfo(&out, &irsend.capture);
+    EXPECT_FALSE(out.hasOverflowed());
+    EXPECT_EQ(resultToTimingInfo(&irsend.capture), String(buffer));
+  }
+  {
+    IRtextWriter out(buffer, sizeof(buffer));
+    resultToSourceCode(&out, &irsend.capture);
+    EXPECT_FALSE(out.hasOverflowed());
+    EXPECT_EQ(resultToSourceCode(&irsend.capture), String(buffer));
+  }
+}
@@ -0,0 +1,392 @@
+// Quick and dirty tool to decode a large corpus of captured messages, using
+// every cpu core available.
+// Copyright 2026 David Conran
+//
+// The corpus file is memory-mapped & may contain any mix of:
+//   mode2 data from LIRC (e.g. "pulse 915" / "space 793" lines), with messages
+//     separated by a long space,
+//   GlobalCache codes (e.g. "sendir,1:1,1,38000,1,1,..." or "38000,1,1,..."),
+//   ProntoHex codes (e.g. "0000 006C 0022 0002 ..."),
+//   Raw arrays (e.g. "uint16_t rawData[71] = {9024, 4512, ...};" or
+//     "9024, 4512, ...") as produced by IRrecvDumpV2 etc.
+// One code per line. Blank lines & lines starting with '#' are ignored.
+// Bare lists of numbers are taken to be raw arrays, unless "--format gc" is
+// given.
+//
+// The messages are parsed first, then decoded by a pool of worker threads.
+// Each worker has its own IRrecv, and steals work from the others when it runs
+// out. The result for each message is written to stdout, in corpus order, as:
+//   <line nr.> <protocol> <bits> <hex value>
+// Throughput statistics are written to stderr.
+//
+// e.g. ./batch_decode --threads 8 captures.txt > results.txt
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include <deque>
+#include <iostream>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+const uint16_t kMaxCodeLength = OUTPUT_BUF / 2;  // Max nr. of values in a code.
+const uint32_t kMode2Gap = 20000;  // uSecs. A space this long ends a message.
+const uint16_t kRawFreq = 38;  // kHz. Frequency to assume for raw arrays.
+const uint16_t kChunkSize = 64;  // Nr. of messages a worker takes at a time.
+
+// The formats a code in the corpus can be in.
+typedef enum {
+  kFormatAuto = 0,  // Work it out from each line.
+  kFormatMode2,
+  kFormatGc,
+  kFormatPronto,
+  kFormatRaw,
+} corpus_format_t;
+
+// A captured message, ready to be decoded.
+typedef struct {
+  uint32_t line;  // The line in the corpus the message started on.
+  std::vector<uint16_t> rawbuf;  // The capture buffer.
+} frame_t;
+
+// The result of decoding a message.
+typedef struct {
+  decode_type_t type;  // The protocol it was decoded as.
+  uint16_t bits;       // The nr. of bits decoded.
+  std::string value;   // The decoded value/state in hexadecimal.
+} frame_result_t;
+
+// What a worker thread got up to.
+typedef struct {
+  uint32_t frames;  // Nr. of messages it decoded.
+  uint32_t steals;  // Nr. of chunks it took from other workers.
+} worker_stats_t;
+
+// A worker's share of the messages, as chunks of consecutive messages.
+// The owner takes chunks from the front, & anyone else steals from the back.
+class WorkQueue {
+ public:
+  void push(const uint32_t chunk) {
+    std::lock_guard<std::mutex> guard(_lock);
+    _chunks.push_back(chunk);
+  }
+  bool take(uint32_t *chunk) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_chunks.empty()) return false;
+    *chunk = _chunks.front();
+    _chunks.pop_front();
+    return true;
+  }
+  bool steal(uint32_t *chunk) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_chunks.empty()) return false;
+    *chunk = _chunks.back();
+    _chunks.pop_back();
+    return true;
+  }
+
+ private:
+  std::mutex _lock;
+  std::deque<uint32_t> _chunks;  // Indexes of the first message in each chunk.
+};
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--threads <nr>] "
+            << "[--format auto|mode2|gc|pronto|raw] <corpus_file>"
+            << std::endl;
+}
+
+// Convert all the numbers in some text into an array.
+// Anything that isn't a digit (of the given base) separates the numbers.
+// Returns the nr. of numbers found.
+uint16_t parseNumbers(const char *start, const char *end, const uint8_t base,
+                      uint16_t *values) {
+  uint16_t count = 0;
+  uint32_t value = 0;
+  bool in_number = false;
+  for (const char *ptr = start; ptr <= end && count < kMaxCodeLength; ptr++) {
+    int8_t digit = -1;  // i.e. Not a digit.
+    if (ptr < end && isdigit(*ptr))
+      digit = *ptr - '0';
+    else if (ptr < end && base == 16 && isxdigit(*ptr))
+      digit = tolower(*ptr) - 'a' + 10;
+    if (digit >= 0) {
+      value = std::min(value * base + digit, (uint32_t)UINT16_MAX);
+      in_number = true;
+    } else if (in_number) {
+      values[count++] = value;
+      value = 0;
+      in_number = false;
+    }
+  }
+  return count;
+}
+
+// Does the text start with the given word?
+bool startsWith(const char *start, const char *end, const char *word) {
+  const size_t len = strlen(word);
+  return (size_t)(end - start) >= len && strncmp(start, word, len) == 0;
+}
+
+// Is the text made up solely of 4 digit hexadecimal words? i.e. ProntoHex.
+bool isPronto(const char *start, const char *end) {
+  uint16_t digits = 0;
+  uint16_t words = 0;
+  for (const char *ptr = start; ptr < end; ptr++) {
+    if (isxdigit(*ptr)) {
+      digits++;
+    } else if (*ptr == ' ' || *ptr == '\t') {
+      if (digits && digits != 4) return false;
+      if (digits) words++;
+      digits = 0;
+    } else {
+      return false;
+    }
+  }
+  if (digits && digits != 4) return false;
+  return words + (digits ? 1 : 0) >= 4;
+}
+
+// Add the message sent via `irsend` to the frames, if there is one.
+// It is the same as `makeDecodeResult()` & `reset()`, but only touches the
+// part of the buffers in use, which makes parsing many times faster.
+void addFrame(IRsendTest *irsend, const uint32_t line,
+              std::vector<frame_t> *frames) {
+  if (irsend->last == 0 && irsend->output[0] == 0) return;  // Nothing sent.
+  frame_t frame;
+  frame.line = line;
+  frame.rawbuf.resize(irsend->last + 2);
+  frame.rawbuf[0] = 0;  // The initial gap.
+  for (uint16_t i = 0; i <= irsend->last; i++)
+    frame.rawbuf[i + 1] = std::min(irsend->output[i] / kRawTick,
+                                   (uint32_t)UINT16_MAX);
+  frames->push_back(frame);
+  irsend->last = 0;
+  irsend->output[0] = 0;
+}
+
+// Convert the corpus into messages, ready to be decoded.
+std::vector<frame_t> parseCorpus(const char *data, const size_t size,
+                                 const corpus_format_t format) {
+  std::vector<frame_t> frames;
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  std::vector<uint16_t> values(kMaxCodeLength);
+  uint32_t line = 0;
+  uint32_t mode2_line = 0;  // Where the mode2 message being built started.
+  const char *end = data + size;
+  for (const char *start = data; start < end; ) {
+    const char *eol = static_cast<const char *>(memchr(start, '\n',
+                                                       end - start));
+    if (eol == NULL) eol = end;
+    const char *next = eol + 1;
+    line++;
+    // Trim any whitespace.
+    while (start < eol && isspace(*start)) start++;
+    while (eol > start && isspace(*(eol - 1))) eol--;
+
+    const bool mode2 = startsWith(start, eol, "pulse") ||
+                       startsWith(start, eol, "space");
+    if (!mode2 || (format != kFormatAuto && format != kFormatMode2))
+      addFrame(&irsend, mode2_line, &frames);  // Finish any mode2 message.
+    if (start == eol || *start == '#') {
+      start = next;
+      continue;
+    }
+    if (mode2 && (format == kFormatAuto || format == kFormatMode2)) {
+      parseNumbers(start, eol, 10, values.data());
+      const uint32_t duration = values[0];
+      if (*start == 'p') {
+        if (irsend.last == 0 && irsend.output[0] == 0) mode2_line = line;
+        if (irsend.last >= kMaxCodeLength)  // Too long, so split it.
+          addFrame(&irsend, mode2_line, &frames);
+        irsend.mark(duration);
+      } else if (duration >= kMode2Gap) {
+        addFrame(&irsend, mode2_line, &frames);  // Also skips leading gaps.
+      } else if (irsend.last || irsend.output[0]) {
+        irsend.space(duration);
+      }
+    } else if (format == kFormatPronto ||
+               (format == kFormatAuto && isPronto(start, eol))) {
+      const uint16_t count = parseNumbers(start, eol, 16, values.data());
+      irsend.sendPronto(values.data(), count);
+      addFrame(&irsend, line, &frames);
+    } else if (format == kFormatGc || startsWith(start, eol, "sendir")) {
+      if (startsWith(start, eol, "sendir"))  // Skip the module, port & id.
+        for (uint8_t field = 0; field < 3 && start < eol; start++)
+          if (*start == ',') field++;
+      const uint16_t count = parseNumbers(start, eol, 10, values.data());
+      irsend.sendGC(values.data(), count);
+      addFrame(&irsend, line, &frames);
+    } else if (format == kFormatAuto || format == kFormatRaw) {
+      // Only use what is between the braces, if there are any.
+      const char *open = static_cast<const char *>(memchr(start, '{',
+                                                          eol - start));
+      if (open != NULL) {
+        start = open + 1;
+        const char *close = static_cast<const char *>(memchr(start, '}',
+                                                             eol - start));
+        if (close != NULL) eol = close;
+      }
+      const uint16_t count = parseNumbers(start, eol, 10, values.data());
+      irsend.sendRaw(values.data(), count, kRawFreq);
+      addFrame(&irsend, line, &frames);
+    }
+    start = next;
+  }
+  addFrame(&irsend, mode2_line, &frames);  // Finish any mode2 message.
+  return frames;
+}
+
+// Decode messages until there are none left, in this worker's queue or anyone
+// else's.
+void decodeWorker(const uint16_t id, std::vector<WorkQueue> *queues,
+                  const std::vector<frame_t> *frames,
+                  std::vector<frame_result_t> *results,
+                  worker_stats_t *stats) {
+  IRrecv irrecv(kGpioUnused);
+  decode_results capture;
+  std::vector<uint16_t> rawbuf;
+  stats->frames = 0;
+  stats->steals = 0;
+  while (true) {
+    uint32_t chunk;
+    bool found = (*queues)[id].take(&chunk);
+    for (uint16_t i = 1; !found && i < queues->size(); i++) {
+      found = (*queues)[(id + i) % queues->size()].steal(&chunk);
+      if (found) stats->steals++;
+    }
+    if (!found) return;  // Nothing is ever added, so we're done.
+    const uint32_t last = std::min((uint32_t)frames->size(),
+                                   chunk + kChunkSize);
+    for (uint32_t i = chunk; i < last; i++) {
+      // A decoder may alter the capture, so use a copy.
+      rawbuf = (*frames)[i].rawbuf;
+      capture.rawbuf = rawbuf.data();
+      capture.rawlen = rawbuf.size();
+      capture.overflow = false;
+      frame_result_t *result = &(*results)[i];
+      if (irrecv.decode(&capture)) {
+        result->type = capture.decode_type;
+        result->bits = capture.bits;
+        result->value = resultToHexidecimal(&capture).c_str();
+      } else {
+        result->type = UNKNOWN;
+        result->bits = 0;
+        result->value = "-";
+      }
+      stats->frames++;
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  uint16_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+  corpus_format_t format = kFormatAuto;
+  int argv_offset = 1;
+  while (argv_offset < argc - 2) {
+    if (strncmp("--threads", argv[argv_offset], 10) == 0) {
+      threads = strtoul(argv[argv_offset + 1], NULL, 10);
+    } else if (strncmp("--format", argv[argv_offset], 9) == 0) {
+      const char *name = argv[argv_offset + 1];
+      if (strcmp(name, "auto") == 0) format = kFormatAuto;
+      else if (strcmp(name, "mode2") == 0) format = kFormatMode2;
+      else if (strcmp(name, "gc") == 0) format = kFormatGc;
+      else if (strcmp(name, "pronto") == 0) format = kFormatPronto;
+      else if (strcmp(name, "raw") == 0) format = kFormatRaw;
+      else
+        threads = 0;  // Force a usage error.
+    } else {
+      break;
+    }
+    argv_offset += 2;
+  }
+  if (argc - argv_offset != 1 || !threads) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  const int fd = open(argv[argv_offset], O_RDONLY);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) != 0) {
+    perror(argv[argv_offset]);
+    return 1;
+  }
+  const size_t size = info.st_size;
+  const char *data = "";
+  if (size) {
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      perror(argv[argv_offset]);
+      return 1;
+    }
+    data = static_cast<const char *>(mapping);
+  }
+
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  const std::vector<frame_t> frames = parseCorpus(data, size, format);
+  const std::chrono::steady_clock::time_point parsed =
+      std::chrono::steady_clock::now();
+  if (size) munmap(const_cast<char *>(data), size);
+  close(fd);
+
+  // Deal the chunks out to the workers, then let them get on with it.
+  std::vector<WorkQueue> queues(threads);
+  for (uint32_t i = 0; i < frames.size(); i += kChunkSize)
+    queues[(i / kChunkSize) % threads].push(i);
+  std::vector<frame_result_t> results(frames.size());
+  std::vector<worker_stats_t> stats(threads);
+  std::vector<std::thread> workers;
+  for (uint16_t id = 0; id < threads; id++)
+    workers.push_back(std::thread(decodeWorker, id, &queues, &frames,
+                                  &results, &stats[id]));
+  for (uint16_t id = 0; id < threads; id++) workers[id].join();
+  const std::chrono::steady_clock::time_point decoded =
+      std::chrono::steady_clock::now();
+
+  uint64_t pulses = 0;
+  uint32_t known = 0;
+  for (uint32_t i = 0; i < frames.size(); i++) {
+    pulses += frames[i].rawbuf.size() - 1;  // Entry 0 is the initial gap.
+    if (results[i].type != UNKNOWN) known++;
+    printf("%u %s %u %s\n", frames[i].line,
+           typeToString(results[i].type).c_str(), results[i].bits,
+           results[i].value.c_str());
+  }
+
+  const double parse_secs =
+      std::chrono::duration<double>(parsed - start).count();
+  const double decode_secs =
+      std::chrono::duration<double>(decoded - parsed).count();
+  uint32_t steals = 0;
+  for (uint16_t id = 0; id < threads; id++) steals += stats[id].steals;
+  fprintf(stderr, "Messages:           %" PRIu64 " (%u decoded)\n",
+          (uint64_t)frames.size(), known);
+  fprintf(stderr, "Pulses:             %" PRIu64 "\n", pulses);
+  fprintf(stderr, "Threads:            %u (%u chunks stolen)\n", threads,
+          steals);
+  fprintf(stderr, "Parse time:         %.3f secs\n", parse_secs);
+  fprintf(stderr, "Decode time:        %.3f secs\n", decode_secs);
+  if (decode_secs > 0) {
+    fprintf(stderr, "Messages per sec:   %.1f\n", frames.size() / decode_secs);
+    fprintf(stderr, "Pulses per sec:     %.1f\n", pulses / decode_secs);
+  }
+  return 0;
+}
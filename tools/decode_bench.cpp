@@ -0,0 +1,116 @@
+// Quick and dirty tool to measure how fast IRrecv::decode() matches pulses.
+// Copyright 2026 David Conran
+//
+// It builds a corpus of one representative message for every protocol we can
+// send, then repeatedly decodes the entire corpus & reports the time taken per
+// message & per pulse (mark or space) in the corpus.
+// When built with ENABLE_DECODE_PROFILING, it also reports where the time went
+// on a per-protocol basis.
+// e.g. make clean && CPPFLAGS=-DENABLE_DECODE_PROFILING=true make decode_bench
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// A captured message, ready to be decoded.
+typedef struct {
+  decode_type_t type;  // The protocol that was sent.
+  std::vector<uint16_t> rawbuf;  // The capture buffer.
+} capture_t;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--iterations <nr>]" << std::endl;
+}
+
+// Build a corpus of one representative message for each protocol we can send.
+std::vector<capture_t> buildCorpus(void) {
+  std::vector<capture_t> corpus;
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    const decode_type_t type = (decode_type_t)i;
+    const uint16_t nbits = IRsend::defaultBits(type);
+    if (!nbits) continue;  // Not something we can send.
+    irsend.reset();
+    bool sent;
+    if (hasACState(type)) {
+      uint8_t state[kStateSizeMax];
+      // An arbitrary, but varied, pattern of bits.
+      for (uint16_t j = 0; j < kStateSizeMax; j++) state[j] = 0xA5 ^ (j * 0x1D);
+      sent = irsend.send(type, state, nbits / 8);
+    } else {
+      const uint64_t value = 0xA5A5A5A5A5A5A5A5ULL;
+      sent = irsend.send(type, value & ((nbits >= 64) ? UINT64_MAX :
+                                        ((1ULL << nbits) - 1)), nbits);
+    }
+    if (!sent) continue;
+    irsend.makeDecodeResult();
+    capture_t capture;
+    capture.type = type;
+    capture.rawbuf.assign(irsend.capture.rawbuf,
+                          irsend.capture.rawbuf + irsend.capture.rawlen);
+    corpus.push_back(capture);
+  }
+  return corpus;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t iterations = 100;
+  if (argc == 3 && strncmp("--iterations", argv[1], 13) == 0) {
+    iterations = strtoul(argv[2], NULL, 10);
+  } else if (argc != 1) {
+    usage_error(argv[0]);
+    return 1;
+  }
+  if (!iterations) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  std::vector<capture_t> corpus = buildCorpus();
+  IRrecv irrecv(kGpioUnused);
+  decode_results results;
+  uint64_t pulses = 0;
+  uint16_t decoded = 0;
+  for (uint16_t i = 0; i < corpus.size(); i++) {
+    pulses += corpus[i].rawbuf.size() - 1;  // Entry 0 is the initial gap.
+    results.rawbuf = corpus[i].rawbuf.data();
+    results.rawlen = corpus[i].rawbuf.size();
+    results.overflow = false;
+    if (irrecv.decode(&results) && results.decode_type == corpus[i].type)
+      decoded++;
+  }
+
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < iterations; n++)
+    for (uint16_t i = 0; i < corpus.size(); i++) {
+      results.rawbuf = corpus[i].rawbuf.data();
+      results.rawlen = corpus[i].rawbuf.size();
+      results.overflow = false;
+      irrecv.decode(&results);
+    }
+  const double elapsed_ns = std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count();
+
+  printf("Messages:           %" PRIu64 " (%u decoded as the sent protocol)\n",
+         (uint64_t)corpus.size(), decoded);
+  printf("Pulses:             %" PRIu64 "\n", pulses);
+  printf("Iterations:         %u\n", iterations);
+  printf("ns per message:     %.1f\n",
+         elapsed_ns / iterations / corpus.size());
+  printf("ns per pulse:       %.2f\n", elapsed_ns / iterations / pulses);
+#if ENABLE_DECODE_PROFILING
+  std::cout << std::endl << irrecv.decodeProfileToString();
+#endif  // ENABLE_DECODE_PROFILING
+  return 0;
+}
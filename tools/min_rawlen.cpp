@@ -0,0 +1,138 @@
+// Quick and dirty tool to (re)generate `IRrecv::_minRawLen[]`.
+// Copyright 2026 David Conran
+//
+// For every protocol we can send, it sends a variety of messages (with a
+// repeat), then truncates the capture until each strict decoder in the
+// decode() table fails. The shortest capture each decoder still accepts is its
+// minimum length. Every point after a gap is also tried as a starting point,
+// so repeat codes & headerless repeats are accounted for.
+// Decoders that accept captures of varying lengths depending on the data
+// (e.g. Manchester encoded protocols), or that never accepted enough messages
+// to be sure, get a 0. i.e. Don't screen on length.
+//
+// The output is suitable for pasting into the table in IRrecv.cpp.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+const uint8_t kSamples = 8;  // Nr. of messages to try per protocol & size.
+const uint8_t kMinAccepted = 3;  // Nr. of messages needed to trust a length.
+const uint16_t kMinGap = 5000;  // uSecs. A space that long may start a message.
+
+// Send a message for a protocol, with a repeat. Returns false if we can't.
+bool sendSample(IRsendTest *irsend, const decode_type_t type,
+                const uint16_t nbits, const uint8_t sample) {
+  irsend->reset();
+  if (hasACState(type)) {
+    if (nbits % 8 || nbits / 8 > kStateSizeMax) return false;
+    uint8_t state[kStateSizeMax];
+    for (uint16_t i = 0; i < kStateSizeMax; i++)
+      state[i] = (sample == 0) ? 0 : (sample == 1) ? 0xFF : rand();
+    if (!irsend->send(type, state, nbits / 8)) return false;
+    irsend->send(type, state, nbits / 8);
+  } else {
+    uint64_t value = (sample == 0) ? 0 : (sample == 1) ? UINT64_MAX :
+        ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ rand();
+    if (nbits < 64) value &= (1ULL << nbits) - 1;
+    if (!irsend->send(type, value, nbits, IRsend::minRepeats(type) + 1))
+      return false;
+  }
+  irsend->makeDecodeResult();
+  return true;
+}
+
+// The shortest part of a capture a decoder accepts, or UINT16_MAX if none.
+uint16_t shortestAccepted(IRrecv *irrecv,
+                          const IRrecv::decoder_entry_t *entry,
+                          const std::vector<uint16_t> &capture) {
+  uint16_t shortest = UINT16_MAX;
+  for (uint16_t start = kStartOffset; start < capture.size(); start += 2) {
+    if (start > kStartOffset && capture[start - 1] * kRawTick < kMinGap)
+      continue;  // Not the start of a message.
+    std::vector<uint16_t> part;
+    part.push_back(capture[0]);
+    part.insert(part.end(), capture.begin() + start, capture.end());
+    for (uint16_t len = part.size(); len > 0; len--) {
+      std::vector<uint16_t> buf(part);  // In case the decoder changes it.
+      decode_results results;
+      results.rawbuf = buf.data();
+      results.rawlen = len;
+      results.overflow = false;
+      // Not strict, so checksums etc. don't matter. We only want the length.
+      if ((irrecv->*entry->decoder)(&results, kStartOffset, entry->nbits,
+                                    false))
+        shortest = std::min(shortest, len);
+      else if (len == part.size())
+        break;  // It doesn't match this at all.
+    }
+  }
+  return shortest;
+}
+
+int main(void) {
+  IRrecv irrecv(kGpioUnused);
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  srand(1);
+  std::vector<IRrecv::decoder_entry_t> entries(IRrecv::_nrDecoders);
+  for (uint16_t i = 0; i < entries.size(); i++)
+    memcpy(&entries[i], &IRrecv::_decoders[i], sizeof(entries[i]));
+  std::vector<uint16_t> shortest(entries.size(), UINT16_MAX);
+  std::vector<uint16_t> accepted(entries.size(), 0);
+  std::vector<bool> varies(entries.size(), false);
+
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    const decode_type_t type = (decode_type_t)i;
+    std::set<uint16_t> sizes;
+    if (IRsend::defaultBits(type)) sizes.insert(IRsend::defaultBits(type));
+    for (uint16_t e = 0; e < entries.size(); e++)
+      if (entries[e].type == type && entries[e].nbits)
+        sizes.insert(entries[e].nbits);
+    for (std::set<uint16_t>::iterator nbits = sizes.begin();
+         nbits != sizes.end(); nbits++) {
+      std::map<uint16_t, std::set<uint16_t> > lengths;  // Per entry.
+      for (uint8_t sample = 0; sample < kSamples; sample++) {
+        if (!sendSample(&irsend, type, *nbits, sample)) continue;
+        std::vector<uint16_t> capture(
+            irsend.capture.rawbuf,
+            irsend.capture.rawbuf + irsend.capture.rawlen);
+        for (uint16_t e = 0; e < entries.size(); e++) {
+          const uint16_t len = shortestAccepted(&irrecv, &entries[e], capture);
+          if (len == UINT16_MAX) continue;
+          lengths[e].insert(len);
+          accepted[e]++;
+          shortest[e] = std::min(shortest[e], len);
+        }
+      }
+      for (std::map<uint16_t, std::set<uint16_t> >::iterator it =
+               lengths.begin(); it != lengths.end(); it++)
+        if (it->second.size() > 1) varies[it->first] = true;
+    }
+  }
+
+  // Only strict decodes are screened, so only they count.
+  std::vector<int32_t> table(kLastDecodeType + 1, -1);
+  for (uint16_t e = 0; e < entries.size(); e++) {
+    if (!entries[e].strict) continue;
+    int32_t len = 0;
+    if (!varies[e] && accepted[e] >= kMinAccepted) len = shortest[e];
+    const decode_type_t type = entries[e].type;
+    table[type] = (table[type] < 0) ? len : std::min(table[type], len);
+  }
+  for (int i = 0; i <= kLastDecodeType; i++) {
+    const int32_t len = std::max(table[i], 0);
+    // The protocol names are the same as their `decode_type_t` names.
+    printf("    {%s, %d},\n", typeToString((decode_type_t)i).c_str(), len);
+  }
+  return 0;
+}
@@ -0,0 +1,292 @@
+// Quick and dirty tool to analyse how faithfully IRsend times what it sends.
+// Copyright 2026 David Conran
+//
+// It sends a representative message for every protocol (or just one) through
+// the real `IRsend::mark()` & `IRsend::space()`, against a simulated CPU clock.
+// Every LED change & delay costs a (configurable) nr. of CPU cycles, as they
+// would on a real device. It then reports, per protocol:
+//   - The nr. of carrier cycles sent vs. what the nominal frequency needs.
+//   - The effective carrier frequency & duty cycle.
+//   - The worst error in the length of a mark.
+//   - How far the message drifted from its nominal timing. (Worst & at the end)
+// With `--fractional` it uses the fractional carrier generator instead.
+// See: `IRsend::setFractionalCarrier()`
+//
+// e.g. Compare the two generators for a 57.6kHz protocol, mark by mark:
+//   ./send_timing --protocol DISH --marks
+//   ./send_timing --protocol DISH --marks --fractional
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRtimer.h"
+#include "IRutils.h"
+
+// The magnitude of a (signed) time.
+int64_t abs64(const int64_t x) { return (x < 0) ? -x : x; }
+
+// The timing of a single mark.
+typedef struct {
+  uint16_t nominal;   // The requested length. (uSecs)
+  uint32_t freq;      // The requested carrier frequency. (Hz)
+  uint64_t actual;    // The length it took. (nSecs)
+  uint64_t on;        // How long the LED was on for. (nSecs)
+  uint16_t cycles;    // Nr. of carrier cycles sent.
+  int64_t drift;      // How far ahead (+) of nominal it ended. (nSecs)
+} mark_timing_t;
+
+// An IRsend that runs against a simulated CPU clock & records what it does.
+class IRsendTiming : public IRsend {
+ public:
+  std::vector<mark_timing_t> marks;
+  int64_t max_drift;  // Largest drift seen at the end of a mark or space.
+
+  IRsendTiming(const uint32_t mhz, const uint32_t overhead)
+      : IRsend(kGpioUnused), _mhz(mhz), _overhead(overhead) { reset(); }
+
+  void reset(void) {
+    marks.clear();
+    max_drift = 0;
+    _start = _now();
+    _nominal = 0;
+    _led = false;
+    _pulses = 0;
+    _on = 0;
+  }
+
+  uint16_t mark(uint16_t usec) {
+    const uint64_t start = _now();
+    const uint32_t pulses = _pulses;
+    const uint64_t on = _on;
+    IRsend::mark(usec);
+    _nominal += usec;
+    mark_timing_t timing;
+    timing.nominal = usec;
+    timing.freq = _freq_unittest;
+    timing.actual = _now() - start;
+    timing.on = _on - on;
+    timing.cycles = _pulses - pulses;
+    timing.drift = _drift();
+    marks.push_back(timing);
+    max_drift = std::max(max_drift, abs64(timing.drift));
+    return timing.cycles;
+  }
+
+  void space(uint32_t usec) {
+    IRsend::space(usec);
+    _nominal += usec;
+    max_drift = std::max(max_drift, abs64(_drift()));
+  }
+
+ protected:
+  void _delayMicroseconds(uint32_t usec) {
+    _tick(_overhead + static_cast<uint64_t>(usec) * _mhz);
+  }
+
+  void ledOn(void) {
+    _tick(_overhead);
+    if (_led) return;
+    _led = true;
+    _on_since = _now();
+    _pulses++;
+  }
+
+  void ledOff(void) {
+    _tick(_overhead);
+    if (!_led) return;
+    _led = false;
+    _on += _now() - _on_since;
+  }
+
+ private:
+  static uint64_t _cycles;  // The simulated CPU clock. Shared like IRtimer's.
+  uint32_t _mhz;            // CPU clock speed.
+  uint32_t _overhead;       // CPU cycles each LED change or delay costs.
+  uint64_t _start;          // When the message started. (nSecs)
+  uint64_t _nominal;        // Nominal length of what we've sent. (uSecs)
+  bool _led;                // Is the LED on?
+  uint64_t _on_since;       // When the LED was turned on. (nSecs)
+  uint32_t _pulses;         // Nr. of times the LED was turned on.
+  uint64_t _on;             // Total time the LED has been on. (nSecs)
+
+  uint64_t _now(void) const { return _cycles * 1000 / _mhz; }
+  int64_t _drift(void) const {
+    return static_cast<int64_t>(_now() - _start) -
+        static_cast<int64_t>(_nominal * 1000);
+  }
+  // Advance the CPU clock, & the uSec clock IRsend uses with it.
+  void _tick(const uint64_t cycles) {
+    const uint64_t before = _cycles / _mhz;
+    _cycles += cycles;
+    IRtimer::add(_cycles / _mhz - before);
+  }
+};
+
+uint64_t IRsendTiming::_cycles = 0;
+
+// A summary of the timing of every mark in a message.
+typedef struct {
+  uint32_t freq;          // Nominal carrier frequency of the first mark. (Hz)
+  uint32_t marks;         // Nr. of marks.
+  uint64_t cycles;        // Nr. of carrier cycles sent.
+  double expected;        // Nr. of carrier cycles the nominal frequency needs.
+  double eff_freq;        // Effective carrier frequency. (Hz)
+  double duty;            // Effective duty cycle. (Percentage)
+  int64_t max_mark_err;   // Worst error in the length of a mark. (nSecs)
+  double max_cycle_err;   // Worst error in the nr. of cycles in a mark.
+  int64_t max_drift;      // Worst drift from the nominal timing. (nSecs)
+  int64_t final_drift;    // Drift at the end of the message. (nSecs)
+} timing_summary_t;
+
+timing_summary_t summarise(const IRsendTiming &irsend) {
+  timing_summary_t summary = {0, 0, 0, 0, 0, 0, 0, 0, irsend.max_drift, 0};
+  uint64_t on = 0;
+  uint64_t modulated = 0;  // Total length of the marks with a carrier.
+  for (uint16_t i = 0; i < irsend.marks.size(); i++) {
+    const mark_timing_t &mark = irsend.marks[i];
+    if (!summary.freq) summary.freq = mark.freq;
+    summary.marks++;
+    summary.cycles += mark.cycles;
+    on += mark.on;
+    modulated += mark.actual;
+    const double expected = mark.nominal * (mark.freq / 1e6);
+    summary.expected += expected;
+    const int64_t err = static_cast<int64_t>(mark.actual) -
+        static_cast<int64_t>(mark.nominal) * 1000;
+    if (abs64(err) > abs64(summary.max_mark_err)) summary.max_mark_err = err;
+    const double cycle_err = mark.cycles - expected;
+    if (std::abs(cycle_err) > std::abs(summary.max_cycle_err))
+      summary.max_cycle_err = cycle_err;
+    summary.final_drift = mark.drift;
+  }
+  if (modulated) {
+    summary.eff_freq = summary.cycles * 1e9 / modulated;
+    summary.duty = on * 100.0 / modulated;
+  }
+  return summary;
+}
+
+// Send a representative message for a protocol. Returns false if we can't.
+bool sendSample(IRsendTiming *irsend, const decode_type_t type) {
+  const uint16_t nbits = IRsend::defaultBits(type);
+  if (!nbits) return false;  // Not something we can send.
+  irsend->reset();
+  if (hasACState(type)) {
+    uint8_t state[kStateSizeMax];
+    // An arbitrary, but varied, pattern of bits.
+    for (uint16_t i = 0; i < kStateSizeMax; i++) state[i] = 0xA5 ^ (i * 0x1D);
+    return irsend->send(type, state, nbits / 8);
+  }
+  const uint64_t value = 0xA5A5A5A5A5A5A5A5ULL;
+  return irsend->send(type, value & ((nbits >= 64) ? UINT64_MAX :
+                                     ((1ULL << nbits) - 1)), nbits);
+}
+
+void printMarks(const IRsendTiming &irsend) {
+  printf("%5s %7s %7s %11s %7s %9s %7s %11s\n", "Mark", "Freq", "Nominal",
+         "Actual", "Cycles", "Expected", "Duty%", "Drift ns");
+  for (uint16_t i = 0; i < irsend.marks.size(); i++) {
+    const mark_timing_t &mark = irsend.marks[i];
+    printf("%5u %7u %7u %11.3f %7u %9.2f %7.1f %11" PRId64 "\n", i, mark.freq,
+           mark.nominal, mark.actual / 1000.0, mark.cycles,
+           mark.nominal * (mark.freq / 1e6),
+           mark.actual ? mark.on * 100.0 / mark.actual : 0.0, mark.drift);
+  }
+}
+
+void printSummaryHeader(const bool json) {
+  if (json) {
+    printf("[");
+    return;
+  }
+  printf("%-26s %6s %6s %8s %9s %9s %6s %9s %8s %10s %10s\n", "Protocol",
+         "Freq", "Marks", "Cycles", "Expected", "Eff. Hz", "Duty%",
+         "MaxMkErr", "MaxCyErr", "MaxDrift", "EndDrift");
+}
+
+void printSummary(const decode_type_t type, const timing_summary_t &s,
+                  const bool json, const bool first) {
+  if (json) {
+    printf("%s\n  {\"protocol\": \"%s\", \"freq\": %u, \"marks\": %u, "
+           "\"cycles\": %" PRIu64 ", \"expected_cycles\": %.2f, "
+           "\"effective_freq\": %.1f, \"duty\": %.2f, "
+           "\"max_mark_error_ns\": %" PRId64 ", \"max_cycle_error\": %.2f, "
+           "\"max_drift_ns\": %" PRId64 ", \"final_drift_ns\": %" PRId64 "}",
+           first ? "" : ",", typeToString(type).c_str(), s.freq, s.marks,
+           s.cycles, s.expected, s.eff_freq, s.duty, s.max_mark_err,
+           s.max_cycle_err, s.max_drift, s.final_drift);
+    return;
+  }
+  printf("%-26s %6u %6u %8" PRIu64 " %9.1f %9.1f %6.1f %9.3f %8.2f %10.3f "
+         "%10.3f\n", typeToString(type).c_str(), s.freq, s.marks, s.cycles,
+         s.expected, s.eff_freq, s.duty, s.max_mark_err / 1000.0,
+         s.max_cycle_err, s.max_drift / 1000.0, s.final_drift / 1000.0);
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--fractional] [--json] "
+            << "[--mhz <cpu_mhz>] [--overhead <cycles>] "
+            << "[--protocol <name> [--marks]]" << std::endl
+            << "  Times are in uSecs unless stated otherwise." << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  bool fractional = false;
+  bool json = false;
+  bool marks = false;
+  uint32_t mhz = 80;  // An ESP8266's default CPU speed.
+  uint32_t overhead = 0;
+  decode_type_t only = decode_type_t::UNKNOWN;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("--fractional", argv[i], 13) == 0) {
+      fractional = true;
+    } else if (strncmp("--json", argv[i], 7) == 0) {
+      json = true;
+    } else if (strncmp("--marks", argv[i], 8) == 0) {
+      marks = true;
+    } else if (strncmp("--mhz", argv[i], 6) == 0 && i + 1 < argc) {
+      mhz = strtoul(argv[++i], NULL, 10);
+    } else if (strncmp("--overhead", argv[i], 11) == 0 && i + 1 < argc) {
+      overhead = strtoul(argv[++i], NULL, 10);
+    } else if (strncmp("--protocol", argv[i], 11) == 0 && i + 1 < argc) {
+      only = strToDecodeType(argv[++i]);
+      if (only == decode_type_t::UNKNOWN) {
+        std::cerr << "Unknown protocol: " << argv[i] << std::endl;
+        return 1;
+      }
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!mhz || (marks && only == decode_type_t::UNKNOWN)) {
+    usage_error(argv[0]);
+    return 1;
+  }
+
+  IRsendTiming irsend(mhz, overhead);
+  irsend.begin();
+  irsend.setFractionalCarrier(fractional);
+  bool first = true;
+  if (!marks) printSummaryHeader(json);
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    const decode_type_t type = (decode_type_t)i;
+    if (only != decode_type_t::UNKNOWN && type != only) continue;
+    if (!sendSample(&irsend, type)) continue;
+    if (marks) {
+      printMarks(irsend);
+    } else {
+      printSummary(type, summarise(irsend), json, first);
+      first = false;
+    }
+  }
+  if (json && !marks) printf("\n]\n");
+  return 0;
+}